@@ -13,24 +13,26 @@ using namespace std::chrono_literals;
 constexpr auto WAVE_SIZE = 16u;
 constexpr auto WAVE_DATA = std::array<byte, WAVE_SIZE>{ 128, 159, 191, 223, 255, 223, 191, 159, 128, 96, 64, 32, 0, 32, 64, 96 };
 
-void MidiAudio::_initialize(HWND windowHandle) noexcept
+// Up to this many notes can be queued before the player has to catch up.
+// That's enough to not drop anything during the attack/decay gaps of a
+// legitimate DECPS tune, while an app hammering BEL in a tight loop can
+// at most buy itself this much backlog before its beeps get dropped.
+constexpr auto NOTE_QUEUE_CAPACITY = 64u;
+
+MidiAudio::~MidiAudio() noexcept
+try
 {
-    _hwnd = windowHandle;
-    _directSoundModule.reset(LoadLibraryExW(L"dsound.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32));
-    if (_directSoundModule)
+    if (_player.joinable())
     {
-        if (const auto createFunction = GetProcAddressByFunctionDeclaration(_directSoundModule.get(), DirectSoundCreate8))
-        {
-            if (SUCCEEDED(createFunction(nullptr, &_directSound, nullptr)))
-            {
-                if (SUCCEEDED(_directSound->SetCooperativeLevel(windowHandle, DSSCL_NORMAL)))
-                {
-                    _createBuffers();
-                }
-            }
-        }
+        // Unblock the wait for any note that's currently playing, then hang
+        // up the channel so the player drains the backlog and runs off the
+        // end. The skip event stays signaled, so draining is just pops.
+        _skip.SetEvent();
+        _notes.reset();
+        _player.join();
     }
 }
+CATCH_LOG()
 
 void MidiAudio::BeginSkip() noexcept
 {
@@ -50,26 +52,56 @@ try
         return;
     }
 
-    if (_hwnd != windowHandle)
+    if (!_player.joinable())
+    {
+        auto [tx, rx] = til::mpsc::channel<Note>(NOTE_QUEUE_CAPACITY);
+        _notes.emplace(std::move(tx));
+        _player = std::thread{ &MidiAudio::_playerProc, this, std::move(rx) };
+    }
+
+    // If the queue is full, the player has fallen a whole queue's worth of
+    // note durations behind. Dropping the note is preferable to blocking
+    // VT processing until the backlog has played out.
+    _notes->try_emplace(windowHandle, noteNumber, velocity, duration);
+}
+CATCH_LOG()
+
+void MidiAudio::_playerProc(til::mpsc::consumer<Note> notes) noexcept
+{
+    while (const auto note = notes.pop())
+    {
+        _playNote(*note);
+    }
+}
+
+void MidiAudio::_playNote(const Note& note) noexcept
+try
+{
+    if (_skip.is_signaled())
+    {
+        return;
+    }
+
+    if (_hwnd != note.windowHandle)
     {
-        _initialize(windowHandle);
+        _initialize(note.windowHandle);
     }
 
     const auto& buffer = _buffers.at(_activeBufferIndex);
-    if (velocity && buffer)
+    if (note.velocity && buffer)
     {
         // The formula for frequency is 2^(n/12) * 440Hz, where n is zero for
         // the A above middle C (A4). In MIDI terms, A4 is note number 69,
         // which is why we subtract 69. We also need to multiply by the size
         // of the wave form to determine the frequency that the sound buffer
         // has to be played to achieve the equivalent note frequency.
-        const auto frequency = std::pow(2.0, (noteNumber - 69.0) / 12.0) * 440.0 * WAVE_SIZE;
+        const auto frequency = std::pow(2.0, (note.noteNumber - 69.0) / 12.0) * 440.0 * WAVE_SIZE;
         buffer->SetFrequency(gsl::narrow_cast<DWORD>(frequency));
         // For the volume, we're using the formula defined in the General
         // MIDI Level 2 specification: Gain in dB = 40 * log10(v/127). We need
         // to multiply by 4000, though, because the SetVolume method expects
         // the volume to be in hundredths of a decibel.
-        const auto volume = 4000.0 * std::log10(velocity / 127.0);
+        const auto volume = 4000.0 * std::log10(note.velocity / 127.0);
         buffer->SetVolume(gsl::narrow_cast<LONG>(volume));
         // Resetting the buffer to a position that is slightly off from the
         // last position will help to produce a clearer separation between
@@ -80,9 +112,9 @@ try
     // By waiting on the skip event with a maximum duration of the note, we'll
     // either be paused for the appropriate amount of time, or we'll break out early
     // because BeginSkip() was called. This happens for Ctrl+C or during shutdown.
-    _skip.wait(::base::saturated_cast<DWORD>(duration.count()));
+    _skip.wait(::base::saturated_cast<DWORD>(note.duration.count()));
 
-    if (velocity && buffer)
+    if (note.velocity && buffer)
     {
         // When the note ends, we just turn the volume down instead of stopping
         // the sound buffer. This helps reduce unwanted static between notes.
@@ -95,6 +127,25 @@ try
 }
 CATCH_LOG()
 
+void MidiAudio::_initialize(HWND windowHandle) noexcept
+{
+    _hwnd = windowHandle;
+    _directSoundModule.reset(LoadLibraryExW(L"dsound.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32));
+    if (_directSoundModule)
+    {
+        if (const auto createFunction = GetProcAddressByFunctionDeclaration(_directSoundModule.get(), DirectSoundCreate8))
+        {
+            if (SUCCEEDED(createFunction(nullptr, &_directSound, nullptr)))
+            {
+                if (SUCCEEDED(_directSound->SetCooperativeLevel(windowHandle, DSSCL_NORMAL)))
+                {
+                    _createBuffers();
+                }
+            }
+        }
+    }
+}
+
 void MidiAudio::_createBuffers() noexcept
 {
     auto waveFormat = WAVEFORMATEX{};
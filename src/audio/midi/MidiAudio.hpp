@@ -6,29 +6,51 @@ Module Name:
 - MidiAudio.hpp
 
 Abstract:
-  This modules provide basic MIDI support with blocking sound output.
+  This modules provide basic MIDI support. Notes are queued and played on a
+  dedicated thread so that sound output never blocks VT processing.
   */
 
 #pragma once
 
 #include <array>
 
+#include <til/mpsc.h>
+
 struct IDirectSound8;
 struct IDirectSoundBuffer;
 
 class MidiAudio
 {
 public:
+    MidiAudio() = default;
+    ~MidiAudio() noexcept;
+
     void BeginSkip() noexcept;
     void EndSkip() noexcept;
     void PlayNote(HWND windowHandle, const int noteNumber, const int velocity, const std::chrono::milliseconds duration) noexcept;
 
 private:
+    struct Note
+    {
+        HWND windowHandle;
+        int noteNumber;
+        int velocity;
+        std::chrono::milliseconds duration;
+    };
+
+    void _playerProc(til::mpsc::consumer<Note> notes) noexcept;
+    void _playNote(const Note& note) noexcept;
     void _initialize(HWND windowHandle) noexcept;
     void _createBuffers() noexcept;
 
     wil::slim_event_manual_reset _skip;
 
+    // The producer end of the note queue. Only ever touched by the thread
+    // that calls PlayNote() (the VT output thread) and the destructor.
+    std::optional<til::mpsc::producer<Note>> _notes;
+    std::thread _player;
+
+    // Everything below is owned by the player thread once it's running.
     HWND _hwnd = nullptr;
     wil::unique_hmodule _directSoundModule;
     wil::com_ptr<IDirectSound8> _directSound;
@@ -173,8 +173,9 @@ til::CoordType CharToColumnMapper::GetTrailingColumnAt(const wchar_t* str) noexc
 // - fillAttribute - the default text attribute
 // Return Value:
 // - constructed object
-ROW::ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute) :
+ROW::ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, std::pmr::memory_resource* charsPool) :
     _charsBuffer{ charsBuffer },
+    _charsPool{ charsPool },
     _chars{ charsBuffer, rowWidth },
     _charOffsets{ charOffsetsBuffer, ::base::strict_cast<size_t>(rowWidth) + 1u },
     _attr{ rowWidth, fillAttribute },
@@ -203,6 +204,14 @@ bool ROW::WasDoubleBytePadded() const noexcept
     return _doubleBytePadded;
 }
 
+// Returns the size of this row's overflow allocation in bytes, or 0 if the
+// text still fits into the slab-backed _charsBuffer. Used by the buffer's
+// memory accounting; _chars.size() is the heap allocation's capacity.
+size_t ROW::GetHeapCharsBytes() const noexcept
+{
+    return _charsHeap ? _chars.size() * sizeof(wchar_t) : 0;
+}
+
 void ROW::SetLineRendition(const LineRendition lineRendition) noexcept
 {
     _lineRendition = lineRendition;
@@ -609,6 +618,39 @@ catch (...)
     }
 }
 
+// Fills the given column range with a single, narrow character. This is equivalent to calling
+// ReplaceText() with a string that repeats `ch` for every column, but it skips building such a
+// string and compiles down to a couple of trivially vectorizable fill loops. It's the backbone
+// of TextBuffer::FillRect() and thus of all the erase/fill operations in AdaptDispatch.
+void ROW::FillCharacter(const til::CoordType columnBegin, const til::CoordType columnLimit, const wchar_t ch)
+try
+{
+    const std::wstring_view chars{ &ch, 1 };
+    WriteHelper h{ *this, columnBegin, columnLimit, chars };
+    if (!h.IsValid())
+    {
+        return;
+    }
+    h.FillCharacters();
+    h.FinishFill(ch);
+}
+catch (...)
+{
+    Reset(TextAttribute{});
+    throw;
+}
+
+[[msvc::forceinline]] void ROW::WriteHelper::FillCharacters() noexcept
+{
+    // Each column gets its own 1-column-wide glyph, so the char offsets
+    // are simply a continuous ascending sequence starting at chBeg.
+    const auto count = gsl::narrow_cast<uint16_t>(colLimit - colBeg);
+    iota_n(row._charOffsets.begin() + colBeg, count, chBeg);
+    colEnd = colLimit;
+    colEndDirty = colLimit;
+    charsConsumed = count;
+}
+
 void ROW::ReplaceText(RowWriteState& state)
 try
 {
@@ -869,6 +911,46 @@ catch (...)
     }
 }
 
+// Identical to Finish(), except that the payload isn't copied from `chars`,
+// but rather synthesized by repeating the given fill character.
+[[msvc::forceinline]] void ROW::WriteHelper::FinishFill(const wchar_t ch)
+{
+    colEndDirty = row._adjustForward(colEndDirty);
+
+    const uint16_t trailingSpaces = colEndDirty - colEnd;
+    const auto chEndDirtyOld = row._uncheckedCharOffset(colEndDirty);
+    const auto chEndDirty = chBegDirty + charsConsumed + leadingSpaces + trailingSpaces;
+
+    if (chEndDirty != chEndDirtyOld)
+    {
+        row._resizeChars(colEndDirty, chBegDirty, chEndDirty, chEndDirtyOld);
+    }
+
+    {
+        const auto itBeg = row._chars.begin() + chBeg;
+        // Unlike the leading/trailing whitespace below, the payload may span the entire
+        // row, so we use std::fill_n which vectorizes for larger counts.
+        std::fill_n(itBeg, charsConsumed, ch);
+
+        if (leadingSpaces)
+        {
+            fill_n_small(row._chars.begin() + chBegDirty, leadingSpaces, L' ');
+            iota_n(row._charOffsets.begin() + colBegDirty, leadingSpaces, chBegDirty);
+        }
+        if (trailingSpaces)
+        {
+            fill_n_small(itBeg + charsConsumed, trailingSpaces, L' ');
+            iota_n(row._charOffsets.begin() + colEnd, trailingSpaces, gsl::narrow_cast<uint16_t>(chBeg + charsConsumed));
+        }
+    }
+
+    // See the identical block in Finish() for why this updates `_doubleBytePadded`.
+    if (colEndDirty == row._columnCount)
+    {
+        row.SetDoubleBytePadded(colEnd < row._columnCount);
+    }
+}
+
 // This function represents the slow path of ReplaceCharacters(),
 // as it reallocates the backing buffer and shifts the char offsets.
 // The parameters are difficult to explain, but their names are identical to
@@ -888,7 +970,15 @@ void ROW::_resizeChars(uint16_t colEndDirty, uint16_t chBegDirty, size_t chEndDi
         const auto minCapacity = std::min<size_t>(UINT16_MAX, _chars.size() + (_chars.size() >> 1));
         const auto newCapacity = gsl::narrow<uint16_t>(std::max(newLength, minCapacity));
 
-        auto charsHeap = std::make_unique_for_overwrite<wchar_t[]>(newCapacity);
+        decltype(_charsHeap) charsHeap;
+        if (_charsPool)
+        {
+            charsHeap = decltype(_charsHeap){ static_cast<wchar_t*>(_charsPool->allocate(newCapacity * sizeof(wchar_t), alignof(wchar_t))), RowCharsHeapDeleter{ _charsPool, newCapacity } };
+        }
+        else
+        {
+            charsHeap = decltype(_charsHeap){ new wchar_t[newCapacity], RowCharsHeapDeleter{} };
+        }
         const std::span chars{ charsHeap.get(), newCapacity };
 
         std::copy_n(_chars.begin(), chBegDirty, chars.begin());
@@ -1051,6 +1141,14 @@ std::wstring_view ROW::GetText() const noexcept
     return { _chars.data(), width };
 }
 
+// Returns the per-column character offsets backing this row, including the
+// past-the-end entry at index size(). Trailing halves of wide glyphs carry the
+// CharOffsetsTrailer flag; mask with CharOffsetsMask to get the actual offset.
+std::span<const uint16_t> ROW::CharOffsets() const noexcept
+{
+    return _charOffsets;
+}
+
 std::wstring_view ROW::GetText(til::CoordType columnBegin, til::CoordType columnEnd) const noexcept
 {
     const til::CoordType columns = _columnCount;
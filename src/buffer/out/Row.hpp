@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <memory_resource>
+
 #include <til/rle.h>
 
 #include "LineRendition.hpp"
@@ -65,6 +67,28 @@ struct RowCopyTextFromState
     til::CoordType sourceColumnEnd = 0; // OUT
 };
 
+// Deleter for ROW's overflow text storage. Overflow allocations are either served by the
+// TextBuffer-owned arena pool (so millions of CJK-heavy rows don't fragment the general
+// purpose heap and everything frees as one unit on buffer teardown), or — for ROWs that
+// were constructed without a pool — by plain operator new[]/delete[].
+struct RowCharsHeapDeleter
+{
+    std::pmr::memory_resource* pool = nullptr;
+    uint16_t capacity = 0;
+
+    void operator()(wchar_t* ptr) const noexcept
+    {
+        if (pool)
+        {
+            pool->deallocate(ptr, capacity * sizeof(wchar_t), alignof(wchar_t));
+        }
+        else
+        {
+            delete[] ptr;
+        }
+    }
+};
+
 // This structure is basically an inverse of ROW::_charOffsets. If you have a pointer
 // into a ROW's text this class can tell you what cell that pointer belongs to.
 struct CharToColumnMapper
@@ -113,8 +137,14 @@ public:
         return (columns * sizeof(uint16_t) + 16) & ~15;
     }
 
+    // To simplify the detection of wide glyphs, we don't just store the simple character offset as described
+    // for _charOffsets. Instead we use the most significant bit to indicate whether any column is the
+    // trailing half of a wide glyph. This simplifies many implementation details via _uncheckedIsTrailer.
+    static constexpr uint16_t CharOffsetsTrailer = 0x8000;
+    static constexpr uint16_t CharOffsetsMask = 0x7fff;
+
     ROW() = default;
-    ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute);
+    ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, std::pmr::memory_resource* charsPool = nullptr);
 
     ROW(const ROW& other) = delete;
     ROW& operator=(const ROW& other) = delete;
@@ -129,6 +159,7 @@ public:
     void SetLineRendition(const LineRendition lineRendition) noexcept;
     LineRendition GetLineRendition() const noexcept;
     til::CoordType GetReadableColumnCount() const noexcept;
+    size_t GetHeapCharsBytes() const noexcept;
 
     void Reset(const TextAttribute& attr) noexcept;
     void TransferAttributes(const til::small_rle<TextAttribute, uint16_t, 1>& attr, til::CoordType newWidth);
@@ -143,6 +174,7 @@ public:
     void SetAttrToEnd(til::CoordType columnBegin, TextAttribute attr);
     void ReplaceAttributes(til::CoordType beginIndex, til::CoordType endIndex, const TextAttribute& newAttr);
     void ReplaceCharacters(til::CoordType columnBegin, til::CoordType width, const std::wstring_view& chars);
+    void FillCharacter(til::CoordType columnBegin, til::CoordType columnLimit, wchar_t ch);
     void ReplaceText(RowWriteState& state);
     void CopyTextFrom(RowCopyTextFromState& state);
 
@@ -158,6 +190,7 @@ public:
     DbcsAttribute DbcsAttrAt(til::CoordType column) const noexcept;
     std::wstring_view GetText() const noexcept;
     std::wstring_view GetText(til::CoordType columnBegin, til::CoordType columnEnd) const noexcept;
+    std::span<const uint16_t> CharOffsets() const noexcept;
     til::CoordType GetLeadingColumnAtCharOffset(ptrdiff_t offset) const noexcept;
     til::CoordType GetTrailingColumnAtCharOffset(ptrdiff_t offset) const noexcept;
     DelimiterClass DelimiterClassAt(til::CoordType column, const std::wstring_view& wordDelimiters) const noexcept;
@@ -178,11 +211,13 @@ private:
         explicit WriteHelper(ROW& row, til::CoordType columnBegin, til::CoordType columnLimit, const std::wstring_view& chars) noexcept;
         bool IsValid() const noexcept;
         void ReplaceCharacters(til::CoordType width) noexcept;
+        void FillCharacters() noexcept;
         void ReplaceText() noexcept;
         void _replaceTextUnicode(size_t ch, std::wstring_view::const_iterator it) noexcept;
         void CopyTextFrom(const std::span<const uint16_t>& charOffsets) noexcept;
         static void _copyOffsets(uint16_t* dst, const uint16_t* src, uint16_t size, uint16_t offset) noexcept;
         void Finish();
+        void FinishFill(wchar_t ch);
 
         // Parent pointer.
         ROW& row;
@@ -217,12 +252,6 @@ private:
         size_t charsConsumed;
     };
 
-    // To simplify the detection of wide glyphs, we don't just store the simple character offset as described
-    // for _charOffsets. Instead we use the most significant bit to indicate whether any column is the
-    // trailing half of a wide glyph. This simplifies many implementation details via _uncheckedIsTrailer.
-    static constexpr uint16_t CharOffsetsTrailer = 0x8000;
-    static constexpr uint16_t CharOffsetsMask = 0x7fff;
-
     template<typename T>
     static constexpr uint16_t _clampedUint16(T v) noexcept;
     template<typename T>
@@ -264,7 +293,10 @@ private:
     // ...but if this ROW needs to store more than _columnCount characters
     // then it will allocate a larger string on the heap and store it here.
     // The capacity of this string on the heap is stored in _chars.size().
-    std::unique_ptr<wchar_t[]> _charsHeap;
+    std::unique_ptr<wchar_t[], RowCharsHeapDeleter> _charsHeap;
+    // The memory resource that backs _charsHeap allocations, if any.
+    // TextBuffer points this at its overflow arena; a nullptr means plain new[].
+    std::pmr::memory_resource* _charsPool = nullptr;
     // _chars either refers to our _charsBuffer or _charsHeap, defaulting to the former.
     // _chars.size() is NOT the length of the string, but rather its capacity.
     // _charOffsets[_columnCount] stores the length.
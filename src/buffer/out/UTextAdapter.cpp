@@ -27,6 +27,36 @@ constexpr til::CoordType& accessCurrentRow(UText* ut) noexcept
     return ut->b;
 }
 
+// The buffer generation the UText was created under. Cached chunk contents are
+// only valid as long as this matches the buffer's current mutation id.
+constexpr uint64_t& accessMutationId(UText* ut) noexcept
+{
+    return *std::bit_cast<uint64_t*>(&ut->privA);
+}
+
+// The previously used chunk. Backtracking regexes oscillate across chunk
+// boundaries, and remembering the chunk we just came from turns each flip into
+// a pointer swap instead of a row text derivation.
+constexpr const char16_t*& accessPrevChunkContents(UText* ut) noexcept
+{
+    return *std::bit_cast<const char16_t**>(&ut->q);
+}
+
+constexpr int64_t& accessPrevChunkStart(UText* ut) noexcept
+{
+    return *std::bit_cast<int64_t*>(&ut->r);
+}
+
+constexpr int32_t& accessPrevChunkLength(UText* ut) noexcept
+{
+    return ut->c;
+}
+
+constexpr til::CoordType& accessPrevChunkRow(UText* ut) noexcept
+{
+    return ut->privB;
+}
+
 // An excerpt from the ICU documentation:
 //
 // Clone a UText. Much like opening a UText where the source text is itself another UText.
@@ -131,44 +161,81 @@ try
 
     if (neededIndex < start || neededIndex >= limit)
     {
-        if (neededIndex < start)
+        // Check the previously used chunk first. Backtracking regexes cross the
+        // same chunk boundary over and over, and this turns every flip back into
+        // a swap of the two cached chunks. The cache is only trusted while the
+        // buffer generation it was filled under is still current.
+        const auto prevContents = accessPrevChunkContents(ut);
+        const auto prevStart = accessPrevChunkStart(ut);
+        const auto prevLength = accessPrevChunkLength(ut);
+        if (prevContents && neededIndex >= prevStart && neededIndex < prevStart + prevLength &&
+            accessMutationId(ut) == textBuffer.GetLastMutationId())
         {
-            do
-            {
-                --y;
-                if (y < range.begin)
-                {
-                    return false;
-                }
-
-                text = textBuffer.GetRowByOffset(y).GetText();
-                limit = start;
-                start -= text.size();
-            } while (neededIndex < start);
+            const auto prevRow = accessPrevChunkRow(ut);
+            accessPrevChunkContents(ut) = ut->chunkContents;
+            accessPrevChunkStart(ut) = ut->chunkNativeStart;
+            accessPrevChunkLength(ut) = ut->chunkLength;
+            accessPrevChunkRow(ut) = y;
+
+            accessCurrentRow(ut) = prevRow;
+            start = prevStart;
+            ut->chunkNativeStart = prevStart;
+            ut->chunkNativeLimit = prevStart + prevLength;
+            ut->chunkLength = prevLength;
+            ut->chunkContents = prevContents;
+            ut->nativeIndexingLimit = prevLength;
         }
         else
         {
-            do
+            // Remember the outgoing chunk before deriving a new one, so an
+            // immediate return to it doesn't have to re-derive its row text.
+            if (ut->chunkContents && ut->chunkLength > 0)
             {
-                ++y;
-                if (y >= range.end)
-                {
-                    return false;
-                }
+                accessPrevChunkContents(ut) = ut->chunkContents;
+                accessPrevChunkStart(ut) = ut->chunkNativeStart;
+                accessPrevChunkLength(ut) = ut->chunkLength;
+                accessPrevChunkRow(ut) = y;
+            }
 
-                text = textBuffer.GetRowByOffset(y).GetText();
-                start = limit;
-                limit += text.size();
-            } while (neededIndex >= limit);
-        }
-
-        accessCurrentRow(ut) = y;
-        ut->chunkNativeStart = start;
-        ut->chunkNativeLimit = limit;
-        ut->chunkLength = gsl::narrow_cast<int32_t>(text.size());
+            if (neededIndex < start)
+            {
+                do
+                {
+                    --y;
+                    if (y < range.begin)
+                    {
+                        return false;
+                    }
+
+                    text = textBuffer.GetRowByOffset(y).GetText();
+                    limit = start;
+                    start -= text.size();
+                } while (neededIndex < start);
+            }
+            else
+            {
+                do
+                {
+                    ++y;
+                    if (y >= range.end)
+                    {
+                        return false;
+                    }
+
+                    text = textBuffer.GetRowByOffset(y).GetText();
+                    start = limit;
+                    limit += text.size();
+                } while (neededIndex >= limit);
+            }
+
+            accessCurrentRow(ut) = y;
+            ut->chunkNativeStart = start;
+            ut->chunkNativeLimit = limit;
+            ut->chunkLength = gsl::narrow_cast<int32_t>(text.size());
 #pragma warning(suppress : 26490) // Don't use reinterpret_cast (type.1).
-        ut->chunkContents = reinterpret_cast<const char16_t*>(text.data());
-        ut->nativeIndexingLimit = ut->chunkLength;
+            ut->chunkContents = reinterpret_cast<const char16_t*>(text.data());
+            ut->nativeIndexingLimit = ut->chunkLength;
+        }
     }
 
     auto offset = gsl::narrow_cast<int32_t>(nativeIndex - start);
@@ -273,6 +340,8 @@ UText Microsoft::Console::ICU::UTextFromTextBuffer(const TextBuffer& textBuffer,
     ut.context = &textBuffer;
     accessCurrentRow(&ut) = rowBeg - 1; // the utextAccess() below will advance this by 1.
     accessRowRange(&ut) = { rowBeg, rowEnd };
+    accessMutationId(&ut) = textBuffer.GetLastMutationId();
+    accessPrevChunkContents(&ut) = nullptr;
 
     utextAccess(&ut, 0, true);
     return ut;
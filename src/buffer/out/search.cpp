@@ -8,17 +8,50 @@
 
 using namespace Microsoft::Console::Types;
 
+// Returns true if ResetIfStale() would have to do a full scan of the scrollback for this
+// query. Callers can use this to move such scans off their UI thread and hand us the
+// results via Reset() instead. Cheap refreshes (unchanged buffer, or one whose changes
+// are covered by the dirty-row aggregate) don't count as stale.
+bool Search::IsStale(const Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, const bool caseInsensitive) const noexcept
+{
+    const auto& textBuffer = renderData.GetTextBuffer();
+
+    if (_needle != needle || _caseInsensitive != caseInsensitive)
+    {
+        return true;
+    }
+    if (_lastMutationId == textBuffer.GetLastMutationId())
+    {
+        return false;
+    }
+    return !textBuffer.HasDirtyRowSpan(_lastMutationId);
+}
+
 bool Search::ResetIfStale(Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, bool reverse, bool caseInsensitive)
 {
     const auto& textBuffer = renderData.GetTextBuffer();
     const auto lastMutationId = textBuffer.GetLastMutationId();
 
-    if (_needle == needle &&
-        _caseInsensitive == caseInsensitive &&
-        _lastMutationId == lastMutationId)
+    if (_needle == needle && _caseInsensitive == caseInsensitive)
     {
-        _step = reverse ? -1 : 1;
-        return false;
+        if (_lastMutationId == lastMutationId)
+        {
+            _step = reverse ? -1 : 1;
+            return false;
+        }
+
+        // Same query against a changed buffer: if the buffer can tell us which rows were
+        // touched since our last scan, we shift the cached results along with the buffer
+        // contents and only re-search the dirty rows instead of the entire history.
+        if (const auto span = textBuffer.TakeDirtyRowSpan(_lastMutationId))
+        {
+            _renderData = &renderData;
+            _lastMutationId = lastMutationId;
+            _updateResultsInSpan(textBuffer, *span);
+            _index = reverse ? gsl::narrow_cast<ptrdiff_t>(_results.size()) - 1 : 0;
+            _step = reverse ? -1 : 1;
+            return true;
+        }
     }
 
     _renderData = &renderData;
@@ -27,12 +60,84 @@ bool Search::ResetIfStale(Microsoft::Console::Render::IRenderData& renderData, c
     _lastMutationId = lastMutationId;
 
     _results = textBuffer.SearchText(needle, caseInsensitive);
+    // Claim the buffer's dirty-row aggregate so the next call for the same needle can be incremental.
+    std::ignore = textBuffer.TakeDirtyRowSpan(lastMutationId);
     _index = reverse ? gsl::narrow_cast<ptrdiff_t>(_results.size()) - 1 : 0;
     _step = reverse ? -1 : 1;
 
     return true;
 }
 
+// Installs results that were computed externally, e.g. on a background thread. The
+// caller is expected to have produced them with TextBuffer::SearchText (or equivalent)
+// for the given needle, and lastMutationId must be the buffer's mutation id at the time
+// the results were collected, so that the next ResetIfStale() can be incremental.
+void Search::Reset(Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, const bool reverse, const bool caseInsensitive, const uint64_t lastMutationId, std::vector<til::point_span> results)
+{
+    _renderData = &renderData;
+    _needle = needle;
+    _caseInsensitive = caseInsensitive;
+    _lastMutationId = lastMutationId;
+
+    _results = std::move(results);
+    // Claim the buffer's dirty-row aggregate so the next call for the same needle can be incremental.
+    std::ignore = renderData.GetTextBuffer().TakeDirtyRowSpan(lastMutationId);
+    _index = reverse ? gsl::narrow_cast<ptrdiff_t>(_results.size()) - 1 : 0;
+    _step = reverse ? -1 : 1;
+}
+
+// Incrementally patches _results after a buffer change that was confined to the given
+// span of rows. Cached matches are shifted by the amount the buffer scrolled, matches
+// overlapping the dirty rows are dropped, and only those rows (plus enough margin for
+// matches spanning row boundaries) are searched again.
+void Search::_updateResultsInSpan(const TextBuffer& textBuffer, const TextBuffer::DirtyRowSpan& span)
+{
+    const auto height = textBuffer.GetSize().Height();
+
+    std::vector<til::point_span> kept;
+    kept.reserve(_results.size());
+    for (auto r : _results)
+    {
+        r.start.y -= span.scrollDelta;
+        r.end.y -= span.scrollDelta;
+        // Drop matches that scrolled out of the buffer,
+        // as well as those overlapping the rows we're about to re-search.
+        if (r.start.y < 0 || (r.end.y >= span.beg && r.start.y < span.end))
+        {
+            continue;
+        }
+        kept.emplace_back(r);
+    }
+
+    std::vector<til::point_span> fresh;
+    if (span.beg < span.end)
+    {
+        // A match can span as many rows as the needle has characters, so the re-scan has
+        // to overlap the dirty rows by that much in both directions to see such matches
+        // in full. Matches entirely outside the dirty rows are filtered back out, since
+        // they're still in `kept`.
+        const auto margin = gsl::narrow_cast<til::CoordType>(std::min<size_t>(_needle.size(), gsl::narrow_cast<size_t>(height)));
+        const auto rescanBeg = std::max<til::CoordType>(0, span.beg - margin);
+        const auto rescanEnd = std::min<til::CoordType>(height, span.end + margin);
+
+        auto hits = textBuffer.SearchText(_needle, _caseInsensitive, rescanBeg, rescanEnd);
+        fresh.reserve(hits.size());
+        for (const auto& r : hits)
+        {
+            if (r.end.y >= span.beg && r.start.y < span.end)
+            {
+                fresh.emplace_back(r);
+            }
+        }
+    }
+
+    _results.clear();
+    _results.reserve(kept.size() + fresh.size());
+    std::merge(kept.begin(), kept.end(), fresh.begin(), fresh.end(), std::back_inserter(_results), [](const auto& a, const auto& b) {
+        return a.start < b.start;
+    });
+}
+
 void Search::MoveToCurrentSelection()
 {
     if (_renderData->IsSelectionActive())
@@ -25,7 +25,9 @@ class Search final
 public:
     Search() = default;
 
+    bool IsStale(const Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, bool caseInsensitive) const noexcept;
     bool ResetIfStale(Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, bool reverse, bool caseInsensitive);
+    void Reset(Microsoft::Console::Render::IRenderData& renderData, const std::wstring_view& needle, bool reverse, bool caseInsensitive, uint64_t lastMutationId, std::vector<til::point_span> results);
 
     void MoveToCurrentSelection();
     void MoveToPoint(til::point anchor) noexcept;
@@ -40,6 +42,8 @@ public:
     ptrdiff_t CurrentMatch() const noexcept;
 
 private:
+    void _updateResultsInSpan(const TextBuffer& textBuffer, const TextBuffer::DirtyRowSpan& span);
+
     // _renderData is a pointer so that Search() is constexpr default constructable.
     Microsoft::Console::Render::IRenderData* _renderData = nullptr;
     std::wstring _needle;
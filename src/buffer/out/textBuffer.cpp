@@ -65,7 +65,7 @@ TextBuffer::TextBuffer(til::size screenBufferSize,
 
 TextBuffer::~TextBuffer()
 {
-    if (_buffer)
+    if (!_slabs.empty())
     {
         _destroy();
     }
@@ -79,13 +79,14 @@ TextBuffer::~TextBuffer()
 #pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
 #pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
 
-// MEM_RESERVEs memory sufficient to store height-many ROW structs,
+// Sizes the slab list to hold height-many ROW structs,
 // as well as their ROW::_chars and ROW::_charOffsets buffers.
 //
 // We use explicit virtual memory allocations to not taint the general purpose allocator
 // with our huge allocation, as well as to be able to reduce the private working set of
-// the application by only committing what we actually need. This reduces conhost's
-// memory usage from ~7MB down to just ~2MB at startup in the general case.
+// the application by only allocating the slabs we actually touch. Keeping the history in
+// fixed-size slabs instead of one contiguous arena means that growing the committed range
+// appends a slab in O(1) and never moves any of the already constructed ROWs.
 void TextBuffer::_reserve(til::size screenBufferSize, const TextAttribute& defaultAttributes)
 {
     const auto w = gsl::narrow<uint16_t>(screenBufferSize.width);
@@ -97,19 +98,17 @@ void TextBuffer::_reserve(til::size screenBufferSize, const TextAttribute& defau
     const auto rowStride = rowSize + charsBufferSize + charOffsetsBufferSize;
     assert(rowStride % alignof(ROW) == 0);
 
-    // 65535*65535 cells would result in a allocSize of 8GiB.
-    // --> Use uint64_t so that we can safely do our calculations even on x86.
     // We allocate 1 additional row, which will be used for GetScratchpadRow().
-    const auto rowCount = ::base::strict_cast<uint64_t>(h) + 1;
-    const auto allocSize = gsl::narrow<size_t>(rowCount * rowStride);
+    // Even at 65535 columns a single slab stays far below any size_t limit,
+    // because each slab only ever holds _rowsPerSlab rows.
+    const auto rowCount = ::base::strict_cast<size_t>(h) + 1;
+    const auto slabCount = (rowCount + _rowsPerSlab - 1) / _rowsPerSlab;
 
     // NOTE: Modifications to this block of code might have to be mirrored over to ResizeTraditional().
     // It constructs a temporary TextBuffer and then extracts the members below, overwriting itself.
-    _buffer = wil::unique_virtualalloc_ptr<std::byte>{
-        static_cast<std::byte*>(THROW_LAST_ERROR_IF_NULL(VirtualAlloc(nullptr, allocSize, MEM_RESERVE, PAGE_READWRITE)))
-    };
-    _bufferEnd = _buffer.get() + allocSize;
-    _commitWatermark = _buffer.get();
+    _slabs = std::vector<Slab>(slabCount);
+    _committedSlabs = 0;
+    _charsPool = std::make_unique<std::pmr::unsynchronized_pool_resource>(til::pmr::get_default_resource());
     _initialAttributes = defaultAttributes;
     _bufferRowStride = rowStride;
     _bufferOffsetChars = rowSize;
@@ -118,53 +117,246 @@ void TextBuffer::_reserve(til::size screenBufferSize, const TextAttribute& defau
     _height = h;
 }
 
-// MEM_COMMITs the memory and constructs all ROWs up to and including the given row pointer.
-// It's expected that the caller verifies the parameter. It goes hand in hand with _getRowByOffsetDirect().
+// Allocates the backing memory for all slabs up to and including the given slab index
+// and constructs their ROWs. It's expected that the caller verifies the parameter.
+// It goes hand in hand with _getRowByOffsetDirect().
+//
+// Slabs are committed strictly in ascending order so that the constructed ROWs always
+// form a single prefix of the buffer, which keeps _destroy() and
+// _estimateOffsetOfLastCommittedRow() trivial.
 //
 // Declaring this function as noinline allows _getRowByOffsetDirect() to be inlined,
 // which improves overall TextBuffer performance by ~6%. And all it cost is this annotation.
 // The compiler doesn't understand the likelihood of our branches. (PGO does, but that's imperfect.)
-__declspec(noinline) void TextBuffer::_commit(const std::byte* row)
+__declspec(noinline) void TextBuffer::_commit(const size_t slab)
 {
-    const auto rowEnd = row + _bufferRowStride;
-    const auto remaining = gsl::narrow_cast<uintptr_t>(_bufferEnd - _commitWatermark);
-    const auto minimum = gsl::narrow_cast<uintptr_t>(rowEnd - _commitWatermark);
-    const auto ideal = minimum + _bufferRowStride * _commitReadAheadRowCount;
-    const auto size = std::min(remaining, ideal);
+    const auto slabSize = _bufferRowStride * _rowsPerSlab;
 
-    THROW_LAST_ERROR_IF_NULL(VirtualAlloc(_commitWatermark, size, MEM_COMMIT, PAGE_READWRITE));
+    for (; _committedSlabs <= slab; ++_committedSlabs)
+    {
+        Slab next;
+        _allocateSlabMemory(next, _committedSlabs, slabSize);
+        _constructSlabRows(next, _committedSlabs);
+        _slabs[_committedSlabs] = std::move(next);
+    }
+}
 
-    _construct(_commitWatermark + size);
+// Allocates the backing memory for a slab, either anonymously or from the spill file.
+void TextBuffer::_allocateSlabMemory(Slab& slab, const size_t index, const size_t slabSize)
+{
+    if (_spillEnabled)
+    {
+        slab.view = _mapSpillSlab(index, slabSize);
+    }
+    else
+    {
+        slab.alloc = wil::unique_virtualalloc_ptr<std::byte>{
+            static_cast<std::byte*>(THROW_LAST_ERROR_IF_NULL(VirtualAlloc(nullptr, slabSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)))
+        };
+    }
 }
 
-// Destructs and MEM_DECOMMITs all previously constructed ROWs.
-// You can use this (or rather the Reset() method) to fully clear the TextBuffer.
-void TextBuffer::_decommit() noexcept
+// Constructs the ROWs of a freshly allocated slab in place.
+void TextBuffer::_constructSlabRows(Slab& slab, const size_t index) noexcept
 {
-    _destroy();
-    VirtualFree(_buffer.get(), 0, MEM_DECOMMIT);
-    _commitWatermark = _buffer.get();
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+    const auto firstRow = index * _rowsPerSlab;
+    const auto lastRow = std::min(firstRow + _rowsPerSlab, rowCount);
+    auto it = slab.get();
+
+    for (auto i = firstRow; i < lastRow; ++i, it += _bufferRowStride)
+    {
+        const auto row = reinterpret_cast<ROW*>(it);
+        const auto chars = reinterpret_cast<wchar_t*>(it + _bufferOffsetChars);
+        const auto indices = reinterpret_cast<uint16_t*>(it + _bufferOffsetCharOffsets);
+        std::construct_at(row, chars, indices, _width, _initialAttributes, _charsPool.get());
+    }
 }
 
-// Constructs ROWs up to (excluding) the ROW pointed to by `until`.
-void TextBuffer::_construct(const std::byte* until) noexcept
+// Maps the file-backed memory for the given slab, creating the spill file on first use.
+// The OS pager takes it from there: cold pages get written to the spill file and dropped
+// from the working set, and scrolling back into them faults them back in transparently.
+wil::unique_mapview_ptr<std::byte> TextBuffer::_mapSpillSlab(const size_t slab, const size_t slabSize)
 {
-    for (; _commitWatermark < until; _commitWatermark += _bufferRowStride)
+    if (!_spillFile)
     {
-        const auto row = reinterpret_cast<ROW*>(_commitWatermark);
-        const auto chars = reinterpret_cast<wchar_t*>(_commitWatermark + _bufferOffsetChars);
-        const auto indices = reinterpret_cast<uint16_t*>(_commitWatermark + _bufferOffsetCharOffsets);
-        std::construct_at(row, chars, indices, _width, _initialAttributes);
+        wchar_t tempPath[MAX_PATH];
+        wchar_t tempFileName[MAX_PATH];
+        THROW_LAST_ERROR_IF(GetTempPathW(MAX_PATH, &tempPath[0]) == 0);
+        THROW_LAST_ERROR_IF(GetTempFileNameW(&tempPath[0], L"con", 0, &tempFileName[0]) == 0);
+        _spillFile.reset(CreateFileW(&tempFileName[0], GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr));
+        THROW_LAST_ERROR_IF(!_spillFile);
     }
+
+    // Views must be mapped at offsets that are a multiple of the allocation granularity,
+    // so each slab occupies a granularity-aligned stride within the spill file.
+    const auto fileStride = (slabSize + _spillAllocationGranularity - 1) & ~(_spillAllocationGranularity - 1);
+    const auto offset = gsl::narrow_cast<uint64_t>(slab) * fileStride;
+    const auto end = offset + fileStride;
+
+    // Creating a new, larger file mapping object extends the file. The views keep the
+    // section alive, so the handle doesn't need to outlive this function.
+    const wil::unique_handle mapping{
+        THROW_LAST_ERROR_IF_NULL(CreateFileMappingW(_spillFile.get(), nullptr, PAGE_READWRITE, gsl::narrow_cast<DWORD>(end >> 32), gsl::narrow_cast<DWORD>(end), nullptr))
+    };
+    return wil::unique_mapview_ptr<std::byte>{
+        static_cast<std::byte*>(THROW_LAST_ERROR_IF_NULL(MapViewOfFile(mapping.get(), FILE_MAP_ALL_ACCESS, gsl::narrow_cast<DWORD>(offset >> 32), gsl::narrow_cast<DWORD>(offset), slabSize)))
+    };
+}
+
+static void slabAppendBytes(std::vector<std::byte>& out, const void* data, size_t size)
+{
+    const auto p = static_cast<const std::byte*>(data);
+    out.insert(out.end(), p, p + size);
+}
+
+template<typename T>
+static void slabAppendValue(std::vector<std::byte>& out, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    slabAppendBytes(out, &value, sizeof(T));
+}
+
+template<typename T>
+static T slabReadValue(const std::byte*& it) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    memcpy(&value, it, sizeof(T));
+    it += sizeof(T);
+    return value;
+}
+
+// Serializes all ROWs of the given slab into a compact cold representation — the text as
+// UTF-8 plus the raw RLE attribute runs — and releases the slab's backing memory.
+// Long runs of identical attributes and the mostly-ASCII text of typical build logs make
+// this several times smaller than the live in-memory representation.
+void TextBuffer::_compressSlab(const size_t slab)
+{
+    auto& s = _slabs[slab];
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+    const auto firstRow = slab * _rowsPerSlab;
+    const auto lastRow = std::min(firstRow + _rowsPerSlab, rowCount);
+
+    auto cold = std::make_unique<std::vector<std::byte>>();
+    std::string u8;
+
+    auto it = s.get();
+    for (auto i = firstRow; i < lastRow; ++i, it += _bufferRowStride)
+    {
+        auto& row = *reinterpret_cast<ROW*>(it);
+
+        u8.clear();
+        THROW_IF_FAILED(til::u16u8(row.GetText(), u8));
+
+        const auto flags = gsl::narrow_cast<uint8_t>(static_cast<uint8_t>(row.WasWrapForced()) | (static_cast<uint8_t>(row.WasDoubleBytePadded()) << 1));
+        slabAppendValue(*cold, flags);
+        slabAppendValue(*cold, row.GetLineRendition());
+        slabAppendValue(*cold, gsl::narrow_cast<uint32_t>(u8.size()));
+        slabAppendBytes(*cold, u8.data(), u8.size());
+
+        const auto& runs = row.Attributes().runs();
+        slabAppendValue(*cold, gsl::narrow_cast<uint16_t>(runs.size()));
+        slabAppendBytes(*cold, runs.data(), runs.size() * sizeof(til::rle_pair<TextAttribute, uint16_t>));
+    }
+
+    // Destroy the rows and drop the slab's memory; only the serialized form remains.
+    it = s.get();
+    for (auto i = firstRow; i < lastRow; ++i, it += _bufferRowStride)
+    {
+        std::destroy_at(reinterpret_cast<ROW*>(it));
+    }
+
+    cold->shrink_to_fit();
+    s.alloc.reset();
+    s.view.reset();
+    s.cold = std::move(cold);
+}
+
+// Re-materializes a compressed cold slab: the backing memory is reallocated, the ROWs are
+// reconstructed and their text is replayed from the serialized UTF-8 form. Replaying the
+// text through ReplaceText() rebuilds the char offsets exactly like the original write did.
+void TextBuffer::_rehydrateSlab(const size_t slab)
+{
+    auto& s = _slabs[slab];
+    const auto cold = std::move(s.cold);
+    const auto slabSize = _bufferRowStride * _rowsPerSlab;
+
+    _allocateSlabMemory(s, slab, slabSize);
+    _constructSlabRows(s, slab);
+
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+    const auto firstRow = slab * _rowsPerSlab;
+    const auto lastRow = std::min(firstRow + _rowsPerSlab, rowCount);
+    const std::byte* in = cold->data();
+    std::wstring text;
+
+    auto it = s.get();
+    for (auto i = firstRow; i < lastRow; ++i, it += _bufferRowStride)
+    {
+        auto& row = *reinterpret_cast<ROW*>(it);
+
+        const auto flags = slabReadValue<uint8_t>(in);
+        const auto rendition = slabReadValue<LineRendition>(in);
+        const auto textLen = slabReadValue<uint32_t>(in);
+        text.clear();
+        THROW_IF_FAILED(til::u8u16(std::string_view{ reinterpret_cast<const char*>(in), textLen }, text));
+        in += textLen;
+
+        // The line rendition affects the column layout, so it has to be set before the text.
+        row.SetLineRendition(rendition);
+
+        RowWriteState state{ .text = text };
+        row.ReplaceText(state);
+
+        const auto runCount = slabReadValue<uint16_t>(in);
+        til::CoordType col = 0;
+        for (uint16_t r = 0; r < runCount; ++r)
+        {
+            const auto run = slabReadValue<til::rle_pair<TextAttribute, uint16_t>>(in);
+            row.ReplaceAttributes(col, col + run.length, run.value);
+            col += run.length;
+        }
+
+        row.SetWrapForced((flags & 1) != 0);
+        row.SetDoubleBytePadded((flags & 2) != 0);
+    }
+}
+
+// Destructs all previously constructed ROWs and releases their slabs.
+// You can use this (or rather the Reset() method) to fully clear the TextBuffer.
+void TextBuffer::_decommit() noexcept
+{
+    _destroy();
+    for (auto& slab : _slabs)
+    {
+        slab.reset();
+    }
+    _committedSlabs = 0;
 }
 
 // Destroys all previously constructed ROWs.
-// Be careful! This doesn't reset any of the members, in particular the _commitWatermark.
+// Be careful! This doesn't reset any of the members, in particular the _committedSlabs count.
 void TextBuffer::_destroy() const noexcept
 {
-    for (auto it = _buffer.get(); it < _commitWatermark; it += _bufferRowStride)
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+
+    for (size_t slab = 0; slab < _committedSlabs; ++slab)
     {
-        std::destroy_at(reinterpret_cast<ROW*>(it));
+        auto it = _slabs[slab].get();
+        if (!it)
+        {
+            // Compressed cold slabs hold no live ROWs.
+            continue;
+        }
+
+        const auto firstRow = slab * _rowsPerSlab;
+        const auto lastRow = std::min(firstRow + _rowsPerSlab, rowCount);
+
+        for (auto i = firstRow; i < lastRow; ++i, it += _bufferRowStride)
+        {
+            std::destroy_at(reinterpret_cast<ROW*>(it));
+        }
     }
 }
 
@@ -173,15 +365,19 @@ void TextBuffer::_destroy() const noexcept
 // is the GetScratchpadRow() and not the GetRowByOffset(0). That one is offset=1.
 ROW& TextBuffer::_getRowByOffsetDirect(size_t offset)
 {
-    const auto row = _buffer.get() + _bufferRowStride * offset;
-    THROW_HR_IF(E_UNEXPECTED, row < _buffer.get() || row >= _bufferEnd);
+    THROW_HR_IF(E_UNEXPECTED, offset > gsl::narrow_cast<size_t>(_height));
 
-    if (row >= _commitWatermark)
+    const auto slab = offset / _rowsPerSlab;
+    if (slab >= _committedSlabs)
+    {
+        _commit(slab);
+    }
+    else if (_slabs[slab].cold)
     {
-        _commit(row);
+        _rehydrateSlab(slab);
     }
 
-    return *reinterpret_cast<ROW*>(row);
+    return *reinterpret_cast<ROW*>(_slabs[slab].get() + _bufferRowStride * (offset % _rowsPerSlab));
 }
 
 ROW& TextBuffer::_getRow(til::CoordType y) const
@@ -206,12 +402,13 @@ ROW& TextBuffer::_getRow(til::CoordType y) const
 // Returns 0 if no rows are committed in.
 til::CoordType TextBuffer::_estimateOffsetOfLastCommittedRow() const noexcept
 {
-    const auto lastRowOffset = (_commitWatermark - _buffer.get()) / _bufferRowStride;
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+    const auto lastRowOffset = std::min(_committedSlabs * _rowsPerSlab, rowCount);
     // This subtracts 2 from the offset to account for the:
     // * scratchpad row at offset 0, whereas regular rows start at offset 1.
-    // * fact that _commitWatermark points _past_ the last committed row,
+    // * fact that lastRowOffset points _past_ the last committed row,
     //   but we want to return an index pointing at the last row.
-    return std::max(0, gsl::narrow_cast<til::CoordType>(lastRowOffset - 2));
+    return std::max(0, gsl::narrow_cast<til::CoordType>(lastRowOffset) - 2);
 }
 
 // Retrieves a row from the buffer by its offset from the first row of the text buffer
@@ -226,9 +423,39 @@ const ROW& TextBuffer::GetRowByOffset(const til::CoordType index) const
 ROW& TextBuffer::GetMutableRowByOffset(const til::CoordType index)
 {
     _lastMutationId++;
+
+    const auto y = std::clamp<til::CoordType>(index, 0, _height - 1);
+    _dirtyRowBeg = std::min(_dirtyRowBeg, y);
+    _dirtyRowEnd = std::max(_dirtyRowEnd, y + 1);
+
     return _getRow(index);
 }
 
+// Returns the aggregated range of rows that were mutated since the given mutation id and
+// resets the aggregate. This works like a baton: the first caller after a change gets the
+// span, while any other (or stale) caller gets nullopt and has to do a full re-scan.
+std::optional<TextBuffer::DirtyRowSpan> TextBuffer::TakeDirtyRowSpan(const uint64_t sinceMutationId) const noexcept
+{
+    std::optional<DirtyRowSpan> span;
+    if (sinceMutationId == _dirtyTrackingBase)
+    {
+        span = DirtyRowSpan{ std::min(_dirtyRowBeg, _dirtyRowEnd), _dirtyRowEnd, _dirtyScrollDelta };
+    }
+
+    _dirtyTrackingBase = _lastMutationId;
+    _dirtyRowBeg = til::CoordTypeMax;
+    _dirtyRowEnd = 0;
+    _dirtyScrollDelta = 0;
+    return span;
+}
+
+// Returns whether TakeDirtyRowSpan() would return a span for the given mutation id,
+// without claiming the aggregate.
+bool TextBuffer::HasDirtyRowSpan(const uint64_t sinceMutationId) const noexcept
+{
+    return sinceMutationId == _dirtyTrackingBase;
+}
+
 // Returns a row filled with whitespace and the current attributes, for you to freely use.
 ROW& TextBuffer::GetScratchpadRow()
 {
@@ -290,6 +517,21 @@ size_t TextBuffer::GetCellDistance(const til::point from, const til::point to) c
     return delta;
 }
 
+// Routine Description:
+// - Retrieves contiguous views into a row's backing storage: its text, its
+//   per-column character offsets and its attribute runs. Unlike the cell
+//   iterators this doesn't materialize any per-cell state, which makes it the
+//   preferred way for bulk readers to copy whole rows at a time.
+// Arguments:
+// - row - Y position of the row in the buffer
+// Return Value:
+// - Read-only views into the row's storage. Only valid until the row is next modified.
+TextBuffer::RowSpanView TextBuffer::GetRowSpanView(til::CoordType row) const
+{
+    const auto& r = GetRowByOffset(row);
+    return { r.GetText(0, r.size()), r.CharOffsets(), &r.Attributes() };
+}
+
 // Routine Description:
 // - Retrieves read-only text iterator at the given buffer location
 // Arguments:
@@ -432,18 +674,14 @@ size_t TextBuffer::FitTextIntoColumns(const std::wstring_view& chars, til::Coord
 
     const auto beg = chars.begin();
     const auto end = chars.end();
-    auto it = beg;
-    const auto asciiEnd = beg + std::min(chars.size(), gsl::narrow_cast<size_t>(columnLimit));
+    const auto asciiLimit = std::min(chars.size(), gsl::narrow_cast<size_t>(columnLimit));
 
     // ASCII fast-path: 1 char always corresponds to 1 column.
-    for (; it != asciiEnd && *it < 0x80; ++it)
-    {
-    }
-
-    const auto dist = gsl::narrow_cast<size_t>(it - beg);
+    const auto dist = MeasureNarrowGlyphRun(chars.substr(0, asciiLimit));
+    auto it = beg + dist;
     auto col = gsl::narrow_cast<til::CoordType>(dist);
 
-    if (it == asciiEnd) [[likely]]
+    if (dist == asciiLimit) [[likely]]
     {
         columns = col;
         return dist;
@@ -574,6 +812,26 @@ void TextBuffer::FillRect(const til::rect& rect, const std::wstring_view& fill,
         return;
     }
 
+    // Fast-pass: Replicating a single narrow character doesn't need the scratchpad row at all,
+    // because ROW::FillCharacter() can synthesize the row contents directly. This turns the
+    // common erase/fill operations (ED, EL, ECH, DECFRA, DECALN, ...) into plain fill loops.
+    if (fill.size() == 1 && !IsGlyphFullWidth(fill))
+    {
+        for (auto y = rect.top; y < rect.bottom; ++y)
+        {
+            auto& r = GetMutableRowByOffset(y);
+            r.FillCharacter(rect.left, rect.right, til::at(fill, 0));
+            r.ReplaceAttributes(rect.left, rect.right, attributes);
+        }
+
+        // If the rect boundary sliced a wide glyph in half, FillCharacter() will have replaced
+        // the other half with whitespace. Extending the redraw area by 1 column on either side
+        // covers that, without us needing to track the exact dirty extents for each row.
+        const auto width = GetSize().Width();
+        TriggerRedraw(Viewport::FromExclusive({ std::max(0, rect.left - 1), rect.top, std::min(width, rect.right + 1), rect.bottom }));
+        return;
+    }
+
     auto& scratchpad = GetScratchpadRow(attributes);
 
     // The scratchpad row gets reset to whitespace by default, so there's no need to
@@ -621,6 +879,95 @@ void TextBuffer::FillRect(const til::rect& rect, const std::wstring_view& fill,
     }
 }
 
+// Copies the attribute runs covering [sourceBegin, sourceBegin + width) of sourceRow
+// over to targetRow at targetBegin, run by run rather than cell by cell.
+static void _copyAttrSpan(const ROW& sourceRow, const til::CoordType sourceBegin, ROW& targetRow, const til::CoordType targetBegin, const til::CoordType width)
+{
+    auto column = targetBegin;
+    sourceRow.Attributes().for_each_run(sourceBegin, sourceBegin + width, [&](const TextAttribute& attr, const auto length) {
+        targetRow.ReplaceAttributes(column, column + length, attr);
+        column += length;
+    });
+}
+
+// Copies a rectangular area of the buffer to another position, moving whole row
+// spans through the row storage instead of cell by cell. Full-width vertical
+// scrolls should keep going through ScrollRows(), which reuses entire rows; this
+// is the bulk equivalent for the partial-width scrolls that VT margins and
+// insert/delete operations produce.
+void TextBuffer::CopyRect(const til::rect& source, const til::point targetOrigin)
+{
+    const auto width = source.width();
+    const auto height = source.height();
+
+    if (!source || (targetOrigin.x == source.left && targetOrigin.y == source.top))
+    {
+        return;
+    }
+
+    if (targetOrigin.y == source.top)
+    {
+        // A purely horizontal move overlaps itself within each row, so the span
+        // gets staged through the scratchpad row first.
+        auto& scratchpad = GetScratchpadRow();
+
+        for (auto y = source.top; y < source.bottom; ++y)
+        {
+            auto& row = GetMutableRowByOffset(y);
+
+            RowCopyTextFromState stage{
+                .source = row,
+                .columnBegin = source.left,
+                .columnLimit = source.right,
+                .sourceColumnBegin = source.left,
+                .sourceColumnLimit = source.right,
+            };
+            scratchpad.CopyTextFrom(stage);
+            _copyAttrSpan(row, source.left, scratchpad, source.left, width);
+
+            RowCopyTextFromState state{
+                .source = scratchpad,
+                .columnBegin = targetOrigin.x,
+                .columnLimit = targetOrigin.x + width,
+                .sourceColumnBegin = source.left,
+                .sourceColumnLimit = source.right,
+            };
+            row.CopyTextFrom(state);
+            _copyAttrSpan(scratchpad, source.left, row, targetOrigin.x, width);
+
+            TriggerRedraw(Viewport::FromExclusive({ state.columnBeginDirty, y, state.columnEndDirty, y + 1 }));
+        }
+    }
+    else
+    {
+        // Rows are walked in the direction that reads each source row before any
+        // copy can overwrite it, the same way memmove resolves its overlap.
+        const auto downward = targetOrigin.y > source.top;
+
+        for (til::CoordType i = 0; i < height; ++i)
+        {
+            const auto offset = downward ? height - 1 - i : i;
+            const auto srcY = source.top + offset;
+            const auto dstY = targetOrigin.y + offset;
+
+            const auto& srcRow = GetRowByOffset(srcY);
+            auto& dstRow = GetMutableRowByOffset(dstY);
+
+            RowCopyTextFromState state{
+                .source = srcRow,
+                .columnBegin = targetOrigin.x,
+                .columnLimit = targetOrigin.x + width,
+                .sourceColumnBegin = source.left,
+                .sourceColumnLimit = source.right,
+            };
+            dstRow.CopyTextFrom(state);
+            _copyAttrSpan(srcRow, source.left, dstRow, targetOrigin.x, width);
+
+            TriggerRedraw(Viewport::FromExclusive({ state.columnBeginDirty, dstY, state.columnEndDirty, dstY + 1 }));
+        }
+    }
+}
+
 // Routine Description:
 // - Writes cells to the output buffer. Writes at the cursor.
 // Arguments:
@@ -874,6 +1221,17 @@ void TextBuffer::IncrementCircularBuffer(const TextAttribute& fillAttributes)
             _firstRow = 0;
         }
     }
+
+    // Keep the incremental-search bookkeeping in line with the rotation: everything moved
+    // up one row, and the recycled row reappears blank at the bottom of the buffer.
+    if (_dirtyRowBeg < _dirtyRowEnd)
+    {
+        _dirtyRowBeg = std::max<til::CoordType>(0, _dirtyRowBeg - 1);
+        _dirtyRowEnd = std::max<til::CoordType>(1, _dirtyRowEnd - 1);
+    }
+    _dirtyRowBeg = std::min<til::CoordType>(_dirtyRowBeg, _height - 1);
+    _dirtyRowEnd = _height;
+    _dirtyScrollDelta = std::min<til::CoordType>(_dirtyScrollDelta + 1, _height);
 }
 
 //Routine Description:
@@ -1052,6 +1410,60 @@ uint64_t TextBuffer::GetLastMutationId() const noexcept
     return _lastMutationId;
 }
 
+// Walks the buffer's actual allocations and produces a breakdown of where the
+// memory went. Only committed, warm slabs are inspected: touching a cold slab
+// would decompress it (and fault spilled pages back in), which would defeat
+// the point of asking. Cold slabs report their compressed size instead.
+TextBuffer::MemoryUsage TextBuffer::GetMemoryUsage() const noexcept
+{
+    MemoryUsage usage;
+
+    const auto slabSize = _bufferRowStride * _rowsPerSlab;
+    const auto rowCount = gsl::narrow_cast<size_t>(_height) + 1;
+
+    for (size_t i = 0; i < _slabs.size(); ++i)
+    {
+        const auto& slab = _slabs[i];
+        if (slab.cold)
+        {
+            usage.coldSlabBytes += slab.cold->capacity();
+            continue;
+        }
+        if (!slab.get())
+        {
+            continue;
+        }
+
+        usage.slabBytes += slabSize;
+
+        const auto firstRow = i * _rowsPerSlab;
+        const auto lastRow = std::min(firstRow + _rowsPerSlab, rowCount);
+        auto it = slab.get();
+        for (auto r = firstRow; r < lastRow; ++r, it += _bufferRowStride)
+        {
+            const auto& row = *reinterpret_cast<const ROW*>(it);
+            usage.charsHeapBytes += row.GetHeapCharsBytes();
+            const auto& runs = row.Attributes().runs();
+            usage.attrRunBytes += runs.capacity() * sizeof(std::remove_reference_t<decltype(runs)>::value_type);
+        }
+    }
+
+    for (const auto& [id, uri] : _hyperlinkMap)
+    {
+        usage.hyperlinkBytes += sizeof(id) + uri.capacity() * sizeof(wchar_t);
+    }
+    for (const auto& [uri, id] : _hyperlinkCustomIdMap)
+    {
+        usage.hyperlinkBytes += sizeof(id) + uri.capacity() * sizeof(wchar_t);
+    }
+    for (const auto& [uri, id] : _hyperlinkUriMap)
+    {
+        usage.hyperlinkBytes += sizeof(id) + uri.capacity() * sizeof(wchar_t);
+    }
+
+    return usage;
+}
+
 const TextAttribute& TextBuffer::GetCurrentAttributes() const noexcept
 {
     return _currentAttributes;
@@ -1146,6 +1558,98 @@ void TextBuffer::Reset() noexcept
     _initialAttributes = _currentAttributes;
 }
 
+// Routine Description:
+// - Makes all slabs committed from here on be backed by an on-disk spill file instead of
+//   anonymous memory. Combined with SpillRowsOutsideWindow() this keeps only the
+//   viewport-adjacent portion of a huge scrollback resident in RAM.
+void TextBuffer::EnableColdScrollbackSpill() noexcept
+{
+    _spillEnabled = true;
+}
+
+// Routine Description:
+// - Flushes all slabs whose rows lie entirely outside the given (inclusive) hot row window
+//   to the spill file and evicts them from the working set. Accessing a spilled row through
+//   GetRowByOffset() transparently faults its pages back in.
+// Arguments:
+// - hotFirst - first row (in GetRowByOffset() coordinates) that must stay resident
+// - hotLast - last row that must stay resident
+// Translates the inclusive hot row window [hotFirst, hotLast] into direct row offsets
+// (+1 for the scratchpad row at offset 0). Because the buffer is circular, the window
+// covers at most two contiguous direct ranges: [beg1, end1) and the wrap-around [1, end2).
+struct HotRowRanges
+{
+    size_t beg1;
+    size_t end1;
+    size_t end2;
+};
+
+static HotRowRanges hotRowRangesFor(til::CoordType hotFirst, til::CoordType hotLast, til::CoordType firstRow, til::CoordType heightCoord) noexcept
+{
+    const auto height = gsl::narrow_cast<size_t>(heightCoord);
+    const auto first = gsl::narrow_cast<size_t>(((std::clamp<til::CoordType>(hotFirst, 0, heightCoord - 1) + firstRow) % heightCoord + heightCoord) % heightCoord);
+    const auto count = gsl::narrow_cast<size_t>(std::clamp<til::CoordType>(hotLast - hotFirst + 1, 0, heightCoord));
+
+    HotRowRanges ranges;
+    ranges.beg1 = first + 1;
+    ranges.end1 = std::min(first + count, height) + 1;
+    ranges.end2 = first + count > height ? first + count - height + 1 : 1;
+    return ranges;
+}
+
+void TextBuffer::SpillRowsOutsideWindow(const til::CoordType hotFirst, const til::CoordType hotLast) noexcept
+{
+    if (!_spillEnabled || !_spillFile)
+    {
+        return;
+    }
+
+    const auto height = gsl::narrow_cast<size_t>(_height);
+    const auto slabSize = _bufferRowStride * _rowsPerSlab;
+    const auto hot = hotRowRangesFor(hotFirst, hotLast, _firstRow, _height);
+
+    for (size_t slab = 1; slab < _committedSlabs; ++slab)
+    {
+        // The scratchpad row keeps slab 0 permanently hot, so we start at slab 1.
+        const auto beg = slab * _rowsPerSlab;
+        const auto end = std::min(beg + _rowsPerSlab, height + 1);
+        const auto isHot = (beg < hot.end1 && hot.beg1 < end) || beg < hot.end2;
+
+        if (!isHot && _slabs[slab].view)
+        {
+            const auto base = _slabs[slab].view.get();
+            std::ignore = FlushViewOfFile(base, slabSize);
+            // VirtualUnlock on pages that were never locked is the documented way
+            // to remove them from the working set without invalidating the view.
+            std::ignore = VirtualUnlock(base, slabSize);
+        }
+    }
+}
+
+// Routine Description:
+// - Compresses all slabs whose rows lie entirely outside the given (inclusive) hot row
+//   window into their serialized cold representation, releasing their backing memory.
+//   Accessing a compressed row through GetRowByOffset() transparently re-materializes
+//   its entire slab.
+void TextBuffer::CompressRowsOutsideWindow(const til::CoordType hotFirst, const til::CoordType hotLast)
+{
+    const auto height = gsl::narrow_cast<size_t>(_height);
+    const auto hot = hotRowRangesFor(hotFirst, hotLast, _firstRow, _height);
+
+    for (size_t slab = 1; slab < _committedSlabs; ++slab)
+    {
+        // The scratchpad row keeps slab 0 permanently hot, so we start at slab 1.
+        const auto beg = slab * _rowsPerSlab;
+        const auto end = std::min(beg + _rowsPerSlab, height + 1);
+        const auto isHot = (beg < hot.end1 && hot.beg1 < end) || beg < hot.end2;
+
+        if (!isHot && !_slabs[slab].cold)
+        {
+            _compressSlab(slab);
+        }
+    }
+}
+
 // Routine Description:
 // - This is the legacy screen resize with minimal changes
 // Arguments:
@@ -1174,10 +1678,14 @@ void TextBuffer::ResizeTraditional(til::size newSize)
         newBuffer.GetMutableRowByOffset(dstRow).CopyFrom(GetRowByOffset(srcRow));
     }
 
+    // Destroy the old ROWs before the member extraction below releases their
+    // backing memory (and the overflow pool their text may live in).
+    _destroy();
+
     // NOTE: Keep this in sync with _reserve().
-    _buffer = std::move(newBuffer._buffer);
-    _bufferEnd = newBuffer._bufferEnd;
-    _commitWatermark = newBuffer._commitWatermark;
+    _slabs = std::move(newBuffer._slabs);
+    _committedSlabs = newBuffer._committedSlabs;
+    _charsPool = std::move(newBuffer._charsPool);
     _initialAttributes = newBuffer._initialAttributes;
     _bufferRowStride = newBuffer._bufferRowStride;
     _bufferOffsetChars = newBuffer._bufferOffsetChars;
@@ -1261,7 +1769,59 @@ void TextBuffer::TriggerNewTextNotification(const std::wstring_view newText)
 // - the delimiter class for the given char
 DelimiterClass TextBuffer::_GetDelimiterClassAt(const til::point pos, const std::wstring_view wordDelimiters) const
 {
-    return GetRowByOffset(pos.y).DelimiterClassAt(pos.x, wordDelimiters);
+    const auto& runs = _GetDelimiterRunsForRow(pos.y, wordDelimiters);
+    return til::at(runs, _delimiterRunIndex(runs, pos.x)).cls;
+}
+
+// Returns the index of the run containing the given column (clamped into the row).
+size_t TextBuffer::_delimiterRunIndex(const std::vector<DelimiterRun>& runs, const til::CoordType col) noexcept
+{
+    // The runs are sorted by their first column and the first one starts at column 0,
+    // so the run containing the position is the last one starting at or before it.
+    const auto it = std::upper_bound(runs.begin(), runs.end(), std::max<til::CoordType>(col, 0), [](const auto c, const auto& run) {
+        return c < run.beg;
+    });
+    return gsl::narrow_cast<size_t>(it - runs.begin()) - 1;
+}
+
+// Method Description:
+// - get (or lazily build) the cached array of delimiter class runs for a row
+// - word-boundary walks (double-click selection, shift-double-click drags, UIA word
+//   navigation) query the same cells over and over; classifying each row once per
+//   buffer state turns those repeated queries into array lookups
+// Arguments:
+// - row: the buffer row under observation
+// - wordDelimiters: the delimiters defined as a part of the DelimiterClass::DelimiterChar
+// Return Value:
+// - the runs of identically-classified columns covering the entire row, in order
+const std::vector<TextBuffer::DelimiterRun>& TextBuffer::_GetDelimiterRunsForRow(const til::CoordType row, const std::wstring_view wordDelimiters) const
+{
+    auto& cache = _delimiterRunCache;
+    if (cache.mutationId != _lastMutationId || cache.delimiters != wordDelimiters)
+    {
+        cache.rows.clear();
+        cache.mutationId = _lastMutationId;
+        cache.delimiters = wordDelimiters;
+    }
+
+    const auto [it, inserted] = cache.rows.try_emplace(row);
+    auto& runs = it->second;
+    if (inserted)
+    {
+        const auto& r = GetRowByOffset(row);
+        const auto width = GetSize().Width();
+        auto last = DelimiterClass::ControlChar;
+        for (til::CoordType x = 0; x < width; ++x)
+        {
+            const auto cls = r.DelimiterClassAt(x, wordDelimiters);
+            if (runs.empty() || cls != last)
+            {
+                runs.push_back({ gsl::narrow_cast<uint16_t>(x), cls });
+                last = cls;
+            }
+        }
+    }
+    return runs;
 }
 
 // Method Description:
@@ -1330,33 +1890,50 @@ til::point TextBuffer::_GetWordStartForAccessibility(const til::point target, co
     auto result = target;
     const auto bufferSize = GetSize();
 
-    // ignore left boundary. Continue until readable text found
-    while (_GetDelimiterClassAt(result, wordDelimiters) != DelimiterClass::RegularChar)
+    // ignore left boundary. Continue until readable text found. Assistive
+    // tools issue these by the thousands while scanning, so rather than
+    // classifying cell after cell we hop backwards over whole runs from the
+    // cached per-row delimiter index.
+    for (;;)
     {
-        if (result == bufferSize.Origin())
+        const auto& runs = _GetDelimiterRunsForRow(result.y, wordDelimiters);
+        auto i = _delimiterRunIndex(runs, result.x);
+        while (i > 0 && til::at(runs, i).cls != DelimiterClass::RegularChar)
         {
-            //looped around and hit origin (no word between origin and target)
-            return result;
+            --i;
+            // jump to the last column of the previous run
+            result.x = til::at(runs, i + 1).beg - 1;
         }
-        bufferSize.DecrementInBounds(result);
+        if (til::at(runs, i).cls == DelimiterClass::RegularChar)
+        {
+            break;
+        }
+        if (result.y == 0)
+        {
+            // looped around and hit origin (no word between origin and target)
+            return bufferSize.Origin();
+        }
+        result = { bufferSize.RightInclusive(), result.y - 1 };
     }
 
     // make sure we expand to the left boundary or the beginning of the word
-    while (_GetDelimiterClassAt(result, wordDelimiters) == DelimiterClass::RegularChar)
+    for (;;)
     {
-        if (result == bufferSize.Origin())
+        const auto& runs = _GetDelimiterRunsForRow(result.y, wordDelimiters);
+        result.x = til::at(runs, _delimiterRunIndex(runs, result.x)).beg;
+        if (result.x > 0 || result.y == 0)
         {
-            // first char in buffer is a RegularChar
-            // we can't move any further back
             return result;
         }
-        bufferSize.DecrementInBounds(result);
+        // the run starts the row; the word only extends further back if the
+        // previous row ends in readable text
+        const auto& prevRuns = _GetDelimiterRunsForRow(result.y - 1, wordDelimiters);
+        if (prevRuns.back().cls != DelimiterClass::RegularChar)
+        {
+            return result;
+        }
+        result = { bufferSize.RightInclusive(), result.y - 1 };
     }
-
-    // move off of delimiter
-    bufferSize.IncrementInBounds(result);
-
-    return result;
 }
 
 // Method Description:
@@ -1459,21 +2036,44 @@ til::point TextBuffer::_GetWordEndForAccessibility(const til::point target, cons
     }
     else
     {
-        while (result != limit && result != bufferSize.BottomRightInclusive() && _GetDelimiterClassAt(result, wordDelimiters) == DelimiterClass::RegularChar)
-        {
-            // Iterate through readable text
-            bufferSize.IncrementInBounds(result);
-        }
+        const auto bottomRight = bufferSize.BottomRightInclusive();
 
-        while (result != limit && result != bufferSize.BottomRightInclusive() && _GetDelimiterClassAt(result, wordDelimiters) != DelimiterClass::RegularChar)
-        {
-            // expand to the beginning of the NEXT word
-            bufferSize.IncrementInBounds(result);
-        }
+        // Advances result run by run (rather than cell by cell) for as long
+        // as the "is readable text" test keeps coming up `skipRegular`,
+        // stopping exactly on the limit or the buffer corner if either lands
+        // mid-run.
+        const auto munch = [&](const bool skipRegular) {
+            while (result != limit && result != bottomRight)
+            {
+                const auto& runs = _GetDelimiterRunsForRow(result.y, wordDelimiters);
+                const auto i = _delimiterRunIndex(runs, result.x);
+                if ((til::at(runs, i).cls == DelimiterClass::RegularChar) != skipRegular)
+                {
+                    break;
+                }
+                // first position past this run (possibly on the next row)
+                auto next = i + 1 < runs.size() ? til::point{ til::at(runs, i + 1).beg, result.y } :
+                                                  til::point{ 0, result.y + 1 };
+                if (bufferSize.CompareInBounds(limit, next, true) < 0)
+                {
+                    next = limit;
+                }
+                if (bufferSize.CompareInBounds(bottomRight, next, true) < 0)
+                {
+                    next = bottomRight;
+                }
+                result = next;
+            }
+        };
+
+        // Iterate through readable text...
+        munch(true);
+        // ...then expand to the beginning of the NEXT word
+        munch(false);
 
         // Special case: we tried to move one past the end of the buffer
         // Manually increment onto the EndExclusive point.
-        if (result == bufferSize.BottomRightInclusive())
+        if (result == bottomRight)
         {
             bufferSize.IncrementInBounds(result, true);
         }
@@ -1518,6 +2118,14 @@ til::point TextBuffer::_GetWordEndForSelection(const til::point target, const st
 
 void TextBuffer::_PruneHyperlinks()
 {
+    // No hyperlinks anywhere means there's nothing to reclaim. This is the
+    // common case and saves us scanning the departing row's attributes on
+    // every scroll.
+    if (_hyperlinkMap.empty())
+    {
+        return;
+    }
+
     // Check the old first row for hyperlink references
     // If there are any, search the entire buffer for the same reference
     // If the buffer does not contain the same reference, we can remove that hyperlink from our map
@@ -1948,11 +2556,26 @@ const TextBuffer::TextAndColor TextBuffer::GetText(const bool includeCRLF,
     for (size_t i = 0; i < rows; i++)
     {
         const auto iRow = selectionRects.at(i).top;
+        const auto& row = GetRowByOffset(iRow);
+        const til::CoordType rowSize = row.size();
+
+        // The text of a row is stored contiguously, so the entire selected range
+        // can be appended as one span instead of iterating cell by cell. The
+        // boundary columns mirror what the old cell iterator produced: a wide
+        // glyph cut in half at the start is dropped (its leading half is outside
+        // the selection), while one cut at the end is included in full.
+        auto colBeg = std::clamp(selectionRects.at(i).left, 0, rowSize);
+        auto colEnd = std::clamp(selectionRects.at(i).right + 1, colBeg, rowSize);
+        if (colBeg < colEnd && row.DbcsAttrAt(colBeg) == DbcsAttribute::Trailing)
+        {
+            colBeg++;
+        }
+        if (colBeg < colEnd && row.DbcsAttrAt(colEnd - 1) == DbcsAttribute::Leading)
+        {
+            colEnd++;
+        }
 
-        const auto highlight = Viewport::FromInclusive(selectionRects.at(i));
-
-        // retrieve the data from the screen buffer
-        auto it = GetCellDataAt(highlight.Origin(), highlight);
+        const auto rowText = row.GetText(colBeg, colEnd);
 
         // allocate a string buffer
         std::wstring selectionText;
@@ -1960,36 +2583,41 @@ const TextBuffer::TextAndColor TextBuffer::GetText(const bool includeCRLF,
         std::vector<COLORREF> selectionBkAttr;
 
         // preallocate to avoid reallocs
-        selectionText.reserve(gsl::narrow<size_t>(highlight.Width()) + 2); // + 2 for \r\n if we munged it
-        if (copyTextColor)
-        {
-            selectionFgAttr.reserve(gsl::narrow<size_t>(highlight.Width()) + 2);
-            selectionBkAttr.reserve(gsl::narrow<size_t>(highlight.Width()) + 2);
-        }
+        selectionText.reserve(rowText.size() + 2); // + 2 for \r\n if we munged it
+        selectionText.append(rowText);
 
-        // copy char data into the string buffer, skipping trailing bytes
-        while (it)
+        if (copyTextColor)
         {
-            const auto& cell = *it;
+            selectionFgAttr.reserve(rowText.size() + 2);
+            selectionBkAttr.reserve(rowText.size() + 2);
+
+            // Colors are emitted per character, but they only ever change at
+            // attribute run boundaries, so resolve them once per run and fill in
+            // as many entries as the run's columns contribute characters.
+            const auto charOffsets = row.CharOffsets();
+            const auto charOffsetAt = [&](const til::CoordType col) {
+                return size_t{ til::at(charOffsets, gsl::narrow_cast<size_t>(col)) } & ROW::CharOffsetsMask;
+            };
 
-            if (cell.DbcsAttr() != DbcsAttribute::Trailing)
+            til::CoordType runBeg = 0;
+            for (const auto& run : row.Attributes().runs())
             {
-                const auto chars = cell.Chars();
-                selectionText.append(chars);
-
-                if (copyTextColor)
+                const auto runEnd = runBeg + run.length;
+                const auto beg = std::max(runBeg, colBeg);
+                const auto end = std::min(runEnd, colEnd);
+                if (beg < end)
                 {
-                    const auto cellData = cell.TextAttr();
-                    const auto [CellFgAttr, CellBkAttr] = GetAttributeColors(cellData);
-                    for (size_t j = 0; j < chars.size(); ++j)
-                    {
-                        selectionFgAttr.push_back(CellFgAttr);
-                        selectionBkAttr.push_back(CellBkAttr);
-                    }
+                    const auto [cellFgAttr, cellBkAttr] = GetAttributeColors(run.value);
+                    const auto charCount = charOffsetAt(end) - charOffsetAt(beg);
+                    selectionFgAttr.insert(selectionFgAttr.end(), charCount, cellFgAttr);
+                    selectionBkAttr.insert(selectionBkAttr.end(), charCount, cellBkAttr);
+                }
+                runBeg = runEnd;
+                if (runBeg >= colEnd)
+                {
+                    break;
                 }
             }
-
-            ++it;
         }
 
         // We apply formatting to rows if the row was NOT wrapped or formatting of wrapped rows is allowed
@@ -2098,171 +2726,171 @@ std::string TextBuffer::GenHTML(const TextAndColor& rows,
 {
     try
     {
-        std::ostringstream htmlBuilder;
+        // Header required by the HTML 0.9 clipboard format. Its size is fixed, so
+        // the content can be appended right behind it into the same allocation and
+        // the offset fields get patched in at the end, once they're known.
+        constexpr std::string_view clipboardHeader{ "Version:0.9\r\n"
+                                                    "StartHTML:0000000000\r\n"
+                                                    "EndHTML:0000000000\r\n"
+                                                    "StartFragment:0000000000\r\n"
+                                                    "EndFragment:0000000000\r\n"
+                                                    "StartSelection:0000000000\r\n"
+                                                    "EndSelection:0000000000\r\n" };
+        constexpr size_t ClipboardHeaderSize = 157;
+        static_assert(clipboardHeader.size() == ClipboardHeaderSize);
+
+        std::string clip{ clipboardHeader };
+
+        {
+            size_t textLength = 0;
+            for (const auto& text : rows.text)
+            {
+                textLength += text.size();
+            }
+            // A generous estimate: UTF-8 expansion, escapes and span headers.
+            // Overshooting a bit beats reallocating a multi-megabyte copy.
+            clip.reserve(ClipboardHeaderSize + textLength * 2 + rows.text.size() * 16 + 512);
+        }
 
         // First we have to add some standard
         // HTML boiler plate required for CF_HTML
         // as part of the HTML Clipboard format
-        const std::string htmlHeader =
-            "<!DOCTYPE><HTML><HEAD></HEAD><BODY>";
-        htmlBuilder << htmlHeader;
+        constexpr std::string_view htmlHeader{ "<!DOCTYPE><HTML><HEAD></HEAD><BODY>" };
+        clip.append(htmlHeader);
 
-        htmlBuilder << "<!--StartFragment -->";
+        clip.append("<!--StartFragment -->");
 
         // apply global style in div element
-        {
-            htmlBuilder << "<DIV STYLE=\"";
-            htmlBuilder << "display:inline-block;";
-            htmlBuilder << "white-space:pre;";
-
-            htmlBuilder << "background-color:";
-            htmlBuilder << Utils::ColorToHexString(backgroundColor);
-            htmlBuilder << ";";
-
-            htmlBuilder << "font-family:";
-            htmlBuilder << "'";
-            htmlBuilder << ConvertToA(CP_UTF8, fontFaceName);
-            htmlBuilder << "',";
-            // even with different font, add monospace as fallback
-            htmlBuilder << "monospace;";
-
-            htmlBuilder << "font-size:";
-            htmlBuilder << fontHeightPoints;
-            htmlBuilder << "pt;";
-
-            // note: MS Word doesn't support padding (in this way at least)
-            htmlBuilder << "padding:";
-            htmlBuilder << 4; // todo: customizable padding
-            htmlBuilder << "px;";
-
-            htmlBuilder << "\">";
-        }
+        clip.append("<DIV STYLE=\"display:inline-block;white-space:pre;");
+        clip.append("background-color:");
+        clip.append(Utils::ColorToHexString(backgroundColor));
+        clip.append(";font-family:'");
+        clip.append(ConvertToA(CP_UTF8, fontFaceName));
+        // even with different font, add monospace as fallback
+        clip.append("',monospace;font-size:");
+        clip.append(std::to_string(fontHeightPoints));
+        // note: MS Word doesn't support padding (in this way at least)
+        clip.append("pt;padding:4px;\">"); // todo: customizable padding
+
+        const auto appendEscaped = [&](const std::wstring_view text) {
+            const auto utf8 = ConvertToA(CP_UTF8, text);
+            size_t beg = 0;
+            for (;;)
+            {
+                const auto end = utf8.find_first_of("<>&", beg);
+                clip.append(utf8, beg, end - beg);
+                if (end == std::string::npos)
+                {
+                    break;
+                }
+                switch (utf8[end])
+                {
+                case '<':
+                    clip.append("&lt;");
+                    break;
+                case '>':
+                    clip.append("&gt;");
+                    break;
+                default:
+                    clip.append("&amp;");
+                    break;
+                }
+                beg = end + 1;
+            }
+        };
 
-        // copy text and info color from buffer
+        // copy text and info color from buffer, one run of identically
+        // colored characters at a time
         auto hasWrittenAnyText = false;
         std::optional<COLORREF> fgColor = std::nullopt;
         std::optional<COLORREF> bkColor = std::nullopt;
         for (size_t row = 0; row < rows.text.size(); row++)
         {
-            size_t startOffset = 0;
-
             if (row != 0)
             {
-                htmlBuilder << "<BR>";
+                clip.append("<BR>");
             }
 
-            for (size_t col = 0; col < rows.text.at(row).length(); col++)
-            {
-                const auto writeAccumulatedChars = [&](bool includeCurrent) {
-                    if (col >= startOffset)
-                    {
-                        const auto unescapedText = ConvertToA(CP_UTF8, std::wstring_view(rows.text.at(row)).substr(startOffset, col - startOffset + includeCurrent));
-                        for (const auto c : unescapedText)
-                        {
-                            switch (c)
-                            {
-                            case '<':
-                                htmlBuilder << "&lt;";
-                                break;
-                            case '>':
-                                htmlBuilder << "&gt;";
-                                break;
-                            case '&':
-                                htmlBuilder << "&amp;";
-                                break;
-                            default:
-                                htmlBuilder << c;
-                            }
-                        }
-
-                        startOffset = col;
-                    }
-                };
-
-                if (rows.text.at(row).at(col) == '\r' || rows.text.at(row).at(col) == '\n')
-                {
-                    // do not include \r nor \n as they don't have color attributes
-                    // and are not HTML friendly. For line break use '<BR>' instead.
-                    writeAccumulatedChars(false);
-                    break;
-                }
+            const auto& rowText = rows.text.at(row);
+            const auto& rowFg = rows.FgAttr.at(row);
+            const auto& rowBk = rows.BkAttr.at(row);
 
-                auto colorChanged = false;
-                if (!fgColor.has_value() || rows.FgAttr.at(row).at(col) != fgColor.value())
-                {
-                    fgColor = rows.FgAttr.at(row).at(col);
-                    colorChanged = true;
-                }
+            // do not include \r nor \n as they don't have color attributes
+            // and are not HTML friendly. For line break use '<BR>' instead.
+            auto length = rowText.size();
+            if (const auto lineBreak = rowText.find_first_of(L"\r\n"); lineBreak != std::wstring::npos)
+            {
+                length = lineBreak;
+            }
 
-                if (!bkColor.has_value() || rows.BkAttr.at(row).at(col) != bkColor.value())
+            for (size_t col = 0; col < length;)
+            {
+                const auto runFg = rowFg.at(col);
+                const auto runBk = rowBk.at(col);
+                auto runEnd = col + 1;
+                while (runEnd < length && rowFg.at(runEnd) == runFg && rowBk.at(runEnd) == runBk)
                 {
-                    bkColor = rows.BkAttr.at(row).at(col);
-                    colorChanged = true;
+                    runEnd++;
                 }
 
-                if (colorChanged)
+                if (fgColor != runFg || bkColor != runBk)
                 {
-                    writeAccumulatedChars(false);
-
                     if (hasWrittenAnyText)
                     {
-                        htmlBuilder << "</SPAN>";
+                        // close the span opened for the previous run
+                        clip.append("</SPAN>");
                     }
 
-                    htmlBuilder << "<SPAN STYLE=\"";
-                    htmlBuilder << "color:";
-                    htmlBuilder << Utils::ColorToHexString(fgColor.value());
-                    htmlBuilder << ";";
-                    htmlBuilder << "background-color:";
-                    htmlBuilder << Utils::ColorToHexString(bkColor.value());
-                    htmlBuilder << ";";
-                    htmlBuilder << "\">";
+                    fgColor = runFg;
+                    bkColor = runBk;
+                    clip.append("<SPAN STYLE=\"color:");
+                    clip.append(Utils::ColorToHexString(runFg));
+                    clip.append(";background-color:");
+                    clip.append(Utils::ColorToHexString(runBk));
+                    clip.append(";\">");
                 }
 
+                appendEscaped(std::wstring_view{ rowText }.substr(col, runEnd - col));
                 hasWrittenAnyText = true;
-
-                // if this is the last character in the row, flush the whole row
-                if (col == rows.text.at(row).length() - 1)
-                {
-                    writeAccumulatedChars(true);
-                }
+                col = runEnd;
             }
         }
 
         if (hasWrittenAnyText)
         {
             // last opened span wasn't closed in loop above, so close it now
-            htmlBuilder << "</SPAN>";
+            clip.append("</SPAN>");
         }
 
-        htmlBuilder << "</DIV>";
+        clip.append("</DIV>");
 
-        htmlBuilder << "<!--EndFragment -->";
+        clip.append("<!--EndFragment -->");
 
-        constexpr std::string_view HtmlFooter = "</BODY></HTML>";
-        htmlBuilder << HtmlFooter;
-
-        // once filled with values, there will be exactly 157 bytes in the clipboard header
-        constexpr size_t ClipboardHeaderSize = 157;
+        constexpr std::string_view htmlFooter = "</BODY></HTML>";
+        clip.append(htmlFooter);
 
         // these values are byte offsets from start of clipboard
         const auto htmlStartPos = ClipboardHeaderSize;
-        const auto htmlEndPos = ClipboardHeaderSize + gsl::narrow<size_t>(htmlBuilder.tellp());
-        const auto fragStartPos = ClipboardHeaderSize + gsl::narrow<size_t>(htmlHeader.length());
-        const auto fragEndPos = htmlEndPos - HtmlFooter.length();
-
-        // header required by HTML 0.9 format
-        std::ostringstream clipHeaderBuilder;
-        clipHeaderBuilder << "Version:0.9\r\n";
-        clipHeaderBuilder << std::setfill('0');
-        clipHeaderBuilder << "StartHTML:" << std::setw(10) << htmlStartPos << "\r\n";
-        clipHeaderBuilder << "EndHTML:" << std::setw(10) << htmlEndPos << "\r\n";
-        clipHeaderBuilder << "StartFragment:" << std::setw(10) << fragStartPos << "\r\n";
-        clipHeaderBuilder << "EndFragment:" << std::setw(10) << fragEndPos << "\r\n";
-        clipHeaderBuilder << "StartSelection:" << std::setw(10) << fragStartPos << "\r\n";
-        clipHeaderBuilder << "EndSelection:" << std::setw(10) << fragEndPos << "\r\n";
-
-        return clipHeaderBuilder.str() + htmlBuilder.str();
+        const auto htmlEndPos = clip.size();
+        const auto fragStartPos = ClipboardHeaderSize + htmlHeader.size();
+        const auto fragEndPos = htmlEndPos - htmlFooter.size();
+
+        // patch the offsets into their zero-filled 10 digit fields,
+        // right-aligned so the leading zeros act as the fill
+        const auto patchOffset = [&](const std::string_view name, const size_t value) {
+            const auto digits = std::to_string(value);
+            const auto pos = clip.find(name);
+            THROW_HR_IF(E_UNEXPECTED, pos >= ClipboardHeaderSize || digits.size() > 10);
+            clip.replace(pos + name.size() + 10 - digits.size(), digits.size(), digits);
+        };
+        patchOffset("StartHTML:", htmlStartPos);
+        patchOffset("EndHTML:", htmlEndPos);
+        patchOffset("StartFragment:", fragStartPos);
+        patchOffset("EndFragment:", fragEndPos);
+        patchOffset("StartSelection:", fragStartPos);
+        patchOffset("EndSelection:", fragEndPos);
+
+        return clip;
     }
     catch (...)
     {
@@ -2287,11 +2915,6 @@ std::string TextBuffer::GenRTF(const TextAndColor& rows, const int fontHeightPoi
 {
     try
     {
-        std::ostringstream rtfBuilder;
-
-        // start rtf
-        rtfBuilder << "{";
-
         // Standard RTF header.
         // This is similar to the header generated by WordPad.
         // \ansi:
@@ -2306,19 +2929,20 @@ std::string TextBuffer::GenRTF(const TextAndColor& rows, const int fontHeightPoi
         //   Some features are blocked by default to maintain compatibility
         //   with older programs (Eg. Word 97-2003). `nouicompat` disables this
         //   behavior, and unblocks these features. See: Spec 1.9.1, Pg. 51.
-        rtfBuilder << "\\rtf1\\ansi\\ansicpg1252\\deff0\\nouicompat";
+        constexpr std::string_view rtfHeader{ "{\\rtf1\\ansi\\ansicpg1252\\deff0\\nouicompat" };
 
         // font table
-        rtfBuilder << "{\\fonttbl{\\f0\\fmodern\\fcharset0 " << ConvertToA(CP_UTF8, fontFaceName) << ";}}";
+        std::string fontTable{ "{\\fonttbl{\\f0\\fmodern\\fcharset0 " };
+        fontTable.append(ConvertToA(CP_UTF8, fontFaceName));
+        fontTable.append(";}}");
 
         // map to keep track of colors:
         // keys are colors represented by COLORREF
         // values are indices of the corresponding colors in the color table
         std::unordered_map<COLORREF, size_t> colorMap;
 
-        // RTF color table
-        std::ostringstream colorTableBuilder;
-        colorTableBuilder << "{\\colortbl ;";
+        // RTF color table; grows as the content scan below discovers colors
+        std::string colorTable{ "{\\colortbl ;" };
 
         const auto getColorTableIndex = [&](const COLORREF color) -> size_t {
             // Exclude the 0 index for the default color, and start with 1.
@@ -2326,103 +2950,109 @@ std::string TextBuffer::GenRTF(const TextAndColor& rows, const int fontHeightPoi
             const auto [it, inserted] = colorMap.emplace(color, colorMap.size() + 1);
             if (inserted)
             {
-                colorTableBuilder << "\\red" << static_cast<int>(GetRValue(color))
-                                  << "\\green" << static_cast<int>(GetGValue(color))
-                                  << "\\blue" << static_cast<int>(GetBValue(color))
-                                  << ";";
+                colorTable.append("\\red");
+                colorTable.append(std::to_string(GetRValue(color)));
+                colorTable.append("\\green");
+                colorTable.append(std::to_string(GetGValue(color)));
+                colorTable.append("\\blue");
+                colorTable.append(std::to_string(GetBValue(color)));
+                colorTable.push_back(';');
             }
             return it->second;
         };
 
         // content
-        std::ostringstream contentBuilder;
-        contentBuilder << "\\viewkind4\\uc4";
+        std::string content{ "\\viewkind4\\uc4" };
+
+        {
+            size_t textLength = 0;
+            for (const auto& text : rows.text)
+            {
+                textLength += text.size();
+            }
+            // A generous estimate: escapes and color run headers. Overshooting
+            // a bit beats reallocating a multi-megabyte copy.
+            content.reserve(textLength * 2 + rows.text.size() * 8 + 64);
+        }
 
         // paragraph styles
         // \fs specifies font size in half-points i.e. \fs20 results in a font size
         // of 10 pts. That's why, font size is multiplied by 2 here.
-        contentBuilder << "\\pard\\slmult1\\f0\\fs" << std::to_string(2 * fontHeightPoints)
-                       // Set the background color for the page. But, the
-                       // standard way (\cbN) to do this isn't supported in Word.
-                       // However, the following control words sequence works
-                       // in Word (and other RTF editors also) for applying the
-                       // text background color. See: Spec 1.9.1, Pg. 23.
-                       << "\\chshdng0\\chcbpat" << getColorTableIndex(backgroundColor)
-                       << " ";
-
+        content.append("\\pard\\slmult1\\f0\\fs");
+        content.append(std::to_string(2 * fontHeightPoints));
+        // Set the background color for the page. But, the
+        // standard way (\cbN) to do this isn't supported in Word.
+        // However, the following control words sequence works
+        // in Word (and other RTF editors also) for applying the
+        // text background color. See: Spec 1.9.1, Pg. 23.
+        content.append("\\chshdng0\\chcbpat");
+        content.append(std::to_string(getColorTableIndex(backgroundColor)));
+        content.push_back(' ');
+
+        // copy the text and color content, one run of identically
+        // colored characters at a time
         std::optional<COLORREF> fgColor = std::nullopt;
         std::optional<COLORREF> bkColor = std::nullopt;
         for (size_t row = 0; row < rows.text.size(); ++row)
         {
-            size_t startOffset = 0;
-
             if (row != 0)
             {
-                contentBuilder << "\\line "; // new line
+                content.append("\\line "); // new line
             }
 
-            for (size_t col = 0; col < rows.text.at(row).length(); ++col)
-            {
-                const auto writeAccumulatedChars = [&](bool includeCurrent) {
-                    if (col >= startOffset)
-                    {
-                        const auto text = std::wstring_view{ rows.text.at(row) }.substr(startOffset, col - startOffset + includeCurrent);
-                        _AppendRTFText(contentBuilder, text);
-
-                        startOffset = col;
-                    }
-                };
-
-                if (rows.text.at(row).at(col) == '\r' || rows.text.at(row).at(col) == '\n')
-                {
-                    // do not include \r nor \n as they don't have color attributes.
-                    // For line break use \line instead.
-                    writeAccumulatedChars(false);
-                    break;
-                }
+            const auto& rowText = rows.text.at(row);
+            const auto& rowFg = rows.FgAttr.at(row);
+            const auto& rowBk = rows.BkAttr.at(row);
 
-                auto colorChanged = false;
-                if (!fgColor.has_value() || rows.FgAttr.at(row).at(col) != fgColor.value())
-                {
-                    fgColor = rows.FgAttr.at(row).at(col);
-                    colorChanged = true;
-                }
+            // do not include \r nor \n as they don't have color attributes.
+            // For line break use \line instead.
+            auto length = rowText.size();
+            if (const auto lineBreak = rowText.find_first_of(L"\r\n"); lineBreak != std::wstring::npos)
+            {
+                length = lineBreak;
+            }
 
-                if (!bkColor.has_value() || rows.BkAttr.at(row).at(col) != bkColor.value())
+            for (size_t col = 0; col < length;)
+            {
+                const auto runFg = rowFg.at(col);
+                const auto runBk = rowBk.at(col);
+                auto runEnd = col + 1;
+                while (runEnd < length && rowFg.at(runEnd) == runFg && rowBk.at(runEnd) == runBk)
                 {
-                    bkColor = rows.BkAttr.at(row).at(col);
-                    colorChanged = true;
+                    runEnd++;
                 }
 
-                if (colorChanged)
+                if (fgColor != runFg || bkColor != runBk)
                 {
-                    writeAccumulatedChars(false);
-                    contentBuilder << "\\chshdng0\\chcbpat" << getColorTableIndex(bkColor.value())
-                                   << "\\cf" << getColorTableIndex(fgColor.value())
-                                   << " ";
+                    fgColor = runFg;
+                    bkColor = runBk;
+                    content.append("\\chshdng0\\chcbpat");
+                    content.append(std::to_string(getColorTableIndex(runBk)));
+                    content.append("\\cf");
+                    content.append(std::to_string(getColorTableIndex(runFg)));
+                    content.push_back(' ');
                 }
 
-                // if this is the last character in the row, flush the whole row
-                if (col == rows.text.at(row).length() - 1)
-                {
-                    writeAccumulatedChars(true);
-                }
+                _AppendRTFText(content, std::wstring_view{ rowText }.substr(col, runEnd - col));
+                col = runEnd;
             }
         }
 
         // end colortbl
-        colorTableBuilder << "}";
-
-        // add color table to the final RTF
-        rtfBuilder << colorTableBuilder.str();
+        colorTable.push_back('}');
 
-        // add the text content to the final RTF
-        rtfBuilder << contentBuilder.str();
+        // assemble the final RTF: header, font table, color table, content
+        std::string rtf;
+        rtf.reserve(rtfHeader.size() + fontTable.size() + colorTable.size() + content.size() + 1);
+        rtf.append(rtfHeader);
+        rtf.append(fontTable);
+        rtf.append(colorTable);
+        rtf.append(content);
 
         // end rtf
-        rtfBuilder << "}";
+        rtf.push_back('}');
 
-        return rtfBuilder.str();
+        return rtf;
     }
     catch (...)
     {
@@ -2431,7 +3061,7 @@ std::string TextBuffer::GenRTF(const TextAndColor& rows, const int fontHeightPoi
     }
 }
 
-void TextBuffer::_AppendRTFText(std::ostringstream& contentBuilder, const std::wstring_view& text)
+void TextBuffer::_AppendRTFText(std::string& contentBuilder, const std::wstring_view& text)
 {
     for (const auto codeUnit : text)
     {
@@ -2442,16 +3072,18 @@ void TextBuffer::_AppendRTFText(std::ostringstream& contentBuilder, const std::w
             case L'\\':
             case L'{':
             case L'}':
-                contentBuilder << "\\" << gsl::narrow<char>(codeUnit);
-                break;
+                contentBuilder.push_back('\\');
+                [[fallthrough]];
             default:
-                contentBuilder << gsl::narrow<char>(codeUnit);
+                contentBuilder.push_back(gsl::narrow_cast<char>(codeUnit));
             }
         }
         else
         {
             // Windows uses unsigned wchar_t - RTF uses signed ones.
-            contentBuilder << "\\u" << std::to_string(til::bit_cast<int16_t>(codeUnit)) << "?";
+            contentBuilder.append("\\u");
+            contentBuilder.append(std::to_string(til::bit_cast<int16_t>(codeUnit)));
+            contentBuilder.push_back('?');
         }
     }
 }
@@ -2474,11 +3106,22 @@ void TextBuffer::_AppendRTFText(std::ostringstream& contentBuilder, const std::w
 // - S_OK if we successfully copied the contents to the new buffer, otherwise an appropriate HRESULT.
 void TextBuffer::Reflow(TextBuffer& oldBuffer, TextBuffer& newBuffer, const Viewport* lastCharacterViewport, PositionInformation* positionInfo)
 {
-    const auto& oldCursor = oldBuffer.GetCursor();
-    auto& newCursor = newBuffer.GetCursor();
+    auto cursor = BeginReflow(oldBuffer, lastCharacterViewport, positionInfo);
+    while (ReflowChunk(oldBuffer, newBuffer, cursor, til::CoordTypeMax))
+    {
+    }
+}
 
-    til::point oldCursorPos = oldCursor.GetPosition();
-    til::point newCursorPos;
+// Function Description:
+// - Prepares a ReflowCursor for an incremental reflow from oldBuffer into newBuffer.
+//   Feed the cursor to ReflowChunk() until it returns false. This allows hosts to
+//   amortize a reflow of a large scrollback across multiple slices of work instead
+//   of blocking on a single Reflow() call.
+TextBuffer::ReflowCursor TextBuffer::BeginReflow(TextBuffer& oldBuffer, const Viewport* lastCharacterViewport, PositionInformation* positionInfo)
+{
+    ReflowCursor cursor;
+    cursor.positionInfo = positionInfo;
+    cursor.oldCursorPos = oldBuffer.GetCursor().GetPosition();
 
     // BODGY: We use oldCursorPos in two critical places below:
     // * To compute an oldHeight that includes at a minimum the cursor row
@@ -2486,27 +3129,53 @@ void TextBuffer::Reflow(TextBuffer& oldBuffer, TextBuffer& newBuffer, const View
     // Both of these would break the reflow algorithm, but the latter of the two in particular
     // would cause the main copy loop below to deadlock. In other words, these two lines
     // protect this function against yet-unknown bugs in other parts of the code base.
-    oldCursorPos.x = std::clamp(oldCursorPos.x, 0, oldBuffer._width - 1);
-    oldCursorPos.y = std::clamp(oldCursorPos.y, 0, oldBuffer._height - 1);
+    cursor.oldCursorPos.x = std::clamp(cursor.oldCursorPos.x, 0, oldBuffer._width - 1);
+    cursor.oldCursorPos.y = std::clamp(cursor.oldCursorPos.y, 0, oldBuffer._height - 1);
 
     const auto lastRowWithText = oldBuffer.GetLastNonSpaceCharacter(lastCharacterViewport).y;
+    cursor.oldHeight = std::max(lastRowWithText, cursor.oldCursorPos.y) + 1;
 
-    auto mutableViewportTop = positionInfo ? positionInfo->mutableViewportTop : til::CoordTypeMax;
-    auto visibleViewportTop = positionInfo ? positionInfo->visibleViewportTop : til::CoordTypeMax;
+    if (positionInfo)
+    {
+        cursor.mutableViewportTop = positionInfo->mutableViewportTop;
+        cursor.visibleViewportTop = positionInfo->visibleViewportTop;
+    }
 
-    til::CoordType oldY = 0;
-    til::CoordType newY = 0;
-    til::CoordType newX = 0;
-    til::CoordType newWidth = newBuffer.GetSize().Width();
-    til::CoordType newYLimit = til::CoordTypeMax;
+    return cursor;
+}
 
-    const auto oldHeight = std::max(lastRowWithText, oldCursorPos.y) + 1;
+// Function Description:
+// - Advances an incremental reflow by up to maxOldRows rows of the old buffer.
+//   Once the copy is complete, the final call also fixes up the new buffer's
+//   attributes, cursor, properties and marks.
+// Return Value:
+// - true if more work remains (call again), false once the reflow is complete.
+bool TextBuffer::ReflowChunk(TextBuffer& oldBuffer, TextBuffer& newBuffer, ReflowCursor& cursor, til::CoordType maxOldRows)
+{
+    const auto positionInfo = cursor.positionInfo;
+    const auto& oldCursorPos = cursor.oldCursorPos;
+    auto& newCursorPos = cursor.newCursorPos;
+    auto& mutableViewportTop = cursor.mutableViewportTop;
+    auto& visibleViewportTop = cursor.visibleViewportTop;
+    auto& oldY = cursor.oldY;
+    auto& newY = cursor.newY;
+    auto& newX = cursor.newX;
+    auto& newYLimit = cursor.newYLimit;
+    const auto oldHeight = cursor.oldHeight;
+
+    const auto newWidth = newBuffer.GetSize().Width();
     const auto newHeight = newBuffer.GetSize().Height();
     const auto newWidthU16 = gsl::narrow_cast<uint16_t>(newWidth);
 
     // Copy oldBuffer into newBuffer until oldBuffer has been fully consumed.
     for (; oldY < oldHeight && newY < newYLimit; ++oldY)
     {
+        if (maxOldRows <= 0)
+        {
+            return true;
+        }
+        maxOldRows--;
+
         const auto& oldRow = oldBuffer.GetRowByOffset(oldY);
 
         // A pair of double height rows should optimally wrap as a union (i.e. after wrapping there should be 4 lines).
@@ -2657,6 +3326,12 @@ void TextBuffer::Reflow(TextBuffer& oldBuffer, TextBuffer& newBuffer, const View
     const auto initializedRowsEnd = oldBuffer._estimateOffsetOfLastCommittedRow() + 1;
     for (; oldY < initializedRowsEnd && newY < newHeight; oldY++, newY++)
     {
+        if (maxOldRows <= 0)
+        {
+            return true;
+        }
+        maxOldRows--;
+
         auto& oldRow = oldBuffer.GetRowByOffset(oldY);
         auto& newRow = newBuffer.GetMutableRowByOffset(newY);
         auto& newAttr = newRow.Attributes();
@@ -2682,11 +3357,14 @@ void TextBuffer::Reflow(TextBuffer& oldBuffer, TextBuffer& newBuffer, const View
 
     assert(newCursorPos.x >= 0 && newCursorPos.x < newWidth);
     assert(newCursorPos.y >= 0 && newCursorPos.y < newHeight);
-    newCursor.SetSize(oldCursor.GetSize());
+    auto& newCursor = newBuffer.GetCursor();
+    newCursor.SetSize(oldBuffer.GetCursor().GetSize());
     newCursor.SetPosition(newCursorPos);
 
+    oldBuffer._flushMarkShift();
     newBuffer._marks = oldBuffer._marks;
     newBuffer._trimMarksOutsideBuffer();
+    return false;
 }
 
 // Method Description:
@@ -2717,12 +3395,27 @@ std::wstring TextBuffer::GetHyperlinkUriFromId(uint16_t id) const
 // - The internal hyperlink ID
 uint16_t TextBuffer::GetHyperlinkId(std::wstring_view uri, std::wstring_view id)
 {
+    // Tools that annotate their output tend to re-emit the exact same OSC 8
+    // for every affected cell. Checking against the most recent link first
+    // turns that repetition into a plain string compare, with no hashing,
+    // no allocation and no map probe.
+    if (_lastHyperlinkId && uri == _lastHyperlinkUri && id == _lastHyperlinkCustomId)
+    {
+        return _lastHyperlinkId;
+    }
+
     uint16_t numericId = 0;
     if (id.empty())
     {
-        // no custom id specified, return our internal count
-        numericId = _currentHyperlinkId;
-        ++_currentHyperlinkId;
+        // No custom id was specified, so we intern by URI: repeated anonymous
+        // links to the same target all share one id and one stored string,
+        // instead of minting a fresh id (and leaking a map entry) per OSC 8.
+        const auto result = _hyperlinkUriMap.emplace(uri, _currentHyperlinkId);
+        if (result.second)
+        {
+            ++_currentHyperlinkId;
+        }
+        numericId = result.first->second;
     }
     else
     {
@@ -2743,6 +3436,9 @@ uint16_t TextBuffer::GetHyperlinkId(std::wstring_view uri, std::wstring_view id)
     {
         ++_currentHyperlinkId;
     }
+    _lastHyperlinkUri = uri;
+    _lastHyperlinkCustomId = id;
+    _lastHyperlinkId = numericId;
     return numericId;
 }
 
@@ -2753,7 +3449,17 @@ uint16_t TextBuffer::GetHyperlinkId(std::wstring_view uri, std::wstring_view id)
 // - The ID of the hyperlink to be removed
 void TextBuffer::RemoveHyperlinkFromMap(uint16_t id) noexcept
 {
-    _hyperlinkMap.erase(id);
+    if (const auto it = _hyperlinkMap.find(id); it != _hyperlinkMap.end())
+    {
+        // If this id was interned by URI, drop the interning entry as well, but
+        // only if it actually points at us - an anonymous link and a custom-id
+        // link can share a URI while having distinct ids.
+        if (const auto uriIt = _hyperlinkUriMap.find(it->second); uriIt != _hyperlinkUriMap.end() && uriIt->second == id)
+        {
+            _hyperlinkUriMap.erase(uriIt);
+        }
+        _hyperlinkMap.erase(it);
+    }
     for (const auto& customIdPair : _hyperlinkCustomIdMap)
     {
         if (customIdPair.second == id)
@@ -2762,6 +3468,11 @@ void TextBuffer::RemoveHyperlinkFromMap(uint16_t id) noexcept
             break;
         }
     }
+    // Never hand out a reclaimed id from the most-recent-link cache.
+    if (_lastHyperlinkId == id)
+    {
+        _lastHyperlinkId = 0;
+    }
 }
 
 // Method Description:
@@ -2792,9 +3503,142 @@ void TextBuffer::CopyHyperlinkMaps(const TextBuffer& other)
 {
     _hyperlinkMap = other._hyperlinkMap;
     _hyperlinkCustomIdMap = other._hyperlinkCustomIdMap;
+    _hyperlinkUriMap = other._hyperlinkUriMap;
     _currentHyperlinkId = other._currentHyperlinkId;
 }
 
+// Method Description:
+// - Drops all hyperlink map entries and resets the id allocator.
+// - Only valid while no row references a hyperlink id anymore, e.g. right
+//   after every row was reset.
+void TextBuffer::ClearHyperlinkMaps() noexcept
+{
+    _hyperlinkMap.clear();
+    _hyperlinkCustomIdMap.clear();
+    _hyperlinkUriMap.clear();
+    _lastHyperlinkUri.clear();
+    _lastHyperlinkCustomId.clear();
+    _lastHyperlinkId = 0;
+    _currentHyperlinkId = 1;
+}
+
+// Returns the first occurrence of `wch` in [beg,end), or `end` if there is none.
+// This is the candidate scan of the literal search fast path: a vectorized compare against
+// the needle's first character, with the full needle only verified at candidate positions.
+static const wchar_t* searchScanForChar(const wchar_t* beg, const wchar_t* end, const wchar_t wch) noexcept
+{
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#ifdef TIL_SSE_INTRINSICS
+    const auto needle = _mm_set1_epi16(wch);
+    for (; end - beg >= 8; beg += 8)
+    {
+        const auto haystack = _mm_loadu_si128(reinterpret_cast<const __m128i*>(beg));
+        const auto mask = _mm_movemask_epi8(_mm_cmpeq_epi16(haystack, needle));
+        if (mask)
+        {
+            unsigned long offset;
+            _BitScanForward(&offset, mask);
+            return beg + offset / 2;
+        }
+    }
+#endif
+    for (; beg != end; ++beg)
+    {
+        if (*beg == wch)
+        {
+            return beg;
+        }
+    }
+    return end;
+#pragma warning(pop)
+}
+
+// Exact-match literal search used by SearchText() for case-sensitive ASCII needles.
+// It walks the ROW text storage directly instead of going through the ICU UText bridge.
+// Rows are treated as one contiguous stream of text, just like ICU::UTextFromTextBuffer()
+// presents them, so matches may span row boundaries. To handle that, `haystack` always
+// starts with the trailing needle-length-minus-1 characters of the preceding rows, and
+// `carryPositions` remembers which buffer position each of those characters came from.
+static void searchTextLiteral(const TextBuffer& textBuffer, const std::wstring_view& needle, const til::CoordType rowBeg, const til::CoordType rowEnd, std::vector<til::point_span>& results)
+{
+    struct CarriedChar
+    {
+        til::CoordType y;
+        ptrdiff_t charOffset;
+    };
+
+    const auto needleLen = needle.size();
+    const auto carryCapacity = needleLen - 1;
+    std::wstring haystack;
+    std::vector<CarriedChar> carryPositions;
+
+    for (auto y = rowBeg; y < rowEnd; ++y)
+    {
+        const auto& row = textBuffer.GetRowByOffset(y);
+        const auto carrySize = carryPositions.size();
+
+        haystack.resize(carrySize);
+        haystack.append(row.GetText());
+
+        if (haystack.size() >= needleLen)
+        {
+            const auto beg = haystack.data();
+            // The last possible match position leaves needleLen-1 characters after it.
+            const auto end = beg + haystack.size() - carryCapacity;
+
+            for (auto it = searchScanForChar(beg, end, needle.front()); it != end; it = searchScanForChar(it + 1, end, needle.front()))
+            {
+                if (memcmp(it, needle.data(), needleLen * sizeof(wchar_t)) != 0)
+                {
+                    continue;
+                }
+
+                const auto idx = gsl::narrow_cast<size_t>(it - beg);
+                const auto endIdx = idx + needleLen - 1;
+
+                // Matches that end inside the carry were already reported on a previous row.
+                if (endIdx < carrySize)
+                {
+                    continue;
+                }
+
+                auto& match = results.emplace_back();
+                if (idx >= carrySize)
+                {
+                    match.start = { row.GetLeadingColumnAtCharOffset(gsl::narrow_cast<ptrdiff_t>(idx - carrySize)), y };
+                }
+                else
+                {
+                    const auto& c = til::at(carryPositions, idx);
+                    match.start = { textBuffer.GetRowByOffset(c.y).GetLeadingColumnAtCharOffset(c.charOffset), c.y };
+                }
+                match.end = { row.GetTrailingColumnAtCharOffset(gsl::narrow_cast<ptrdiff_t>(endIdx - carrySize)), y };
+            }
+        }
+
+        // Retain the trailing needleLen-1 characters of the stream, and where they came
+        // from, so that the next row can detect matches spanning the boundary.
+        const auto keep = std::min(carryCapacity, haystack.size());
+        std::vector<CarriedChar> newPositions;
+        newPositions.reserve(keep);
+        for (auto i = haystack.size() - keep; i < haystack.size(); ++i)
+        {
+            if (i >= carrySize)
+            {
+                newPositions.push_back({ y, gsl::narrow_cast<ptrdiff_t>(i - carrySize) });
+            }
+            else
+            {
+                newPositions.push_back(til::at(carryPositions, i));
+            }
+        }
+        carryPositions = std::move(newPositions);
+        haystack.erase(0, haystack.size() - keep);
+    }
+}
+
 // Searches through the entire (committed) text buffer for `needle` and returns the coordinates in absolute coordinates.
 // The end coordinates of the returned ranges are considered inclusive.
 std::vector<til::point_span> TextBuffer::SearchText(const std::wstring_view& needle, bool caseInsensitive) const
@@ -2816,21 +3660,41 @@ std::vector<til::point_span> TextBuffer::SearchText(const std::wstring_view& nee
         return results;
     }
 
+    // Case-sensitive ASCII needles can't be affected by case folding, which allows us to
+    // skip the ICU UText bridge entirely and scan the row text storage directly.
+    // ICU remains responsible for case-insensitive and non-ASCII searches.
+    if (!caseInsensitive && std::all_of(needle.begin(), needle.end(), [](const auto& wch) { return wch < 0x80; }))
+    {
+        searchTextLiteral(*this, needle, rowBeg, rowEnd, results);
+        return results;
+    }
+
     auto text = ICU::UTextFromTextBuffer(*this, rowBeg, rowEnd);
 
     uint32_t flags = UREGEX_LITERAL;
     WI_SetFlagIf(flags, UREGEX_CASE_INSENSITIVE, caseInsensitive);
 
     UErrorCode status = U_ZERO_ERROR;
-    const auto re = ICU::CreateRegex(needle, flags, &status);
-    uregex_setUText(re.get(), &text, &status);
 
-    if (uregex_find(re.get(), -1, &status))
+    // Reuse the compiled pattern if the query hasn't changed. Incremental
+    // refreshes of an ongoing search (same needle, changed buffer) hit this
+    // on every call.
+    if (!_searchPatternCache.re || _searchPatternCache.flags != flags || _searchPatternCache.needle != needle)
+    {
+        _searchPatternCache.needle = needle;
+        _searchPatternCache.flags = flags;
+        _searchPatternCache.re = { ICU::CreateRegex(needle, flags, &status).release(), [](URegularExpression* re) { uregex_close(re); } };
+    }
+
+    const auto re = _searchPatternCache.re.get();
+    uregex_setUText(re, &text, &status);
+
+    if (uregex_find(re, -1, &status))
     {
         do
         {
-            results.emplace_back(ICU::BufferRangeFromMatch(&text, re.get()));
-        } while (uregex_findNext(re.get(), &status));
+            results.emplace_back(ICU::BufferRangeFromMatch(&text, re));
+        } while (uregex_findNext(re, &status));
     }
 
     return results;
@@ -2838,14 +3702,24 @@ std::vector<til::point_span> TextBuffer::SearchText(const std::wstring_view& nee
 
 const std::vector<ScrollMark>& TextBuffer::GetMarks() const noexcept
 {
+    _flushMarkShift();
     return _marks;
 }
 
+// Returns true if we have any marks at all. Doesn't flush a pending scroll
+// shift - shifting changes where the marks are, not whether there are any - so
+// this stays cheap enough to probe on every buffer rotation.
+bool TextBuffer::HasMarks() const noexcept
+{
+    return !_marks.empty();
+}
+
 // Remove all marks between `start` & `end`, inclusive.
 void TextBuffer::ClearMarksInRange(
     const til::point start,
     const til::point end)
 {
+    _flushMarkShift();
     auto inRange = [&start, &end](const ScrollMark& m) {
         return (m.start >= start && m.start <= end) ||
                (m.end >= start && m.end <= end);
@@ -2859,6 +3733,7 @@ void TextBuffer::ClearMarksInRange(
 void TextBuffer::ClearAllMarks() noexcept
 {
     _marks.clear();
+    _markShift = 0;
 }
 
 // Adjust all the marks in the y-direction by `delta`. Positive values move the
@@ -2866,6 +3741,23 @@ void TextBuffer::ClearAllMarks() noexcept
 // trim marks that are no longer have a start in the bounds of the buffer
 void TextBuffer::ScrollMarks(const int delta)
 {
+    // The actual adjustment is deferred - with shell integration emitting a
+    // mark per prompt, rewriting tens of thousands of marks on every scrolled
+    // row would dominate the rotation path. The accumulated shift is applied
+    // in one batched pass by _flushMarkShift.
+    _markShift += delta;
+}
+
+// Applies any deferred scroll adjustment to the marks, then trims the ones
+// whose start no longer lies in the bounds of the buffer.
+void TextBuffer::_flushMarkShift() const noexcept
+{
+    const auto delta = std::exchange(_markShift, 0);
+    if (delta == 0)
+    {
+        return;
+    }
+
     for (auto& mark : _marks)
     {
         mark.start.y += delta;
@@ -2880,7 +3772,11 @@ void TextBuffer::ScrollMarks(const int delta)
             (*mark.outputEnd).y += delta;
         }
     }
-    _trimMarksOutsideBuffer();
+
+    const til::CoordType height = _height;
+    std::erase_if(_marks, [height](const auto& m) {
+        return (m.start.y < 0) || (m.start.y >= height);
+    });
 }
 
 // Method Description:
@@ -2892,6 +3788,7 @@ void TextBuffer::ScrollMarks(const int delta)
 // - m: the mark to add.
 void TextBuffer::StartPromptMark(const ScrollMark& m)
 {
+    _flushMarkShift();
     _marks.push_back(m);
 }
 // Method Description:
@@ -2903,11 +3800,13 @@ void TextBuffer::StartPromptMark(const ScrollMark& m)
 // - m: the mark to add.
 void TextBuffer::AddMark(const ScrollMark& m)
 {
+    _flushMarkShift();
     _marks.insert(_marks.begin(), m);
 }
 
 void TextBuffer::_trimMarksOutsideBuffer()
 {
+    _flushMarkShift();
     const til::CoordType height = _height;
     std::erase_if(_marks, [height](const auto& m) {
         return (m.start.y < 0) || (m.start.y >= height);
@@ -2916,6 +3815,7 @@ void TextBuffer::_trimMarksOutsideBuffer()
 
 std::wstring_view TextBuffer::CurrentCommand() const
 {
+    _flushMarkShift();
     if (_marks.size() == 0)
     {
         return L"";
@@ -2932,6 +3832,7 @@ std::wstring_view TextBuffer::CurrentCommand() const
 
 void TextBuffer::SetCurrentPromptEnd(const til::point pos) noexcept
 {
+    _flushMarkShift();
     if (_marks.empty())
     {
         return;
@@ -2941,6 +3842,7 @@ void TextBuffer::SetCurrentPromptEnd(const til::point pos) noexcept
 }
 void TextBuffer::SetCurrentCommandEnd(const til::point pos) noexcept
 {
+    _flushMarkShift();
     if (_marks.empty())
     {
         return;
@@ -2950,6 +3852,7 @@ void TextBuffer::SetCurrentCommandEnd(const til::point pos) noexcept
 }
 void TextBuffer::SetCurrentOutputEnd(const til::point pos, ::MarkCategory category) noexcept
 {
+    _flushMarkShift();
     if (_marks.empty())
     {
         return;
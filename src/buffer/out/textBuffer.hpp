@@ -126,6 +126,20 @@ public:
     const ROW& GetRowByOffset(til::CoordType index) const;
     ROW& GetMutableRowByOffset(til::CoordType index);
 
+    // Contiguous views into a single row's backing storage, for bulk readers
+    // that want to copy whole rows without going through per-cell iterators.
+    struct RowSpanView
+    {
+        // The row's full text.
+        std::wstring_view chars;
+        // Per-column offsets into chars, plus a past-the-end entry at index width.
+        // See ROW::CharOffsets() for the CharOffsetsTrailer semantics.
+        std::span<const uint16_t> charOffsets;
+        // The row's attribute runs (1 decompressed TextAttribute per column).
+        const til::small_rle<TextAttribute, uint16_t, 1>* attrs = nullptr;
+    };
+    RowSpanView GetRowSpanView(til::CoordType row) const;
+
     TextBufferCellIterator GetCellDataAt(const til::point at) const;
     TextBufferCellIterator GetCellLineDataAt(const til::point at) const;
     TextBufferCellIterator GetCellDataAt(const til::point at, const Microsoft::Console::Types::Viewport limit) const;
@@ -144,6 +158,7 @@ public:
     // Text insertion functions
     void Write(til::CoordType row, const TextAttribute& attributes, RowWriteState& state);
     void FillRect(const til::rect& rect, const std::wstring_view& fill, const TextAttribute& attributes);
+    void CopyRect(const til::rect& source, const til::point targetOrigin);
 
     OutputCellIterator Write(const OutputCellIterator givenIt);
 
@@ -172,6 +187,33 @@ public:
     uint64_t GetLastMutationId() const noexcept;
     const til::CoordType GetFirstRowIndex() const noexcept;
 
+    struct DirtyRowSpan
+    {
+        til::CoordType beg = 0; // inclusive
+        til::CoordType end = 0; // exclusive
+        // How many rows the buffer contents moved up (via IncrementCircularBuffer) in that time.
+        til::CoordType scrollDelta = 0;
+    };
+    std::optional<DirtyRowSpan> TakeDirtyRowSpan(uint64_t sinceMutationId) const noexcept;
+    bool HasDirtyRowSpan(uint64_t sinceMutationId) const noexcept;
+
+    // A breakdown of the buffer's actual memory consumption, as opposed to
+    // the estimate-from-geometry that external tools have to resort to.
+    struct MemoryUsage
+    {
+        size_t slabBytes = 0; // committed row slabs (ROW headers, chars, offsets), incl. spill-backed ones
+        size_t coldSlabBytes = 0; // compressed cold slabs
+        size_t charsHeapBytes = 0; // per-row overflow allocations for text wider than the slab slot
+        size_t attrRunBytes = 0; // run-length-encoded attribute storage, incl. the inline run
+        size_t hyperlinkBytes = 0; // hyperlink map payloads (URIs and ids; table overhead not included)
+
+        size_t Total() const noexcept
+        {
+            return slabBytes + coldSlabBytes + charsHeapBytes + attrRunBytes + hyperlinkBytes;
+        }
+    };
+    MemoryUsage GetMemoryUsage() const noexcept;
+
     const Microsoft::Console::Types::Viewport GetSize() const noexcept;
 
     void ScrollRows(const til::CoordType firstRow, const til::CoordType size, const til::CoordType delta);
@@ -195,6 +237,10 @@ public:
 
     void Reset() noexcept;
 
+    void EnableColdScrollbackSpill() noexcept;
+    void SpillRowsOutsideWindow(til::CoordType hotFirst, til::CoordType hotLast) noexcept;
+    void CompressRowsOutsideWindow(til::CoordType hotFirst, til::CoordType hotLast);
+
     void ResizeTraditional(const til::size newSize);
 
     void SetAsActiveBuffer(const bool isActiveBuffer) noexcept;
@@ -228,6 +274,7 @@ public:
     void RemoveHyperlinkFromMap(uint16_t id) noexcept;
     std::wstring GetCustomIdFromId(uint16_t id) const;
     void CopyHyperlinkMaps(const TextBuffer& OtherBuffer);
+    void ClearHyperlinkMaps() noexcept;
 
     class TextAndColor
     {
@@ -263,12 +310,32 @@ public:
         til::CoordType visibleViewportTop{ 0 };
     };
 
+    // Tracks the progress of an incremental reflow between two buffers.
+    // Produced by BeginReflow() and advanced by ReflowChunk(). The referenced
+    // buffers (and positionInfo, if any) must outlive the cursor.
+    struct ReflowCursor
+    {
+        PositionInformation* positionInfo = nullptr;
+        til::point oldCursorPos;
+        til::point newCursorPos;
+        til::CoordType mutableViewportTop = til::CoordTypeMax;
+        til::CoordType visibleViewportTop = til::CoordTypeMax;
+        til::CoordType oldY = 0;
+        til::CoordType newY = 0;
+        til::CoordType newX = 0;
+        til::CoordType newYLimit = til::CoordTypeMax;
+        til::CoordType oldHeight = 0;
+    };
+
     static void Reflow(TextBuffer& oldBuffer, TextBuffer& newBuffer, const Microsoft::Console::Types::Viewport* lastCharacterViewport = nullptr, PositionInformation* positionInfo = nullptr);
+    static ReflowCursor BeginReflow(TextBuffer& oldBuffer, const Microsoft::Console::Types::Viewport* lastCharacterViewport = nullptr, PositionInformation* positionInfo = nullptr);
+    static bool ReflowChunk(TextBuffer& oldBuffer, TextBuffer& newBuffer, ReflowCursor& cursor, til::CoordType maxOldRows);
 
     std::vector<til::point_span> SearchText(const std::wstring_view& needle, bool caseInsensitive) const;
     std::vector<til::point_span> SearchText(const std::wstring_view& needle, bool caseInsensitive, til::CoordType rowBeg, til::CoordType rowEnd) const;
 
     const std::vector<ScrollMark>& GetMarks() const noexcept;
+    bool HasMarks() const noexcept;
     void ClearMarksInRange(const til::point start, const til::point end);
     void ClearAllMarks() noexcept;
     void ScrollMarks(const int delta);
@@ -281,9 +348,13 @@ public:
 
 private:
     void _reserve(til::size screenBufferSize, const TextAttribute& defaultAttributes);
-    void _commit(const std::byte* row);
+    void _commit(size_t slab);
+    void _allocateSlabMemory(Slab& slab, size_t index, size_t slabSize);
+    void _constructSlabRows(Slab& slab, size_t index) noexcept;
+    wil::unique_mapview_ptr<std::byte> _mapSpillSlab(size_t slab, size_t slabSize);
+    void _compressSlab(size_t slab);
+    void _rehydrateSlab(size_t slab);
     void _decommit() noexcept;
-    void _construct(const std::byte* until) noexcept;
     void _destroy() const noexcept;
     ROW& _getRowByOffsetDirect(size_t offset);
     ROW& _getRow(til::CoordType y) const;
@@ -296,25 +367,43 @@ private:
     // Assist with maintaining proper buffer state for Double Byte character sequences
     void _PrepareForDoubleByteSequence(const DbcsAttribute dbcsAttribute);
     void _ExpandTextRow(til::inclusive_rect& selectionRow) const;
+    // One run of identically-classified columns within a row.
+    struct DelimiterRun
+    {
+        uint16_t beg = 0; // first column of the run
+        DelimiterClass cls = DelimiterClass::ControlChar;
+    };
+
     DelimiterClass _GetDelimiterClassAt(const til::point pos, const std::wstring_view wordDelimiters) const;
+    const std::vector<DelimiterRun>& _GetDelimiterRunsForRow(const til::CoordType row, const std::wstring_view wordDelimiters) const;
+    static size_t _delimiterRunIndex(const std::vector<DelimiterRun>& runs, const til::CoordType col) noexcept;
     til::point _GetWordStartForAccessibility(const til::point target, const std::wstring_view wordDelimiters) const;
     til::point _GetWordStartForSelection(const til::point target, const std::wstring_view wordDelimiters) const;
     til::point _GetWordEndForAccessibility(const til::point target, const std::wstring_view wordDelimiters, const til::point limit) const;
     til::point _GetWordEndForSelection(const til::point target, const std::wstring_view wordDelimiters) const;
     void _PruneHyperlinks();
+    void _flushMarkShift() const noexcept;
     void _trimMarksOutsideBuffer();
 
-    static void _AppendRTFText(std::ostringstream& contentBuilder, const std::wstring_view& text);
+    static void _AppendRTFText(std::string& contentBuilder, const std::wstring_view& text);
 
     Microsoft::Console::Render::Renderer& _renderer;
 
     std::unordered_map<uint16_t, std::wstring> _hyperlinkMap;
     std::unordered_map<std::wstring, uint16_t> _hyperlinkCustomIdMap;
+    // Interns anonymous (no custom id) links: the same URI always maps to the same id.
+    std::unordered_map<std::wstring, uint16_t> _hyperlinkUriMap;
+    // The most recently requested link, so that tools which re-emit the same
+    // OSC 8 for every cell don't hash and probe the maps over and over.
+    std::wstring _lastHyperlinkUri;
+    std::wstring _lastHyperlinkCustomId;
+    uint16_t _lastHyperlinkId = 0;
     uint16_t _currentHyperlinkId = 1;
 
-    // This block describes the state of the underlying virtual memory buffer that holds all ROWs, text and attributes.
-    // Initially memory is only allocated with MEM_RESERVE to reduce the private working set of conhost.
-    // ROWs are laid out like this in memory:
+    // This block describes the state of the virtual memory that holds all ROWs, text and attributes.
+    // Rows are stored in a list of fixed-size slabs rather than one contiguous arena, so the
+    // scrollback can grow one slab at a time and a slab never moves once it's been handed out.
+    // Within a slab, each ROW is laid out like this in memory:
     //   ROW                <-- sizeof(ROW), stores
     //   (padding)
     //   ROW::_charsBuffer  <-- _width * sizeof(wchar_t)
@@ -324,34 +413,59 @@ private:
     //   ...
     // Padding may exist for alignment purposes.
     //
-    // The base (start) address of the memory arena.
-    wil::unique_virtualalloc_ptr<std::byte> _buffer;
-    // The past-the-end pointer of the memory arena.
-    std::byte* _bufferEnd = nullptr;
-    // The range between _buffer (inclusive) and _commitWatermark (exclusive) is the range of
-    // memory that has already been committed via MEM_COMMIT and contains ready-to-use ROWs.
-    //
-    // The problem is that calling VirtualAlloc(MEM_COMMIT) on each ROW one by one is extremely expensive, which forces
-    // us to commit ROWs in batches and avoid calling it on already committed ROWs. Let's say we commit memory in
-    // batches of 128 ROWs. One option to know whether a ROW has already been committed is to allocate a vector<uint8_t>
-    // of size `(height + 127) / 128` and mark the corresponding slot as 1 if that 128-sized batch has been committed.
-    // That way we know not to commit it again. But ROWs aren't accessed randomly. Instead, they're usually accessed
-    // fairly linearly from row 1 to N. As such we can just commit ROWs up to the point of the highest accessed ROW
-    // plus some read-ahead of 128 ROWs. This is exactly what _commitWatermark stores: The highest accessed ROW plus
-    // some read-ahead. It's the amount of memory that has been committed and is ready to use.
-    //
-    // _commitWatermark will always be a multiple of _bufferRowStride away from _buffer.
-    // In other words, _commitWatermark itself will either point exactly onto the next ROW
-    // that should be committed or be equal to _bufferEnd when all ROWs are committed.
-    std::byte* _commitWatermark = nullptr;
-    // This will MEM_COMMIT 128 rows more than we need, to avoid us from having to call VirtualAlloc too often.
-    // This equates to roughly the following commit chunk sizes at these column counts:
-    // *  80 columns (the usual minimum) =  60KB chunks,  4.1MB buffer at 9001 rows
-    // * 120 columns (the most common)   =  80KB chunks,  5.6MB buffer at 9001 rows
-    // * 400 columns (the usual maximum) = 220KB chunks, 15.5MB buffer at 9001 rows
-    // There's probably a better metric than this. (This comment was written when ROW had both,
-    // a _chars array containing text and a _charOffsets array contain column-to-text indices.)
-    static constexpr size_t _commitReadAheadRowCount = 128;
+    // A slab is backed either by regular (pagefile-backed) virtual memory, or — once
+    // EnableColdScrollbackSpill() has been called — by a view of the on-disk spill file.
+    // Spilled slabs behave exactly like regular ones: a cold page that was written out
+    // faults straight back in when one of its ROWs is accessed.
+    struct Slab
+    {
+        wil::unique_virtualalloc_ptr<std::byte> alloc;
+        wil::unique_mapview_ptr<std::byte> view;
+        // The serialized form of a compressed cold slab (see _compressSlab()).
+        // While this is set, alloc and view are empty and the slab holds no live ROWs.
+        std::unique_ptr<std::vector<std::byte>> cold;
+
+        std::byte* get() const noexcept
+        {
+            return alloc ? alloc.get() : view.get();
+        }
+        void reset() noexcept
+        {
+            alloc.reset();
+            view.reset();
+            cold.reset();
+        }
+    };
+
+    // _slabs is sized for the full buffer height up front, but the backing memory of each slab
+    // is only allocated on first access (see _commit()). Calling VirtualAlloc on each ROW one
+    // by one would be extremely expensive, and ROWs are usually accessed fairly linearly from
+    // row 1 to N, so slabs are committed strictly in ascending order: the prefix
+    // [0, _committedSlabs) is exactly the set of slabs whose ROWs have been constructed.
+    std::vector<Slab> _slabs;
+    // The number of slabs at the start of _slabs that are backed by committed memory.
+    size_t _committedSlabs = 0;
+    // Each slab holds this many ROWs together with their text and offset buffers.
+    // This equates to roughly the following slab sizes at these column counts:
+    // *  80 columns (the usual minimum) =  60KB slabs
+    // * 120 columns (the most common)   =  80KB slabs
+    // * 400 columns (the usual maximum) = 220KB slabs
+    static constexpr size_t _rowsPerSlab = 128;
+    // Backing file for spilled cold scrollback. Created lazily by the first slab commit after
+    // EnableColdScrollbackSpill(). The file is temporary and delete-on-close.
+    wil::unique_hfile _spillFile;
+    // Whether newly committed slabs should be backed by _spillFile instead of anonymous memory.
+    bool _spillEnabled = false;
+    // Arena that backs all ROW overflow ("charsHeap") allocations. Rows that need more
+    // than a slab slot's worth of text (surrogate pairs, combining marks, etc.) allocate
+    // from this pool instead of the general purpose heap, so CJK-heavy workloads don't
+    // fragment it with millions of small blocks. The pool recycles freed blocks when rows
+    // are reset and releases everything as one unit on buffer teardown.
+    // Held by pointer so the resource survives the member extraction in ResizeTraditional().
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> _charsPool;
+    // File mapping views must be placed at offsets that are a multiple of the allocation
+    // granularity, so slabs are laid out in the spill file with a stride rounded up to 64KiB.
+    static constexpr size_t _spillAllocationGranularity = 0x10000;
     // Before TextBuffer was made to use virtual memory it initialized the entire memory arena with the initial
     // attributes right away. To ensure it continues to work the way it used to, this stores these initial attributes.
     TextAttribute _initialAttributes;
@@ -373,8 +487,49 @@ private:
     til::CoordType _firstRow = 0; // indexes top row (not necessarily 0)
     uint64_t _lastMutationId = 0;
 
+    // Incremental-search bookkeeping: the aggregated range of rows that were handed out
+    // mutably since _dirtyTrackingBase, plus how often the circular buffer advanced in
+    // that time. There's exactly one aggregate, so only a single consumer at a time can
+    // profit from it; everyone else falls back to a full re-scan. The members are
+    // mutable because claiming the aggregate (TakeDirtyRowSpan) doesn't change any
+    // observable buffer contents.
+    mutable uint64_t _dirtyTrackingBase = 0;
+    mutable til::CoordType _dirtyRowBeg = til::CoordTypeMax;
+    mutable til::CoordType _dirtyRowEnd = 0;
+    mutable til::CoordType _dirtyScrollDelta = 0;
+
+    // Lazily-built per-row delimiter run arrays, shared by double-click selection
+    // expansion and UIA word navigation so that repeated boundary queries against an
+    // unchanged row are array lookups. The whole cache is discarded whenever the
+    // buffer mutates (keyed off _lastMutationId) or the delimiter set changes. It's
+    // mutable because classification doesn't change any observable buffer contents.
+    mutable struct
+    {
+        uint64_t mutationId = UINT64_MAX;
+        std::wstring delimiters;
+        std::unordered_map<til::CoordType, std::vector<DelimiterRun>> rows;
+    } _delimiterRunCache;
+
+    // The most recently compiled search pattern (see SearchText). Compiling the
+    // ICU pattern costs far more than matching it over a handful of rows, and
+    // find-as-you-type reruns the same needle for every incremental refresh. It's
+    // mutable because reusing the matcher doesn't change any observable buffer
+    // contents; access is serialized by the console/terminal lock like all other
+    // search state.
+    mutable struct
+    {
+        std::wstring needle;
+        uint32_t flags = 0;
+        std::unique_ptr<URegularExpression, void (*)(URegularExpression*)> re{ nullptr, nullptr };
+    } _searchPatternCache;
+
     Cursor _cursor;
-    std::vector<ScrollMark> _marks;
+    // When the buffer circles, every mark moves by the same amount. Rather
+    // than touching each of them per recycled row, the shift accumulates in
+    // _markShift and is applied in one pass the next time the marks are read
+    // or mutated. Mutable, because the flush happens from const accessors.
+    mutable std::vector<ScrollMark> _marks;
+    mutable til::CoordType _markShift = 0;
     bool _isActiveBuffer = false;
 
 #ifdef UNIT_TESTING
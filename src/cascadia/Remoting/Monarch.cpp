@@ -99,10 +99,19 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             peasant.HideNotificationIconRequested([this](auto&&, auto&&) { _HideNotificationIconRequestedHandlers(*this, nullptr); });
             peasant.QuitAllRequested({ this, &Monarch::_handleQuitAll });
 
+            // Record the peasant's window name in our registry. This is the
+            // only cross-process name query we make for it - renames and
+            // closes keep the registry current from here on.
+            const auto windowName = peasant.WindowName();
+
             {
                 std::unique_lock lock{ _peasantsMutex };
                 _peasants[newPeasantsId] = peasant;
             }
+            {
+                std::unique_lock lock{ _windowNamesMutex };
+                _windowNames[newPeasantsId] = windowName;
+            }
 
             TraceLoggingWrite(g_hRemotingProvider,
                               "Monarch_AddPeasant",
@@ -207,6 +216,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             std::unique_lock lock{ _peasantsMutex };
             _peasants.erase(peasantId);
         }
+        _forgetWindowNames({ peasantId });
         _WindowClosedHandlers(nullptr, nullptr);
     }
 
@@ -276,6 +286,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 std::unique_lock lock{ _peasantsMutex };
                 _peasants.erase(peasantID);
             }
+            _forgetWindowNames({ peasantID });
 
             if (clearMruPeasantOnFailure)
             {
@@ -309,8 +320,48 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
 
         uint64_t result = 0;
 
+        // Check our name registry first. In the happy path this resolves the
+        // name with a single cross-process call (to confirm the peasant is
+        // alive and really has that name), instead of asking every peasant for
+        // its name in turn.
+        uint64_t registeredId = 0;
+        {
+            std::shared_lock lock{ _windowNamesMutex };
+            for (const auto& [id, registeredName] : _windowNames)
+            {
+                if (registeredName == name)
+                {
+                    registeredId = id;
+                    break;
+                }
+            }
+        }
+        if (registeredId != 0)
+        {
+            try
+            {
+                const auto peasant{ _getPeasant(registeredId) };
+                if (peasant && peasant.WindowName() == name)
+                {
+                    return registeredId;
+                }
+            }
+            CATCH_LOG();
+            // The registry was stale for this peasant (it died, or was renamed
+            // behind our back). Fall through to the full scan, which will
+            // refresh it.
+        }
+
         const auto callback = [&](const auto& id, const auto& p) {
             auto otherName = p.WindowName();
+
+            // Refresh the registry with whatever we learned, so the next
+            // lookup takes the fast path again.
+            {
+                std::unique_lock lock{ _windowNamesMutex };
+                _windowNames[id] = otherName;
+            }
+
             if (otherName == name)
             {
                 result = id;
@@ -338,6 +389,37 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return result;
     }
 
+    // Method Description:
+    // - Looks up the registered window name for the given peasant, without any
+    //   cross-process calls.
+    // Arguments:
+    // - peasantID: The ID of the peasant to get the name of
+    // Return Value:
+    // - the name we have on record for that peasant, or an empty string if we
+    //   don't know about them.
+    winrt::hstring Monarch::_lookupWindowName(const uint64_t peasantID)
+    {
+        std::shared_lock lock{ _windowNamesMutex };
+        const auto search = _windowNames.find(peasantID);
+        return search == _windowNames.end() ? winrt::hstring{} : search->second;
+    }
+
+    // Method Description:
+    // - Removes the given peasants from our window name registry. Called
+    //   whenever peasants are removed from _peasants.
+    // Arguments:
+    // - peasantIds: The set of peasant IDs to forget the names of
+    // Return Value:
+    // - <none>
+    void Monarch::_forgetWindowNames(const std::unordered_set<uint64_t>& peasantIds)
+    {
+        std::unique_lock lock{ _windowNamesMutex };
+        for (const auto& id : peasantIds)
+        {
+            _windowNames.erase(id);
+        }
+    }
+
     // Method Description:
     // - Handler for the `Peasant::WindowActivated` event. We'll make a in-proc
     //   copy of the WindowActivatedArgs from the peasant. That way, we won't
@@ -555,7 +637,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 continue;
             }
 
-            if (ignoreQuakeWindow && peasant.WindowName() == QuakeWindowName)
+            if (ignoreQuakeWindow && _lookupWindowName(mruWindowArgs.PeasantID()) == QuakeWindowName)
             {
                 // The _quake window should never be treated as the MRU window.
                 // Skip it if we see it. Users can still target it with `wt -w
@@ -841,7 +923,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     //   indicating if the request was successful.
     // Return Value:
     // - <none>
-    void Monarch::_renameRequested(const winrt::Windows::Foundation::IInspectable& /*sender*/,
+    void Monarch::_renameRequested(const winrt::Windows::Foundation::IInspectable& sender,
                                    const winrt::Microsoft::Terminal::Remoting::RenameRequestArgs& args)
     {
         auto successfullyRenamed = false;
@@ -858,6 +940,15 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 // be renamed.
                 args.Succeeded(true);
                 successfullyRenamed = true;
+
+                // Update our name registry - the requestor will apply this
+                // name as soon as we return.
+                if (const auto peasant{ sender.try_as<Remoting::IPeasant>() })
+                {
+                    const auto senderId = peasant.GetID();
+                    std::unique_lock lock{ _windowNamesMutex };
+                    _windowNames[senderId] = name;
+                }
             }
 
             TraceLoggingWrite(g_hRemotingProvider,
@@ -128,9 +128,18 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         std::shared_mutex _peasantsMutex{};
         std::shared_mutex _mruPeasantsMutex{};
 
+        // Our in-proc registry of the peasants' window names, maintained from
+        // the notifications we already receive (add, rename, close). Window
+        // lookups and glomming decisions read this map instead of making a
+        // cross-process WindowName() call per peasant.
+        std::unordered_map<uint64_t, winrt::hstring> _windowNames;
+        std::shared_mutex _windowNamesMutex{};
+
         winrt::Microsoft::Terminal::Remoting::IPeasant _getPeasant(uint64_t peasantID, bool clearMruPeasantOnFailure = true);
         uint64_t _getMostRecentPeasantID(bool limitToCurrentDesktop, const bool ignoreQuakeWindow);
         uint64_t _lookupPeasantIdForName(std::wstring_view name);
+        winrt::hstring _lookupWindowName(uint64_t peasantID);
+        void _forgetWindowNames(const std::unordered_set<uint64_t>& peasantIds);
 
         void _peasantWindowActivated(const winrt::Windows::Foundation::IInspectable& sender,
                                      const winrt::Microsoft::Terminal::Remoting::WindowActivatedArgs& args);
@@ -220,6 +229,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                     }
                 }
                 _clearOldMruEntries(peasantsToErase);
+                _forgetWindowNames(peasantsToErase);
 
                 // A peasant died, let the app host know that the number of
                 // windows has changed.
@@ -48,6 +48,31 @@ namespace
         }
         return Monarch_clsid;
     }
+
+    // The class name of the message-only window the monarch creates to accept
+    // commandline handoffs over WM_COPYDATA. Embedding the monarch CLSID makes
+    // the class unique per install, for exactly the same reasons the CLSID
+    // itself is.
+    const std::wstring& HandoffWindowClassName()
+    {
+        static std::wstring className = L"Windows Terminal Handoff " + Utils::GuidToString(MonarchCLSID());
+        return className;
+    }
+
+    // WM_COPYDATA blocks tagged with this dwData carry a serialized
+    // CommandlineArgs: a HandoffCommandlineHeader, followed by (argc + 2)
+    // strings - the arguments, then the current working directory, then the
+    // environment block - each encoded as a uint32_t character count followed
+    // by that many wchar_t's.
+    constexpr ULONG_PTR HandoffCopyDataId = 0x7774636c; // 'wtcl'
+    constexpr uint32_t HandoffCommandlineVersion = 1;
+
+    struct HandoffCommandlineHeader
+    {
+        uint32_t version;
+        uint32_t showWindowCommand;
+        uint32_t argc;
+    };
 }
 
 namespace winrt::Microsoft::Terminal::Remoting::implementation
@@ -121,6 +146,19 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     {
         if (!isolatedMode)
         {
+            // Before doing any COM work at all, try handing the commandline to
+            // an existing monarch over a plain window message. That's
+            // dramatically cheaper than a WinRT activation, which matters when
+            // a script is driving `wt` in a loop.
+            if (_proposeViaWindowMessage(args))
+            {
+                // A monarch received the commandline. It'll run it in an
+                // existing window or make a new one, exactly like a successful
+                // _proposeToMonarch below. Either way, this process doesn't
+                // need to make a window.
+                return winrt::make<ProposeCommandlineResult>(false);
+            }
+
             // _createMonarch always attempts to connect an existing monarch. In
             // isolated mode, we don't want to do that.
             _createMonarch();
@@ -192,6 +230,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 {
                     _registerAsMonarch();
                     _createMonarch();
+                    _createHandoffWindow();
                 }
                 else
                 {
@@ -337,6 +376,196 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return false;
     }
 
+    // Method Description:
+    // - Attempt to hand our commandline to an existing monarch over
+    //   WM_COPYDATA, without any COM involved. For a `wt` invocation that
+    //   lands in an existing window, this is the entire cost of the handoff:
+    //   one window lookup and one (blocking) window message.
+    // - This can fail for plenty of legitimate reasons: there's no monarch
+    //   yet, the monarch is elevated and we aren't (UIPI filters the message),
+    //   or the monarch died between the lookup and the send. Callers fall
+    //   back to the COM path in all of those cases.
+    // Arguments:
+    // - args: the commandline to send to the monarch.
+    // Return Value:
+    // - true if a monarch received and handled the commandline.
+    bool WindowManager::_proposeViaWindowMessage(const Remoting::CommandlineArgs& args)
+    {
+        const auto target = FindWindowExW(HWND_MESSAGE, nullptr, HandoffWindowClassName().c_str(), nullptr);
+        if (!target)
+        {
+            return false;
+        }
+
+        const auto commandline = args.Commandline();
+        const auto cwd = args.CurrentDirectory();
+        const auto env = args.CurrentEnvironment();
+
+        const HandoffCommandlineHeader header{ HandoffCommandlineVersion,
+                                               args.ShowWindowCommand(),
+                                               gsl::narrow<uint32_t>(commandline.size()) };
+
+        std::vector<std::byte> buffer;
+        {
+            auto bytesNeeded = sizeof(header) + 2 * sizeof(uint32_t) + (cwd.size() + env.size()) * sizeof(wchar_t);
+            for (const auto& arg : commandline)
+            {
+                bytesNeeded += sizeof(uint32_t) + arg.size() * sizeof(wchar_t);
+            }
+            buffer.reserve(bytesNeeded);
+        }
+
+        auto append = [&](const void* data, const size_t size) {
+            const auto bytes = static_cast<const std::byte*>(data);
+            buffer.insert(buffer.end(), bytes, bytes + size);
+        };
+        auto appendString = [&](const std::wstring_view& str) {
+            const auto length = gsl::narrow<uint32_t>(str.size());
+            append(&length, sizeof(length));
+            append(str.data(), length * sizeof(wchar_t));
+        };
+
+        append(&header, sizeof(header));
+        for (const auto& arg : commandline)
+        {
+            appendString(arg);
+        }
+        appendString(cwd);
+        appendString(env);
+
+        COPYDATASTRUCT cds{};
+        cds.dwData = HandoffCopyDataId;
+        cds.cbData = gsl::narrow<DWORD>(buffer.size());
+        cds.lpData = buffer.data();
+
+        // Deliberately not SendMessageTimeout: if we gave up while the monarch
+        // was merely busy, it might still run the commandline later, after
+        // we've fallen back to the COM path and run it a second time. A plain
+        // send blocks exactly as long as the equivalent COM call would.
+        const auto handled = SendMessageW(target, WM_COPYDATA, 0, reinterpret_cast<LPARAM>(&cds));
+
+        TraceLoggingWrite(g_hRemotingProvider,
+                          "WindowManager_ProposeViaWindowMessage",
+                          TraceLoggingBoolean(handled == TRUE, "handled", "true if the monarch accepted the commandline"),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                          TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+
+        return handled == TRUE;
+    }
+
+    // Method Description:
+    // - Create the message-only window other wt processes use to hand us
+    //   their commandlines. Only called once we've registered as the monarch,
+    //   so a window that can't accept handoffs (isolated mode) never creates
+    //   one. We're on the window thread here, and it'll keep pumping messages
+    //   for as long as we're the monarch.
+    void WindowManager::_createHandoffWindow()
+    {
+        const auto& className = HandoffWindowClassName();
+
+        WNDCLASSEXW wc{};
+        wc.cbSize = sizeof(wc);
+        wc.lpfnWndProc = WindowManager::_handoffWndProc;
+        wc.hInstance = wil::GetModuleInstanceHandle();
+        wc.lpszClassName = className.c_str();
+        RegisterClassExW(&wc);
+
+        _handoffWindow.reset(CreateWindowExW(0,
+                                             className.c_str(),
+                                             nullptr,
+                                             0,
+                                             0,
+                                             0,
+                                             0,
+                                             0,
+                                             HWND_MESSAGE,
+                                             nullptr,
+                                             wil::GetModuleInstanceHandle(),
+                                             this));
+        LOG_LAST_ERROR_IF_NULL(_handoffWindow.get());
+    }
+
+    [[nodiscard]] LRESULT __stdcall WindowManager::_handoffWndProc(HWND const window, UINT const message, WPARAM const wparam, LPARAM const lparam) noexcept
+    {
+        if (message == WM_NCCREATE)
+        {
+            const auto cs = reinterpret_cast<CREATESTRUCTW*>(lparam);
+            SetWindowLongPtrW(window, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(cs->lpCreateParams));
+        }
+        else if (message == WM_COPYDATA)
+        {
+            if (const auto that = reinterpret_cast<WindowManager*>(GetWindowLongPtrW(window, GWLP_USERDATA)))
+            {
+                return that->_handleCopyData(reinterpret_cast<const COPYDATASTRUCT*>(lparam));
+            }
+            return FALSE;
+        }
+        return DefWindowProcW(window, message, wparam, lparam);
+    }
+
+    // Method Description:
+    // - Deserialize a commandline another process sent us over WM_COPYDATA
+    //   and hand it to our monarch, exactly as if it had arrived over COM.
+    // - The block comes from another process, so every read is bounds-checked
+    //   against cbData before we trust it.
+    // Arguments:
+    // - cds: the COPYDATASTRUCT the other process sent us.
+    // Return Value:
+    // - TRUE if we handled the commandline. FALSE tells the sender to fall
+    //   back to the COM path.
+    LRESULT WindowManager::_handleCopyData(const COPYDATASTRUCT* cds)
+    try
+    {
+        if (!_monarch || cds->dwData != HandoffCopyDataId || cds->cbData < sizeof(HandoffCommandlineHeader))
+        {
+            return FALSE;
+        }
+
+        const auto data = static_cast<const std::byte*>(cds->lpData);
+        const size_t size = cds->cbData;
+
+        HandoffCommandlineHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (header.version != HandoffCommandlineVersion)
+        {
+            return FALSE;
+        }
+
+        size_t offset = sizeof(header);
+        auto readString = [&]() {
+            uint32_t length = 0;
+            THROW_HR_IF(E_INVALIDARG, size - offset < sizeof(length));
+            memcpy(&length, data + offset, sizeof(length));
+            offset += sizeof(length);
+            THROW_HR_IF(E_INVALIDARG, (size - offset) / sizeof(wchar_t) < length);
+            winrt::hstring str{ std::wstring_view{ reinterpret_cast<const wchar_t*>(data + offset), length } };
+            offset += length * sizeof(wchar_t);
+            return str;
+        };
+
+        // Each argument takes at least a length prefix, so argc can't
+        // plausibly exceed the number of uint32_t's in the block.
+        THROW_HR_IF(E_INVALIDARG, header.argc > size / sizeof(uint32_t));
+
+        std::vector<winrt::hstring> commandline;
+        commandline.reserve(header.argc);
+        for (uint32_t i = 0; i < header.argc; ++i)
+        {
+            commandline.emplace_back(readString());
+        }
+        const auto cwd = readString();
+        const auto env = readString();
+
+        const Remoting::CommandlineArgs eventArgs{ { commandline }, cwd, header.showWindowCommand, env };
+        _monarch.ProposeCommandline(eventArgs);
+        return TRUE;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        return FALSE;
+    }
+
     Remoting::Peasant WindowManager::CreatePeasant(const Remoting::WindowRequestedArgs& args)
     {
         auto p = winrt::make_self<Remoting::implementation::Peasant>();
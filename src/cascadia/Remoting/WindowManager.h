@@ -59,11 +59,17 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     private:
         DWORD _registrationHostClass{ 0 };
         winrt::Microsoft::Terminal::Remoting::IMonarch _monarch{ nullptr };
+        wil::unique_hwnd _handoffWindow;
 
         void _createMonarch();
         void _registerAsMonarch();
 
         bool _proposeToMonarch(const Remoting::CommandlineArgs& args);
+        bool _proposeViaWindowMessage(const Remoting::CommandlineArgs& args);
+
+        void _createHandoffWindow();
+        LRESULT _handleCopyData(const COPYDATASTRUCT* cds);
+        [[nodiscard]] static LRESULT __stdcall _handoffWndProc(HWND const window, UINT const message, WPARAM const wparam, LPARAM const lparam) noexcept;
 
         void _createCallbacks();
         void _raiseFindTargetWindowRequested(const winrt::Windows::Foundation::IInspectable& sender,
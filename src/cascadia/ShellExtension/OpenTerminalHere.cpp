@@ -89,7 +89,10 @@ HRESULT OpenTerminalHere::GetTitle(IShellItemArray* /*psiItemArray*/,
 {
     // Change the string we return depending on if we're running from the dev
     // build package or not.
-    const auto resource =
+    // The branding is fixed at build time and the MRT resource lookup isn't
+    // free, while Explorer calls this on every right-click; resolve the string
+    // once per process.
+    static const auto resource =
 #if defined(WT_BRANDING_RELEASE)
         RS_(L"ShellExtension_OpenInTerminalMenuItem");
 #elif defined(WT_BRANDING_PREVIEW)
@@ -131,12 +134,17 @@ HRESULT OpenTerminalHere::GetIcon(IShellItemArray* /*psiItemArray*/,
                                   LPWSTR* ppszIcon)
 try
 {
-    std::filesystem::path modulePath{ wil::GetModuleFileNameW<std::wstring>(wil::GetModuleInstanceHandle()) };
-    modulePath.replace_filename(WindowsTerminalExe);
-    // WindowsTerminal.exe,-101 will be the first icon group in WT
-    // We're using WindowsTerminal here explicitly, and not wt (from GetWtExePath), because
-    // WindowsTerminal is the only one built with the right icons.
-    const auto resource{ modulePath.wstring() + L",-101" };
+    // The module path can't change for the lifetime of the process, so build
+    // the indirect icon string once. Explorer resolves it to actual icon bits
+    // itself, on its own schedule - we never load the icon here.
+    static const auto resource = []() {
+        std::filesystem::path modulePath{ wil::GetModuleFileNameW<std::wstring>(wil::GetModuleInstanceHandle()) };
+        modulePath.replace_filename(WindowsTerminalExe);
+        // WindowsTerminal.exe,-101 will be the first icon group in WT
+        // We're using WindowsTerminal here explicitly, and not wt (from GetWtExePath), because
+        // WindowsTerminal is the only one built with the right icons.
+        return modulePath.wstring() + L",-101";
+    }();
     return SHStrDupW(resource.c_str(), ppszIcon);
 }
 CATCH_RETURN();
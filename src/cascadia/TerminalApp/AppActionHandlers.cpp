@@ -1425,4 +1425,13 @@ namespace winrt::TerminalApp::implementation
         _ShowAboutDialog();
         args.Handled(true);
     }
+
+    void TerminalPage::_HandleDumpMemoryUsage(const IInspectable& /*sender*/,
+                                              const ActionEventArgs& args)
+    {
+        _ApplyToActiveControls([](auto& control) {
+            control.DumpMemoryUsage();
+        });
+        args.Handled(true);
+    }
 }
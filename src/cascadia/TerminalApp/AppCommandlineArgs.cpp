@@ -201,6 +201,8 @@ void AppCommandlineArgs::_buildParser()
                     _loadPersistedLayoutIdx,
                     RS_A(L"CmdSavedLayoutArgDesc"));
 
+    _app.add_flag("--startupTimes", _showStartupTimes, RS_A(L"CmdStartupTimesDesc"));
+
     // Subcommands
     _buildNewTabParser();
     _buildSplitPaneParser();
@@ -922,6 +924,18 @@ bool AppCommandlineArgs::ShouldExitEarly() const noexcept
     return _shouldExitEarly;
 }
 
+// Method Description:
+// - Returns true if the user passed `--startupTimes`, requesting that we
+//   display the per-phase startup time summary once the window is up.
+// Arguments:
+// - <none>
+// Return Value:
+// - true iff we should display the startup time summary
+bool AppCommandlineArgs::ShouldShowStartupTimes() const noexcept
+{
+    return _showStartupTimes;
+}
+
 // Method Description:
 // - Ensure that the first command in our list of actions is a NewTab action.
 //   This makes sure that if the user passes a commandline like "wt split-pane
@@ -1105,6 +1119,7 @@ void AppCommandlineArgs::FullResetState()
     _startupActions.clear();
     _exitMessage = "";
     _shouldExitEarly = false;
+    _showStartupTimes = false;
     _isHandoffListener = false;
 
     _windowTarget = {};
@@ -38,6 +38,7 @@ public:
     bool IsHandoffListener() const noexcept;
     const std::string& GetExitMessage();
     bool ShouldExitEarly() const noexcept;
+    bool ShouldShowStartupTimes() const noexcept;
 
     std::optional<uint32_t> GetPersistedLayoutIdx() const noexcept;
     std::optional<winrt::Microsoft::Terminal::Settings::Model::LaunchMode> GetLaunchMode() const noexcept;
@@ -131,6 +132,7 @@ private:
     std::vector<winrt::Microsoft::Terminal::Settings::Model::ActionAndArgs> _startupActions;
     std::string _exitMessage;
     bool _shouldExitEarly{ false };
+    bool _showStartupTimes{ false };
 
     int _loadPersistedLayoutIdx{};
     std::string _windowTarget{};
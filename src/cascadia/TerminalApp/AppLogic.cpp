@@ -85,6 +85,29 @@ static winrt::hstring _GetErrorText(SettingsLoadErrors error)
 
 static constexpr std::wstring_view StartupTaskName = L"StartTerminalOnLoginTask";
 
+// Function Description:
+// - Returns the time elapsed since this process was created, in FILETIME units
+//   (100ns). Startup phases are all stamped on this common timeline, so they
+//   can be compared across modules and threads.
+static uint64_t _timeSinceProcessCreation() noexcept
+{
+    static constexpr auto asInteger = [](const FILETIME& f) {
+        ULARGE_INTEGER i;
+        i.LowPart = f.dwLowDateTime;
+        i.HighPart = f.dwHighDateTime;
+        return i.QuadPart;
+    };
+
+    FILETIME creationTime, exitTime, kernelTime, userTime, now;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0;
+    }
+
+    GetSystemTimeAsFileTime(&now);
+    return asInteger(now) - asInteger(creationTime);
+}
+
 namespace winrt::TerminalApp::implementation
 {
     // Function Description:
@@ -191,6 +214,59 @@ namespace winrt::TerminalApp::implementation
             TraceLoggingBool(_settings.GlobalSettings().ShowTabsInTitlebar(), "TabsInTitlebar"),
             TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
             TelemetryPrivacyDataTag(PDT_ProductAndServiceUsage));
+
+        MarkStartupPhase(L"appCreated");
+    }
+
+    // Method Description:
+    // - Records that startup has reached a named phase. Each mark is stamped
+    //   with the time since process creation and emitted as its own
+    //   TraceLogging event, so fleet telemetry can aggregate startup time per
+    //   phase; the collected set also backs the `wt --startupTimes` summary.
+    // - Safe to call from any thread. AppHost and the window layer mark their
+    //   phases through the projection; a later window reusing this process
+    //   will add its phases to the same list.
+    // Arguments:
+    // - phase: a short, stable name for the phase that was just reached.
+    void AppLogic::MarkStartupPhase(const winrt::hstring& phase)
+    {
+        const auto elapsed = _timeSinceProcessCreation();
+
+        {
+            const std::scoped_lock guard{ _startupPhasesLock };
+            _startupPhases.emplace_back(phase, elapsed);
+        }
+
+        TraceLoggingWrite(
+            g_hTerminalAppProvider,
+            "StartupPhaseReached",
+            TraceLoggingDescription("Event emitted when startup reaches a named phase"),
+            TraceLoggingWideString(phase.c_str(), "Phase"),
+            TraceLoggingFloat32(elapsed * 1e-7f, "latency"),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+            TelemetryPrivacyDataTag(PDT_ProductAndServiceUsage));
+    }
+
+    // Method Description:
+    // - Renders the phases recorded by MarkStartupPhase into a human-readable
+    //   table, for the `wt --startupTimes` flag. Each line shows how long
+    //   after process creation the phase was reached, and the delta from the
+    //   previous phase.
+    // Return Value:
+    // - the summary text, one phase per line.
+    winrt::hstring AppLogic::StartupTimesSummary()
+    {
+        std::wstring summary{ L"Startup times, in milliseconds since process creation:" };
+
+        const std::scoped_lock guard{ _startupPhasesLock };
+        uint64_t previous = 0;
+        for (const auto& [phase, elapsed] : _startupPhases)
+        {
+            fmt::format_to(std::back_inserter(summary), L"\n{:>10.1f}  {}  (+{:.1f})", elapsed * 1e-4, std::wstring_view{ phase }, (elapsed - previous) * 1e-4);
+            previous = elapsed;
+        }
+
+        return winrt::hstring{ summary };
     }
 
     // Method Description:
@@ -410,6 +486,11 @@ namespace winrt::TerminalApp::implementation
         const auto initialLoad = !_loadedInitialSettings;
         _loadedInitialSettings = true;
 
+        if (initialLoad)
+        {
+            MarkStartupPhase(L"settingsLoaded");
+        }
+
         if (FAILED(_settingsLoadedResult))
         {
             if (initialLoad)
@@ -468,6 +549,8 @@ namespace winrt::TerminalApp::implementation
             return;
         }
 
+        MarkStartupPhase(L"rootInitialized");
+
         // Both LoadSettings and ReloadSettings are supposed to call this function,
         // but LoadSettings skips it, so that the UI starts up faster.
         // Now that the UI is present we can do them with a less significant UX impact.
@@ -665,6 +748,16 @@ namespace winrt::TerminalApp::implementation
         return _settings.GlobalSettings().AllowHeadless();
     }
 
+    bool AppLogic::ShowTabsInTitlebar()
+    {
+        if (!_loadedInitialSettings)
+        {
+            // Load settings if we haven't already
+            ReloadSettings();
+        }
+        return _settings.GlobalSettings().ShowTabsInTitlebar();
+    }
+
     TerminalApp::TerminalWindow AppLogic::CreateNewWindow()
     {
         if (_settings == nullptr)
@@ -67,6 +67,7 @@ namespace winrt::TerminalApp::implementation
         bool IsolatedMode();
         bool AllowHeadless();
         bool RequestsTrayIcon();
+        bool ShowTabsInTitlebar();
 
         TerminalApp::TerminalWindow CreateNewWindow();
 
@@ -74,6 +75,9 @@ namespace winrt::TerminalApp::implementation
 
         TerminalApp::ParseCommandlineResult GetParseCommandlineMessage(array_view<const winrt::hstring> args);
 
+        void MarkStartupPhase(const winrt::hstring& phase);
+        winrt::hstring StartupTimesSummary();
+
         TYPED_EVENT(SettingsChanged, winrt::Windows::Foundation::IInspectable, winrt::TerminalApp::SettingsLoadEventArgs);
 
     private:
@@ -90,6 +94,11 @@ namespace winrt::TerminalApp::implementation
         bool _hasSettingsStartupActions{ false };
         ::TerminalApp::AppCommandlineArgs _settingsAppArgs;
 
+        // See MarkStartupPhase. Marks come in from multiple threads (the
+        // emperor's main thread, window threads, and our own UI thread).
+        std::mutex _startupPhasesLock;
+        std::vector<std::pair<winrt::hstring, uint64_t>> _startupPhases;
+
         std::shared_ptr<ThrottledFuncTrailing<>> _reloadSettings;
         til::throttled_func_trailing<> _reloadState;
 
@@ -19,6 +19,32 @@ using namespace winrt::Microsoft::Terminal::Settings::Model;
 
 namespace winrt::TerminalApp::implementation
 {
+    // Lowercases the given text with the same locale-aware mapping the
+    // comparisons (lstrcmpi) have always used, so that the per-keystroke
+    // matching can run on plain character equality.
+    static std::wstring _foldText(const std::wstring_view text)
+    {
+        std::wstring folded{ text };
+        if (!folded.empty())
+        {
+            CharLowerBuffW(folded.data(), gsl::narrow_cast<DWORD>(folded.size()));
+        }
+        return folded;
+    }
+
+    // A coarse character-presence bitmap: one bit per folded character,
+    // modulo 64. If the filter sets a bit the name doesn't, no subsequence
+    // match is possible and the name scan can be skipped entirely.
+    static uint64_t _textBits(const std::wstring_view text) noexcept
+    {
+        uint64_t bits = 0;
+        for (const auto ch : text)
+        {
+            bits |= 1ull << (ch & 63);
+        }
+        return bits;
+    }
+
     // This class is a wrapper of PaletteItem, that is used as an item of a filterable list in CommandPalette.
     // It manages a highlighted text that is computed by matching search filter characters to item name
     FilteredCommand::FilteredCommand(const winrt::TerminalApp::PaletteItem& item) :
@@ -26,6 +52,7 @@ namespace winrt::TerminalApp::implementation
         _Filter(L""),
         _Weight(0)
     {
+        _updateNameCache();
         _HighlightedName = _computeHighlightedName();
 
         // Recompute the highlighted name if the item name changes
@@ -33,12 +60,19 @@ namespace winrt::TerminalApp::implementation
             auto filteredCommand{ weakThis.get() };
             if (filteredCommand && e.PropertyName() == L"Name")
             {
+                filteredCommand->_updateNameCache();
                 filteredCommand->HighlightedName(filteredCommand->_computeHighlightedName());
                 filteredCommand->Weight(filteredCommand->_computeWeight());
             }
         });
     }
 
+    void FilteredCommand::_updateNameCache()
+    {
+        _lowercaseName = _foldText(_Item.Name());
+        _nameBits = _textBits(_lowercaseName);
+    }
+
     void FilteredCommand::UpdateFilter(const winrt::hstring& filter)
     {
         // If the filter was not changed we want to prevent the re-computation of matching
@@ -74,13 +108,28 @@ namespace winrt::TerminalApp::implementation
     {
         const auto segments = winrt::single_threaded_observable_vector<winrt::TerminalApp::HighlightedTextSegment>();
         auto commandName = _Item.Name();
+
+        // The filter is a handful of keystrokes; fold it here rather than
+        // caching it, so the name cache is the only state to keep in sync.
+        const auto lowercaseFilter = _foldText(_Filter);
+        const auto filterBits = _textBits(lowercaseFilter);
+
+        // Bulk rejection straight off the precomputed index: if the filter
+        // contains any character class the name doesn't, there can be no
+        // subsequence match, so skip the scan (and all the segment churn)
+        // and report the entire name as unmatched.
+        if ((_nameBits & filterBits) != filterBits)
+        {
+            segments.Append(winrt::make<HighlightedTextSegment>(commandName, false));
+            return winrt::make<HighlightedText>(segments);
+        }
+
         auto isProcessingMatchedSegment = false;
         uint32_t nextOffsetToReport = 0;
         uint32_t currentOffset = 0;
 
-        for (const auto searchChar : _Filter)
+        for (const auto searchChar : lowercaseFilter)
         {
-            const WCHAR searchCharAsString[] = { searchChar, L'\0' };
             while (true)
             {
                 if (currentOffset == commandName.size())
@@ -93,10 +142,11 @@ namespace winrt::TerminalApp::implementation
                     return winrt::make<HighlightedText>(segments);
                 }
 
-                // GH#9941: search should be locale-aware as well
-                // We use the same comparison method as upon sorting to guarantee consistent behavior
-                const WCHAR currentCharAsString[] = { commandName[currentOffset], L'\0' };
-                auto isCurrentCharMatched = lstrcmpi(searchCharAsString, currentCharAsString) == 0;
+                // GH#9941: search should be locale-aware as well. Both the name
+                // and the filter were folded with the same locale mapping up
+                // front, so plain equality here behaves like the per-character
+                // lstrcmpi this used to do - minus the call per character.
+                const auto isCurrentCharMatched = til::at(_lowercaseName, currentOffset) == searchChar;
                 if (isProcessingMatchedSegment != isCurrentCharMatched)
                 {
                     // We reached the end of the region (matched character came after a series of unmatched or vice versa).
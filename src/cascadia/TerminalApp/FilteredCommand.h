@@ -32,8 +32,17 @@ namespace winrt::TerminalApp::implementation
     private:
         winrt::TerminalApp::HighlightedText _computeHighlightedName();
         int _computeWeight();
+        void _updateNameCache();
         Windows::UI::Xaml::Data::INotifyPropertyChanged::PropertyChanged_revoker _itemChangedRevoker;
 
+        // Precomputed per-item match index: the locale-folded (lowercased)
+        // item name and a coarse character-presence bitmap over it, refreshed
+        // when the item name changes. This keeps the per-keystroke scan on
+        // plain character equality with a cheap bulk rejection, instead of a
+        // locale comparison call per character per command.
+        std::wstring _lowercaseName;
+        uint64_t _nameBits = 0;
+
         friend class TerminalAppLocalTests::FilteredCommandTests;
     };
 }
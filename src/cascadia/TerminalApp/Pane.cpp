@@ -1989,7 +1989,22 @@ void Pane::_CreateRowColDefinitions()
     const auto second = 100.0f - first;
     if (_splitState == SplitState::Vertical)
     {
-        _root.ColumnDefinitions().Clear();
+        const auto cols = _root.ColumnDefinitions();
+
+        // If the grid already has our two columns, just move the split: a
+        // Width change invalidates layout once, while rebuilding the
+        // collection invalidates it for every removal and insertion. This is
+        // the path every step of a resize takes; the collection only needs
+        // rebuilding when the split orientation changes, and those callers
+        // clear the definitions first.
+        if (cols.Size() == 2)
+        {
+            cols.GetAt(0).Width(GridLengthHelper::FromValueAndType(first, GridUnitType::Star));
+            cols.GetAt(1).Width(GridLengthHelper::FromValueAndType(second, GridUnitType::Star));
+            return;
+        }
+
+        cols.Clear();
 
         // Create two columns in this grid: one for each pane
 
@@ -1999,12 +2014,21 @@ void Pane::_CreateRowColDefinitions()
         auto secondColDef = Controls::ColumnDefinition();
         secondColDef.Width(GridLengthHelper::FromValueAndType(second, GridUnitType::Star));
 
-        _root.ColumnDefinitions().Append(firstColDef);
-        _root.ColumnDefinitions().Append(secondColDef);
+        cols.Append(firstColDef);
+        cols.Append(secondColDef);
     }
     else if (_splitState == SplitState::Horizontal)
     {
-        _root.RowDefinitions().Clear();
+        const auto rows = _root.RowDefinitions();
+
+        if (rows.Size() == 2)
+        {
+            rows.GetAt(0).Height(GridLengthHelper::FromValueAndType(first, GridUnitType::Star));
+            rows.GetAt(1).Height(GridLengthHelper::FromValueAndType(second, GridUnitType::Star));
+            return;
+        }
+
+        rows.Clear();
 
         // Create two rows in this grid: one for each pane
 
@@ -2014,8 +2038,8 @@ void Pane::_CreateRowColDefinitions()
         auto secondRowDef = Controls::RowDefinition();
         secondRowDef.Height(GridLengthHelper::FromValueAndType(second, GridUnitType::Star));
 
-        _root.RowDefinitions().Append(firstRowDef);
-        _root.RowDefinitions().Append(secondRowDef);
+        rows.Append(firstRowDef);
+        rows.Append(secondRowDef);
     }
 }
 
@@ -3204,10 +3228,24 @@ void Pane::BroadcastKey(const winrt::Microsoft::Terminal::Control::TermControl&
                         const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers,
                         const bool keyDown)
 {
+    // Encode the event once, and hand the same bytes to every pane that would
+    // have produced them itself. The first pane written becomes the encoder;
+    // the sequence it translated the event into is offered to the remaining
+    // panes, which only accept it if their input-mode fingerprints match and
+    // nothing about their state needs the full per-event path. A pane that
+    // declines re-encodes the event for itself and takes over as the encoder,
+    // so a mix of modes still works - it just translates more often.
+    uint64_t fingerprint{};
+    winrt::hstring encoded;
     WalkTree([&](const auto& pane) {
         if (pane->_IsLeaf() && pane->_control != sourceControl && !pane->_control.ReadOnly())
         {
-            pane->_control.RawWriteKeyEvent(vkey, scanCode, modifiers, keyDown);
+            if (!encoded.empty() && pane->_control.TrySendEncodedInput(fingerprint, encoded))
+            {
+                return;
+            }
+            encoded = pane->_control.SendKeyEventForBroadcast(vkey, scanCode, modifiers, keyDown);
+            fingerprint = pane->_control.InputModeFingerprint();
         }
     });
 }
@@ -3217,10 +3255,22 @@ void Pane::BroadcastChar(const winrt::Microsoft::Terminal::Control::TermControl&
                          const WORD scanCode,
                          const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers)
 {
+    // Same encode-once scheme as BroadcastKey. Control characters always take
+    // the full path: Enter places prompt marks and restarts a pane whose
+    // connection has closed, and ^C interrupts MIDI playback - all per-pane
+    // decisions that a pre-encoded byte string would skip.
+    const auto shareable = character >= L' ';
+    uint64_t fingerprint{};
+    winrt::hstring encoded;
     WalkTree([&](const auto& pane) {
         if (pane->_IsLeaf() && pane->_control != sourceControl && !pane->_control.ReadOnly())
         {
-            pane->_control.RawWriteChar(character, scanCode, modifiers);
+            if (shareable && !encoded.empty() && pane->_control.TrySendEncodedInput(fingerprint, encoded))
+            {
+                return;
+            }
+            encoded = pane->_control.SendCharEventForBroadcast(character, scanCode, modifiers);
+            fingerprint = pane->_control.InputModeFingerprint();
         }
     });
 }
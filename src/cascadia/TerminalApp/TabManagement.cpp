@@ -217,7 +217,28 @@ namespace winrt::TerminalApp::implementation
 
         // This kicks off TabView::SelectionChanged, in response to which
         // we'll attach the terminal's Xaml control to the Xaml root.
-        _tabView.SelectedItem(tabViewItem);
+        //
+        // Attaching a tab's content to the tree is what actually builds out
+        // its panes' renderers and starts their connections, so selecting
+        // every restored tab in turn during startup would pay for a full
+        // terminal initialization per tab. Instead, only select the very
+        // first tab immediately (so the window has content as soon as
+        // possible), and remember the most recently created one - the
+        // selection will land there once the startup actions are done (see
+        // ProcessStartupActions). Until a tab is first selected, it stays a
+        // lightweight placeholder.
+        if (_startupState == StartupState::InStartup)
+        {
+            if (_tabs.Size() == 1)
+            {
+                _tabView.SelectedItem(tabViewItem);
+            }
+            _startupTabToSelect = tabViewItem;
+        }
+        else
+        {
+            _tabView.SelectedItem(tabViewItem);
+        }
     }
 
     // Method Description:
@@ -593,6 +614,10 @@ namespace winrt::TerminalApp::implementation
 
         if (_startupState == StartupState::InStartup)
         {
+            // This was an explicit selection (e.g. the switchToTab action a
+            // persisted layout ends with), so it should stand - drop any
+            // selection that tab creation deferred.
+            _startupTabToSelect = nullptr;
             _UpdatedSelectedTab(tab);
         }
         else
@@ -617,6 +617,19 @@ namespace winrt::TerminalApp::implementation
                 }
             }
 
+            // Apply the tab selection that creation deferred while we were
+            // starting up: the most recently created tab, unless an explicit
+            // switchToTab along the way already chose another one (in which
+            // case this was cleared). See _InitializeTab.
+            if (const auto tabToSelect = std::exchange(_startupTabToSelect, nullptr))
+            {
+                uint32_t index{};
+                if (_tabView.TabItems().IndexOf(tabToSelect, index))
+                {
+                    _tabView.SelectedItem(tabToSelect);
+                }
+            }
+
             // GH#6586: now that we're done processing all startup commands,
             // focus the active control. This will work as expected for both
             // commandline invocations and for `wt` action invocations.
@@ -254,6 +254,10 @@ namespace winrt::TerminalApp::implementation
 
         winrt::Windows::UI::Xaml::Controls::Grid::LayoutUpdated_revoker _layoutUpdatedRevoker;
         StartupState _startupState{ StartupState::NotInitialized };
+        // During startup, tab creation defers selecting each new tab. This is
+        // the tab the selection should land on once the startup actions are
+        // done. See _InitializeTab and ProcessStartupActions.
+        Microsoft::UI::Xaml::Controls::TabViewItem _startupTabToSelect{ nullptr };
 
         Windows::Foundation::Collections::IVector<Microsoft::Terminal::Settings::Model::ActionAndArgs> _startupActions;
         bool _shouldStartInboundListener{ false };
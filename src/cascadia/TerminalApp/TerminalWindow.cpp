@@ -984,6 +984,18 @@ namespace winrt::TerminalApp::implementation
         return _appArgs.ShouldExitEarly();
     }
 
+    // Method Description:
+    // - Returns true if this window's commandline included `--startupTimes`,
+    //   asking us to display the startup phase summary once the window is up.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - true iff we should display the startup time summary
+    bool TerminalWindow::ShouldShowStartupTimes()
+    {
+        return _appArgs.ShouldShowStartupTimes();
+    }
+
     bool TerminalWindow::FocusMode() const
     {
         return _root ? _root->FocusMode() : false;
@@ -1134,17 +1146,23 @@ namespace winrt::TerminalApp::implementation
         return winrt::to_hstring(_appArgs.GetExitMessage());
     }
 
-    hstring TerminalWindow::GetWindowLayoutJson(LaunchPosition position)
+    // Method Description:
+    // - Collects this window's layout, stamped with the given launch position.
+    //   Serializing the layout to JSON is left to the caller, so that it can
+    //   happen off the UI thread - with many tabs and panes the stringify is
+    //   the expensive half of a periodic layout save, and it doesn't need any
+    //   controls.
+    WindowLayout TerminalWindow::GetWindowLayout(LaunchPosition position)
     {
         if (_root != nullptr)
         {
             if (const auto layout = _root->GetWindowLayout())
             {
                 layout.InitialPosition(position);
-                return WindowLayout::ToJson(layout);
+                return layout;
             }
         }
-        return L"";
+        return nullptr;
     }
 
     void TerminalWindow::SetPersistedLayoutIdx(const uint32_t idx)
@@ -85,6 +85,7 @@ namespace winrt::TerminalApp::implementation
         void SetSettingsStartupArgs(const std::vector<winrt::Microsoft::Terminal::Settings::Model::ActionAndArgs>& actions);
         winrt::hstring ParseCommandlineMessage();
         bool ShouldExitEarly();
+        bool ShouldShowStartupTimes();
 
         bool ShouldImmediatelyHandoffToElevated();
         void HandoffToElevated();
@@ -95,7 +96,7 @@ namespace winrt::TerminalApp::implementation
         bool AlwaysOnTop() const;
         bool AutoHideWindow();
 
-        hstring GetWindowLayoutJson(Microsoft::Terminal::Settings::Model::LaunchPosition position);
+        winrt::Microsoft::Terminal::Settings::Model::WindowLayout GetWindowLayout(Microsoft::Terminal::Settings::Model::LaunchPosition position);
 
         void IdentifyWindow();
         void RenameFailed();
@@ -7,6 +7,8 @@
 #include "AzureClientID.h"
 #include <sstream>
 #include <cstdlib>
+#include <map>
+#include <til/mutex.h>
 #include <LibraryResources.h>
 #include <unicode.hpp>
 
@@ -28,6 +30,18 @@ static constexpr std::wstring_view HttpUserAgent = L"Mozilla/5.0 (Windows NT 10.
 static constexpr int USER_INPUT_COLOR = 93; // yellow - the color of something the user can type
 static constexpr int USER_INFO_COLOR = 97; // white - the color of clarifying information
 
+// A second Azure tab doesn't need to re-resolve the cloud shell: the console
+// endpoint and the user's preferred shell only change when the account's cloud
+// shell is reconfigured. We keep the last resolution per tenant so follow-up
+// tabs skip straight to requesting a terminal over the known endpoint. A stale
+// entry simply fails that request, upon which we drop it and re-resolve.
+struct ResolvedCloudShell
+{
+    winrt::hstring cloudShellUri;
+    winrt::hstring shellType;
+};
+static til::shared_mutex<std::map<std::wstring, ResolvedCloudShell>> s_resolvedCloudShells;
+
 using namespace winrt::Windows::Foundation;
 namespace WDJ = ::winrt::Windows::Data::Json;
 namespace WSS = ::winrt::Windows::Storage::Streams;
@@ -741,24 +755,63 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     // - helper function to connect the user to the Azure cloud shell
     void AzureConnection::_RunConnectState()
     {
-        // Get user's cloud shell settings
-        const auto settingsResponse = _GetCloudShellUserSettings();
-        if (settingsResponse.HasKey(L"error"))
+        winrt::hstring socketUri;
+
+        // A second tab for the same tenant reuses the cloud shell endpoint
+        // resolved by the first one; see s_resolvedCloudShells above.
         {
-            _WriteStringWithNewline(RS_(L"AzureNoCloudAccount"));
-            _transitionToState(ConnectionState::Failed);
-            return;
+            std::optional<ResolvedCloudShell> cached;
+            {
+                const auto guard = s_resolvedCloudShells.lock_shared();
+                if (const auto it = guard->find(_currentTenant->ID); it != guard->end())
+                {
+                    cached = it->second;
+                }
+            }
+
+            if (cached.has_value())
+            {
+                try
+                {
+                    _cloudShellUri = cached->cloudShellUri;
+                    _WriteStringWithNewline(RS_(L"AzureRequestingTerminal"));
+                    socketUri = _GetTerminal(cached->shellType);
+                }
+                catch (...)
+                {
+                    // The cached endpoint went stale; drop it and re-resolve below.
+                    _WriteCaughtExceptionRecord();
+                    const auto guard = s_resolvedCloudShells.lock();
+                    guard->erase(_currentTenant->ID);
+                    socketUri = {};
+                }
+            }
         }
 
-        // Request for a cloud shell
-        _WriteStringWithNewline(RS_(L"AzureRequestingCloud"));
-        _cloudShellUri = _GetCloudShell();
-        _WriteStringWithNewline(RS_(L"AzureSuccess"));
+        if (socketUri.empty())
+        {
+            // Get user's cloud shell settings
+            const auto settingsResponse = _GetCloudShellUserSettings();
+            if (settingsResponse.HasKey(L"error"))
+            {
+                _WriteStringWithNewline(RS_(L"AzureNoCloudAccount"));
+                _transitionToState(ConnectionState::Failed);
+                return;
+            }
 
-        // Request for a terminal for said cloud shell
-        const auto shellType = _ParsePreferredShellType(settingsResponse);
-        _WriteStringWithNewline(RS_(L"AzureRequestingTerminal"));
-        const auto socketUri = _GetTerminal(shellType);
+            // Request for a cloud shell
+            _WriteStringWithNewline(RS_(L"AzureRequestingCloud"));
+            _cloudShellUri = _GetCloudShell();
+            _WriteStringWithNewline(RS_(L"AzureSuccess"));
+
+            // Request for a terminal for said cloud shell
+            const auto shellType = _ParsePreferredShellType(settingsResponse);
+            _WriteStringWithNewline(RS_(L"AzureRequestingTerminal"));
+            socketUri = _GetTerminal(shellType);
+
+            const auto guard = s_resolvedCloudShells.lock();
+            guard->insert_or_assign(_currentTenant->ID, ResolvedCloudShell{ _cloudShellUri, shellType });
+        }
         _TerminalOutputHandlers(L"\r\n");
 
         //// Step 8: connecting to said terminal
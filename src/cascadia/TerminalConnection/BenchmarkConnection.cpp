@@ -0,0 +1,232 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "BenchmarkConnection.h"
+
+#include <fstream>
+
+#include "BenchmarkConnection.g.cpp"
+
+using namespace winrt::Windows::Foundation;
+
+namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
+{
+    // How much output we hand to the terminal per TerminalOutput event. Large
+    // enough that the event/conversion overhead doesn't dominate what we're
+    // trying to measure, and roughly what a busy conpty connection delivers
+    // per read.
+    static constexpr size_t BenchmarkChunkChars = 32 * 1024;
+
+    template<typename T>
+    static T unbox_prop_or(const Collections::ValueSet& blob, std::wstring_view key, T defaultValue)
+    {
+        return winrt::unbox_value_or<T>(blob.TryLookup(key).try_as<IPropertyValue>(), defaultValue);
+    }
+
+    BenchmarkConnection::~BenchmarkConnection()
+    {
+        Close();
+    }
+
+    void BenchmarkConnection::Initialize(const Collections::ValueSet& settings)
+    {
+        if (settings)
+        {
+            _pattern = unbox_prop_or<winrt::hstring>(settings, L"pattern", winrt::hstring{ _pattern });
+            _replayPath = unbox_prop_or<winrt::hstring>(settings, L"replayPath", winrt::hstring{ _replayPath });
+            _charsPerSecond = unbox_prop_or<uint64_t>(settings, L"charsPerSecond", _charsPerSecond);
+            _totalChars = unbox_prop_or<uint64_t>(settings, L"totalChars", _totalChars);
+        }
+    }
+
+    void BenchmarkConnection::Start()
+    {
+        if (_transitionToState(ConnectionState::Connected))
+        {
+            _thread = std::thread{ &BenchmarkConnection::_generatorThread, this };
+        }
+    }
+
+    void BenchmarkConnection::WriteInput(const hstring& data)
+    {
+        // The only input we react to is ^C, which stops the run early. The
+        // summary is still printed, so an interactive session can eyeball
+        // throughput without waiting for the full volume.
+        if (data.size() > 0 && til::at(data, 0) == L'\x03')
+        {
+            _stopRequested = true;
+        }
+    }
+
+    void BenchmarkConnection::Resize(uint32_t /*rows*/, uint32_t /*columns*/) noexcept
+    {
+    }
+
+    void BenchmarkConnection::Close() noexcept
+    {
+        if (_transitionToState(ConnectionState::Closing))
+        {
+            _stopRequested = true;
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+            _transitionToState(ConnectionState::Closed);
+        }
+    }
+
+    // Method Description:
+    // - Delivers one chunk of output to the terminal, accounting for the time
+    //   spent inside the handler. Since TermControl consumes the event
+    //   synchronously, the handler time is the end-to-end ingest cost for
+    //   those characters.
+    // Return Value:
+    // - false if the run should stop (closed or ^C), true otherwise.
+    bool BenchmarkConnection::_emit(const std::wstring_view chunk)
+    {
+        if (_stopRequested || !_isConnected())
+        {
+            return false;
+        }
+
+        LARGE_INTEGER beg, end;
+        QueryPerformanceCounter(&beg);
+        _TerminalOutputHandlers(chunk);
+        QueryPerformanceCounter(&end);
+
+        _handlerTicks += end.QuadPart - beg.QuadPart;
+        _emittedChars += chunk.size();
+        return true;
+    }
+
+    // Method Description:
+    // - Appends one line of the configured stress pattern to the chunk being built.
+    void BenchmarkConnection::_appendLine(std::wstring& chunk, size_t lineNumber) const
+    {
+        if (_pattern == L"sgr")
+        {
+            // A color change per word is about as attribute-heavy as real
+            // programs get (think colorized build output or ls --color).
+            for (auto word = 0; word < 10; ++word)
+            {
+                fmt::format_to(std::back_inserter(chunk), L"\x1b[38;5;{}mword{:04} ", (lineNumber * 10 + word) % 256, word);
+            }
+            chunk.append(L"\x1b[m\r\n");
+        }
+        else if (_pattern == L"scroll")
+        {
+            // Full-width lines with a periodic clear, so the buffer both
+            // scrolls and gets rewritten from the top.
+            if (lineNumber % 500 == 499)
+            {
+                chunk.append(L"\x1b[2J\x1b[H");
+            }
+            fmt::format_to(std::back_inserter(chunk), L"{:08} ", lineNumber);
+            chunk.append(70, L'#');
+            chunk.append(L"\r\n");
+        }
+        else if (_pattern == L"unicode")
+        {
+            // Wide glyphs, surrogate pairs and combining marks - everything
+            // that falls off the ASCII fast paths in the conversion and
+            // measurement code.
+            fmt::format_to(std::back_inserter(chunk), L"{:08} ", lineNumber);
+            for (auto i = 0; i < 8; ++i)
+            {
+                chunk.append(L"あ漢字 \xD83D\xDE00 e\x0301\x0327 ");
+            }
+            chunk.append(L"\r\n");
+        }
+        else
+        {
+            // "ascii" (and anything unrecognized): plain printable text, the
+            // absolute best case for every stage of the pipeline.
+            fmt::format_to(std::back_inserter(chunk), L"{:08} ", lineNumber);
+            chunk.append(70, L'x');
+            chunk.append(L"\r\n");
+        }
+    }
+
+    void BenchmarkConnection::_generatorThread() noexcept
+    try
+    {
+        LOG_IF_FAILED(SetThreadDescription(GetCurrentThread(), L"BenchmarkConnection Generator Thread"));
+
+        LARGE_INTEGER freq, start;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&start);
+
+        std::wstring replay;
+        if (!_replayPath.empty())
+        {
+            std::ifstream file{ std::filesystem::path{ _replayPath }, std::ios::binary };
+            const std::string raw{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+            if (file.fail() || raw.empty())
+            {
+                _emit(fmt::format(L"\r\nbenchmark: couldn't read transcript '{}'\r\n", std::wstring_view{ _replayPath }));
+                return;
+            }
+            THROW_IF_FAILED(til::u8u16(raw, replay));
+        }
+
+        std::wstring chunk;
+        size_t lineNumber = 0;
+        size_t replayOffset = 0;
+        auto done = false;
+        while (!done)
+        {
+            chunk.clear();
+            if (!replay.empty())
+            {
+                // Replay whole files regardless of totalChars: a transcript
+                // only makes sense as a unit (cursor state, partial escapes).
+                chunk.assign(replay, replayOffset, BenchmarkChunkChars);
+                replayOffset += chunk.size();
+                done = replayOffset >= replay.size();
+            }
+            else
+            {
+                while (chunk.size() < BenchmarkChunkChars)
+                {
+                    _appendLine(chunk, lineNumber++);
+                }
+                done = _emittedChars + chunk.size() >= _totalChars;
+            }
+
+            if (!_emit(chunk))
+            {
+                break;
+            }
+
+            if (_charsPerSecond > 0)
+            {
+                // Pace against the global schedule rather than per-chunk, so
+                // a slow consumer doesn't drag the effective rate below the
+                // requested one.
+                LARGE_INTEGER now;
+                QueryPerformanceCounter(&now);
+                const auto elapsedMs = (now.QuadPart - start.QuadPart) * 1000 / freq.QuadPart;
+                const auto scheduledMs = static_cast<int64_t>(_emittedChars * 1000 / _charsPerSecond);
+                if (scheduledMs > elapsedMs)
+                {
+                    Sleep(gsl::narrow_cast<DWORD>(scheduledMs - elapsedMs));
+                }
+            }
+        }
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        const auto wallSeconds = static_cast<double>(now.QuadPart - start.QuadPart) / freq.QuadPart;
+        const auto handlerSeconds = static_cast<double>(_handlerTicks) / freq.QuadPart;
+        _emit(fmt::format(L"\r\n\x1b[m"
+                          L"benchmark: {} chars in {:.3f}s wall, {:.3f}s in the output handler ({:.1f} Mchars/s consumed)\r\n",
+                          _emittedChars,
+                          wallSeconds,
+                          handlerSeconds,
+                          handlerSeconds > 0 ? _emittedChars / handlerSeconds / 1e6 : 0.0));
+
+        // Stay Connected after reporting; the host decides when to close us.
+    }
+    CATCH_LOG()
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "BenchmarkConnection.g.h"
+
+#include "ConnectionStateHolder.h"
+
+// A synthetic load generator for TermControl. Instead of echoing input like
+// EchoConnection, it produces VT output by itself - canned stress patterns or
+// a recorded transcript replayed from disk - at a configurable rate, and
+// reports how long the attached control took to consume it. This gives us a
+// first-class way to measure the ControlCore ingest path without spawning a
+// child process.
+namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
+{
+    struct BenchmarkConnection : BenchmarkConnectionT<BenchmarkConnection>, ConnectionStateHolder<BenchmarkConnection>
+    {
+        BenchmarkConnection() = default;
+        ~BenchmarkConnection();
+
+        // Supported settings:
+        // - "pattern": "ascii" (default), "sgr", "scroll" or "unicode"
+        // - "replayPath": path to a UTF-8 VT transcript; overrides "pattern"
+        // - "charsPerSecond": pacing in UTF-16 code units per second, 0 (default) = unthrottled
+        // - "totalChars": how much to emit before reporting, default 64M; a replay always completes whole files
+        void Initialize(const Windows::Foundation::Collections::ValueSet& settings);
+
+        void Start();
+        void WriteInput(const hstring& data);
+        void Resize(uint32_t rows, uint32_t columns) noexcept;
+        void Close() noexcept;
+
+        WINRT_CALLBACK(TerminalOutput, TerminalOutputHandler);
+
+    private:
+        void _generatorThread() noexcept;
+        void _appendLine(std::wstring& chunk, size_t lineNumber) const;
+        bool _emit(const std::wstring_view chunk);
+
+        std::wstring _pattern{ L"ascii" };
+        std::wstring _replayPath;
+        uint64_t _charsPerSecond{ 0 };
+        uint64_t _totalChars{ 64 * 1024 * 1024 };
+
+        std::atomic<bool> _stopRequested{ false };
+        std::thread _thread;
+
+        // Consumption accounting, only touched on the generator thread.
+        uint64_t _emittedChars{ 0 };
+        uint64_t _handlerTicks{ 0 };
+    };
+}
+
+namespace winrt::Microsoft::Terminal::TerminalConnection::factory_implementation
+{
+    BASIC_FACTORY(BenchmarkConnection);
+}
@@ -5,6 +5,7 @@
 #include "ConptyConnection.h"
 
 #include <conpty-static.h>
+#include <til/mutex.h>
 #include <til/string.h>
 #include <winternl.h>
 
@@ -48,8 +49,14 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         wil::unique_hfile outPipeOurSide, outPipePseudoConsoleSide;
         wil::unique_hfile inPipeOurSide, inPipePseudoConsoleSide;
 
-        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, 0));
-        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, 0));
+        // The given buffer size is only a hint: it sizes the in-kernel buffer
+        // that decouples the two ends. The default (4KiB) makes a fast client
+        // ping-pong with conhost every few thousand bytes during bulk output;
+        // with a generous buffer either side can burst a whole batch of frames
+        // before the other needs to be scheduled at all.
+        static constexpr DWORD pipeBufferSize = 128 * 1024;
+        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, pipeBufferSize));
+        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, pipeBufferSize));
         RETURN_IF_FAILED(ConptyCreatePseudoConsole(size, inPipePseudoConsoleSide.get(), outPipePseudoConsoleSide.get(), dwFlags, phPC));
         *phInput = inPipeOurSide.release();
         *phOutput = outPipeOurSide.release();
@@ -255,6 +262,89 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         return winrt::unbox_value_or<T>(blob.TryLookup(key).try_as<Windows::Foundation::IPropertyValue>(), defaultValue);
     }
 
+    // Function Description:
+    // - Returns a copy of a fully regenerated environment block, equivalent to
+    //   calling til::env::regenerate(). Regeneration re-reads a dozen registry
+    //   keys and every new tab pays for it again, even though the result is
+    //   identical until someone actually edits their environment. We thus cache
+    //   the regenerated block and invalidate the cache with registry change
+    //   notifications on every key regenerate() reads: the system and user
+    //   environment keys and the user's volatile environment subtree.
+    static til::env _regeneratedEnvironment()
+    {
+        struct CachedEnv
+        {
+            til::env env;
+            wil::unique_hkey keys[3];
+            wil::unique_event events[3];
+            bool valid = false;
+        };
+        static til::shared_mutex<CachedEnv> sharedCache;
+
+        const auto cache = sharedCache.lock();
+
+        for (const auto& event : cache->events)
+        {
+            if (event && event.is_signaled())
+            {
+                cache->valid = false;
+            }
+        }
+
+        if (!cache->valid)
+        {
+            struct WatchedRoot
+            {
+                HKEY root;
+                wil::zwstring_view path;
+                BOOL watchSubtree;
+            };
+            static constexpr WatchedRoot roots[3]{
+                { HKEY_LOCAL_MACHINE, til::details::vars::reg::system_env_var_root, FALSE },
+                { HKEY_CURRENT_USER, til::details::vars::reg::user_env_var_root, FALSE },
+                // regenerate() also reads the user's Volatile Environment and
+                // its per-session subkey; watching the subtree covers both.
+                { HKEY_CURRENT_USER, til::details::vars::reg::user_volatile_env_var_root, TRUE },
+            };
+
+            // (Re)arm the notifications before reading the registry, so that a
+            // write racing with us at worst invalidates an already fresh block.
+            for (size_t i = 0; i < std::size(roots); ++i)
+            {
+                auto& key = cache->keys[i];
+                auto& event = cache->events[i];
+
+                if (!key && RegOpenKeyExW(roots[i].root, roots[i].path.c_str(), 0, KEY_NOTIFY, key.addressof()) != ERROR_SUCCESS)
+                {
+                    key.reset();
+                }
+                if (!event)
+                {
+                    event.create(wil::EventOptions::ManualReset);
+                }
+                else
+                {
+                    event.ResetEvent();
+                }
+                if (key)
+                {
+                    // REG_NOTIFY_THREAD_AGNOSTIC keeps the registration alive after
+                    // this (possibly short-lived) thread exits. The notification is
+                    // one-shot, which is why we rearm it on each refresh.
+                    LOG_IF_WIN32_ERROR(RegNotifyChangeKeyValue(key.get(), roots[i].watchSubtree, REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET | REG_NOTIFY_THREAD_AGNOSTIC, event.get(), TRUE));
+                }
+            }
+
+            cache->env = {};
+            cache->env.regenerate();
+            // If a key couldn't be opened for notifications we can't tell when it
+            // changes, so we simply don't cache and regenerate on each call.
+            cache->valid = cache->keys[0] && cache->keys[1] && cache->keys[2];
+        }
+
+        return cache->env;
+    }
+
     void ConptyConnection::Initialize(const Windows::Foundation::Collections::ValueSet& settings)
     {
         if (settings)
@@ -283,7 +373,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
             if (reloadEnvironmentVariables)
             {
-                _initialEnv.regenerate();
+                _initialEnv = _regeneratedEnvironment();
             }
             else
             {
@@ -91,7 +91,11 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         til::u8state _u8State{};
         std::wstring _u16Str{};
-        std::array<char, 4096> _buffer{};
+        // Sized to drain a whole backlog of conpty output in one ReadFile when
+        // we fall behind a fast client. The per-chunk costs of the ingest path
+        // (read syscall, conversion, the hstring the event payload lives in)
+        // then amortize over 16x more data than the old 4KiB buffer allowed.
+        std::array<char, 64 * 1024> _buffer{};
         bool _passthroughMode{};
         bool _inheritCursor{ false };
 
@@ -45,5 +45,30 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                 _ColorTable[i] = appearance.GetColorTableEntry(static_cast<int32_t>(i));
             }
         }
+
+        // Method Description:
+        // - Compares this appearance against another one, value by value. Used
+        //   on settings reload to tell whether a control's appearance actually
+        //   changed.
+        bool Equals(const ControlAppearance& other) const
+        {
+#define COMPARE_SETTING(type, name, ...) \
+    if (_##name != other._##name)        \
+    {                                    \
+        return false;                    \
+    }
+            CORE_APPEARANCE_SETTINGS(COMPARE_SETTING)
+            CONTROL_APPEARANCE_SETTINGS(COMPARE_SETTING)
+#undef COMPARE_SETTING
+
+            for (size_t i = 0; i < _ColorTable.size(); i++)
+            {
+                if (til::color{ _ColorTable[i] } != til::color{ other._ColorTable[i] })
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
     };
 }
@@ -9,6 +9,7 @@
 #include <dsound.h>
 
 #include <DefaultSettings.h>
+#include <til/unicode.h>
 #include <unicode.hpp>
 #include <utils.hpp>
 #include <WinUser.h>
@@ -42,6 +43,14 @@ constexpr const auto UpdatePatternLocationsInterval = std::chrono::milliseconds(
 // The delay before performing the search after change of search criteria
 constexpr const auto SearchAfterChangeDelay = std::chrono::milliseconds(200);
 
+// The number of rows a background search scans per slice of the terminal lock.
+constexpr const til::CoordType SearchScanChunkRows = 4096;
+
+// Pastes no larger than this go to the connection in a single write; anything
+// bigger is streamed to the connection in chunks of this size from a
+// background thread, so a slow consumer can't freeze the UI thread.
+constexpr const size_t PasteChunkSize = 128 * 1024;
+
 namespace winrt::Microsoft::Terminal::Control::implementation
 {
     static winrt::Microsoft::Terminal::Core::OptionalColor OptionalFromColor(const til::color& c)
@@ -146,6 +155,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _renderer->SetBackgroundColorChangedCallback([this]() { _rendererBackgroundColorChanged(); });
             _renderer->SetFrameColorChangedCallback([this]() { _rendererTabColorChanged(); });
             _renderer->SetRendererEnteredErrorStateCallback([this]() { _RendererEnteredErrorStateHandlers(nullptr, nullptr); });
+            _renderer->SetPaintedCallback([this](const std::span<const til::rect> /*dirty*/) noexcept { _markInputPresented(); });
 
             THROW_IF_FAILED(localPointerToThread->Initialize(_renderer.get()));
         }
@@ -319,6 +329,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _panelHeight = actualHeight;
         _compositionScale = compositionScale;
 
+        {
+            const auto shared = _shared.lock();
+            shared->requestedSize = { actualWidth, actualHeight, compositionScale };
+        }
+
         { // scope for terminalLock
             const auto lock = _terminal->LockForWriting();
 
@@ -473,9 +488,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _sendInputToConnection(wstr);
     }
 
-    bool ControlCore::SendCharEvent(const wchar_t ch,
-                                    const WORD scanCode,
-                                    const ::Microsoft::Terminal::Core::ControlKeyStates modifiers)
+    // Method Description:
+    // - Handles the connection-level special cases of a char event and
+    //   translates it under the terminal lock.
+    // Return Value:
+    // - nullopt if the event wasn't handled, and a (possibly empty) sequence
+    //   to write to the connection otherwise.
+    TerminalInput::OutputType ControlCore::_translateCharEvent(const wchar_t ch,
+                                                               const WORD scanCode,
+                                                               const ::Microsoft::Terminal::Core::ControlKeyStates modifiers)
     {
         const wchar_t CtrlD = 0x4;
         const wchar_t Enter = '\r';
@@ -485,14 +506,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             if (ch == CtrlD)
             {
                 _CloseTerminalRequestedHandlers(*this, nullptr);
-                return true;
+                return TerminalInput::MakeOutput({});
             }
 
             if (ch == Enter)
             {
                 // Ask the hosting application to give us a new connection.
                 _RestartTerminalRequestedHandlers(*this, nullptr);
-                return true;
+                return TerminalInput::MakeOutput({});
             }
         }
 
@@ -501,12 +522,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _handleControlC();
         }
 
-        TerminalInput::OutputType out;
-        {
-            const auto lock = _terminal->LockForReading();
-            out = _terminal->SendCharEvent(ch, scanCode, modifiers);
-        }
-        if (out)
+        const auto lock = _terminal->LockForReading();
+        return _terminal->SendCharEvent(ch, scanCode, modifiers);
+    }
+
+    bool ControlCore::SendCharEvent(const wchar_t ch,
+                                    const WORD scanCode,
+                                    const ::Microsoft::Terminal::Core::ControlKeyStates modifiers)
+    {
+        if (const auto out = _translateCharEvent(ch, scanCode, modifiers))
         {
             _sendInputToConnection(*out);
             return true;
@@ -514,6 +538,23 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return false;
     }
 
+    // Method Description:
+    // - Identical to SendCharEvent, but returns the sequence the event was
+    //   translated into ("" if none), so that broadcast input can offer the
+    //   same bytes to sibling cores via TrySendEncodedInput instead of
+    //   re-encoding the event once per pane.
+    winrt::hstring ControlCore::SendCharEventForBroadcast(const wchar_t ch,
+                                                          const WORD scanCode,
+                                                          const ::Microsoft::Terminal::Core::ControlKeyStates modifiers)
+    {
+        if (const auto out = _translateCharEvent(ch, scanCode, modifiers); out && !out->empty())
+        {
+            _sendInputToConnection(*out);
+            return winrt::hstring{ *out };
+        }
+        return {};
+    }
+
     void ControlCore::_handleControlC()
     {
         if (!_midiAudioSkipTimer)
@@ -615,6 +656,55 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // - scanCode: The scan code of the key pressed.
     // - modifiers: The Microsoft::Terminal::Core::ControlKeyStates representing the modifier key states.
     // - keyDown: If true, the key was pressed, otherwise the key was released.
+    // Method Description:
+    // - Handles selection updates for a key event and translates it under the
+    //   terminal lock.
+    // Return Value:
+    // - nullopt if the event wasn't handled, and a (possibly empty) sequence
+    //   to write to the connection otherwise.
+    TerminalInput::OutputType ControlCore::_translateKeyEvent(const WORD vkey,
+                                                              const WORD scanCode,
+                                                              const ControlKeyStates modifiers,
+                                                              const bool keyDown)
+    {
+        const auto lock = _terminal->LockForWriting();
+
+        // Update the selection, if it's present
+        // GH#8522, GH#3758 - Only modify the selection on key _down_. If we
+        // modify on key up, then there's chance that we'll immediately dismiss
+        // a selection created by an action bound to a keydown.
+        if (_shouldTryUpdateSelection(vkey) && keyDown)
+        {
+            // try to update the selection
+            if (const auto updateSlnParams{ _terminal->ConvertKeyEventToUpdateSelectionParams(modifiers, vkey) })
+            {
+                _terminal->UpdateSelection(updateSlnParams->first, updateSlnParams->second, modifiers);
+                _updateSelectionUI();
+                return TerminalInput::MakeOutput({});
+            }
+
+            // GH#8791 - don't dismiss selection if Windows key was also pressed as a key-combination.
+            if (!modifiers.IsWinPressed())
+            {
+                _terminal->ClearSelection();
+                _updateSelectionUI();
+            }
+
+            // When there is a selection active, escape should clear it and NOT flow through
+            // to the terminal. With any other keypress, it should clear the selection AND
+            // flow through to the terminal.
+            if (vkey == VK_ESCAPE)
+            {
+                return TerminalInput::MakeOutput({});
+            }
+        }
+
+        // If the terminal translated the key, mark the event as handled.
+        // This will prevent the system from trying to get the character out
+        // of it and sending us a CharacterReceived event.
+        return _terminal->SendKeyEvent(vkey, scanCode, modifiers, keyDown);
+    }
+
     bool ControlCore::TrySendKeyEvent(const WORD vkey,
                                       const WORD scanCode,
                                       const ControlKeyStates modifiers,
@@ -625,51 +715,88 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             return true;
         }
 
-        TerminalInput::OutputType out;
+        if (const auto out = _translateKeyEvent(vkey, scanCode, modifiers, keyDown))
         {
-            const auto lock = _terminal->LockForWriting();
-
-            // Update the selection, if it's present
-            // GH#8522, GH#3758 - Only modify the selection on key _down_. If we
-            // modify on key up, then there's chance that we'll immediately dismiss
-            // a selection created by an action bound to a keydown.
-            if (_shouldTryUpdateSelection(vkey) && keyDown)
+            if (!out->empty())
             {
-                // try to update the selection
-                if (const auto updateSlnParams{ _terminal->ConvertKeyEventToUpdateSelectionParams(modifiers, vkey) })
+                _sendInputToConnection(*out);
+                if (keyDown)
                 {
-                    _terminal->UpdateSelection(updateSlnParams->first, updateSlnParams->second, modifiers);
-                    _updateSelectionUI();
-                    return true;
+                    _markInputSent();
                 }
+            }
+            return true;
+        }
+        return false;
+    }
 
-                // GH#8791 - don't dismiss selection if Windows key was also pressed as a key-combination.
-                if (!modifiers.IsWinPressed())
-                {
-                    _terminal->ClearSelection();
-                    _updateSelectionUI();
-                }
+    // Method Description:
+    // - Identical to TrySendKeyEvent, but returns the sequence the event was
+    //   translated into ("" if none), so that broadcast input can offer the
+    //   same bytes to sibling cores via TrySendEncodedInput instead of
+    //   re-encoding the event once per pane.
+    winrt::hstring ControlCore::SendKeyEventForBroadcast(const WORD vkey,
+                                                         const WORD scanCode,
+                                                         const ControlKeyStates modifiers,
+                                                         const bool keyDown)
+    {
+        if (!vkey)
+        {
+            return {};
+        }
 
-                // When there is a selection active, escape should clear it and NOT flow through
-                // to the terminal. With any other keypress, it should clear the selection AND
-                // flow through to the terminal.
-                if (vkey == VK_ESCAPE)
-                {
-                    return true;
-                }
+        if (const auto out = _translateKeyEvent(vkey, scanCode, modifiers, keyDown); out && !out->empty())
+        {
+            _sendInputToConnection(*out);
+            if (keyDown)
+            {
+                _markInputSent();
             }
+            return winrt::hstring{ *out };
+        }
+        return {};
+    }
 
-            // If the terminal translated the key, mark the event as handled.
-            // This will prevent the system from trying to get the character out
-            // of it and sending us a CharacterReceived event.
-            out = _terminal->SendKeyEvent(vkey, scanCode, modifiers, keyDown);
+    // Method Description:
+    // - Returns an opaque value identifying the terminal's input-encoding
+    //   mode state, for use with TrySendEncodedInput.
+    uint64_t ControlCore::InputModeFingerprint()
+    {
+        const auto lock = _terminal->LockForReading();
+        return _terminal->GetInputModeFingerprint();
+    }
+
+    // Method Description:
+    // - Writes a sequence that another core already encoded directly to the
+    //   connection, provided this core would have produced the same bytes:
+    //   the mode fingerprints have to match, and nothing about this core's
+    //   state may need the full per-event path (an active selection wants to
+    //   handle keystrokes itself, and a closed connection offers to restart
+    //   on Enter).
+    // Return Value:
+    // - false if the caller should fall back to re-encoding the event.
+    bool ControlCore::TrySendEncodedInput(const uint64_t fingerprint, const winrt::hstring& encoded)
+    {
+        {
+            const auto lock = _terminal->LockForWriting();
+            if (_terminal->GetInputModeFingerprint() != fingerprint ||
+                _terminal->IsSelectionActive())
+            {
+                return false;
+            }
+
+            // The full path snaps a scrolled-back viewport to the bottom when
+            // input arrives; keep that behavior on the fast path.
+            _terminal->TrySnapOnInput();
         }
-        if (out)
+
+        if (_connection.State() >= winrt::Microsoft::Terminal::TerminalConnection::ConnectionState::Closed)
         {
-            _sendInputToConnection(*out);
-            return true;
+            return false;
         }
-        return false;
+
+        _sendInputToConnection(encoded);
+        return true;
     }
 
     bool ControlCore::SendMouseEvent(const til::point viewportPos,
@@ -863,9 +990,31 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // Method Description:
     // - Updates the settings of the current terminal.
     // - INVARIANT: This method can only be called if the caller DOES NOT HAVE writing lock on the terminal.
-    void ControlCore::UpdateSettings(const IControlSettings& settings, const IControlAppearance& newAppearance)
-    {
-        _settings = winrt::make_self<implementation::ControlSettings>(settings, newAppearance);
+    // Return Value:
+    // - true if the new settings were actually applied. false if they were
+    //   identical to the ones we already had, and the caller can skip its own
+    //   settings-dependent work too.
+    bool ControlCore::UpdateSettings(const IControlSettings& settings, const IControlAppearance& newAppearance)
+    {
+        auto newSettings = winrt::make_self<implementation::ControlSettings>(settings, newAppearance);
+
+        // On a settings reload, every open control gets handed a freshly built
+        // settings object, even when the edit didn't touch its profile at all
+        // (think: changing one keybinding with 30 panes open). If nothing in
+        // our effective settings changed, don't pay for a font rebuild and a
+        // full repaint - just adopt the new snapshot (which carries the new
+        // KeyBindings) and bail. This also deliberately leaves any runtime
+        // overrides (like a scroll-wheel opacity adjustment) in place, since
+        // the user didn't ask to change them.
+        if (_settings &&
+            _initializedTerminal.load(std::memory_order_relaxed) &&
+            _settings->Equals(*newSettings))
+        {
+            _settings = std::move(newSettings);
+            return false;
+        }
+
+        _settings = std::move(newSettings);
 
         const auto lock = _terminal->LockForWriting();
 
@@ -886,7 +1035,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             // If we haven't initialized, there's no point in continuing.
             // Initialization will handle the renderer settings.
-            return;
+            return true;
         }
 
         _renderEngine->SetForceFullRepaintRendering(_settings->ForceFullRepaintRendering());
@@ -903,6 +1052,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             _refreshSizeUnderLock();
         }
+
+        return true;
     }
 
     // Method Description:
@@ -913,15 +1064,31 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         const auto lock = _terminal->LockForWriting();
         const auto& newAppearance{ focused ? _settings->FocusedAppearance() : _settings->UnfocusedAppearance() };
         // Update the terminal core with its new Core settings
-        _terminal->UpdateAppearance(*newAppearance);
+        const auto coreAppearanceChanged = _terminal->UpdateAppearance(*newAppearance);
 
         // Update DxEngine settings under the lock
         if (_renderEngine)
         {
+            // Figure out whether the engine-bound parts of the appearance
+            // differ from what we applied last time. Focus changes land here
+            // with every pane switch, and when the focused and unfocused
+            // appearances are identical (the default), there's nothing to
+            // repaint.
+            const AppliedEngineAppearance engineAppearance{
+                til::color{ newAppearance->SelectionBackground() },
+                newAppearance->RetroTerminalEffect(),
+                newAppearance->PixelShaderPath(),
+            };
+            const auto engineAppearanceChanged = !_appliedEngineAppearance ||
+                                                 _appliedEngineAppearance->selectionBackground != engineAppearance.selectionBackground ||
+                                                 _appliedEngineAppearance->retroTerminalEffect != engineAppearance.retroTerminalEffect ||
+                                                 _appliedEngineAppearance->pixelShaderPath != engineAppearance.pixelShaderPath;
+            _appliedEngineAppearance = engineAppearance;
+
             // Update DxEngine settings under the lock
-            _renderEngine->SetSelectionBackground(til::color{ newAppearance->SelectionBackground() });
-            _renderEngine->SetRetroTerminalEffect(newAppearance->RetroTerminalEffect());
-            _renderEngine->SetPixelShaderPath(newAppearance->PixelShaderPath());
+            _renderEngine->SetSelectionBackground(engineAppearance.selectionBackground);
+            _renderEngine->SetRetroTerminalEffect(engineAppearance.retroTerminalEffect);
+            _renderEngine->SetPixelShaderPath(engineAppearance.pixelShaderPath);
 
             // Incase EnableUnfocusedAcrylic is disabled and Focused Acrylic is set to true,
             // the terminal should ignore the unfocused opacity from settings.
@@ -947,7 +1114,13 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             auto eventArgs = winrt::make_self<TransparencyChangedEventArgs>(Opacity());
             _TransparencyChangedHandlers(*this, *eventArgs);
 
-            _renderer->TriggerRedrawAll(true, true);
+            // Repainting the whole buffer is only warranted when something
+            // that feeds into cell colors or engine state actually changed;
+            // opacity changes notify their own paths above.
+            if (coreAppearanceChanged || engineAppearanceChanged)
+            {
+                _renderer->TriggerRedrawAll(true, true);
+            }
         }
     }
 
@@ -1135,7 +1308,12 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void ControlCore::SizeChanged(const float width,
                                   const float height)
     {
-        SizeOrScaleChanged(width, height, _compositionScale);
+        float scale;
+        {
+            const auto shared = _shared.lock_shared();
+            scale = shared->requestedSize.scale;
+        }
+        SizeOrScaleChanged(width, height, scale);
     }
 
     void ControlCore::ScaleChanged(const float scale)
@@ -1144,12 +1322,70 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             return;
         }
-        SizeOrScaleChanged(_panelWidth, _panelHeight, scale);
+        float width, height;
+        {
+            const auto shared = _shared.lock_shared();
+            width = shared->requestedSize.width;
+            height = shared->requestedSize.height;
+        }
+        SizeOrScaleChanged(width, height, scale);
     }
 
     void ControlCore::SizeOrScaleChanged(const float width,
                                          const float height,
                                          const float scale)
+    {
+        if (_inUnitTests) [[unlikely]]
+        {
+            const auto lock = _terminal->LockForWriting();
+            _applySizeChangeUnderLock(width, height, scale);
+            return;
+        }
+
+        auto scaleChanged = false;
+        {
+            const auto shared = _shared.lock();
+            scaleChanged = shared->requestedSize.scale != scale;
+            shared->requestedSize = { width, height, scale };
+            shared->sizeRequestSerial++;
+            if (scaleChanged)
+            {
+                // A scale change means new font metrics, and the FontSizeChanged
+                // event raised for those is consumed by XAML right on the raising
+                // thread, so it has to be applied here on the UI thread. Retract any
+                // queued plain resize; this request carries the latest size anyways.
+                shared->sizePending = false;
+            }
+            else
+            {
+                // Plain resizes carry the expensive buffer reflow; hand those to a
+                // background worker so XAML's layout pass isn't blocked on it. The
+                // renderer keeps presenting the old buffer contents until the
+                // rewrapped buffer is swapped in under the terminal lock.
+                shared->sizePending = true;
+                if (shared->sizeChangeInFlight)
+                {
+                    return;
+                }
+                shared->sizeChangeInFlight = true;
+            }
+        }
+
+        if (scaleChanged)
+        {
+            const auto lock = _terminal->LockForWriting();
+            _applySizeChangeUnderLock(width, height, scale);
+            return;
+        }
+
+        _applySizeChangeAsync();
+    }
+
+    // Method Description:
+    // - Applies a new panel size and composition scale to the terminal. This carries
+    //   the buffer reflow, so it's the expensive part of a resize.
+    // - The write lock should be held when calling this method.
+    void ControlCore::_applySizeChangeUnderLock(const float width, const float height, const float scale)
     {
         const auto scaleChanged = _compositionScale != scale;
         // _refreshSizeUnderLock redraws the entire terminal.
@@ -1163,7 +1399,6 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _panelHeight = height;
         _compositionScale = scale;
 
-        const auto lock = _terminal->LockForWriting();
         if (scaleChanged)
         {
             // _updateFont relies on the new _compositionScale set above
@@ -1172,6 +1407,54 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _refreshSizeUnderLock();
     }
 
+    // Method Description:
+    // - Applies queued size changes on a background thread, newest size winning. Only
+    //   one instance runs at a time (sizeChangeInFlight), so the rapid intermediate
+    //   sizes of a window drag collapse into whatever is current by the time the
+    //   terminal lock is ours.
+    winrt::fire_and_forget ControlCore::_applySizeChangeAsync()
+    {
+        const auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        const auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
+        for (;;)
+        {
+            float width, height, scale;
+            uint64_t serial;
+            {
+                const auto shared = _shared.lock();
+                if (!shared->sizePending)
+                {
+                    shared->sizeChangeInFlight = false;
+                    co_return;
+                }
+                shared->sizePending = false;
+                width = shared->requestedSize.width;
+                height = shared->requestedSize.height;
+                scale = shared->requestedSize.scale;
+                serial = shared->sizeRequestSerial;
+            }
+
+            const auto lock = _terminal->LockForWriting();
+            {
+                // A synchronous scale change may have overtaken us while we waited
+                // for the terminal lock; our snapshot is stale in that case.
+                const auto shared = _shared.lock_shared();
+                if (serial != shared->sizeRequestSerial)
+                {
+                    continue;
+                }
+            }
+            _applySizeChangeUnderLock(width, height, scale);
+        }
+    }
+
     void ControlCore::SetSelectionAnchor(const til::point position)
     {
         const auto lock = _terminal->LockForWriting();
@@ -1256,7 +1539,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         // extract text from buffer
         // RetrieveSelectedTextFromBuffer will lock while it's reading
-        const auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine);
+        // Only extract colors if we'll actually generate HTML or RTF from them.
+        const auto withColor = WI_IsFlagSet(copyFormats, CopyFormat::HTML) || WI_IsFlagSet(copyFormats, CopyFormat::RTF);
+        const auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine, withColor);
 
         // convert text: vector<string> --> string
         std::wstring textData;
@@ -1374,8 +1659,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             filtered.append(L"\x1b[201~");
         }
 
-        // It's important to not hold the terminal lock while calling this function as sending the data may take a long time.
-        _sendInputToConnection(filtered);
+        // It's important to not hold the terminal lock while sending the data:
+        // the connection won't return until the client has drained its end of
+        // the pipe. Small pastes go out synchronously so they stay strictly
+        // ordered with surrounding keystrokes; anything larger streams in
+        // chunks from a background thread, letting a slow consumer (ssh to a
+        // distant host, say) apply backpressure without freezing the UI.
+        if (filtered.size() <= PasteChunkSize)
+        {
+            _sendInputToConnection(filtered);
+        }
+        else
+        {
+            _pasteAsync(std::move(filtered));
+        }
 
         const auto lock = _terminal->LockForWriting();
         _terminal->ClearSelection();
@@ -1383,6 +1680,38 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _terminal->TrySnapOnInput();
     }
 
+    // Method Description:
+    // - Streams an oversized paste to the connection in bounded chunks off the
+    //   UI thread. WriteInput only returns once the ConPTY pipe has accepted a
+    //   chunk, so the connection's own write completion pace throttles us to
+    //   whatever the client can consume. Chunk boundaries are adjusted to
+    //   never split a surrogate pair (each chunk is converted to UTF-8 on its
+    //   own), and the bracketed paste markers travel whole with the first and
+    //   last chunks because they're already part of the text.
+    winrt::fire_and_forget ControlCore::_pasteAsync(std::wstring text)
+    {
+        const auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        const auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
+        const std::wstring_view remaining{ text };
+        for (size_t offset = 0; offset < remaining.size() && !_IsClosing();)
+        {
+            auto len = std::min(PasteChunkSize, remaining.size() - offset);
+            if (len < remaining.size() - offset && til::is_leading_surrogate(remaining[offset + len - 1]))
+            {
+                len--;
+            }
+            _sendInputToConnection(remaining.substr(offset, len));
+            offset += len;
+        }
+    }
+
     FontInfo ControlCore::GetFont() const
     {
         return _actualFont;
@@ -1625,7 +1954,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         // RetrieveSelectedTextFromBuffer will lock while it's reading
         const auto lock = _terminal->LockForReading();
-        const auto internalResult{ _terminal->RetrieveSelectedTextFromBuffer(trimTrailingWhitespace).text };
+        const auto internalResult{ _terminal->RetrieveSelectedTextFromBuffer(trimTrailingWhitespace, false).text };
 
         auto result = winrt::single_threaded_vector<winrt::hstring>();
 
@@ -1644,6 +1973,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // Method Description:
     // - Search text in text buffer. This is triggered if the user click
     //   search button or press enter.
+    // - If the query requires a full scan of the scrollback, the scan runs on a
+    //   background thread and the FoundMatch event arrives once it's done.
     // Arguments:
     // - text: the text to search
     // - goForward: boolean that represents if the current search direction is forward
@@ -1654,8 +1985,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         const auto lock = _terminal->LockForWriting();
 
+        if (_searcher.IsStale(*GetRenderData(), text, !caseSensitive))
+        {
+            // Collecting the matches anew means scanning the entire scrollback, which
+            // on large buffers takes longer than we're willing to stall the UI thread
+            // for. Kick the scan off to a background thread instead; a newer Search()
+            // or a ClearSearch() cancels it.
+            _searchAsync(text, goForward, caseSensitive, ++_searchGeneration);
+            return;
+        }
+
         if (_searcher.ResetIfStale(*GetRenderData(), text, !goForward, !caseSensitive))
         {
+            // Not stale enough for a full scan: the cached results were patched
+            // incrementally from the buffer's dirty-row aggregate.
             _searcher.HighlightResults();
             _searcher.MoveToCurrentSelection();
             _cachedSearchResultRows = {};
@@ -1665,6 +2008,138 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _searcher.FindNext();
         }
 
+        _reportSearchResults();
+    }
+
+    // Method Description:
+    // - Runs the full-buffer portion of a search off the UI thread. The scan is done
+    //   in chunks of rows, so that it can be abandoned cheaply when it's superseded
+    //   and so that the connection's output thread isn't starved of the terminal lock
+    //   for the whole scan.
+    // Arguments:
+    // - text/goForward/caseSensitive: the query, as passed to Search().
+    // - generation: identifies this scan; once _searchGeneration has moved past it,
+    //   the results are no longer wanted and the scan exits early.
+    winrt::fire_and_forget ControlCore::_searchAsync(winrt::hstring text, const bool goForward, const bool caseSensitive, const uint64_t generation)
+    {
+        const auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        const auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
+        const std::wstring_view needle{ text };
+        const auto caseInsensitive = !caseSensitive;
+
+        const auto lock = _terminal->LockForWriting();
+
+        // Paint the matches that are visible right now before indexing the rest
+        // of the scrollback. The renderer only ever draws the viewport-local
+        // slice of the highlight list, so this makes highlight-all respond
+        // immediately on huge buffers; the full result set (and the match
+        // counts) replaces these when the scan below finishes.
+        {
+            const auto& textBuffer = GetRenderData()->GetTextBuffer();
+            const auto viewport = GetRenderData()->GetViewport();
+            const auto height = textBuffer.GetSize().Height();
+            const auto margin = gsl::narrow_cast<til::CoordType>(std::min<size_t>(needle.size(), gsl::narrow_cast<size_t>(height)));
+
+            std::vector<til::inclusive_rect> toSelect;
+            for (const auto& hit : textBuffer.SearchText(needle, caseInsensitive, viewport.Top(), std::min(viewport.BottomExclusive() + margin, height)))
+            {
+                const auto start = textBuffer.BufferToScreenPosition(hit.start);
+                const auto stop = textBuffer.BufferToScreenPosition(hit.end);
+
+                til::inclusive_rect re;
+                re.top = start.y;
+                re.bottom = stop.y;
+                re.left = start.x;
+                re.right = stop.x;
+                toSelect.emplace_back(re);
+            }
+
+            GetRenderData()->SelectSearchRegions(std::move(toSelect));
+            _renderer->TriggerSelection();
+        }
+
+        std::vector<til::point_span> results;
+        uint64_t mutationId = 0;
+        // Yielding the lock between chunks keeps the output thread responsive, but any
+        // write that sneaks in shifts the coordinates we've collected so far and forces
+        // a rescan. If that happens once, we stop yielding, so that a busy session
+        // can't keep the scan from ever finishing.
+        auto mayYield = true;
+
+        for (auto stale = true; stale;)
+        {
+            results.clear();
+
+            const auto& textBuffer = GetRenderData()->GetTextBuffer();
+            mutationId = textBuffer.GetLastMutationId();
+
+            const auto height = textBuffer.GetSize().Height();
+            // A match can span as many rows as the needle has characters, so each chunk
+            // is scanned with that much overlap and matches belonging to the next chunk
+            // are filtered back out. (Same idea as Search::_updateResultsInSpan.)
+            const auto margin = gsl::narrow_cast<til::CoordType>(std::min<size_t>(needle.size(), gsl::narrow_cast<size_t>(height)));
+
+            for (til::CoordType beg = 0; beg < height; beg += SearchScanChunkRows)
+            {
+                if (generation != _searchGeneration.load(std::memory_order_relaxed))
+                {
+                    co_return;
+                }
+
+                const auto end = std::min(beg + SearchScanChunkRows, height);
+                for (const auto& hit : textBuffer.SearchText(needle, caseInsensitive, beg, std::min(end + margin, height)))
+                {
+                    if (hit.start.y >= beg && hit.start.y < end)
+                    {
+                        results.emplace_back(hit);
+                    }
+                }
+
+                if (mayYield && end < height)
+                {
+                    {
+                        const auto suspension = _terminal->SuspendLock();
+                    }
+                    // A write during the suspension may have resized or swapped the
+                    // buffer, so our reference into the render data can't be trusted
+                    // anymore. Bail out and start over.
+                    if (GetRenderData()->GetTextBuffer().GetLastMutationId() != mutationId)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            stale = GetRenderData()->GetTextBuffer().GetLastMutationId() != mutationId;
+            mayYield = false;
+        }
+
+        if (generation != _searchGeneration.load(std::memory_order_relaxed))
+        {
+            co_return;
+        }
+
+        _searcher.Reset(*GetRenderData(), needle, !goForward, !caseSensitive, mutationId, std::move(results));
+        _searcher.HighlightResults();
+        _searcher.MoveToCurrentSelection();
+        _cachedSearchResultRows = {};
+
+        _reportSearchResults();
+    }
+
+    // Method Description:
+    // - Selects the searcher's current match (if any) and raises a FoundMatch event
+    //   for the current state of the results. Must be called while holding the
+    //   terminal lock.
+    void ControlCore::_reportSearchResults()
+    {
         const auto foundMatch = _searcher.SelectCurrent();
         auto foundResults = winrt::make_self<implementation::FoundResultsArgs>(foundMatch);
         if (foundMatch)
@@ -1712,8 +2187,72 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return _cachedSearchResultRows;
     }
 
+    // Method Description:
+    // - Samples the text buffer into a strip of colors suitable for drawing a
+    //   coarse minimap into the scrollbar. One entry is produced per requested
+    //   sample by summarizing the buffer row nearest to it: a row dominated by
+    //   an explicitly set background color reports that color, a row that
+    //   merely contains text reports the default foreground at reduced alpha,
+    //   and a blank row reports transparent. Because we sample instead of
+    //   scanning, the cost scales with the height of the scrollbar in pixels
+    //   rather than with the length of the scrollback.
+    // Arguments:
+    // - sampleCount: the number of evenly spaced samples to take.
+    com_array<Core::Color> ControlCore::MinimapRowColors(int32_t sampleCount) const
+    {
+        if (sampleCount <= 0)
+        {
+            return {};
+        }
+
+        const auto lock = _terminal->LockForReading();
+        const auto& textBuffer = _terminal->GetTextBuffer();
+        const auto& renderSettings = _terminal->GetRenderSettings();
+        const auto totalRows = _terminal->GetBufferHeight();
+
+        com_array<Core::Color> colors{ static_cast<uint32_t>(sampleCount) };
+        for (int32_t i = 0; i < sampleCount; i++)
+        {
+            const auto y = gsl::narrow_cast<til::CoordType>(i * static_cast<int64_t>(totalRows) / sampleCount);
+            const auto& row = textBuffer.GetRowByOffset(y);
+
+            // Find the widest run on the row whose background isn't the default.
+            uint16_t bestLength = 0;
+            TextAttribute bestAttr;
+            for (const auto& run : row.Attributes().runs())
+            {
+                if (run.length > bestLength && !run.value.GetBackground().IsDefault())
+                {
+                    bestLength = run.length;
+                    bestAttr = run.value;
+                }
+            }
+
+            til::color color;
+            if (bestLength > 0)
+            {
+                color = til::color{ renderSettings.GetAttributeColors(bestAttr).second };
+            }
+            else if (row.MeasureRight() > 0)
+            {
+                // Plain text on the default background: a faint echo of the
+                // foreground reads as "there's content here" without turning
+                // the scrollbar into a solid bar.
+                color = til::color{ renderSettings.GetAttributeColors({}).first }.with_alpha(64);
+            }
+            colors[i] = color;
+        }
+
+        return colors;
+    }
+
     void ControlCore::ClearSearch()
     {
+        // Abandon any in-flight background scan. The lock makes sure it's not
+        // in the middle of installing its results into _searcher right now.
+        ++_searchGeneration;
+        const auto lock = _terminal->LockForWriting();
+
         _terminal->AlwaysNotifyOnBufferRotation(false);
         _searcher = {};
     }
@@ -1724,6 +2263,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             _closing = true;
 
+            // Any in-flight background search is pointless now; tell it to stop.
+            ++_searchGeneration;
+
             // Ensure Close() doesn't hang, waiting for MidiAudio to finish playing an hour long song.
             _midiAudio.BeginSkip();
 
@@ -2025,6 +2567,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                 _terminal->Write(hstr);
             }
 
+            // Stamped after the write so that the next painted frame is
+            // guaranteed to contain whatever the connection echoed back.
+            _markInputEchoReceived();
+
             // Start the throttled update of where our hyperlinks are.
             const auto shared = _shared.lock_shared();
             if (shared->updatePatternLocations)
@@ -2039,6 +2585,81 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         }
     }
 
+    // Input-to-photon latency markers: correlate one keystroke at a time from
+    // the moment its translation is sent to the connection, through the conpty
+    // round trip, to the frame that presents the echo. The intermediate stages
+    // emit verbose events carrying the same id so a WPR trace can be stitched
+    // together without archaeology; the final stage emits a single end-to-end
+    // measure per tracked keystroke for fleet telemetry.
+    void ControlCore::_markInputSent() noexcept
+    {
+        if (_inputLatencyStage.load(std::memory_order_acquire) != 0)
+        {
+            // The previous keystroke is still in flight; keep tracking it.
+            return;
+        }
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        _inputLatencyId++;
+        _inputLatencySendQpc = now.QuadPart;
+        _inputLatencyStage.store(1, std::memory_order_release);
+
+        TraceLoggingWrite(
+            g_hTerminalControlProvider,
+            "InputLatencyKeySent",
+            TraceLoggingDescription("A tracked keystroke was sent to the connection"),
+            TraceLoggingUInt32(_inputLatencyId, "id"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
+    void ControlCore::_markInputEchoReceived() noexcept
+    {
+        if (_inputLatencyStage.load(std::memory_order_acquire) != 1)
+        {
+            return;
+        }
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        _inputLatencyEchoQpc = now.QuadPart;
+        _inputLatencyStage.store(2, std::memory_order_release);
+
+        TraceLoggingWrite(
+            g_hTerminalControlProvider,
+            "InputLatencyEchoReceived",
+            TraceLoggingDescription("The connection produced output after a tracked keystroke"),
+            TraceLoggingUInt32(_inputLatencyId, "id"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
+    void ControlCore::_markInputPresented() noexcept
+    {
+        if (_inputLatencyStage.load(std::memory_order_acquire) != 2)
+        {
+            return;
+        }
+
+        LARGE_INTEGER now, frequency;
+        QueryPerformanceCounter(&now);
+        QueryPerformanceFrequency(&frequency);
+
+        const auto echoUs = ((_inputLatencyEchoQpc - _inputLatencySendQpc) * 1'000'000) / frequency.QuadPart;
+        const auto totalUs = ((now.QuadPart - _inputLatencySendQpc) * 1'000'000) / frequency.QuadPart;
+        _inputLatencyStage.store(0, std::memory_order_release);
+
+        TraceLoggingWrite(
+            g_hTerminalControlProvider,
+            "InputToPresentLatency",
+            TraceLoggingDescription("End-to-end latency of one keystroke from send to presented echo"),
+            TraceLoggingUInt32(_inputLatencyId, "id"),
+            TraceLoggingInt64(echoUs, "echoMicroseconds"),
+            TraceLoggingInt64(totalUs - echoUs, "presentMicroseconds"),
+            TraceLoggingInt64(totalUs, "totalMicroseconds"),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+    }
+
     uint64_t ControlCore::SwapChainHandle() const
     {
         // This is only ever called by TermControl::AttachContent, which occurs
@@ -2279,6 +2900,31 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         if (_initializedTerminal.load(std::memory_order_relaxed))
         {
             // show is true, hide is false
+            if (showOrHide)
+            {
+                // The swapchain retains the last frame we presented, but after
+                // a long stretch hidden (a dismissed quake-mode window, say)
+                // the GPU may have evicted its surfaces, and presents into an
+                // occluded window can be dropped by the compositor. Repaint
+                // everything right as the window comes back, so the summon
+                // animation reveals a current frame instead of a blank or
+                // stale surface.
+                const auto lock = _terminal->LockForWriting();
+                _renderer->EnablePainting();
+                _renderer->TriggerRedrawAll();
+            }
+            else
+            {
+                // Nobody can see the frames of a hidden window, so stop
+                // producing them. Invalidations keep accumulating in the
+                // engines while the render thread is paused, and the
+                // TriggerRedrawAll() above repaints the rest when we're next
+                // shown, so a window streaming a build log stays dormant for
+                // the price of a single full repaint on summon.
+                const auto lock = _terminal->LockForWriting();
+                _renderer->DisablePainting();
+            }
+
             if (auto conpty{ _connection.try_as<TerminalConnection::ConptyConnection>() })
             {
                 conpty.ShowHide(showOrHide);
@@ -2407,6 +3053,43 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _terminal->ClearAllMarks();
     }
 
+    // Method Description:
+    // - Collect the text buffer's memory accounting, log it for fleet-wide
+    //   analysis and surface a human-readable summary as an info notice. This
+    //   backs the dumpMemoryUsage action, so that memory growth can be
+    //   attributed to scrollback vs. hyperlinks without attaching a debugger.
+    void ControlCore::DumpMemoryUsage()
+    {
+        TextBuffer::MemoryUsage usage;
+        {
+            const auto lock = _terminal->LockForReading();
+            usage = _terminal->GetTextBuffer().GetMemoryUsage();
+        }
+
+        TraceLoggingWrite(
+            g_hTerminalControlProvider,
+            "TerminalMemoryUsage",
+            TraceLoggingDescription("Memory accounting for one terminal's text buffer"),
+            TraceLoggingUInt64(usage.slabBytes, "slabBytes"),
+            TraceLoggingUInt64(usage.coldSlabBytes, "coldSlabBytes"),
+            TraceLoggingUInt64(usage.charsHeapBytes, "charsHeapBytes"),
+            TraceLoggingUInt64(usage.attrRunBytes, "attrRunBytes"),
+            TraceLoggingUInt64(usage.hyperlinkBytes, "hyperlinkBytes"),
+            TraceLoggingUInt64(usage.Total(), "totalBytes"),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
+        const winrt::hstring message{ fmt::format(std::wstring_view{ RS_(L"TerminalMemoryUsageNotice") },
+                                                  usage.Total() / 1024,
+                                                  usage.slabBytes / 1024,
+                                                  usage.coldSlabBytes / 1024,
+                                                  usage.charsHeapBytes / 1024,
+                                                  usage.attrRunBytes / 1024,
+                                                  usage.hyperlinkBytes / 1024) };
+        auto noticeArgs = winrt::make<NoticeEventArgs>(NoticeLevel::Info, message);
+        _RaiseNoticeHandlers(*this, std::move(noticeArgs));
+    }
+
     void ControlCore::ScrollToMark(const Control::ScrollToMarkDirection& direction)
     {
         const auto lock = _terminal->LockForWriting();
@@ -80,7 +80,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         void Detach();
 
-        void UpdateSettings(const Control::IControlSettings& settings, const IControlAppearance& newAppearance);
+        bool UpdateSettings(const Control::IControlSettings& settings, const IControlAppearance& newAppearance);
         void ApplyAppearance(const bool& focused);
         Control::IControlSettings Settings() { return *_settings; };
         Control::IControlAppearance FocusedAppearance() const { return *_settings->FocusedAppearance(); };
@@ -165,6 +165,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void ClearMark();
         void ClearAllMarks();
         void ScrollToMark(const Control::ScrollToMarkDirection& direction);
+        void DumpMemoryUsage();
 
         void SelectCommand(const bool goUp);
         void SelectOutput(const bool goUp);
@@ -181,6 +182,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         bool SendCharEvent(const wchar_t ch,
                            const WORD scanCode,
                            const ::Microsoft::Terminal::Core::ControlKeyStates modifiers);
+        winrt::hstring SendKeyEventForBroadcast(const WORD vkey,
+                                                const WORD scanCode,
+                                                const ::Microsoft::Terminal::Core::ControlKeyStates modifiers,
+                                                const bool keyDown);
+        winrt::hstring SendCharEventForBroadcast(const wchar_t ch,
+                                                 const WORD scanCode,
+                                                 const ::Microsoft::Terminal::Core::ControlKeyStates modifiers);
+        uint64_t InputModeFingerprint();
+        bool TrySendEncodedInput(const uint64_t fingerprint, const winrt::hstring& encoded);
         bool SendMouseEvent(const til::point viewportPos,
                             const unsigned int uiButton,
                             const ::Microsoft::Terminal::Core::ControlKeyStates states,
@@ -210,6 +220,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void ClearSearch();
 
         Windows::Foundation::Collections::IVector<int32_t> SearchResultRows();
+        com_array<Core::Color> MinimapRowColors(int32_t sampleCount) const;
 
         void LeftClickOnTerminal(const til::point terminalPosition,
                                  const int numberOfClicks,
@@ -287,6 +298,19 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             std::shared_ptr<ThrottledFuncTrailing<>> tsfTryRedrawCanvas;
             std::unique_ptr<til::throttled_func_trailing<>> updatePatternLocations;
             std::shared_ptr<ThrottledFuncTrailing<Control::ScrollPositionChangedArgs>> updateScrollBar;
+
+            // The most recently requested panel size/scale, plus the bookkeeping the
+            // background resize worker uses to coalesce rapid intermediate sizes.
+            // See SizeOrScaleChanged.
+            struct
+            {
+                float width = 0;
+                float height = 0;
+                float scale = 0;
+            } requestedSize;
+            uint64_t sizeRequestSerial = 0;
+            bool sizePending = false;
+            bool sizeChangeInFlight = false;
         };
 
         std::atomic<bool> _initializedTerminal{ false };
@@ -298,6 +322,17 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         winrt::com_ptr<ControlSettings> _settings{ nullptr };
 
+        // The engine-bound parts of the appearance most recently applied by
+        // ApplyAppearance, so that a focus change between identical focused
+        // and unfocused appearances doesn't force a full-buffer repaint.
+        struct AppliedEngineAppearance
+        {
+            til::color selectionBackground;
+            bool retroTerminalEffect = false;
+            winrt::hstring pixelShaderPath;
+        };
+        std::optional<AppliedEngineAppearance> _appliedEngineAppearance;
+
         std::shared_ptr<::Microsoft::Terminal::Core::Terminal> _terminal{ nullptr };
 
         // NOTE: _renderEngine must be ordered before _renderer.
@@ -309,6 +344,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         std::unique_ptr<::Microsoft::Console::Render::Renderer> _renderer{ nullptr };
 
         ::Search _searcher;
+        // Identifies the most recent search request. A background scan whose generation
+        // no longer matches has been superseded and abandons its work.
+        std::atomic<uint64_t> _searchGeneration{ 0 };
 
         winrt::handle _lastSwapChainHandle{ nullptr };
 
@@ -351,6 +389,13 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _refreshSizeUnderLock();
         void _updateSelectionUI();
         bool _shouldTryUpdateSelection(const WORD vkey);
+        ::Microsoft::Console::VirtualTerminal::TerminalInput::OutputType _translateKeyEvent(const WORD vkey,
+                                                                                            const WORD scanCode,
+                                                                                            const ::Microsoft::Terminal::Core::ControlKeyStates modifiers,
+                                                                                            const bool keyDown);
+        ::Microsoft::Console::VirtualTerminal::TerminalInput::OutputType _translateCharEvent(const wchar_t ch,
+                                                                                             const WORD scanCode,
+                                                                                             const ::Microsoft::Terminal::Core::ControlKeyStates modifiers);
 
         void _handleControlC();
         void _sendInputToConnection(std::wstring_view wstr);
@@ -376,6 +421,18 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         MidiAudio _midiAudio;
         winrt::Windows::System::DispatcherQueueTimer _midiAudioSkipTimer{ nullptr };
 
+        // Input-to-photon latency markers. One keystroke is tracked at a time:
+        // TrySendKeyEvent arms the marker, the connection output handler stamps
+        // when the echo came back, and the renderer's painted callback emits a
+        // single correlated end-to-end event once that echo has been presented.
+        // Each transition has exactly one writing thread (UI arms 0->1, the
+        // connection thread advances 1->2, the render thread retires 2->0), so
+        // the stage atomic is the only synchronization needed.
+        std::atomic<uint8_t> _inputLatencyStage{ 0 };
+        uint32_t _inputLatencyId = 0;
+        int64_t _inputLatencySendQpc = 0;
+        int64_t _inputLatencyEchoQpc = 0;
+
 #pragma region RendererCallbacks
         void _rendererWarning(const HRESULT hr);
         winrt::fire_and_forget _renderEngineSwapChainChanged(const HANDLE handle);
@@ -386,12 +443,23 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _raiseReadOnlyWarning();
         void _updateAntiAliasingMode();
         void _connectionOutputHandler(const hstring& hstr);
+        void _markInputSent() noexcept;
+        void _markInputEchoReceived() noexcept;
+        void _markInputPresented() noexcept;
         void _updateHoveredCell(const std::optional<til::point> terminalPosition);
         void _setOpacity(const double opacity, const bool focused = true);
 
         bool _isBackgroundTransparent();
         void _focusChanged(bool focused);
 
+        winrt::fire_and_forget _searchAsync(winrt::hstring text, const bool goForward, const bool caseSensitive, const uint64_t generation);
+        void _reportSearchResults();
+
+        winrt::fire_and_forget _pasteAsync(std::wstring text);
+
+        void _applySizeChangeUnderLock(const float width, const float height, const float scale);
+        winrt::fire_and_forget _applySizeChangeAsync();
+
         void _selectSpan(til::point_span s);
 
         void _contextMenuSelectMark(
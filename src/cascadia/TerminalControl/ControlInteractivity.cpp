@@ -339,6 +339,29 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         const auto terminalPosition = _getTerminalPosition(til::point{ pixelPosition });
 
+        // High-polling-rate mice deliver hundreds of move events per second,
+        // and nearly all of them land in the same cell as the previous one.
+        // Everything a move can affect - the hovered cell, VT mouse events,
+        // the selection endpoint - is cell-granular, so a move that changes
+        // neither the cell nor any of the accompanying state has no further
+        // effect and can be dropped before we take any locks. Sub-cell motion
+        // still matters while a single click might yet become a drag, so
+        // don't skip in that case.
+        if (!_singleClickTouchdownPos &&
+            _lastPointerMovedCell == terminalPosition &&
+            _lastPointerMovedButtons == buttonState &&
+            _lastPointerMovedUpdateKind == pointerUpdateKind &&
+            _lastPointerMovedModifiers == modifiers &&
+            _lastPointerMovedFocused == focused)
+        {
+            return;
+        }
+        _lastPointerMovedCell = terminalPosition;
+        _lastPointerMovedButtons = buttonState;
+        _lastPointerMovedUpdateKind = pointerUpdateKind;
+        _lastPointerMovedModifiers = modifiers;
+        _lastPointerMovedFocused = focused;
+
         // Short-circuit isReadOnly check to avoid warning dialog
         if (focused && !_core->IsInReadOnlyMode() && _canSendVTMouseInput(modifiers))
         {
@@ -381,6 +404,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _core->SetHoveredCell(terminalPosition.to_core_point());
     }
 
+    void ControlInteractivity::PointerExited()
+    {
+        // Forget the cached move state: when the pointer comes back, the first
+        // move has to re-establish the hovered cell even if it lands in the
+        // same cell it left from.
+        _lastPointerMovedCell = std::nullopt;
+        _core->ClearHoveredCell();
+    }
+
     void ControlInteractivity::TouchMoved(const Core::Point newTouchPoint,
                                           const bool focused)
     {
@@ -614,6 +646,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         auto viewTop = ::base::saturated_cast<int>(::std::round(_internalScrollbarPosition));
         if (viewTop != _core->ScrollOffset())
         {
+            // The content moved underneath the pointer, so the next move event
+            // has to be processed even if the pointer stayed in the same cell.
+            _lastPointerMovedCell = std::nullopt;
+
             _core->UserScrollViewport(viewTop);
 
             // _core->ScrollOffset() is now set to newValue
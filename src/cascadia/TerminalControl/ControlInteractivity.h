@@ -64,6 +64,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                           const bool focused,
                           const Core::Point pixelPosition,
                           const bool pointerPressedInBounds);
+        void PointerExited();
         void TouchMoved(const Core::Point newTouchPoint,
                         const bool focused);
 
@@ -127,6 +128,16 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         std::optional<Core::Point> _lastMouseClickPos;
         std::optional<Core::Point> _singleClickTouchdownPos;
         std::optional<Core::Point> _lastMouseClickPosNoSelection;
+        // The cell and accompanying state of the last pointer-moved event we
+        // processed, used to short-circuit the flood of sub-cell move events
+        // a high-polling-rate mouse produces. Cleared whenever the content
+        // can move underneath a stationary pointer (scrolling) or the pointer
+        // leaves the control.
+        std::optional<til::point> _lastPointerMovedCell;
+        Control::MouseButtonState _lastPointerMovedButtons{};
+        unsigned int _lastPointerMovedUpdateKind{ 0 };
+        ::Microsoft::Terminal::Core::ControlKeyStates _lastPointerMovedModifiers{};
+        bool _lastPointerMovedFocused{ false };
         // This field tracks whether the selection has changed meaningfully
         // since it was last copied. It's generally used to prevent copyOnSelect
         // from firing when the pointer _just happens_ to be released over the
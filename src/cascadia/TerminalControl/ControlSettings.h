@@ -83,5 +83,82 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             return _focusedAppearance->GetColorTableEntry(index);
         }
+
+        // Method Description:
+        // - Compares this snapshot against another one, value by value. Used on
+        //   settings reload to tell whether a control's effective settings
+        //   actually changed, so callers can skip re-applying identical
+        //   settings to the terminal and renderer.
+        // - KeyBindings is deliberately left out of the comparison: a reload
+        //   always builds a new bindings object, and adopting the new snapshot
+        //   is all that's needed to pick it up.
+        bool Equals(const ControlSettings& other) const
+        {
+#define COMPARE_SETTING(type, name, ...)       \
+    if (!_valueEquals(_##name, other._##name)) \
+    {                                          \
+        return false;                          \
+    }
+            CORE_SETTINGS(COMPARE_SETTING)
+            CONTROL_SETTINGS(COMPARE_SETTING)
+#undef COMPARE_SETTING
+
+            if (_hasUnfocusedAppearance != other._hasUnfocusedAppearance)
+            {
+                return false;
+            }
+            return _focusedAppearance->Equals(*other._focusedAppearance) &&
+                   _unfocusedAppearance->Equals(*other._unfocusedAppearance);
+        }
+
+    private:
+        // Comparison helpers for Equals. Most settings are plain values, but a
+        // few are WinRT objects where operator== only compares identity, and
+        // the model hands us freshly created objects on every reload.
+        template<typename T>
+        static bool _valueEquals(const T& lhs, const T& rhs)
+        {
+            return lhs == rhs;
+        }
+        static bool _valueEquals(const winrt::Windows::UI::Text::FontWeight& lhs,
+                                 const winrt::Windows::UI::Text::FontWeight& rhs) noexcept
+        {
+            return lhs.Weight == rhs.Weight;
+        }
+        static bool _valueEquals(const winrt::Windows::Foundation::IReference<winrt::Microsoft::Terminal::Core::Color>& lhs,
+                                 const winrt::Windows::Foundation::IReference<winrt::Microsoft::Terminal::Core::Color>& rhs)
+        {
+            if (!lhs || !rhs)
+            {
+                return !lhs == !rhs;
+            }
+            return til::color{ lhs.Value() } == til::color{ rhs.Value() };
+        }
+        template<typename K, typename V>
+        static bool _valueEquals(const winrt::Windows::Foundation::Collections::IMap<K, V>& lhs,
+                                 const winrt::Windows::Foundation::Collections::IMap<K, V>& rhs)
+        {
+            if (!lhs || !rhs)
+            {
+                return !lhs == !rhs;
+            }
+            if (lhs.Size() != rhs.Size())
+            {
+                return false;
+            }
+            for (const auto& pair : lhs)
+            {
+                const auto key{ pair.Key() };
+                if (!rhs.HasKey(key) || rhs.Lookup(key) != pair.Value())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        static bool _valueEquals(const Control::IKeyBindings&, const Control::IKeyBindings&) noexcept
+        {
+            return true;
+        }
     };
 }
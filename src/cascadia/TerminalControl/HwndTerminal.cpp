@@ -211,6 +211,7 @@ HRESULT HwndTerminal::Initialize()
     RETURN_IF_FAILED(dxEngine->SetHwnd(_hwnd.get()));
     RETURN_IF_FAILED(dxEngine->Enable());
     _renderer->AddRenderEngine(dxEngine.get());
+    _renderer->SetPaintedCallback([this](const std::span<const til::rect> dirtyCells) noexcept { _PublishInvalidatedRegion(dirtyCells); });
 
     _UpdateFont(USER_DEFAULT_SCREEN_DPI);
     RECT windowRect;
@@ -290,6 +291,35 @@ void HwndTerminal::RegisterWriteCallback(const void _stdcall callback(wchar_t*))
     _pfnWriteCallback = callback;
 }
 
+void HwndTerminal::RegisterInvalidateCallback(void _stdcall callback(const til::rect*, uint32_t)) noexcept
+{
+    _pfnInvalidateCallback = callback;
+}
+
+// Called on the render thread after each presented frame. Converts the dirty
+// cell runs the renderer painted into pixel rectangles and hands them to the
+// embedding application, so it can invalidate just those parts of its surface
+// instead of blitting the whole thing.
+void HwndTerminal::_PublishInvalidatedRegion(const std::span<const til::rect> dirtyCells) noexcept
+try
+{
+    if (!_pfnInvalidateCallback || dirtyCells.empty())
+    {
+        return;
+    }
+
+    const auto fontSize = _actualFont.GetSize();
+    _invalidatedRects.clear();
+    _invalidatedRects.reserve(dirtyCells.size());
+    for (const auto& cells : dirtyCells)
+    {
+        _invalidatedRects.push_back(cells.scale_up(fontSize));
+    }
+
+    _pfnInvalidateCallback(_invalidatedRects.data(), gsl::narrow_cast<uint32_t>(_invalidatedRects.size()));
+}
+CATCH_LOG()
+
 ::Microsoft::Console::Render::IRenderData* HwndTerminal::GetRenderData() const noexcept
 {
     return _terminal.get();
@@ -415,6 +445,14 @@ try
 }
 CATCH_LOG()
 
+void _stdcall TerminalRegisterInvalidateCallback(void* terminal, void __stdcall callback(const til::rect*, uint32_t))
+try
+{
+    const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    publicTerminal->RegisterInvalidateCallback(callback);
+}
+CATCH_LOG()
+
 void _stdcall TerminalSendOutput(void* terminal, LPCWSTR data)
 try
 {
@@ -669,7 +707,7 @@ try
     TextBuffer::TextAndColor bufferData;
     {
         const auto lock = publicTerminal->_terminal->LockForWriting();
-        bufferData = publicTerminal->_terminal->RetrieveSelectedTextFromBuffer(false);
+        bufferData = publicTerminal->_terminal->RetrieveSelectedTextFromBuffer(false, false);
         publicTerminal->_ClearSelection();
     }
 
@@ -123,9 +123,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         }
 
         // Get the cursor position in text buffer position
-        auto cursorArgs = winrt::make_self<CursorPositionEventArgs>();
-        _CurrentCursorPositionHandlers(*this, *cursorArgs);
-        const til::point cursorPos{ til::math::flooring, cursorArgs->CurrentPosition() };
+        _CurrentCursorPositionHandlers(*this, *_cursorArgs);
+        const til::point cursorPos{ til::math::flooring, _cursorArgs->CurrentPosition() };
 
         const auto actualCanvasWidth{ Canvas().ActualWidth() };
         const auto actualTextBlockHeight{ TextBlock().ActualHeight() };
@@ -158,17 +157,21 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TSFInputControl::_RedrawCanvas()
     {
         // Get Font Info as we use this is the pixel size for characters in the display
-        auto fontArgs = winrt::make_self<FontInfoEventArgs>();
-        _CurrentFontInfoHandlers(*this, *fontArgs);
+        _CurrentFontInfoHandlers(*this, *_fontArgs);
 
-        const til::size fontSize{ til::math::flooring, fontArgs->FontSize() };
+        const til::size fontSize{ til::math::flooring, _fontArgs->FontSize() };
 
         // Convert text buffer cursor position to client coordinate position
         // within the window. This point is in _pixels_
         const auto clientCursorPos{ _currentTerminalCursorPos * fontSize };
 
-        // Get scale factor for view
-        const auto scaleFactor = DisplayInformation::GetForCurrentView().RawPixelsPerViewPixel();
+        // Get scale factor for view. The DisplayInformation instance is cached, but
+        // the scale is queried fresh since it changes when the window moves displays.
+        if (!_displayInformation)
+        {
+            _displayInformation = DisplayInformation::GetForCurrentView();
+        }
+        const auto scaleFactor = _displayInformation.RawPixelsPerViewPixel();
 
         const til::point clientCursorInDips{ til::math::flooring, clientCursorPos.x / scaleFactor, clientCursorPos.y / scaleFactor };
 
@@ -313,10 +316,12 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         try
         {
             const auto range = args.Request().Range();
-            const auto text = _inputBuffer.substr(
+            // substr on a view rather than the string; this runs per keystroke and
+            // the intermediate std::wstring copy is pure waste.
+            const auto text = std::wstring_view{ _inputBuffer }.substr(
                 range.StartCaretPosition,
                 range.EndCaretPosition - range.StartCaretPosition);
-            args.Request().Text(text);
+            args.Request().Text(winrt::hstring{ text });
         }
         CATCH_LOG();
     }
@@ -384,8 +389,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             else
             {
                 Canvas().Visibility(Visibility::Visible);
-                const auto text = _inputBuffer.substr(_activeTextStart);
-                TextBlock().Text(text);
+                const auto text = std::wstring_view{ _inputBuffer }.substr(_activeTextStart);
+                TextBlock().Text(winrt::hstring{ text });
             }
 
             // Notify the TSF that the update succeeded
@@ -402,13 +407,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
     void TSFInputControl::_SendAndClearText()
     {
-        const auto text = _inputBuffer.substr(_activeTextStart);
+        const auto text = std::wstring_view{ _inputBuffer }.substr(_activeTextStart);
         if (text.empty())
         {
             return;
         }
 
-        _CompositionCompletedHandlers(text);
+        // The entire pending composition goes out as one string, so the terminal
+        // only sees a single write per completion.
+        _CompositionCompletedHandlers(winrt::hstring{ text });
 
         _activeTextStart = _inputBuffer.size();
 
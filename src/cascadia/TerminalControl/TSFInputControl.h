@@ -72,6 +72,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         winrt::Windows::UI::Text::Core::CoreTextEditContext::CompositionCompleted_revoker _compositionCompletedRevoker;
 
         Windows::UI::Text::Core::CoreTextEditContext _editContext{ nullptr };
+
+        // These are queried on every keystroke of an IME composition; pool the args
+        // objects and the view's DisplayInformation rather than reallocating them
+        // each time. The handlers only ever write the properties, they don't retain
+        // the args.
+        com_ptr<CursorPositionEventArgs> _cursorArgs{ winrt::make_self<CursorPositionEventArgs>() };
+        com_ptr<FontInfoEventArgs> _fontArgs{ winrt::make_self<FontInfoEventArgs>() };
+        winrt::Windows::Graphics::Display::DisplayInformation _displayInformation{ nullptr };
+
         std::wstring _inputBuffer;
         winrt::Windows::UI::Text::Core::CoreTextRange _selection{};
         size_t _activeTextStart = 0;
@@ -365,6 +365,27 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
             memset(data, 0, buffer.Length());
 
+            // Fill the center stripe with a coarse minimap of the buffer
+            // contents. The core hands us one color per bitmap pixel row,
+            // sampled from the rows of the buffer; marks and search results
+            // are drawn over it on the outer stripes afterwards.
+            {
+                const auto minimap = _core.MinimapRowColors(gsl::narrow_cast<int32_t>(drawableRange));
+                auto dst = drawableDataStart + pipWidth * sizeof(til::color);
+                for (const til::color color : minimap)
+                {
+                    if (color.a)
+                    {
+                        // The bitmap uses premultiplied alpha, so scale the
+                        // channels by the alpha the core picked for this row.
+#pragma warning(suppress : 26490) // Don't use reinterpret_cast (type.1).
+                        const DWORD c = color.a << 24 | (color.r * color.a / 255) << 16 | (color.g * color.a / 255) << 8 | (color.b * color.a / 255);
+                        std::fill_n(reinterpret_cast<DWORD*>(dst), pipWidth, c);
+                    }
+                    dst += stride;
+                }
+            }
+
             if (const auto marks = _core.ScrollMarks())
             {
                 for (const auto& m : marks)
@@ -528,7 +549,13 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // terminal.
         co_await wil::resume_foreground(Dispatcher());
 
-        _core.UpdateSettings(settings, unfocusedAppearance);
+        if (!_core.UpdateSettings(settings, unfocusedAppearance))
+        {
+            // Nothing in our effective settings actually changed (the reload
+            // was for some other profile, or a keybinding). The UI is already
+            // in the right state - don't re-apply everything.
+            co_return;
+        }
 
         _UpdateSettingsFromUIThread();
 
@@ -695,6 +722,56 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // that message, we'll redraw them.
     }
 
+    // Method Description:
+    // - Returns a BitmapImage for the given URI, shared across every control
+    //   on this UI thread. Previously each control decoded its own copy, so a
+    //   window split into N panes of the same profile decoded the same
+    //   (possibly 4K) image N times. The cache key includes the file's last
+    //   write time, so editing the image and reloading the settings still
+    //   picks up the new contents. Thread-local because XAML objects are tied
+    //   to their UI thread; weak references so that closing a window's last
+    //   control releases the decoded image.
+    static Media::Imaging::BitmapImage _getSharedBackgroundImage(const winrt::hstring& path, const Windows::Foundation::Uri& imageUri)
+    {
+        struct CacheEntry
+        {
+            winrt::weak_ref<Media::Imaging::BitmapImage> image;
+            uint64_t lastWriteTime = 0;
+        };
+        thread_local std::unordered_map<std::wstring, CacheEntry> cache;
+
+        // Sweep out entries whose images have been released, so the map
+        // doesn't grow with every image the user has ever configured.
+        std::erase_if(cache, [](const auto& it) { return !it.second.image.get(); });
+
+        // For local files a settings reload should notice that the image
+        // changed on disk; for anything else (web URLs and the like) the
+        // URI is all we have.
+        uint64_t lastWriteTime = 0;
+        if (WIN32_FILE_ATTRIBUTE_DATA attr{}; GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &attr))
+        {
+            lastWriteTime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) | attr.ftLastWriteTime.dwLowDateTime;
+        }
+
+        auto& entry = cache[std::wstring{ imageUri.AbsoluteCanonicalUri() }];
+        if (entry.lastWriteTime == lastWriteTime)
+        {
+            if (const auto image = entry.image.get())
+            {
+                return image;
+            }
+        }
+
+        // Note that BitmapImage handles the image load asynchronously,
+        // which is especially important since the image
+        // may well be both large and somewhere out on the
+        // internet.
+        Media::Imaging::BitmapImage image{ imageUri };
+        entry.image = image;
+        entry.lastWriteTime = lastWriteTime;
+        return image;
+    }
+
     // Method Description:
     // - Sets background image and applies its settings (stretch, opacity and alignment)
     // - Checks path validity
@@ -725,17 +802,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // Check if the image brush is already pointing to the image
         // in the modified settings; if it isn't (or isn't there),
         // set a new image source for the brush
-        auto imageSource = BackgroundImage().Source().try_as<Media::Imaging::BitmapImage>();
+        const Media::ImageSource image = _getSharedBackgroundImage(newAppearance.BackgroundImage(), imageUri);
 
-        if (imageSource == nullptr ||
-            imageSource.UriSource() == nullptr ||
-            !imageSource.UriSource().Equals(imageUri))
+        if (BackgroundImage().Source() != image)
         {
-            // Note that BitmapImage handles the image load asynchronously,
-            // which is especially important since the image
-            // may well be both large and somewhere out on the
-            // internet.
-            Media::Imaging::BitmapImage image(imageUri);
             BackgroundImage().Source(image);
         }
 
@@ -1205,6 +1275,79 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _core.SendInput(text);
     }
 
+    // Method Description:
+    // - Variants of RawWriteKeyEvent/RawWriteChar for broadcast input: they
+    //   write the event like the originals do, but additionally return the
+    //   sequence it was translated into ("" if none), so the caller can
+    //   offer the same bytes to sibling controls via TrySendEncodedInput.
+    winrt::hstring TermControl::SendKeyEventForBroadcast(const WORD vkey,
+                                                         const WORD scanCode,
+                                                         const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers,
+                                                         const bool keyDown)
+    {
+        const auto encoded = _core.SendKeyEventForBroadcast(vkey, scanCode, modifiers, keyDown);
+
+        if (vkey && keyDown && _automationPeer)
+        {
+            get_self<TermControlAutomationPeer>(_automationPeer)->RecordKeyEvent(vkey);
+        }
+
+        if (_cursorTimer)
+        {
+            // Manually show the cursor when a key is pressed. Restarting
+            // the timer prevents flickering.
+            _core.CursorOn(_core.SelectionMode() != SelectionInteractionMode::Mark);
+            _cursorTimer.Start();
+        }
+
+        return encoded;
+    }
+
+    winrt::hstring TermControl::SendCharEventForBroadcast(const wchar_t character,
+                                                          const WORD scanCode,
+                                                          const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers)
+    {
+        return _core.SendCharEventForBroadcast(character, scanCode, modifiers);
+    }
+
+    uint64_t TermControl::InputModeFingerprint()
+    {
+        return _core.InputModeFingerprint();
+    }
+
+    // Method Description:
+    // - Writes a sequence that a sibling control already encoded directly to
+    //   the connection, if this control would have translated the same event
+    //   into the same bytes.
+    // Return Value:
+    // - false if the caller should fall back to the full per-event path.
+    bool TermControl::TrySendEncodedInput(const uint64_t fingerprint, const winrt::hstring& encoded)
+    {
+        // The automation peer records every keystroke so that it can tell
+        // typed echo apart from application output; pre-encoded bytes don't
+        // come with a keystroke to record, so take the full path whenever a
+        // peer is attached.
+        if (_automationPeer)
+        {
+            return false;
+        }
+
+        if (!_core.TrySendEncodedInput(fingerprint, encoded))
+        {
+            return false;
+        }
+
+        if (_cursorTimer)
+        {
+            // Manually show the cursor while input is flowing. Restarting
+            // the timer prevents flickering.
+            _core.CursorOn(_core.SelectionMode() != SelectionInteractionMode::Mark);
+            _cursorTimer.Start();
+        }
+
+        return true;
+    }
+
     // Method Description:
     // - Manually handles key events for certain keys that can't be passed to us
     //   normally. Namely, the keys we're concerned with are F7 down and Alt up.
@@ -3199,7 +3342,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TermControl::_PointerExitedHandler(const Windows::Foundation::IInspectable& /*sender*/,
                                             const Windows::UI::Xaml::Input::PointerRoutedEventArgs& /*e*/)
     {
-        _core.ClearHoveredCell();
+        _interactivity.PointerExited();
     }
 
     void TermControl::_hoveredHyperlinkChanged(const IInspectable& /*sender*/, const IInspectable& /*args*/)
@@ -3554,6 +3697,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TermControl::ClearMark() { _core.ClearMark(); }
     void TermControl::ClearAllMarks() { _core.ClearAllMarks(); }
     void TermControl::ScrollToMark(const Control::ScrollToMarkDirection& direction) { _core.ScrollToMark(direction); }
+    void TermControl::DumpMemoryUsage() { _core.DumpMemoryUsage(); }
 
     Windows::Foundation::Collections::IVector<Control::ScrollMark> TermControl::ScrollMarks() const
     {
@@ -86,6 +86,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void ClearMark();
         void ClearAllMarks();
         void ScrollToMark(const Control::ScrollToMarkDirection& direction);
+        void DumpMemoryUsage();
         void SelectCommand(const bool goUp);
         void SelectOutput(const bool goUp);
 
@@ -152,6 +153,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         bool RawWriteKeyEvent(const WORD vkey, const WORD scanCode, const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers, const bool keyDown);
         bool RawWriteChar(const wchar_t character, const WORD scanCode, const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers);
         void RawWriteString(const winrt::hstring& text);
+        winrt::hstring SendKeyEventForBroadcast(const WORD vkey, const WORD scanCode, const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers, const bool keyDown);
+        winrt::hstring SendCharEventForBroadcast(const wchar_t character, const WORD scanCode, const winrt::Microsoft::Terminal::Core::ControlKeyStates modifiers);
+        uint64_t InputModeFingerprint();
+        bool TrySendEncodedInput(const uint64_t fingerprint, const winrt::hstring& encoded);
 
         void ShowContextMenu();
 
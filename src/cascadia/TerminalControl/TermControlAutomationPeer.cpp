@@ -133,14 +133,25 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TermControlAutomationPeer::SignalSelectionChanged()
     {
         UiaTracing::Signal::SelectionChanged();
+
+        // The event carries no payload, so consecutive signals merge: if one
+        // is already queued and hasn't been raised yet, it covers this change
+        // too, and the output path doesn't pay for another dispatch.
+        if (_selectionChangedPending.exchange(true, std::memory_order_relaxed))
+        {
+            return;
+        }
+
         auto dispatcher{ Dispatcher() };
         if (!dispatcher)
         {
+            _selectionChangedPending.store(false, std::memory_order_relaxed);
             return;
         }
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                strongThis->_selectionChangedPending.store(false, std::memory_order_relaxed);
                 if (auto control{ strongThis->_termControl.get() })
                 {
                     // The event that is raised when the text selection is modified.
@@ -159,14 +170,25 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TermControlAutomationPeer::SignalTextChanged()
     {
         UiaTracing::Signal::TextChanged();
+
+        // Fast output signals this once per rendered frame; with a screen
+        // reader attached, each raised event is a cross-process call. Merge
+        // consecutive signals into the one that's already queued.
+        if (_textChangedPending.exchange(true, std::memory_order_relaxed))
+        {
+            return;
+        }
+
         auto dispatcher{ Dispatcher() };
         if (!dispatcher)
         {
+            _textChangedPending.store(false, std::memory_order_relaxed);
             return;
         }
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                strongThis->_textChangedPending.store(false, std::memory_order_relaxed);
                 if (auto control{ strongThis->_termControl.get() })
                 {
                     // The event that is raised when textual content is modified.
@@ -185,14 +207,24 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TermControlAutomationPeer::SignalCursorChanged()
     {
         UiaTracing::Signal::CursorChanged();
+
+        // Like the other signals, this carries no payload, so a queued-but-
+        // not-yet-raised event covers any number of cursor movements.
+        if (_cursorChangedPending.exchange(true, std::memory_order_relaxed))
+        {
+            return;
+        }
+
         auto dispatcher{ Dispatcher() };
         if (!dispatcher)
         {
+            _cursorChangedPending.store(false, std::memory_order_relaxed);
             return;
         }
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                strongThis->_cursorChangedPending.store(false, std::memory_order_relaxed);
                 if (auto control{ strongThis->_termControl.get() })
                 {
                     // The event that is raised when the text was changed in an edit control.
@@ -242,26 +274,46 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             return;
         }
 
+        // Merge this chunk into whatever output is already waiting to be
+        // announced. If the queue wasn't empty, a drain is already scheduled
+        // on the dispatcher and will pick this text up too; the output path
+        // only pays for the append.
+        {
+            auto queuedOutput = _queuedOutput.lock();
+            const auto drainScheduled = !queuedOutput->empty();
+            queuedOutput->append(sanitized);
+            if (drainScheduled)
+            {
+                return;
+            }
+        }
+
         auto dispatcher{ Dispatcher() };
         if (!dispatcher)
         {
+            _queuedOutput.lock()->clear();
             return;
         }
 
         // IMPORTANT:
-        // [1] make sure the scope returns a copy of "sanitized" so that it isn't accidentally deleted
-        // [2] AutomationNotificationProcessing::All --> ensures it can be interrupted by keyboard events
-        // [3] Do not "RunAsync(...).get()". For whatever reason, this causes NVDA to just not receive "SignalTextChanged()"'s events.
-        dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }, sanitizedCopy{ hstring{ sanitized } }]() {
+        // [1] AutomationNotificationProcessing::All --> ensures it can be interrupted by keyboard events
+        // [2] Do not "RunAsync(...).get()". For whatever reason, this causes NVDA to just not receive "SignalTextChanged()"'s events.
+        dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                hstring queuedText;
+                {
+                    auto queuedOutput = strongThis->_queuedOutput.lock();
+                    queuedText = hstring{ *queuedOutput };
+                    queuedOutput->clear();
+                }
                 if (auto control{ strongThis->_termControl.get() })
                 {
                     try
                     {
                         strongThis->RaiseNotificationEvent(AutomationNotificationKind::ActionCompleted,
                                                            AutomationNotificationProcessing::All,
-                                                           sanitizedCopy,
+                                                           queuedText,
                                                            L"TerminalTextOutput");
                     }
                     CATCH_LOG();
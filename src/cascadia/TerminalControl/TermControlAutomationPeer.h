@@ -82,5 +82,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         winrt::weak_ref<Microsoft::Terminal::Control::implementation::TermControl> _termControl;
         Control::InteractivityAutomationPeer _contentAutomationPeer;
         til::shared_mutex<std::deque<wchar_t>> _keyEvents;
+
+        // Consecutive signals of the same kind are merged: while a dispatch
+        // for one of them is still queued on the dispatcher, further signals
+        // of that kind are covered by it and don't queue another. New output
+        // accumulates in _queuedOutput and is announced in one notification
+        // when its dispatch runs.
+        std::atomic<bool> _selectionChangedPending{ false };
+        std::atomic<bool> _textChangedPending{ false };
+        std::atomic<bool> _cursorChangedPending{ false };
+        til::shared_mutex<std::wstring> _queuedOutput;
     };
 }
@@ -12,6 +12,7 @@
 #include "../../buffer/out/UTextAdapter.h"
 
 #include <til/hash.h>
+#include <til/unicode.h>
 #include <winrt/Microsoft.Terminal.Core.h>
 
 using namespace winrt::Microsoft::Terminal::Core;
@@ -49,6 +50,15 @@ void Terminal::Create(til::size viewportSize, til::CoordType scrollbackLines, Re
     const UINT cursorSize = 12;
     _mainBuffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, true, renderer);
 
+    // Scrollback is mostly write-once and rarely revisited. Backing the row
+    // slabs with a spill file lets _SweepColdScrollback() evict rows far
+    // above the viewport from the working set; scrolling back into them
+    // faults them back in transparently.
+    if (scrollbackLines > 0)
+    {
+        _mainBuffer->EnableColdScrollbackSpill();
+    }
+
     auto dispatch = std::make_unique<AdaptDispatch>(*this, renderer, _renderSettings, _terminalInput);
     auto engine = std::make_unique<OutputStateMachineEngine>(std::move(dispatch));
     _stateMachine = std::make_unique<StateMachine>(std::move(engine));
@@ -132,9 +142,14 @@ void Terminal::UpdateSettings(ICoreSettings settings)
 //   CoreAppearance object.
 // Arguments:
 // - appearance: an ICoreAppearance with new settings values for us to use.
-void Terminal::UpdateAppearance(const ICoreAppearance& appearance)
+bool Terminal::UpdateAppearance(const ICoreAppearance& appearance)
 {
     auto& renderSettings = GetRenderSettings();
+    // The color generation moves whenever a Set* call below actually changes
+    // something, which tells the caller whether a repaint is warranted. Focus
+    // changes reapply the appearance every time, and focused and unfocused
+    // appearances are identical unless the user configured them apart.
+    const auto initialColorGeneration = renderSettings.GetColorGeneration();
 
     renderSettings.SetRenderMode(RenderSettings::Mode::IntenseIsBold, appearance.IntenseIsBold());
     renderSettings.SetRenderMode(RenderSettings::Mode::IntenseIsBright, appearance.IntenseIsBright());
@@ -191,12 +206,16 @@ void Terminal::UpdateAppearance(const ICoreAppearance& appearance)
         break;
     }
 
+    auto changed = renderSettings.GetColorGeneration() != initialColorGeneration;
+
     // We're checking if the main buffer exists here, but then setting the
     // appearance of the active one. If the main buffer exists, then at least
     // one buffer exists and _activeBuffer() will work
     if (_mainBuffer)
     {
-        _activeBuffer().GetCursor().SetStyle(appearance.CursorHeight(), cursorShape);
+        auto& cursor = _activeBuffer().GetCursor();
+        changed |= cursor.GetType() != cursorShape || cursor.GetSize() != appearance.CursorHeight();
+        cursor.SetStyle(appearance.CursorHeight(), cursorShape);
     }
 
     _defaultCursorShape = cursorShape;
@@ -205,6 +224,8 @@ void Terminal::UpdateAppearance(const ICoreAppearance& appearance)
     // workaround to force the control to redraw any scrollbar marks whose color
     // may have changed.
     _NotifyScrollEvent();
+
+    return changed;
 }
 
 void Terminal::SetCursorStyle(const DispatchTypes::CursorStyle cursorStyle)
@@ -417,14 +438,60 @@ try
 }
 CATCH_RETURN()
 
+// Method Description:
+// - Feeds output from the connection into the parser. Large chunks are
+//   processed in slices: between slices, if another thread is queued up on the
+//   terminal lock (a keystroke, a selection update, the renderer), we briefly
+//   suspend the lock to let it in. The ticket lock is FIFO-fair, so a waiter
+//   is guaranteed its turn before we reacquire. This bounds the latency a
+//   runaway `cat` can add to input handling to roughly one slice's worth of
+//   parsing, instead of a whole multi-megabyte chunk.
 void Terminal::Write(std::wstring_view stringView)
 {
-    const auto& cursor = _activeBuffer().GetCursor();
-    const til::point cursorPosBefore{ cursor.GetPosition() };
+    const til::point cursorPosBefore{ _activeBuffer().GetCursor().GetPosition() };
+
+    while (!stringView.empty())
+    {
+        auto chunk = stringView;
+        if (chunk.size() > _writeChunkChars)
+        {
+            // Don't split a surrogate pair across slices.
+            const size_t extra = til::is_leading_surrogate(chunk[_writeChunkChars - 1]) ? 1 : 0;
+            chunk = chunk.substr(0, _writeChunkChars + extra);
+        }
+        stringView = stringView.substr(chunk.size());
 
-    _stateMachine->ProcessString(stringView);
+        {
+            // Fast output scrolls the viewport once per line, and forwarding every one
+            // of those to the control layer costs an allocation and a throttled-func
+            // poke each. Latch them while the parser runs and deliver at most one
+            // consolidated notification per slice below.
+            _deferScrollNotifications = true;
+            const auto restoreScrollNotifications = wil::scope_exit([this]() noexcept {
+                _deferScrollNotifications = false;
+            });
+            _stateMachine->ProcessString(chunk);
+        }
 
-    const til::point cursorPosAfter{ cursor.GetPosition() };
+        if (std::exchange(_scrollNotificationDeferred, false))
+        {
+            _NotifyScrollEvent();
+        }
+
+        if (!stringView.empty() && _readWriteLock.is_contended())
+        {
+            // Destroying the suspension reacquires the lock right away, but
+            // only after the already-queued waiters have had their turn.
+            //
+            // A suspension point can run a resize or a buffer switch on
+            // another thread, which is why anything we carry across slices
+            // (like the cursor position above) is position data, never a
+            // reference into the buffer.
+            const auto suspension = _readWriteLock.suspend();
+        }
+    }
+
+    const til::point cursorPosAfter{ _activeBuffer().GetCursor().GetPosition() };
 
     // Firing the CursorPositionChanged event is very expensive so we try not to
     // do that when the cursor does not need to be redrawn.
@@ -434,6 +501,15 @@ void Terminal::Write(std::wstring_view stringView)
     }
 }
 
+// Method Description:
+// - Adjusts how much output Write() parses per slice of the terminal lock.
+//   The default suits typical desktops; lower values trade raw throughput for
+//   better input and render latency on low-core machines.
+void Terminal::SetWriteChunking(size_t chunkChars) noexcept
+{
+    _writeChunkChars = std::max<size_t>(chunkChars, 1);
+}
+
 // Method Description:
 // - Attempts to snap to the bottom of the buffer, if SnapOnInput is true. Does
 //   nothing if SnapOnInput is set to false, or we're already at the bottom of
@@ -488,7 +564,7 @@ std::wstring Terminal::GetHyperlinkAtViewportPosition(const til::point viewportP
 std::wstring Terminal::GetHyperlinkAtBufferPosition(const til::point bufferPos)
 {
     // Case 1: buffer position has a hyperlink stored in the buffer
-    const auto attr = _activeBuffer().GetCellDataAt(bufferPos)->TextAttr();
+    const auto attr = _activeBuffer().GetRowByOffset(bufferPos.y).GetAttrByColumn(bufferPos.x);
     if (attr.IsHyperlink())
     {
         return _activeBuffer().GetHyperlinkUriFromId(attr.GetHyperlinkId());
@@ -551,7 +627,11 @@ std::wstring Terminal::GetHyperlinkAtBufferPosition(const til::point bufferPos)
 // - The hyperlink ID
 uint16_t Terminal::GetHyperlinkIdAtViewportPosition(const til::point viewportPos)
 {
-    return _activeBuffer().GetCellDataAt(_ConvertToBufferCell(viewportPos))->TextAttr().GetHyperlinkId();
+    // This is queried on every pointer move that crosses a cell boundary, so
+    // probe the row's attribute run directly instead of spinning up a full
+    // cell iterator just to read one attribute.
+    const auto bufferPos = _ConvertToBufferCell(viewportPos);
+    return _activeBuffer().GetRowByOffset(bufferPos.y).GetAttrByColumn(bufferPos.x).GetHyperlinkId();
 }
 
 // Method description:
@@ -740,6 +820,15 @@ TerminalInput::OutputType Terminal::SendCharEvent(const wchar_t ch, const WORD s
     return _getTerminalInput().HandleKey(keyDown);
 }
 
+// Method Description:
+// - Returns an opaque value identifying the terminal's input-encoding mode
+//   state. Broadcast input uses this to decide whether a sequence encoded by
+//   one terminal can be handed to another one verbatim.
+uint64_t Terminal::GetInputModeFingerprint() const noexcept
+{
+    return _getTerminalInput().GetModeFingerprint();
+}
+
 // Method Description:
 // - Tell the terminal input that we gained or lost focus. If the client
 //   requested focus events, this will send a message to them.
@@ -1047,6 +1136,35 @@ void Terminal::_PreserveUserScrollOffset(const int viewportDelta) noexcept
     }
 }
 
+// Method Description:
+// - Pushes scrollback rows that nobody is near out of the hot working set,
+//   in two tiers. Rows a couple of viewports above the visible area are
+//   flushed to the buffer's spill file and evicted; rows much further out
+//   are compressed into their serialized cold representation, freeing their
+//   backing memory entirely. Reading either kind back (scrolling up,
+//   search, ...) rehydrates it transparently.
+// - Called throttled from NotifyBufferRotation, i.e. only once the scrollback
+//   has filled up and started churning.
+void Terminal::_SweepColdScrollback()
+{
+    // Keep a healthy margin above the visible area resident so that casual
+    // scrolling doesn't immediately fault pages back in.
+    static constexpr til::CoordType hotViewportsAbove = 2;
+    // Rows this far out are cold enough to be worth full serialization;
+    // rehydrating them costs real work rather than a page fault, so the
+    // margin is a lot wider.
+    static constexpr til::CoordType compressViewportsAbove = 8;
+
+    const auto viewportHeight = _mutableViewport.Height();
+    const auto bottom = _mainBuffer->GetSize().Height() - 1;
+    const auto visibleTop = _VisibleStartIndex();
+
+    // Compress the coldest band first: the slabs it frees are slabs the
+    // spill below would otherwise flush to disk for nothing.
+    _mainBuffer->CompressRowsOutsideWindow(visibleTop - compressViewportsAbove * viewportHeight, bottom);
+    _mainBuffer->SpillRowsOutsideWindow(visibleTop - hotViewportsAbove * viewportHeight, bottom);
+}
+
 void Terminal::UserScrollViewport(const int viewTop)
 {
     // Clear the regex pattern tree so the renderer does not try to render them while scrolling
@@ -1080,6 +1198,16 @@ void Terminal::_NotifyScrollEvent()
     // See UserScrollViewport().
     _clearPatternTree();
 
+    // While Write() is parsing a slice of output, the scroll position is still in
+    // flux; remember that it changed and let Write() deliver one consolidated
+    // notification with the final values instead. User-initiated scrolls don't go
+    // through Write() and stay immediate.
+    if (_deferScrollNotifications)
+    {
+        _scrollNotificationDeferred = true;
+        return;
+    }
+
     if (_pfnScrollPositionChanged)
     {
         const auto visible = _GetVisibleViewport();
@@ -91,7 +91,7 @@ public:
                             Microsoft::Console::Render::Renderer& renderer);
 
     void UpdateSettings(winrt::Microsoft::Terminal::Core::ICoreSettings settings);
-    void UpdateAppearance(const winrt::Microsoft::Terminal::Core::ICoreAppearance& appearance);
+    bool UpdateAppearance(const winrt::Microsoft::Terminal::Core::ICoreAppearance& appearance);
     void SetFontInfo(const FontInfo& fontInfo);
     void SetCursorStyle(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::CursorStyle cursorStyle);
     void EraseScrollback();
@@ -102,6 +102,7 @@ public:
 
     // Write comes from the PTY and goes to our parser to be stored in the output buffer
     void Write(std::wstring_view stringView);
+    void SetWriteChunking(size_t chunkChars) noexcept;
 
     void _assertLocked() const noexcept;
     void _assertUnlocked() const noexcept;
@@ -176,6 +177,8 @@ public:
     [[nodiscard]] ::Microsoft::Console::VirtualTerminal::TerminalInput::OutputType SendCharEvent(const wchar_t ch, const WORD scanCode, const ControlKeyStates states) override;
     [[nodiscard]] ::Microsoft::Console::VirtualTerminal::TerminalInput::OutputType FocusChanged(const bool focused) override;
 
+    uint64_t GetInputModeFingerprint() const noexcept;
+
     [[nodiscard]] HRESULT UserResize(const til::size viewportSize) noexcept override;
     void UserScrollViewport(const int viewTop) override;
     int GetScrollOffset() noexcept override;
@@ -311,7 +314,7 @@ public:
     til::point SelectionEndForRendering() const;
     const SelectionEndpoint SelectionEndpointTarget() const noexcept;
 
-    const TextBuffer::TextAndColor RetrieveSelectedTextFromBuffer(bool trimTrailingWhitespace);
+    const TextBuffer::TextAndColor RetrieveSelectedTextFromBuffer(bool singleLine, bool withColor = true);
 #pragma endregion
 
 #ifndef NDEBUG
@@ -362,6 +365,14 @@ private:
 
     size_t _hyperlinkPatternId = 0;
 
+    // How many characters Write() parses per slice of the terminal lock
+    // before it considers yielding to waiting threads. See Terminal::Write.
+    size_t _writeChunkChars = 64 * 1024;
+    // See _NotifyScrollEvent(): scroll notifications raised while Write() is parsing
+    // a slice are latched and delivered as one consolidated callback per slice.
+    bool _deferScrollNotifications = false;
+    bool _scrollNotificationDeferred = false;
+
     std::wstring _workingDirectory;
 
     // This default fake font value is only used to check if the font is a raster font.
@@ -391,6 +402,10 @@ private:
 
     std::unique_ptr<TextBuffer> _mainBuffer;
     std::unique_ptr<TextBuffer> _altBuffer;
+    // The buffer from the last alt-buffer session, stashed on exit so that apps which
+    // toggle the alt screen repeatedly (less, vim, etc.) can re-enter it without
+    // allocating and tearing down an entire TextBuffer each time.
+    std::unique_ptr<TextBuffer> _altBufferCache;
     Microsoft::Console::Types::Viewport _mutableViewport;
     til::CoordType _scrollbackLines = 0;
     bool _detectURLs = false;
@@ -401,6 +416,9 @@ private:
     // _scrollOffset is the number of lines above the viewport that are currently visible
     // If _scrollOffset is 0, then the visible region of the buffer is the viewport.
     til::CoordType _scrollOffset = 0;
+    // Rows circled out of the buffer since the last cold scrollback sweep,
+    // see _SweepColdScrollback().
+    til::CoordType _rowsRotatedSinceColdSweep = 0;
     // TODO this might not be the value we want to store.
     // We might want to store the height in the scrollback that's currently visible.
     // Think on this some more.
@@ -455,6 +473,8 @@ private:
 
     void _PreserveUserScrollOffset(const int viewportDelta) noexcept;
 
+    void _SweepColdScrollback();
+
     void _NotifyScrollEvent();
 
     void _NotifyTerminalCursorPositionChanged() noexcept;
@@ -206,12 +206,33 @@ void Terminal::UseAlternateScreenBuffer(const TextAttribute& attrs)
 
     ClearSelection();
 
-    // Create a new alt buffer
-    _altBuffer = std::make_unique<TextBuffer>(_altBufferSize,
-                                              attrs,
-                                              cursorSize,
-                                              true,
-                                              _mainBuffer->GetRenderer());
+    // Reuse the buffer from the previous alt-buffer session if its size still matches.
+    // Resetting a screenful of rows in place is much cheaper than allocating and tearing
+    // down an entire TextBuffer, and apps like less/vim toggle the alt screen constantly.
+    if (_altBufferCache && _altBufferCache->GetSize().Dimensions() == _altBufferSize)
+    {
+        _altBuffer = std::move(_altBufferCache);
+        for (til::CoordType y = 0; y < _altBufferSize.height; ++y)
+        {
+            _altBuffer->GetMutableRowByOffset(y).Reset(attrs);
+        }
+        _altBuffer->SetCurrentAttributes(attrs);
+        // The rows were just reset, so nothing references the previous
+        // session's scroll marks or hyperlink ids anymore. Drop them so they
+        // can't reappear in (or accumulate across) this session.
+        _altBuffer->ClearAllMarks();
+        _altBuffer->ClearHyperlinkMaps();
+        _altBuffer->SetAsActiveBuffer(true);
+    }
+    else
+    {
+        _altBufferCache.reset();
+        _altBuffer = std::make_unique<TextBuffer>(_altBufferSize,
+                                                  attrs,
+                                                  cursorSize,
+                                                  true,
+                                                  _mainBuffer->GetRenderer());
+    }
     _mainBuffer->SetAsActiveBuffer(false);
 
     // Copy our cursor state to the new buffer's cursor
@@ -251,8 +272,8 @@ void Terminal::UseMainScreenBuffer()
     // To make UserResize() work as if we're back in the main buffer, we first need to unset
     // _altBuffer, which is used throughout this class as an indicator via _inAltBuffer().
     //
-    // We delay destroying the alt buffer instance to get a valid altBuffer->GetCursor() reference below.
-    const auto altBuffer = std::exchange(_altBuffer, nullptr);
+    // We delay releasing the alt buffer instance to get a valid altBuffer->GetCursor() reference below.
+    auto altBuffer = std::exchange(_altBuffer, nullptr);
     if (!altBuffer)
     {
         return;
@@ -296,6 +317,10 @@ void Terminal::UseMainScreenBuffer()
     // Update scrollbars
     _NotifyScrollEvent();
 
+    // Stash the buffer for the next alt-buffer session instead of destroying it.
+    altBuffer->SetAsActiveBuffer(false);
+    _altBufferCache = std::move(altBuffer);
+
     // redraw the screen
     _activeBuffer().TriggerRedrawAll();
 }
@@ -497,8 +522,9 @@ void Terminal::NotifyBufferRotation(const int delta)
     // manually erase our pattern intervals since the locations have changed now
     _patternIntervalTree = {};
 
-    auto& marks{ _activeBuffer().GetMarks() };
-    const auto hasScrollMarks = marks.size() > 0;
+    // Deliberately HasMarks and not GetMarks here: GetMarks flushes the
+    // accumulated mark shift, and this path runs for every circled row.
+    const auto hasScrollMarks = _activeBuffer().HasMarks();
     if (hasScrollMarks)
     {
         _activeBuffer().ScrollMarks(-delta);
@@ -510,4 +536,17 @@ void Terminal::NotifyBufferRotation(const int delta)
     {
         _NotifyScrollEvent();
     }
+
+    // Rotation only happens once the scrollback is full, which is exactly when
+    // evicting cold rows starts to pay off. The sweep is cheap but not free,
+    // so run it once per viewport's worth of circled rows rather than per row.
+    if (!_inAltBuffer())
+    {
+        _rowsRotatedSinceColdSweep += delta;
+        if (_rowsRotatedSinceColdSweep >= _mutableViewport.Height())
+        {
+            _rowsRotatedSinceColdSweep = 0;
+            _SweepColdScrollback();
+        }
+    }
 }
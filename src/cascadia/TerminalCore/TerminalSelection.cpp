@@ -870,15 +870,21 @@ void Terminal::ClearSelection()
 // - get wstring text from highlighted portion of text buffer
 // Arguments:
 // - singleLine: collapse all of the text to one line
+// - withColor: also extract the color of every character. Only needed for the
+//   HTML/RTF clipboard formats; plain text extraction is faster without it.
 // Return Value:
 // - wstring text from buffer. If extended to multiple lines, each line is separated by \r\n
-const TextBuffer::TextAndColor Terminal::RetrieveSelectedTextFromBuffer(bool singleLine)
+const TextBuffer::TextAndColor Terminal::RetrieveSelectedTextFromBuffer(bool singleLine, bool withColor)
 {
     const auto selectionRects = _GetSelectionRects();
 
-    const auto GetAttributeColors = [&](const auto& attr) {
-        return _renderSettings.GetAttributeColors(attr);
-    };
+    std::function<std::pair<COLORREF, COLORREF>(const TextAttribute&)> GetAttributeColors;
+    if (withColor)
+    {
+        GetAttributeColors = [&](const auto& attr) {
+            return _renderSettings.GetAttributeColors(attr);
+        };
+    }
 
     // GH#6740: Block selection should preserve the visual structure:
     // - CRLFs need to be added - so the lines structure is preserved
@@ -198,6 +198,11 @@ namespace winrt::Microsoft::Terminal::Settings::Editor::implementation
         {
             _PropertyChangedHandlers(*this, PropertyChangedEventArgs{ L"AccessibleName" });
         }
+        if (propertyName == L"Color")
+        {
+            // The cached brush is rebuilt on the next Brush() call.
+            _PropertyChangedHandlers(*this, PropertyChangedEventArgs{ L"Brush" });
+        }
     }
 
 }
@@ -68,6 +68,20 @@ namespace winrt::Microsoft::Terminal::Settings::Editor::implementation
             return hstring{ fmt::format(FMT_COMPILE(L"{} RGB({}, {}, {})"), _Name, _Color.R, _Color.G, _Color.B) };
         }
 
+        // Method Description:
+        // - Returns a brush of this entry's color. The brush is created lazily
+        //   and reused for as long as the color doesn't change, so rebinding a
+        //   recycled list container (or revisiting the page) doesn't allocate
+        //   a fresh brush for every color chip in the scheme list.
+        Windows::UI::Xaml::Media::SolidColorBrush Brush()
+        {
+            if (!_Brush || til::color{ _Brush.Color() } != til::color{ _Color })
+            {
+                _Brush = Windows::UI::Xaml::Media::SolidColorBrush{ _Color };
+            }
+            return _Brush;
+        }
+
         WINRT_CALLBACK(PropertyChanged, Windows::UI::Xaml::Data::PropertyChangedEventHandler);
         WINRT_OBSERVABLE_PROPERTY(Windows::UI::Color, Color, _PropertyChangedHandlers);
         WINRT_OBSERVABLE_PROPERTY(winrt::hstring, Name, _PropertyChangedHandlers);
@@ -75,6 +89,7 @@ namespace winrt::Microsoft::Terminal::Settings::Editor::implementation
 
     private:
         Windows::UI::Color _color;
+        Windows::UI::Xaml::Media::SolidColorBrush _Brush{ nullptr };
 
         void _PropertyChangedHandler(const Windows::Foundation::IInspectable& sender, const Windows::UI::Xaml::Data::PropertyChangedEventArgs& args);
     };
@@ -97,6 +97,7 @@ static constexpr std::string_view ExpandSelectionToWordKey{ "expandSelectionToWo
 static constexpr std::string_view RestartConnectionKey{ "restartConnection" };
 static constexpr std::string_view ToggleBroadcastInputKey{ "toggleBroadcastInput" };
 static constexpr std::string_view OpenAboutKey{ "openAbout" };
+static constexpr std::string_view DumpMemoryUsageKey{ "dumpMemoryUsage" };
 
 static constexpr std::string_view ActionKey{ "action" };
 
@@ -432,6 +433,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
                 { ShortcutAction::RestartConnection, RS_(L"RestartConnectionKey") },
                 { ShortcutAction::ToggleBroadcastInput, RS_(L"ToggleBroadcastInputCommandKey") },
                 { ShortcutAction::OpenAbout, RS_(L"OpenAboutCommandKey") },
+                { ShortcutAction::DumpMemoryUsage, RS_(L"DumpMemoryUsageCommandKey") },
             };
         }();
 
@@ -461,7 +463,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         auto data = winrt::to_string(content);
 
         std::string errs;
-        std::unique_ptr<Json::CharReader> reader{ Json::CharReaderBuilder{}.newCharReader() };
+        const auto reader{ JsonUtils::CreateCharReader() };
         Json::Value root;
         if (!reader->parse(data.data(), data.data() + data.size(), &root, &errs))
         {
@@ -134,7 +134,19 @@ SettingsLoader SettingsLoader::Default(const std::string_view& userJSON, const s
 // At a minimum you should do at least everything that SettingsLoader::Default does.
 SettingsLoader::SettingsLoader(const std::string_view& userJSON, const std::string_view& inboxJSON)
 {
-    _parse(OriginTag::InBox, {}, inboxJSON, inboxSettings);
+    // Outside of test code the inbox JSON is the compiled-in defaults.json.
+    // Its DOM can't possibly change for the lifetime of the process, so parse
+    // it exactly once and reuse it for every settings (re)load after that,
+    // instead of running jsoncpp over ~20kB of static text each time.
+    if (inboxJSON.data() == DefaultJson.data() && inboxJSON.size() == DefaultJson.size())
+    {
+        static const auto defaultJson{ _parseJson(DefaultJson) };
+        _parse(OriginTag::InBox, {}, defaultJson, inboxSettings);
+    }
+    else
+    {
+        _parse(OriginTag::InBox, {}, inboxJSON, inboxSettings);
+    }
 
     try
     {
@@ -160,15 +172,52 @@ SettingsLoader::SettingsLoader(const std::string_view& userJSON, const std::stri
 
 // Generate dynamic profiles and add them to the list of "inbox" profiles
 // (meaning profiles specified by the application rather by the user).
+//
+// The generators don't depend on each other and are bounded by I/O (registry,
+// file system, the VS setup COM API), so each one runs as its own thread pool
+// work item into a private vector. The results are appended in the fixed
+// order below, keeping profile order (and thus the settings.json we may write
+// back) identical to what the old sequential execution produced.
 void SettingsLoader::GenerateProfiles()
 {
-    _executeGenerator(PowershellCoreProfileGenerator{});
-    _executeGenerator(WslDistroGenerator{});
-    _executeGenerator(AzureCloudShellGenerator{});
-    _executeGenerator(VisualStudioGenerator{});
+    const PowershellCoreProfileGenerator powershellGenerator;
+    const WslDistroGenerator wslGenerator;
+    const AzureCloudShellGenerator azureGenerator;
+    const VisualStudioGenerator visualStudioGenerator;
 #if TIL_FEATURE_DYNAMICSSHPROFILES_ENABLED
-    _executeGenerator(SshHostGenerator{});
+    const SshHostGenerator sshGenerator;
 #endif
+
+    const std::array generators{
+        static_cast<const IDynamicProfileGenerator*>(&powershellGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&wslGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&azureGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&visualStudioGenerator),
+#if TIL_FEATURE_DYNAMICSSHPROFILES_ENABLED
+        static_cast<const IDynamicProfileGenerator*>(&sshGenerator),
+#endif
+    };
+
+    std::array<std::vector<winrt::com_ptr<Profile>>, generators.size()> results;
+    til::latch latch{ gsl::narrow_cast<ptrdiff_t>(generators.size()) };
+
+    for (size_t i = 0; i < generators.size(); ++i)
+    {
+        [](const SettingsLoader* self, const IDynamicProfileGenerator* generator, std::vector<winrt::com_ptr<Profile>>* profiles, til::latch* latch) -> winrt::fire_and_forget {
+            const auto cleanup = wil::scope_exit([&]() {
+                latch->count_down();
+            });
+            co_await winrt::resume_background();
+            self->_executeGenerator(*generator, *profiles);
+        }(this, til::at(generators, i), &til::at(results, i), &latch);
+    }
+
+    latch.wait();
+
+    for (auto& profiles : results)
+    {
+        std::move(profiles.begin(), profiles.end(), std::back_inserter(inboxSettings.profiles));
+    }
 }
 
 // A new settings.json gets a special treatment:
@@ -522,7 +571,7 @@ Json::Value SettingsLoader::_parseJSON(const std::string_view& content)
 {
     Json::Value json;
     std::string errs;
-    const std::unique_ptr<Json::CharReader> reader{ Json::CharReaderBuilder{}.newCharReader() };
+    const auto reader{ JsonUtils::CreateCharReader() };
 
     if (!reader->parse(content.data(), content.data() + content.size(), &json, &errs))
     {
@@ -563,8 +612,13 @@ std::span<const winrt::com_ptr<Profile>> SettingsLoader::_getNonUserOriginProfil
 // This function is to be used for user settings files.
 void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source, const std::string_view& content, ParsedSettings& settings)
 {
-    const auto json = _parseJson(content);
+    _parse(origin, source, _parseJson(content), settings);
+}
 
+// The overload above funnels through here; callers that already hold a parsed
+// DOM (the process-wide defaults.json cache) can skip straight to this one.
+void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source, const JsonSettings& json, ParsedSettings& settings)
+{
     settings.clear();
 
     {
@@ -793,7 +847,10 @@ void SettingsLoader::_addUserProfileParent(const winrt::com_ptr<implementation::
 
 // As the name implies it executes a generator.
 // Generated profiles are added to .inboxSettings. Used by GenerateProfiles().
-void SettingsLoader::_executeGenerator(const IDynamicProfileGenerator& generator)
+// Runs a single generator into the given (generator-private) vector. Apart
+// from reading _ignoredNamespaces this doesn't touch any shared loader state,
+// which is what allows GenerateProfiles to run the generators concurrently.
+void SettingsLoader::_executeGenerator(const IDynamicProfileGenerator& generator, std::vector<winrt::com_ptr<Profile>>& profiles) const
 {
     const auto generatorNamespace = generator.GetNamespace();
     if (_ignoredNamespaces.count(generatorNamespace))
@@ -801,21 +858,19 @@ void SettingsLoader::_executeGenerator(const IDynamicProfileGenerator& generator
         return;
     }
 
-    const auto previousSize = inboxSettings.profiles.size();
-
     try
     {
-        generator.GenerateProfiles(inboxSettings.profiles);
+        generator.GenerateProfiles(profiles);
     }
     CATCH_LOG_MSG("Dynamic Profile Namespace: \"%.*s\"", gsl::narrow<int>(generatorNamespace.size()), generatorNamespace.data())
 
     // If the generator produced some profiles we're going to give them default attributes.
     // By setting the Origin/Source/etc. here, we deduplicate some code and ensure they aren't missing accidentally.
-    if (inboxSettings.profiles.size() > previousSize)
+    if (!profiles.empty())
     {
         const winrt::hstring source{ generatorNamespace };
 
-        for (const auto& profile : std::span(inboxSettings.profiles).subspan(previousSize))
+        for (const auto& profile : profiles)
         {
             profile->Origin(OriginTag::Generated);
             profile->Source(source);
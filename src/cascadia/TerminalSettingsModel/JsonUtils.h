@@ -47,6 +47,22 @@ inline std::string JsonKey(const std::string_view key)
 
 namespace Microsoft::Terminal::Settings::Model::JsonUtils
 {
+    // Method Description:
+    // - Creates a Json::CharReader for parsing our settings documents. The
+    //   reader still accepts comments in the document (our files are JSONC),
+    //   but it's configured to not collect them into the DOM: nothing ever
+    //   reads them back out of the parsed tree, and skipping collection saves
+    //   a pile of small string allocations on heavily-commented documents
+    //   like defaults.json.
+    // Return Value:
+    // - a CharReader for parsing settings JSON.
+    inline std::unique_ptr<Json::CharReader> CreateCharReader()
+    {
+        Json::CharReaderBuilder builder;
+        builder.settings_["collectComments"] = false;
+        return std::unique_ptr<Json::CharReader>{ builder.newCharReader() };
+    }
+
     template<typename T>
     struct ConversionTrait
     {
@@ -43,6 +43,8 @@ namespace ControlUnitTests
 
         TEST_METHOD(TestSimpleClickSelection);
 
+        TEST_METHOD(TestBroadcastInputEncoding);
+
         TEST_CLASS_SETUP(ModuleSetup)
         {
             winrt::init_apartment(winrt::apartment_type::single_threaded);
@@ -571,4 +573,38 @@ namespace ControlUnitTests
         }
         VERIFY_IS_TRUE(gotSelectionUpdate);
     }
+
+    void ControlCoreTests::TestBroadcastInputEncoding()
+    {
+        auto [settings, conn] = _createSettingsAndConnection();
+        auto core = createCore(*settings, *conn);
+        _standardInit(core);
+
+        auto [settings2, conn2] = _createSettingsAndConnection();
+        auto core2 = createCore(*settings2, *conn2);
+        _standardInit(core2);
+
+        Log::Comment(L"Encode a plain character with the first core");
+        const auto fingerprint = core->InputModeFingerprint();
+        const auto encoded = core->SendCharEventForBroadcast(L'a', 0, {});
+        VERIFY_ARE_EQUAL(winrt::hstring{ L"a" }, encoded);
+
+        Log::Comment(L"A core with the same input modes accepts the encoded bytes");
+        VERIFY_IS_TRUE(core2->TrySendEncodedInput(fingerprint, encoded));
+
+        Log::Comment(L"A core with different input modes declines them");
+        conn2->WriteInput(winrt::hstring{ L"\x1b[?1h" }); // DECCKM: application cursor keys
+        VERIFY_ARE_NOT_EQUAL(fingerprint, core2->InputModeFingerprint());
+        VERIFY_IS_FALSE(core2->TrySendEncodedInput(fingerprint, encoded));
+
+        Log::Comment(L"...and accepts them again once the modes match");
+        conn2->WriteInput(winrt::hstring{ L"\x1b[?1l" });
+        VERIFY_IS_TRUE(core2->TrySendEncodedInput(fingerprint, encoded));
+
+        Log::Comment(L"An active selection needs the full per-event path");
+        core2->SelectAll();
+        VERIFY_IS_FALSE(core2->TrySendEncodedInput(fingerprint, encoded));
+        core2->ClearSelection();
+        VERIFY_IS_TRUE(core2->TrySendEncodedInput(fingerprint, encoded));
+    }
 }
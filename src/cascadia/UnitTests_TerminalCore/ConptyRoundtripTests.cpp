@@ -225,6 +225,7 @@ class TerminalCoreUnitTests::ConptyRoundtripTests final
 
     TEST_METHOD(SimpleAltBufferTest);
     TEST_METHOD(AltBufferToAltBufferTest);
+    TEST_METHOD(AltBufferReuseTest);
 
     TEST_METHOD(TestPowerLineFirstFrame);
 
@@ -4097,6 +4098,56 @@ void ConptyRoundtripTests::AltBufferToAltBufferTest()
     verifyBuffer(*termAltTb, term->_GetMutableViewport().ToExclusive(), Frame::StillInAltBuffer);
 }
 
+void ConptyRoundtripTests::AltBufferReuseTest()
+{
+    Log::Comment(L"Repeatedly entering and leaving the alt buffer should reuse the same "
+                 L"TextBuffer instance instead of reallocating one per switch, and the "
+                 L"reused buffer has to come back fully blank.");
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& gci = g.getConsoleInformation();
+    auto& si = gci.GetActiveOutputBuffer();
+    auto& sm = si.GetStateMachine();
+
+    _flushFirstFrame();
+
+    _checkConptyOutput = false;
+
+    gci.LockConsole(); // Lock must be taken to manipulate alt/main buffer state.
+    auto unlock = wil::scope_exit([&] { gci.UnlockConsole(); });
+
+    Log::Comment(L"========== First alt buffer session ==========");
+    sm.ProcessString(L"\x1b[?1049h");
+    VERIFY_IS_TRUE(term->_inAltBuffer());
+    const auto* firstAltBuffer = term->_altBuffer.get();
+    sm.ProcessString(L"CCCCC");
+    sm.ProcessString(L"\x1b[?1049l");
+    VERIFY_IS_FALSE(term->_inAltBuffer());
+
+    Log::Comment(L"========== Second alt buffer session reuses the stashed buffer ==========");
+    sm.ProcessString(L"\x1b[?1049h");
+    auto leaveAltBuffer = wil::scope_exit([&] { sm.ProcessString(L"\x1b[?1049l"); });
+    VERIFY_IS_TRUE(term->_inAltBuffer());
+    VERIFY_ARE_EQUAL(firstAltBuffer, term->_altBuffer.get());
+
+    // The leftovers from the first session must be gone.
+    auto iter = term->_altBuffer->GetCellDataAt({ 0, 0 });
+    TestUtils::VerifySpanOfText(L" ", iter, 0, 5);
+
+    Log::Comment(L"========== Measure the swap latency over a few round trips ==========");
+    constexpr auto iterations = 50;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        sm.ProcessString(L"\x1b[?1049l");
+        sm.ProcessString(L"\x1b[?1049h");
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    Log::Comment(NoThrowString().Format(L"%d alt buffer round trips took %lld us (%lld us/swap)",
+                                        iterations,
+                                        static_cast<long long>(elapsed.count()),
+                                        static_cast<long long>(elapsed.count() / (iterations * 2))));
+}
+
 void ConptyRoundtripTests::TestPowerLineFirstFrame()
 {
     Log::Comment(L"This is a test for GH#8341. If we received colored spaces "
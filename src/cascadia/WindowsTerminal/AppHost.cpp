@@ -85,6 +85,8 @@ AppHost::AppHost(const winrt::TerminalApp::AppLogic& logic,
     _windowCallbacks.ShouldExitFullscreen = _window->ShouldExitFullscreen({ &_windowLogic, &winrt::TerminalApp::TerminalWindow::RequestExitFullscreen });
 
     _window->MakeWindow();
+
+    _appLogic.MarkStartupPhase(L"windowCreated");
 }
 
 bool AppHost::OnDirectKeyEvent(const uint32_t vkey, const uint8_t scanCode, const bool down)
@@ -278,6 +280,8 @@ void AppHost::Initialize()
     // You aren't allowed to do ANY XAML before this line!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     _window->Initialize();
 
+    _appLogic.MarkStartupPhase(L"xamlIslandCreated");
+
     if (auto withWindow{ _windowLogic.try_as<IInitializeWithWindow>() })
     {
         // You aren't allowed to do anything with the TerminalPage before this line!!!!!!!
@@ -969,6 +973,7 @@ winrt::fire_and_forget AppHost::_peasantNotifyActivateWindow()
 winrt::Windows::Foundation::IAsyncOperation<winrt::hstring> AppHost::_GetWindowLayoutAsync()
 {
     winrt::hstring layoutJson = L"";
+    WindowLayout layout{ nullptr };
 
     auto weakThis{ weak_from_this() };
 
@@ -985,10 +990,25 @@ winrt::Windows::Foundation::IAsyncOperation<winrt::hstring> AppHost::_GetWindowL
     try
     {
         const auto pos = _GetWindowLaunchPosition();
-        layoutJson = _windowLogic.GetWindowLayoutJson(pos);
+        layout = _windowLogic.GetWindowLayout(pos);
     }
     CATCH_LOG()
 
+    if (layout)
+    {
+        // Only collecting the layout needs the controls. Serializing it to
+        // JSON doesn't, and with many tabs and panes it's the expensive half
+        // of a layout save - do that off the UI thread, so the periodic
+        // background saves don't stall the window.
+        co_await winrt::resume_background();
+
+        try
+        {
+            layoutJson = WindowLayout::ToJson(layout);
+        }
+        CATCH_LOG()
+    }
+
     co_return layoutJson;
 }
 
@@ -1457,6 +1477,15 @@ winrt::fire_and_forget AppHost::_WindowInitializedHandler(const winrt::Windows::
     // In AppHost::_WindowMoved, we'll make sure we're at least initialized
     // before dismissing open dialogs.
     _isWindowInitialized = WindowInitializedState::Initialized;
+
+    _appLogic.MarkStartupPhase(L"windowShown");
+
+    // The summary only exists once startup is over, so this is where
+    // `wt --startupTimes` pays out: one message box, after the window is up.
+    if (_windowLogic.ShouldShowStartupTimes())
+    {
+        AppHost::s_DisplayMessageBox({ _appLogic.StartupTimesSummary(), 0 });
+    }
 }
 
 winrt::TerminalApp::TerminalWindow AppHost::Logic()
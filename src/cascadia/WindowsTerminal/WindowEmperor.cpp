@@ -117,6 +117,8 @@ bool WindowEmperor::HandleCommandlineArgs()
     const bool makeWindow = result.ShouldCreateWindow();
     if (makeWindow)
     {
+        _app.Logic().MarkStartupPhase(L"windowRequested");
+
         _createNewWindowThread(Remoting::WindowRequestedArgs{ result, eventArgs });
 
         _becomeMonarch();
@@ -171,6 +173,9 @@ void WindowEmperor::_createNewWindowThread(const Remoting::WindowRequestedArgs&
         window->Microwave(args, peasant);
         // This will unblock the event we're waiting on in KeepWarm, and the
         // window thread (started below) will continue through it's loop
+
+        // We just took the spare window; start warming up a replacement.
+        _restockFridge();
         return;
     }
 
@@ -205,68 +210,143 @@ void WindowEmperor::_createNewWindowThread(const Remoting::WindowRequestedArgs&
             {
                 self->_windowStartedHandlerPostXAML(window);
             }
-            while (window->KeepWarm())
+
+            _windowThreadLoop(weakThis, window);
+        }
+        CATCH_LOG()
+    });
+    LOG_IF_FAILED(SetThreadDescription(t.native_handle(), L"Window Thread"));
+
+    t.detach();
+}
+
+// The main loop of a window thread. Each pass through the loop runs the
+// message pump for one "use" of the window; between uses (on Windows 10), the
+// thread parks in KeepWarm with its window refrigerated, waiting to be
+// reheated for a future window request.
+void WindowEmperor::_windowThreadLoop(std::weak_ptr<WindowEmperor> weakThis, const std::shared_ptr<WindowThread>& window)
+{
+    while (window->KeepWarm())
+    {
+        // Now that the window is ready to go, we can add it to our list of windows,
+        // because we know it will be well behaved.
+        //
+        // Be sure to only modify the list of windows under lock.
+
+        if (auto self{ weakThis.lock() })
+        {
+            auto lockedWindows{ self->_windows.lock() };
+            lockedWindows->push_back(window);
+        }
+        auto removeWindow = wil::scope_exit([&]() {
+            if (auto self{ weakThis.lock() })
+            {
+                self->_removeWindow(window->PeasantID());
+            }
+        });
+
+        auto decrementWindowCount = wil::scope_exit([&]() {
+            if (auto self{ weakThis.lock() })
+            {
+                self->_decrementWindowCount();
+            }
+        });
+
+        window->RunMessagePump();
+
+        // Manually trigger the cleanup callback. This will ensure that we
+        // remove the window from our list of windows, before we release the
+        // AppHost (and subsequently, the host's Logic() member that we use
+        // elsewhere).
+        removeWindow.reset();
+
+        // On Windows 11, we DONT want to refrigerate the window. There,
+        // we can just close it like normal. Break out of the loop, so
+        // we don't try to put this window in the fridge.
+        if (Utils::IsWindows11())
+        {
+            decrementWindowCount.reset();
+            break;
+        }
+        else
+        {
+            window->Refrigerate();
+            decrementWindowCount.reset();
+
+            if (auto self{ weakThis.lock() })
             {
-                // Now that the window is ready to go, we can add it to our list of windows,
-                // because we know it will be well behaved.
-                //
-                // Be sure to only modify the list of windows under lock.
+                auto fridge{ self->_oldThreads.lock() };
+                fridge->push_back(window);
+            }
+        }
+    }
+
+    // Now that we no longer care about this thread's window, let it
+    // release it's app host and flush the rest of the XAML queue.
+    window->RundownForExit();
+}
+
+// Method Description:
+// - Makes sure there's a dormant, pre-initialized window thread sitting in the
+//   fridge. Spinning up XAML and the DesktopWindowXamlSource is the dominant
+//   cost of opening a window in an already-running Terminal, so pay it ahead
+//   of time on a background thread. The next window request - most notably a
+//   default-terminal handoff, where the user is staring at an empty console
+//   frame until we can draw - then reheats a window that's already warm,
+//   instead of starting XAML from scratch.
+void WindowEmperor::_restockFridge()
+{
+    {
+        auto fridge{ _oldThreads.lock_shared() };
+        if (!fridge->empty())
+        {
+            return;
+        }
+    }
+    if (_prewarmInFlight.exchange(true, std::memory_order_relaxed))
+    {
+        // Someone else is already warming one up.
+        return;
+    }
+
+    auto window{ std::make_shared<WindowThread>(_app.Logic(), _manager) };
 
+    // Hook the same WindowThread-level callback _windowStartedHandlerPostXAML
+    // would add for a window that started out hot. (The AppHost-level ones get
+    // re-hooked by the thread itself when it's reheated.)
+    window->UpdateSettingsRequested({ this, &WindowEmperor::_windowRequestUpdateSettings });
+
+    std::weak_ptr<WindowEmperor> weakThis{ weak_from_this() };
+
+    std::thread t([weakThis, window]() {
+        try
+        {
+            auto clearInFlight = wil::scope_exit([&]() {
                 if (auto self{ weakThis.lock() })
                 {
-                    auto lockedWindows{ self->_windows.lock() };
-                    lockedWindows->push_back(window);
-                }
-                auto removeWindow = wil::scope_exit([&]() {
-                    if (auto self{ weakThis.lock() })
-                    {
-                        self->_removeWindow(window->PeasantID());
-                    }
-                });
-
-                auto decrementWindowCount = wil::scope_exit([&]() {
-                    if (auto self{ weakThis.lock() })
-                    {
-                        self->_decrementWindowCount();
-                    }
-                });
-
-                window->RunMessagePump();
-
-                // Manually trigger the cleanup callback. This will ensure that we
-                // remove the window from our list of windows, before we release the
-                // AppHost (and subsequently, the host's Logic() member that we use
-                // elsewhere).
-                removeWindow.reset();
-
-                // On Windows 11, we DONT want to refrigerate the window. There,
-                // we can just close it like normal. Break out of the loop, so
-                // we don't try to put this window in the fridge.
-                if (Utils::IsWindows11())
-                {
-                    decrementWindowCount.reset();
-                    break;
-                }
-                else
-                {
-                    window->Refrigerate();
-                    decrementWindowCount.reset();
-
-                    if (auto self{ weakThis.lock() })
-                    {
-                        auto fridge{ self->_oldThreads.lock() };
-                        fridge->push_back(window);
-                    }
+                    self->_prewarmInFlight.store(false, std::memory_order_relaxed);
                 }
+            });
+
+            // Warming up is anticipatory work - don't compete with live
+            // windows for CPU while we do it.
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+            window->WarmUp();
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL);
+
+            if (auto self{ weakThis.lock() })
+            {
+                auto fridge{ self->_oldThreads.lock() };
+                fridge->push_back(window);
             }
+            clearInFlight.reset();
 
-            // Now that we no longer care about this thread's window, let it
-            // release it's app host and flush the rest of the XAML queue.
-            window->RundownForExit();
+            // Park in the fridge until a window request microwaves us.
+            _windowThreadLoop(weakThis, window);
         }
         CATCH_LOG()
     });
-    LOG_IF_FAILED(SetThreadDescription(t.native_handle(), L"Window Thread"));
+    LOG_IF_FAILED(SetThreadDescription(t.native_handle(), L"Prewarmed Window Thread"));
 
     t.detach();
 }
@@ -285,6 +365,10 @@ void WindowEmperor::_windowStartedHandlerPostXAML(const std::shared_ptr<WindowTh
     sender->Logic().IsQuakeWindowChanged({ this, &WindowEmperor::_windowIsQuakeWindowChanged });
     sender->UpdateSettingsRequested({ this, &WindowEmperor::_windowRequestUpdateSettings });
 
+    // This window is up and running; use the lull to get a head start on the
+    // next one.
+    _restockFridge();
+
     // DON'T Summon the window to the foreground, since we might not _currently_ be in
     // the foreground, but we should act like the new window is.
     //
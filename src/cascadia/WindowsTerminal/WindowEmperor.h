@@ -56,6 +56,10 @@ private:
 
     bool _quitting{ false };
 
+    static void _windowThreadLoop(std::weak_ptr<WindowEmperor> weakThis, const std::shared_ptr<WindowThread>& window);
+    void _restockFridge();
+    std::atomic<bool> _prewarmInFlight{ false };
+
     void _windowStartedHandlerPostXAML(const std::shared_ptr<WindowThread>& sender);
     void _removeWindow(uint64_t senderID);
     void _decrementWindowCount();
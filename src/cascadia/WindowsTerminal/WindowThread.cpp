@@ -16,6 +16,47 @@ WindowThread::WindowThread(winrt::TerminalApp::AppLogic logic,
     // DO NOT start the AppHost here in the ctor, as that will start XAML on the wrong thread!
 }
 
+// Constructor for a dormant window thread: one with no pending window request,
+// which exists just to pre-warm a window and XAML island for a future request.
+// Call WarmUp (on the new thread) to build the window, then KeepWarm to park
+// until someone Microwave()s us.
+WindowThread::WindowThread(winrt::TerminalApp::AppLogic logic,
+                           winrt::Microsoft::Terminal::Remoting::WindowManager manager) :
+    _appLogic{ std::move(logic) },
+    _manager{ std::move(manager) }
+{
+}
+
+// Method Description:
+// - Build the window for a dormant thread, without an AppHost attached. This
+//   initializes the winrt apartment, creates a hidden top-level window, and -
+//   the expensive part - instantiates its DesktopWindowXamlSource, which spins
+//   up the XAML framework for this thread. The resulting window is left
+//   refrigerated, exactly like one that previously hosted content, so the
+//   usual reheat path in Microwave can pick it up untouched.
+// INVARIANT: This must be called on our "ui thread", our window thread.
+void WindowThread::WarmUp()
+{
+    assert(_host == nullptr && _warmWindow == nullptr);
+
+    winrt::init_apartment(winrt::apartment_type::single_threaded);
+
+    // Build the same kind of window AppHost would build for the current
+    // settings, so the AppHost that eventually inherits it finds what it
+    // expects.
+    if (_appLogic.ShowTabsInTitlebar())
+    {
+        _warmWindow = std::make_unique<NonClientIslandWindow>(_appLogic.Theme().RequestedTheme());
+    }
+    else
+    {
+        _warmWindow = std::make_unique<IslandWindow>();
+    }
+    _warmWindow->MakeWindow();
+    _warmWindow->Initialize();
+    _warmWindow->Refrigerate();
+}
+
 void WindowThread::CreateHost()
 {
     // Calling this while refrigerated won't work.
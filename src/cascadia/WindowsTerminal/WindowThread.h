@@ -12,8 +12,12 @@ public:
                  winrt::Microsoft::Terminal::Remoting::WindowManager manager,
                  winrt::Microsoft::Terminal::Remoting::Peasant peasant);
 
+    WindowThread(winrt::TerminalApp::AppLogic logic,
+                 winrt::Microsoft::Terminal::Remoting::WindowManager manager);
+
     winrt::TerminalApp::TerminalWindow Logic();
     void CreateHost();
+    void WarmUp();
     int RunMessagePump();
     void RundownForExit();
 
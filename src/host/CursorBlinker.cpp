@@ -55,7 +55,16 @@ void CursorBlinker::SettingsChanged() noexcept
     {
         KillCaretTimer();
         _uCaretBlinkTime = dwCaretBlinkTime;
-        SetCaretTimer();
+
+        // WM_SETTINGCHANGE is broadcast to every window, focused or not. Only
+        // the focused console can show a blinking cursor, so don't start
+        // waking an unfocused one up every half second here; it'll arm the
+        // timer again on its next WM_SETFOCUS.
+        const auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        if (WI_IsFlagSet(gci.Flags, CONSOLE_HAS_FOCUS))
+        {
+            SetCaretTimer();
+        }
     }
 }
 
@@ -171,7 +180,11 @@ void CursorBlinker::SetCaretTimer() const noexcept
     const auto periodInMS = _uCaretBlinkTime == -1 ? dwDefTimeout : _uCaretBlinkTime;
     // The FILETIME struct measures time in 100ns steps. 10000 thus equals 1ms.
     auto periodInFiletime = -static_cast<int64_t>(periodInMS) * 10000;
-    SetThreadpoolTimer(_timer.get(), reinterpret_cast<FILETIME*>(&periodInFiletime), periodInMS, 0);
+    // Grant the OS a 10% coalescing window, so that these wakes can ride
+    // along with other timers that are due around the same time instead of
+    // forcing their own. Blink cadence is nowhere near precise enough for
+    // anyone to notice.
+    SetThreadpoolTimer(_timer.get(), reinterpret_cast<FILETIME*>(&periodInFiletime), periodInMS, periodInMS / 10);
 }
 
 void CursorBlinker::KillCaretTimer() const noexcept
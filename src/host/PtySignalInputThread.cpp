@@ -137,6 +137,25 @@ try
                 return S_OK;
             }
 
+            // Dragging the terminal's corner queues dozens of resize packets, each
+            // of which would trigger a full buffer reflow. Collapse whatever resize
+            // packets have piled up in the pipe in the meantime down to the most
+            // recent geometry, so that we only reflow once.
+            uint64_t collapsed = 0;
+            while (_TryConsumeQueuedResize(resizeMsg))
+            {
+                collapsed++;
+            }
+
+            if (collapsed)
+            {
+                TraceLoggingWrite(g_hConhostV2EventTraceProvider,
+                                  "PtySignalInputThread_CollapsedResizes",
+                                  TraceLoggingUInt64(collapsed, "Count"),
+                                  TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                                  TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+            }
+
             _DoResizeWindow(resizeMsg);
             break;
         }
@@ -281,6 +300,41 @@ void PtySignalInputThread::_DoSetWindowParent(const SetParentData& data)
     }
 }
 
+// Method Description:
+// - Checks whether the next complete packet waiting in the signal pipe is another
+//   ResizeWindow packet and if so, consumes it and returns its geometry.
+// - The sender writes each packet with a single WriteFile (see _ResizePseudoConsole
+//   in winconpty.cpp), so if enough bytes are available to peek at, the packet is
+//   complete and the subsequent reads cannot block.
+// Arguments:
+// - data - Receives the newer resize geometry if another packet was consumed.
+// Return Value:
+// - True if another ResizeWindow packet was consumed. False otherwise.
+[[nodiscard]] bool PtySignalInputThread::_TryConsumeQueuedResize(ResizeWindowData& data)
+{
+    if (!_hFile)
+    {
+        return false;
+    }
+
+    char peekBuffer[sizeof(PtySignal) + sizeof(ResizeWindowData)];
+    DWORD bytesRead = 0;
+    if (!PeekNamedPipe(_hFile.get(), &peekBuffer[0], sizeof(peekBuffer), &bytesRead, nullptr, nullptr) || bytesRead < sizeof(peekBuffer))
+    {
+        return false;
+    }
+
+    PtySignal signalId;
+    memcpy(&signalId, &peekBuffer[0], sizeof(signalId));
+    if (signalId != PtySignal::ResizeWindow)
+    {
+        return false;
+    }
+
+    // Actually consume the packet we just peeked at.
+    return _GetData(&signalId, sizeof(signalId)) && _GetData(&data, sizeof(data));
+}
+
 // Method Description:
 // - Retrieves bytes from the file stream and exits or throws errors should the pipe state
 //   be compromised.
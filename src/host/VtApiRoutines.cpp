@@ -450,17 +450,40 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
     const size_t width = requestRectangle.Width();
     size_t pos = 0;
 
+    // Legacy TUI apps redraw their entire screen through this API, and the
+    // naive translation (a cursor move and two SGRs per cell) amplifies that
+    // into pathological VT volume. Instead, emit one cursor move per row and
+    // coalesce each row into runs of identical attributes, only emitting an
+    // SGR when the attributes actually change from the previous run.
+    std::wstring run;
+    std::optional<WORD> lastAttributes;
+
     while (pos < buffer.size())
     {
         (void)m_pVtEngine->_CursorPosition(cursor);
 
         const auto subspan = buffer.subspan(pos, width);
 
-        for (const auto& ci : subspan)
+        for (size_t i = 0; i < subspan.size();)
         {
-            (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(ci.Attributes), true);
-            (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(ci.Attributes >> 4), false);
-            (void)m_pVtEngine->WriteTerminalW(std::wstring_view{ &ci.Char.UnicodeChar, 1 });
+            const auto attributes = subspan[i].Attributes;
+
+            // The characters aren't contiguous in memory (they're interleaved
+            // with the attributes), so gather the run into a scratch string.
+            run.clear();
+            do
+            {
+                run.push_back(subspan[i].Char.UnicodeChar);
+                ++i;
+            } while (i < subspan.size() && subspan[i].Attributes == attributes);
+
+            if (attributes != lastAttributes)
+            {
+                (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attributes), true);
+                (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attributes >> 4), false);
+                lastAttributes = attributes;
+            }
+            (void)m_pVtEngine->WriteTerminalW(run);
         }
 
         ++cursor.y;
@@ -481,11 +504,24 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
 {
     (void)m_pVtEngine->_CursorPosition(target);
 
-    for (const auto& attr : attrs)
+    // Coalesce runs of identical attributes into one SGR and one write,
+    // mirroring what WriteConsoleOutputWImpl does for whole rectangles.
+    std::string run;
+    for (size_t i = 0; i < attrs.size();)
     {
+        const auto attr = attrs[i];
+
+        auto length = size_t{ 0 };
+        do
+        {
+            ++length;
+            ++i;
+        } while (i < attrs.size() && attrs[i] == attr);
+
         (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attr), true);
         (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attr >> 4), false);
-        (void)m_pVtEngine->WriteTerminalUtf8(std::string_view{ &s_readBackAscii.Char.AsciiChar, 1 });
+        run.assign(length, s_readBackAscii.Char.AsciiChar);
+        (void)m_pVtEngine->WriteTerminalUtf8(run);
     }
 
     (void)m_pVtEngine->_Flush();
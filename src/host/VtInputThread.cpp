@@ -69,9 +69,8 @@ DWORD WINAPI VtInputThread::StaticVtInputThreadProc(_In_ LPVOID lpParameter)
 // - true if you should continue reading
 bool VtInputThread::DoReadInput()
 {
-    char buffer[4096];
     DWORD dwRead = 0;
-    const auto ok = ReadFile(_hFile.get(), buffer, ARRAYSIZE(buffer), &dwRead, nullptr);
+    const auto ok = ReadFile(_hFile.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), &dwRead, nullptr);
 
     // The ReadFile() documentations calls out that:
     // > If the lpNumberOfBytesRead parameter is zero when ReadFile returns TRUE on a pipe, the other
@@ -90,7 +89,7 @@ bool VtInputThread::DoReadInput()
     }
 
     // If we hit a parsing error, eat it. It's bad utf-8, we can't do anything with it.
-    if (FAILED_LOG(til::u8u16({ buffer, gsl::narrow_cast<size_t>(dwRead) }, _wstr, _u8State)))
+    if (FAILED_LOG(til::u8u16({ _buffer.data(), gsl::narrow_cast<size_t>(dwRead) }, _wstr, _u8State)))
     {
         return true;
     }
@@ -105,6 +104,13 @@ bool VtInputThread::DoReadInput()
         LockConsole();
         const auto unlock = wil::scope_exit([&] { UnlockConsole(); });
 
+        // A single chunk can decompose into hundreds of events (win32-input-mode
+        // floods, fast paste), each of which would wake the blocked readers
+        // individually. Defer the wakeups until the whole chunk is dispatched;
+        // the guard runs before the lock is released above.
+        auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        const auto wakeReaders = gci.pInputBuffer->DeferReaderWakeups();
+
         _pInputStateMachine->ProcessString(_wstr);
     }
     CATCH_LOG();
@@ -40,5 +40,9 @@ namespace Microsoft::Console
         std::unique_ptr<Microsoft::Console::VirtualTerminal::StateMachine> _pInputStateMachine;
         til::u8state _u8State;
         std::wstring _wstr;
+        // The read buffer is sized well beyond the typical size of a single read so
+        // that we can drain a backlog of events (fast paste, mouse reporting floods)
+        // in one ReadFile/lock cycle whenever we fall behind the terminal.
+        std::array<char, 64 * 1024> _buffer{};
     };
 }
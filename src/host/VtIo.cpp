@@ -256,6 +256,14 @@ bool VtIo::IsUsingVt() const
             g.pRender->AddRenderEngine(_pVtRenderEngine.get());
             g.getConsoleInformation().GetActiveOutputBuffer().SetTerminalConnection(_pVtRenderEngine.get());
 
+            // A client emitting hundreds of small updates a second would
+            // otherwise make us emit just as many tiny conpty frames, each of
+            // which the connected terminal has to parse, but few of which it
+            // can actually present. Cap the paced frame rate at 120Hz and let
+            // the invalidations in between collapse into a single frame.
+            using namespace std::chrono_literals;
+            g.pRender->SetMinimumFrameInterval(1'000'000'000ns / 120);
+
             // Force the whole window to be put together first.
             // We don't really need the handle, we just want to leverage the setup steps.
             ServiceLocator::LocatePseudoWindow();
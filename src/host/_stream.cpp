@@ -142,6 +142,102 @@ void _writeCharsLegacyUnprocessed(SCREEN_INFORMATION& screenInfo, const std::wst
     }
 }
 
+// Disable vectorization-unfriendly warnings.
+#pragma warning(push)
+#pragma warning(disable : 26429) // Symbol '...' is never tested for nullness, it can be marked as not_null (f.23).
+#pragma warning(disable : 26472) // Don't use a static_cast for arithmetic conversions. Use brace initialization, gsl::narrow_cast or gsl::narrow (type.1).
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+
+[[msvc::forceinline]] static size_t _findNextControlCharPlain(const wchar_t* beg, const wchar_t* end, const wchar_t* it) noexcept
+{
+#pragma loop(no_vector)
+    for (; it < end && IS_GLYPH_CHAR(*it); ++it)
+    {
+    }
+    return it - beg;
+}
+
+// Returns the offset of the first character that WriteCharsLegacy has to treat
+// as a control character: anything below 0x20, and 0x7F. Client payloads are
+// overwhelmingly printable text with the occasional CR/LF, so this is modeled
+// after StateMachine's findActionableFromGround and scans in bulk.
+static size_t _findNextControlChar(const wchar_t* data, size_t count) noexcept
+{
+#if defined(TIL_SSE_INTRINSICS)
+
+    auto it = data;
+    const auto z = _mm_setzero_si128();
+
+    const auto classify = [=](const __m128i wch) noexcept {
+        // Check for "wch <= 0x1f" as "max(0, wch - 0x1f) == 0", where the max()
+        // is what subtraction with unsigned saturation ("SubS") gives us.
+        const auto a = _mm_cmpeq_epi16(_mm_subs_epu16(wch, _mm_set1_epi16(0x1f)), z);
+        // Check for "wch == 0x7f".
+        const auto b = _mm_cmpeq_epi16(wch, _mm_set1_epi16(0x7f));
+        return _mm_or_si128(a, b);
+    };
+
+    for (const auto end = data + (count & ~size_t{ 7 }); it < end; it += 8)
+    {
+        const auto c = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)));
+        const auto mask = _mm_movemask_epi8(c);
+
+        if (mask)
+        {
+            unsigned long offset;
+            _BitScanForward(&offset, mask);
+            it += offset / 2;
+            return it - data;
+        }
+    }
+
+    return _findNextControlCharPlain(data, data + count, it);
+
+#elif defined(TIL_ARM_NEON_INTRINSICS)
+
+    auto it = data;
+    uint64_t mask;
+
+    for (const auto end = data + (count & ~size_t{ 7 }); it < end;)
+    {
+        const auto wch = vld1q_u16(it);
+        const auto a = vcleq_u16(wch, vdupq_n_u16(0x1f));
+        const auto b = vceqq_u16(wch, vdupq_n_u16(0x7f));
+        const auto c = vorrq_u16(a, b);
+
+        mask = vgetq_lane_u64(c, 0);
+        if (mask)
+        {
+            goto exitWithMask;
+        }
+        it += 4;
+
+        mask = vgetq_lane_u64(c, 1);
+        if (mask)
+        {
+            goto exitWithMask;
+        }
+        it += 4;
+    }
+
+    return _findNextControlCharPlain(data, data + count, it);
+
+exitWithMask:
+    unsigned long offset;
+    _BitScanForward64(&offset, mask);
+    it += offset / 16;
+    return it - data;
+
+#else
+
+    return _findNextControlCharPlain(data, data + count, data);
+
+#endif
+}
+
+#pragma warning(pop)
+
 // This routine writes a string to the screen while handling control characters.
 // `interactive` exists for COOKED_READ_DATA which uses it to transform control characters into visible text like "^X".
 // Similarly, `psScrollY` is also used by it to track whether the underlying buffer circled. It requires this information to know where the input line moved to.
@@ -153,8 +249,8 @@ void WriteCharsLegacy(SCREEN_INFORMATION& screenInfo, const std::wstring_view& t
     const auto width = textBuffer.GetSize().Width();
     auto& cursor = textBuffer.GetCursor();
     const auto wrapAtEOL = WI_IsFlagSet(screenInfo.OutputMode, ENABLE_WRAP_AT_EOL_OUTPUT);
-    auto it = text.begin();
-    const auto end = text.end();
+    auto it = text.data();
+    const auto end = it + text.size();
 
     // In VT mode, when you have a 120-column terminal you can write 120 columns without the cursor wrapping.
     // Whenever the cursor is in that 120th column IsDelayedEOLWrap() will return true. I'm not sure why the VT parts
@@ -185,7 +281,7 @@ void WriteCharsLegacy(SCREEN_INFORMATION& screenInfo, const std::wstring_view& t
 
     while (it != end)
     {
-        const auto nextControlChar = std::find_if(it, end, [](const auto& wch) { return !IS_GLYPH_CHAR(wch); });
+        const auto nextControlChar = it + _findNextControlChar(it, gsl::narrow_cast<size_t>(end - it));
         if (nextControlChar != it)
         {
             _writeCharsLegacyUnprocessed(screenInfo, { it, nextControlChar }, psScrollY);
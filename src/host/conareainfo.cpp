@@ -115,7 +115,9 @@ void ConversionAreaInfo::WriteText(const std::vector<OutputCell>& text,
 }
 
 // Routine Description:
-// - Clears out a conversion area
+// - Clears out a conversion area, hiding it without repainting. The caller is
+//   responsible for repainting the vacated region (see GetScreenRegion),
+//   which lets it batch the repaint of several areas into one.
 void ConversionAreaInfo::ClearArea() noexcept
 {
     SetHidden(true);
@@ -125,8 +127,6 @@ void ConversionAreaInfo::ClearArea() noexcept
         _screenBuffer->ClearTextData();
     }
     CATCH_LOG();
-
-    Paint();
 }
 
 [[nodiscard]] HRESULT ConversionAreaInfo::Resize(const til::size newSize) noexcept
@@ -198,17 +198,25 @@ void ConversionAreaInfo::SetViewPos(const til::point pos) noexcept
     }
 }
 
+// Routine Description:
+// - Computes the region of the screen buffer that this conversion area is
+//   drawn over, given the current viewport.
+[[nodiscard]] til::inclusive_rect ConversionAreaInfo::GetScreenRegion(const Viewport& viewport) const noexcept
+{
+    til::inclusive_rect region;
+    region.left = viewport.Left() + _caInfo.coordConView.x + _caInfo.rcViewCaWindow.left;
+    region.right = region.left + (_caInfo.rcViewCaWindow.right - _caInfo.rcViewCaWindow.left);
+    region.top = viewport.Top() + _caInfo.coordConView.y + _caInfo.rcViewCaWindow.top;
+    region.bottom = region.top + (_caInfo.rcViewCaWindow.bottom - _caInfo.rcViewCaWindow.top);
+    return region;
+}
+
 void ConversionAreaInfo::Paint() const noexcept
 {
     auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     auto& ScreenInfo = gci.GetActiveOutputBuffer();
-    const auto viewport = ScreenInfo.GetViewport();
 
-    til::inclusive_rect WriteRegion;
-    WriteRegion.left = viewport.Left() + _caInfo.coordConView.x + _caInfo.rcViewCaWindow.left;
-    WriteRegion.right = WriteRegion.left + (_caInfo.rcViewCaWindow.right - _caInfo.rcViewCaWindow.left);
-    WriteRegion.top = viewport.Top() + _caInfo.coordConView.y + _caInfo.rcViewCaWindow.top;
-    WriteRegion.bottom = WriteRegion.top + (_caInfo.rcViewCaWindow.bottom - _caInfo.rcViewCaWindow.top);
+    const auto WriteRegion = GetScreenRegion(ScreenInfo.GetViewport());
 
     if (!IsHidden())
     {
@@ -22,6 +22,7 @@ Revision History:
 #include "../buffer/out/OutputCell.hpp"
 #include "../buffer/out/TextAttribute.hpp"
 #include "../renderer/inc/FontInfo.hpp"
+#include "../types/inc/viewport.hpp"
 
 class SCREEN_INFORMATION;
 class TextBuffer;
@@ -59,6 +60,7 @@ public:
 
     void SetViewPos(const til::point pos) noexcept;
     void SetWindowInfo(const til::inclusive_rect& view) noexcept;
+    [[nodiscard]] til::inclusive_rect GetScreenRegion(const Microsoft::Console::Types::Viewport& viewport) const noexcept;
     void Paint() const noexcept;
 
     void WriteText(const std::vector<OutputCell>& text, const til::CoordType column);
@@ -44,7 +44,7 @@ void ConsoleImeInfo::RedrawCompMessage()
     if (!_text.empty())
     {
         ClearAllAreas();
-        _WriteUndeterminedChars(_text, _attributes, _colorArray);
+        _WriteUndeterminedChars(_text, _attributes, _colorArray, {});
     }
 }
 
@@ -60,7 +60,12 @@ void ConsoleImeInfo::WriteCompMessage(const std::wstring_view text,
                                       const std::span<const BYTE> attributes,
                                       const std::span<const WORD> colorArray)
 {
-    ClearAllAreas();
+    // Hide the previous composition without repainting it. The vacated region
+    // is carried into the write below, which issues a single invalidation
+    // covering both it and the new composition. While someone is typing, the
+    // two overlap almost entirely, so this collapses the whole update into
+    // (roughly) one repaint of the composition line per keystroke.
+    auto dirtyArea = _HideAllAreas();
 
     // MSFT:29219348 only hide the cursor after the IME produces a string.
     // See notes in convarea.cpp ImeStartComposition().
@@ -71,7 +76,7 @@ void ConsoleImeInfo::WriteCompMessage(const std::wstring_view text,
     _attributes.assign(attributes.begin(), attributes.end());
     _colorArray.assign(colorArray.begin(), colorArray.end());
 
-    _WriteUndeterminedChars(text, attributes, colorArray);
+    _WriteUndeterminedChars(text, attributes, colorArray, dirtyArea);
 }
 
 // Routine Description:
@@ -101,16 +106,37 @@ void ConsoleImeInfo::_ClearComposition()
 // - Clears out all conversion areas
 void ConsoleImeInfo::ClearAllAreas()
 {
+    const auto dirtyArea = _HideAllAreas();
+    if (!dirtyArea.empty())
+    {
+        auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        WriteToScreen(gci.GetActiveOutputBuffer(), Microsoft::Console::Types::Viewport::FromExclusive(dirtyArea));
+    }
+
+    // Also clear internal buffer of string data.
+    _ClearComposition();
+}
+
+// Routine Description:
+// - Hides and clears out all conversion areas without repainting them.
+// Return Value:
+// - The screen region the areas were drawn over, so the caller can batch the
+//   repaint of everything that was vacated into a single invalidation.
+til::rect ConsoleImeInfo::_HideAllAreas()
+{
+    const auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    const auto viewport = gci.GetActiveOutputBuffer().GetViewport();
+
+    til::rect dirtyArea;
     for (auto& area : ConvAreaCompStr)
     {
         if (!area.IsHidden())
         {
+            dirtyArea |= til::rect{ area.GetScreenRegion(viewport) };
             area.ClearArea();
         }
     }
-
-    // Also clear internal buffer of string data.
-    _ClearComposition();
+    return dirtyArea;
 }
 
 // Routine Description:
@@ -309,7 +335,9 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
                                                                              const std::vector<OutputCell>::const_iterator end,
                                                                              til::point& pos,
                                                                              const Microsoft::Console::Types::Viewport view,
-                                                                             SCREEN_INFORMATION& screenInfo)
+                                                                             SCREEN_INFORMATION& screenInfo,
+                                                                             size_t& nextAreaIndex,
+                                                                             til::rect& dirtyArea)
 {
     // The position in the viewport where we will start inserting cells for this conversion area
     // NOTE: We might exit early if there's not enough space to fit here, so we take a copy of
@@ -358,24 +386,29 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
     // Copy out the substring into a vector.
     const std::vector<OutputCell> lineVec(lineBegin, lineEnd);
 
-    // Add a conversion area to the internal state to hold this line.
-    THROW_IF_FAILED(_AddConversionArea());
-
-    // Get the added conversion area.
-    auto& area = ConvAreaCompStr.back();
+    // Grab the next pooled conversion area to hold this line, growing the pool
+    // only if this composition needs more lines than any previous one did.
+    if (nextAreaIndex >= ConvAreaCompStr.size())
+    {
+        THROW_IF_FAILED(_AddConversionArea());
+    }
+    auto& area = ConvAreaCompStr.at(nextAreaIndex);
+    nextAreaIndex++;
 
     // Write our text into the conversion area.
     area.WriteText(lineVec, insertionPos.x);
 
     // Set the viewport and positioning parameters for the conversion area to describe to the renderer
     // the appropriate location to overlay this conversion area on top of the main screen buffer inside the viewport.
+    // The area is still hidden at this point, so these don't paint anything.
     const til::inclusive_rect region{ insertionPos.x, 0, gsl::narrow<til::CoordType>(insertionPos.x + lineVec.size() - 1), 0 };
     area.SetWindowInfo(region);
     area.SetViewPos({ 0 - view.Left(), insertionPos.y - view.Top() });
 
-    // Make it visible and paint it.
+    // Make it visible and fold it into the batched invalidation that our
+    // caller issues once all lines have been written.
     area.SetHidden(false);
-    area.Paint();
+    dirtyArea |= til::rect{ area.GetScreenRegion(view) };
 
     // Notify accessibility that we have updated the text in this display region within the viewport.
     if (screenInfo.HasAccessibilityEventing())
@@ -397,9 +430,13 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
 // - attributes - Attributes specifying which color and cursor positioning information should apply to
 //                each text character. This view must be the same size as the text view.
 // - colorArray - 8 colors to be used to format the text for display
+// - dirtyArea - Screen region that already needs repainting (the area the
+//               previous composition vacated). The regions written here are
+//               added to it and the whole thing is invalidated in one go.
 void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
                                              const std::span<const BYTE> attributes,
-                                             const std::span<const WORD> colorArray)
+                                             const std::span<const WORD> colorArray,
+                                             til::rect dirtyArea)
 {
     auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
     auto& screenInfo = gci.GetActiveOutputBuffer();
@@ -407,16 +444,20 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     // Ensure cursor is visible for prompt line
     screenInfo.MakeCurrentCursorVisible();
 
-    // Clear out existing conversion areas.
-    ConvAreaCompStr.clear();
+    // The conversion areas themselves are pooled and reused across
+    // compositions - they were already hidden and cleared by our caller.
 
     // If the text length and attribute length don't match,
     // it's a programming error on our part. We control the sizes here.
     FAIL_FAST_IF(text.size() != attributes.size());
 
-    // If we have no text, return. We've already cleared above.
+    // If we have no text, just repaint whatever the previous composition vacated.
     if (text.empty())
     {
+        if (!dirtyArea.empty())
+        {
+            WriteToScreen(screenInfo, Microsoft::Console::Types::Viewport::FromExclusive(dirtyArea));
+        }
         return;
     }
 
@@ -441,10 +482,18 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     const auto end = cells.cend();
 
     // Write over and over updating the beginning iterator until we reach the end.
+    size_t nextAreaIndex = 0;
     do
     {
-        begin = _WriteConversionArea(begin, end, pos, view, screenInfo);
+        begin = _WriteConversionArea(begin, end, pos, view, screenInfo, nextAreaIndex, dirtyArea);
     } while (begin < end);
+
+    // One invalidation for the entire update: the region the previous
+    // composition occupied plus everything that was just written.
+    if (!dirtyArea.empty())
+    {
+        WriteToScreen(screenInfo, Microsoft::Console::Types::Viewport::FromExclusive(dirtyArea));
+    }
 }
 
 // Routine Description:
@@ -63,9 +63,12 @@ private:
 
     void _ClearComposition();
 
+    til::rect _HideAllAreas();
+
     void _WriteUndeterminedChars(const std::wstring_view text,
                                  const std::span<const BYTE> attributes,
-                                 const std::span<const WORD> colorArray);
+                                 const std::span<const WORD> colorArray,
+                                 til::rect dirtyArea);
 
     void _InsertConvertedString(const std::wstring_view text);
 
@@ -81,7 +84,9 @@ private:
                                                                  const std::vector<OutputCell>::const_iterator end,
                                                                  til::point& pos,
                                                                  const Microsoft::Console::Types::Viewport view,
-                                                                 SCREEN_INFORMATION& screenInfo);
+                                                                 SCREEN_INFORMATION& screenInfo,
+                                                                 size_t& nextAreaIndex,
+                                                                 til::rect& dirtyArea);
 
     bool _isSavedCursorVisible;
 
@@ -301,7 +301,7 @@ CATCH_RETURN();
 
                         // Try to convert the unicode character (2 bytes) in the leading cell to the codepage.
                         CHAR AsciiDbcs[2]{};
-                        ConvertToOem(codepage, &in1.Char.UnicodeChar, 1, &AsciiDbcs[0], 2);
+                        ConvertToOemChar(codepage, in1.Char.UnicodeChar, &AsciiDbcs[0]);
 
                         // Fill the 1 byte (AsciiChar) portion of the leading and trailing cells with each of the bytes returned.
                         // We have to be bit careful here not to directly write the CHARs, because CHARs are signed whereas wchar_t isn't
@@ -320,10 +320,12 @@ CATCH_RETURN();
                 else if (WI_AreAllFlagsClear(in1.Attributes, COMMON_LVB_SBCSDBCS))
                 {
                     // If there are no leading/trailing pair flags, then we only have 1 ascii byte to try to fit the
-                    // 2 byte UTF-16 character into. Give it a go.
-                    CHAR asciiChar{};
-                    ConvertToOem(codepage, &in1.Char.UnicodeChar, 1, &asciiChar, 1);
-                    in1.Char.UnicodeChar = til::bit_cast<uint8_t>(asciiChar);
+                    // 2 byte UTF-16 character into. Give it a go, but only accept
+                    // single-byte translations, just like the direct conversion
+                    // with a 1 byte target buffer did.
+                    CHAR asciiChars[2]{};
+                    const auto length = ConvertToOemChar(codepage, in1.Char.UnicodeChar, &asciiChars[0]);
+                    in1.Char.UnicodeChar = length == 1 ? til::bit_cast<uint8_t>(asciiChars[0]) : 0;
                 }
             }
         }
@@ -470,7 +472,6 @@ CATCH_RETURN();
 {
     try
     {
-        const auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
         const auto& storageBuffer = context.GetActiveBuffer().GetTextBuffer();
         const auto storageSize = storageBuffer.GetSize().Dimensions();
 
@@ -507,41 +508,67 @@ CATCH_RETURN();
 
         // We will start reading the buffer at the point of the top left corner (origin) of the (potentially adjusted) request
         const auto sourcePoint = clippedRequestRectangle.Origin();
+        const auto clippedSize = clippedRequestRectangle.Dimensions();
 
-        // Get an iterator to the beginning of the return buffer
-        // We might have to seek this forward or skip around if we clipped the request.
-        auto targetIter = targetBuffer.begin();
-        til::point targetPos;
-        const auto targetLimit = Viewport::FromDimensions(targetPoint, clippedRequestRectangle.Dimensions());
-
-        // Get an iterator to the beginning of the request inside the screen buffer
-        // This should walk exactly along every cell of the clipped request.
-        auto sourceIter = storageBuffer.GetCellDataAt(sourcePoint, clippedRequestRectangle);
-
-        // Walk through every cell of the target, advancing the buffer.
-        // Validate that we always still have a valid iterator to the backing store,
-        // that we always are writing inside the user's buffer (before the end)
-        // and we're always targeting the user's buffer inside its original bounds.
-        while (sourceIter && targetIter < targetBuffer.end())
+        // Walk the clipped request row by row. Every row hands us contiguous views of
+        // its text, char offsets and attribute runs, which lets us expand whole rows
+        // into the caller's CHAR_INFOs and resolve the legacy attributes once per
+        // attribute run instead of once per cell.
+        for (til::CoordType row = 0; row < clippedSize.height; ++row)
         {
-            // If the point we're trying to write is inside the limited buffer write zone...
-            if (targetLimit.IsInBounds(targetPos))
+            const auto view = storageBuffer.GetRowSpanView(sourcePoint.y + row);
+            const auto targetOffset = gsl::narrow_cast<size_t>(targetPoint.y + row) * targetSize.width + targetPoint.x;
+            if (targetOffset >= targetBuffer.size())
             {
-                // Copy the data into position...
-                *targetIter = gci.AsCharInfo(*sourceIter);
-                // ... and advance the read iterator.
-                ++sourceIter;
+                break;
             }
 
-            // Always advance the write iterator, we might have skipped it due to clipping.
-            ++targetIter;
+            const auto target = targetBuffer.subspan(targetOffset, std::min(gsl::narrow_cast<size_t>(clippedSize.width), targetBuffer.size() - targetOffset));
+            const auto colBeg = sourcePoint.x;
+            const auto colEnd = colBeg + gsl::narrow_cast<til::CoordType>(target.size());
 
-            // Increment the target
-            targetPos.x++;
-            if (targetPos.x >= targetSize.width)
+            auto col = colBeg;
+            til::CoordType runBeg = 0;
+            for (const auto& run : view.attrs->runs())
             {
-                targetPos.x = 0;
-                targetPos.y++;
+                const auto runEnd = runBeg + run.length;
+                if (runEnd > col)
+                {
+                    const auto legacyAttributes = run.value.GetLegacyAttributes();
+                    for (const auto to = std::min(runEnd, colEnd); col < to; ++col)
+                    {
+                        const auto offset = til::at(view.charOffsets, col);
+                        const size_t chBeg = offset & ROW::CharOffsetsMask;
+                        auto attributes = legacyAttributes;
+                        size_t chEnd;
+
+                        if (WI_IsFlagSet(offset, ROW::CharOffsetsTrailer))
+                        {
+                            chEnd = til::at(view.charOffsets, col + 1) & ROW::CharOffsetsMask;
+                            WI_SetFlag(attributes, COMMON_LVB_TRAILING_BYTE);
+                        }
+                        else if (WI_IsFlagSet(til::at(view.charOffsets, col + 1), ROW::CharOffsetsTrailer))
+                        {
+                            chEnd = til::at(view.charOffsets, col + 2) & ROW::CharOffsetsMask;
+                            WI_SetFlag(attributes, COMMON_LVB_LEADING_BYTE);
+                        }
+                        else
+                        {
+                            chEnd = til::at(view.charOffsets, col + 1);
+                        }
+
+                        auto& ci = til::at(target, gsl::narrow_cast<size_t>(col - colBeg));
+                        // Multi-wchar_t glyphs cannot be represented in a CHAR_INFO. Same as Utf16ToUcs2.
+                        ci.Char.UnicodeChar = chEnd - chBeg == 1 ? til::at(view.chars, chBeg) : UNICODE_REPLACEMENT;
+                        ci.Attributes = attributes;
+                    }
+                }
+
+                runBeg = runEnd;
+                if (col >= colEnd)
+                {
+                    break;
+                }
             }
         }
 
@@ -222,7 +222,9 @@ int CALLBACK wWinMain(
     _In_ PWSTR /*pwszCmdLine*/,
     _In_ int /*nCmdShow*/)
 {
-    TraceLoggingRegister(g_hConhostV2EventTraceProvider);
+    // RegisterEx rather than Register, so that trace controllers can request a
+    // capture state to dump the per-API latency histograms on demand.
+    TraceLoggingRegisterEx(g_hConhostV2EventTraceProvider, Tracing::s_EtwEnableCallback, nullptr);
     wil::SetResultLoggingCallback(&Tracing::TraceFailure);
     Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().hInstance = hInstance;
 
@@ -49,6 +49,9 @@ struct NullDeviceComm : public IDeviceComm
     {
         return nullptr;
     }
+    void DestroyHandle(ULONG_PTR) override
+    {
+    }
     HRESULT GetServerHandle(HANDLE*) const override
     {
         return S_FALSE;
@@ -114,13 +117,111 @@ extern "C" __declspec(dllexport) HRESULT RunConhost()
     return hr;
 }
 
+namespace
+{
+    // Scripted corpora for the ingest baseline below. These mirror the
+    // workloads benchcat generates, but here they're pumped straight into the
+    // host's VT state machine with no device, no window and no render
+    // engines, so the numbers are pure parse+buffer cost. Diffing them
+    // against benchcat's full-pipeline numbers splits a "terminal is slow"
+    // report into rendering vs. ingest shares.
+    std::wstring GenerateCorpus(const std::string_view name, const size_t chars)
+    {
+        std::wstring corpus;
+        corpus.reserve(chars + 64);
+        uint32_t seed = 0x9e3779b9;
+        const auto rng = [&](uint32_t bound) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            return seed % bound;
+        };
+
+        wchar_t run[32];
+        while (corpus.size() < chars)
+        {
+            if (name == "ascii")
+            {
+                for (auto col = 0; col < 80; col += 6)
+                {
+                    corpus.append(L"lorem ");
+                }
+                corpus.append(L"\r\n");
+            }
+            else if (name == "vt")
+            {
+                swprintf_s(run, L"\x1b[%d;%dH", rng(25) + 1, rng(78) + 1);
+                corpus.append(run);
+                corpus.append(L"ok");
+            }
+            else if (name == "attr")
+            {
+                swprintf_s(run, L"\x1b[38;2;%d;%d;%dm", rng(256), rng(256), rng(256));
+                corpus.append(run);
+                corpus.append(L"text");
+            }
+            else // scroll
+            {
+                corpus.append(78, L'#');
+                corpus.append(L"\r\n");
+            }
+        }
+        return corpus;
+    }
+
+    int RunIngestBench()
+    {
+        auto& gci = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().getConsoleInformation();
+
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+
+        static constexpr std::string_view corpora[] = { "ascii", "vt", "attr", "scroll" };
+        static constexpr size_t corpusChars = 8 * 1024 * 1024;
+        static constexpr int passes = 4;
+
+        printf("%-8s %14s %10s\n", "corpus", "chars/pass", "MCh/s");
+        for (const auto& name : corpora)
+        {
+            const auto corpus = GenerateCorpus(name, corpusChars);
+
+            gci.LockConsole();
+            auto u = wil::scope_exit([&]() { gci.UnlockConsole(); });
+            auto& machine = gci.GetActiveOutputBuffer().GetStateMachine();
+
+            // One untimed pass to populate the buffer and warm the caches.
+            machine.ProcessString(corpus);
+
+            LARGE_INTEGER start, end;
+            QueryPerformanceCounter(&start);
+            for (auto pass = 0; pass < passes; pass++)
+            {
+                machine.ProcessString(corpus);
+            }
+            QueryPerformanceCounter(&end);
+
+            const auto seconds = static_cast<double>(end.QuadPart - start.QuadPart) / static_cast<double>(freq.QuadPart);
+            const auto mchPerSecond = (static_cast<double>(corpus.size()) * passes) / seconds / 1e6;
+            printf("%-8.*s %14zu %10.1f\n", static_cast<int>(name.size()), name.data(), corpus.size(), mchPerSecond);
+        }
+
+        return 0;
+    }
+}
+
 #ifdef FUZZING_BUILD
 extern "C" __declspec(dllexport) int LLVMFuzzerInitialize(int* /*argc*/, char*** /*argv*/)
 #else
-int main(int /*argc*/, char** /*argv*/)
+int main(int argc, char** argv)
 #endif
 {
     RETURN_IF_FAILED(RunConhost());
+#ifndef FUZZING_BUILD
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+    {
+        return RunIngestBench();
+    }
+#endif
     return 0;
 }
 
@@ -55,6 +55,14 @@ public:
     int dpi = USER_DEFAULT_SCREEN_DPI;
     ULONG cursorPixelWidth = 1;
 
+    // Bumped by the window message thread whenever the monitor layout, DPI,
+    // system metrics or window position may have changed. It allows
+    // SCREEN_INFORMATION to cache the maximum client rect (which is expensive
+    // to compute, because it involves a bunch of user32 calls) across the very
+    // frequent GetConsoleScreenBufferInfoEx calls. Starts at 1 so that a
+    // zero-initialized cache generation is always considered stale.
+    std::atomic<uint32_t> windowMetricsGeneration{ 1 };
+
     NTSTATUS ntstatusConsoleInputInitStatus;
     wil::unique_event_nothrow hConsoleInputInitEvent;
     DWORD dwInputThreadId;
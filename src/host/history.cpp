@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 
+#include <til/hash.h>
+
 #include "history.h"
 
 #include "_output.h"
@@ -78,6 +80,25 @@ bool CommandHistory::IsAppNameMatch(const std::wstring_view other) const
     return CompareStringOrdinal(_appName.data(), gsl::narrow<int>(_appName.size()), other.data(), gsl::narrow<int>(other.size()), TRUE) == CSTR_EQUAL;
 }
 
+// Routine Description:
+// - Packs the first few characters of the given command into an integer.
+//   Two commands can only share a prefix if these integers compare equal
+//   under a mask covering the shorter of the two (see FindMatchingCommand).
+uint64_t CommandHistory::_PrefixOf(const std::wstring_view& command) noexcept
+{
+    uint64_t prefix = 0;
+    if (!command.empty())
+    {
+        memcpy(&prefix, command.data(), std::min(command.size(), sizeof(prefix) / sizeof(wchar_t)) * sizeof(wchar_t));
+    }
+    return prefix;
+}
+
+CommandHistory::CommandFingerprint CommandHistory::_FingerprintOf(const std::wstring_view& command) noexcept
+{
+    return { til::hash(command), _PrefixOf(command) };
+}
+
 // Routine Description:
 // - This routine is called when escape is entered or a command is added.
 void CommandHistory::_Reset()
@@ -121,6 +142,7 @@ void CommandHistory::_Reset()
             if (GetNumberOfCommands() == _maxCommands)
             {
                 _commands.erase(_commands.cbegin());
+                _fingerprints.erase(_fingerprints.cbegin());
                 // move LastDisplayed back one in order to stay synced with the
                 // command it referred to before erasing the lru one
                 --LastDisplayed;
@@ -135,6 +157,7 @@ void CommandHistory::_Reset()
             {
                 _commands.emplace_back(newCommand);
             }
+            _fingerprints.emplace_back(_FingerprintOf(newCommand));
 
             if (LastDisplayed == -1 ||
                 _commands.at(LastDisplayed).size() != newCommand.size() ||
@@ -211,6 +234,7 @@ std::wstring_view CommandHistory::GetLastCommand() const
 void CommandHistory::Empty()
 {
     _commands.clear();
+    _fingerprints.clear();
     LastDisplayed = -1;
     WI_SetFlag(Flags, CLE_RESET);
 }
@@ -244,6 +268,7 @@ void CommandHistory::Realloc(const Index commands)
     }
 
     _commands.resize(std::min(_commands.size(), gsl::narrow_cast<size_t>(std::max(0, commands))));
+    _fingerprints.resize(_commands.size());
 
     WI_SetFlag(Flags, CLE_RESET);
     LastDisplayed = GetNumberOfCommands() - 1;
@@ -349,6 +374,7 @@ CommandHistory* CommandHistory::s_Allocate(const std::wstring_view appName, cons
         if (!SameApp)
         {
             BestCandidate->_commands.clear();
+            BestCandidate->_fingerprints.clear();
             BestCandidate->LastDisplayed = -1;
             BestCandidate->_appName = appName;
         }
@@ -414,6 +440,7 @@ std::wstring CommandHistory::Remove(const Index iDel)
 
     const auto str = std::move(_commands.at(iDel));
     _commands.erase(_commands.begin() + iDel);
+    _fingerprints.erase(_fingerprints.begin() + iDel);
 
     if (LastDisplayed == iDel)
     {
@@ -457,18 +484,42 @@ std::wstring CommandHistory::Remove(const Index iDel)
 
     try
     {
-        for (size_t i = 0; i < _commands.size(); i++)
+        if (WI_IsFlagSet(options, MatchOptions::ExactMatch))
         {
-            const auto& storedCommand = _commands.at(indexFound);
-            if ((WI_IsFlagClear(options, MatchOptions::ExactMatch) && (givenCommand.size() <= storedCommand.size())) || (givenCommand.size() == storedCommand.size()))
+            // Equal strings imply equal hashes, so comparing the cached hash first
+            // rejects almost all entries without reading the string allocations.
+            const auto givenHash = til::hash(givenCommand);
+
+            for (size_t i = 0; i < _commands.size(); i++)
             {
-                if (til::starts_with(storedCommand, givenCommand))
+                if (_fingerprints.at(indexFound).hash == givenHash && _commands.at(indexFound) == givenCommand)
                 {
                     return true;
                 }
+
+                _Prev(indexFound);
             }
+        }
+        else
+        {
+            // A command can only start with givenCommand if their first characters
+            // are identical, so comparing the cached prefix (masked to the length
+            // of givenCommand) rejects almost all entries without reading the
+            // string allocations. The mask is never 0 because givenCommand isn't empty.
+            const auto prefixLength = std::min(givenCommand.size(), sizeof(uint64_t) / sizeof(wchar_t));
+            const auto prefixMask = ~uint64_t{ 0 } >> (64 - prefixLength * 16);
+            const auto givenPrefix = _PrefixOf(givenCommand);
+
+            for (size_t i = 0; i < _commands.size(); i++)
+            {
+                if ((_fingerprints.at(indexFound).prefix & prefixMask) == givenPrefix &&
+                    til::starts_with(_commands.at(indexFound), givenCommand))
+                {
+                    return true;
+                }
 
-            _Prev(indexFound);
+                _Prev(indexFound);
+            }
         }
     }
     CATCH_LOG();
@@ -496,6 +547,7 @@ void CommandHistory::Swap(const Index indexA, const Index indexB)
         indexB >= 0 && indexB < num)
     {
         std::swap(_commands.at(indexA), _commands.at(indexB));
+        std::swap(_fingerprints.at(indexA), _fingerprints.at(indexB));
     }
 }
 
@@ -63,6 +63,21 @@ public:
     void Swap(const Index indexA, const Index indexB);
 
 private:
+    // A cheap-to-compare summary of a command: the til::hash() of the whole
+    // string, plus its first few characters packed into an integer.
+    // FindMatchingCommand() compares these before the strings themselves,
+    // which lets it reject almost all entries without touching the string
+    // allocations. That keeps duplicate suppression and F8 completion fast
+    // even when the history size was cranked up via the registry.
+    struct CommandFingerprint
+    {
+        size_t hash;
+        uint64_t prefix;
+    };
+
+    static uint64_t _PrefixOf(const std::wstring_view& command) noexcept;
+    static CommandFingerprint _FingerprintOf(const std::wstring_view& command) noexcept;
+
     void _Reset();
 
     // _Next and _Prev go to the next and prev command
@@ -76,6 +91,8 @@ private:
     // NOTE: In conhost v1 this used to be a circular buffer because removal at the
     // start is a very common operation. It seems this was lost in the C++ refactor.
     std::vector<std::wstring> _commands;
+    // Kept index-synchronized with _commands at all times.
+    std::vector<CommandFingerprint> _fingerprints;
     Index _maxCommands = 0;
 
     std::wstring _appName;
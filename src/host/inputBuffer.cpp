@@ -298,6 +298,11 @@ void InputBuffer::ReinitializeInputBuffer()
 // - None
 void InputBuffer::WakeUpReadersWaitingForData()
 {
+    if (_wakeupsDeferred)
+    {
+        _wakeupPending = true;
+        return;
+    }
     WaitQueue.NotifyWaiters(false);
 }
 
@@ -672,7 +677,28 @@ bool InputBuffer::WriteMouseEvent(til::point position, const unsigned int button
 
         if (const auto out = _termInput.HandleMouse(position, button, keyState, wheelDelta, state))
         {
-            _HandleTerminalInputCallback(*out);
+            if (button == WM_MOUSEMOVE && !out->empty())
+            {
+                // The non-VT path coalesces consecutive unread mouse moves into
+                // a single record (see _CoalesceEvent). Do the equivalent for
+                // the encoded sequences: if the previous motion sequence is
+                // still sitting unread at the tail of the queue, its position
+                // has been superseded by this event, so replace it rather than
+                // letting a high-polling-rate mouse queue up kilobytes of
+                // stale motion behind a busy client. Presses, releases and
+                // wheel events are never touched.
+                if (_lastMouseMoveIsUnread())
+                {
+                    _storage.resize(_storage.size() - _lastMouseMoveSequence.size());
+                }
+                _HandleTerminalInputCallback(*out);
+                _lastMouseMoveSequence = *out;
+                _sizeAfterLastMouseMove = _storage.size();
+            }
+            else
+            {
+                _HandleTerminalInputCallback(*out);
+            }
             return true;
         }
     }
@@ -680,6 +706,37 @@ bool InputBuffer::WriteMouseEvent(til::point position, const unsigned int button
     return false;
 }
 
+// Routine Description:
+// - Checks whether the sequence of the last mouse motion event is still
+//   sitting, fully unread, at the tail of the storage queue. Reads consume
+//   from the front and writes append to the back, so if the queue size hasn't
+//   changed since the sequence was appended and the tail still spells it out,
+//   no reader can have seen any part of it yet.
+// Return Value:
+// - true if the last motion sequence may safely be removed and replaced.
+bool InputBuffer::_lastMouseMoveIsUnread() const noexcept
+{
+    const auto length = _lastMouseMoveSequence.size();
+    if (length == 0 || _storage.size() != _sizeAfterLastMouseMove || _storage.size() < length)
+    {
+        return false;
+    }
+
+    auto it = _storage.end() - gsl::narrow_cast<ptrdiff_t>(length);
+    for (const auto wch : _lastMouseMoveSequence)
+    {
+        const auto& record = *it++;
+        if (record.EventType != KEY_EVENT ||
+            !record.Event.KeyEvent.bKeyDown ||
+            record.Event.KeyEvent.uChar.UnicodeChar != wch)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // Ctrl-S is traditionally considered an alias for the pause key.
 // This returns true if it's either of the two.
 static bool IsPauseKey(const KEY_EVENT_RECORD& event)
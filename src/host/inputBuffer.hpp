@@ -43,6 +43,24 @@ public:
 
     void ReinitializeInputBuffer();
     void WakeUpReadersWaitingForData();
+
+    // Batches WakeUpReadersWaitingForData() calls for the lifetime of the
+    // returned scope guard. The VT input thread dispatches event floods one
+    // Write() at a time, and each of those walked the whole wait queue under
+    // the console lock. Readers can't run until the lock is released anyway,
+    // so waking them once per chunk - which the guard does on destruction -
+    // is equivalent and a lot cheaper.
+    [[nodiscard]] auto DeferReaderWakeups() noexcept
+    {
+        _wakeupsDeferred = true;
+        return wil::scope_exit([this]() {
+            _wakeupsDeferred = false;
+            if (std::exchange(_wakeupPending, false))
+            {
+                WakeUpReadersWaitingForData();
+            }
+        });
+    }
     void TerminateRead(_In_ WaitTerminationReason Flag);
     size_t GetNumberOfReadyEvents() const noexcept;
     void Flush();
@@ -86,16 +104,28 @@ private:
     bool _writePartialByteSequenceAvailable = false;
     Microsoft::Console::VirtualTerminal::TerminalInput _termInput;
 
+    // The VT sequence of the most recent mouse motion event written by
+    // WriteMouseEvent(), and the storage size right after it was appended.
+    // If the next motion arrives while that sequence is still sitting unread
+    // at the tail of _storage, it gets superseded in place.
+    std::wstring _lastMouseMoveSequence;
+    size_t _sizeAfterLastMouseMove = 0;
+
     // This flag is used in _HandleTerminalInputCallback
     // If the InputBuffer leads to a _HandleTerminalInputCallback call,
     //    we should suppress the wakeup functions.
     // Otherwise, we should be calling them.
     bool _vtInputShouldSuppress{ false };
 
+    // See DeferReaderWakeups().
+    bool _wakeupsDeferred{ false };
+    bool _wakeupPending{ false };
+
     void _switchReadingMode(ReadingMode mode);
     void _switchReadingModeSlowPath(ReadingMode mode);
     void _WriteBuffer(const std::span<const INPUT_RECORD>& inRecords, _Out_ size_t& eventsWritten, _Out_ bool& setWaitEvent);
     bool _CoalesceEvent(const INPUT_RECORD& inEvent) noexcept;
+    bool _lastMouseMoveIsUnread() const noexcept;
     void _HandleTerminalInputCallback(const Microsoft::Console::VirtualTerminal::TerminalInput::StringType& text);
     void _writeString(const std::wstring_view& text);
 
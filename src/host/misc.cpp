@@ -71,6 +71,94 @@ int ConvertToOem(const UINT uiCodePage,
     return LOG_IF_WIN32_BOOL_FALSE(WideCharToMultiByte(uiCodePage, 0, pwchSource, cchSource, pchTarget, cchTarget, nullptr, nullptr));
 }
 
+// A lazily built translation table for single UTF-16 code units, so that the
+// A-variant surface APIs (which inherently convert cell by cell) don't pay
+// for a WideCharToMultiByte call per cell. Blocks of 256 code units are
+// filled on first use: single-byte codepages convert a whole block with one
+// batched WideCharToMultiByte call, DBCS codepages convert per code unit
+// (the output byte count varies, so batch results can't be split up again).
+// Like its callers, this is guarded by the console lock.
+namespace
+{
+    struct OemCharEntry
+    {
+        CHAR bytes[2];
+        BYTE length;
+    };
+
+    UINT s_oemCharCacheCodepage = 0;
+    bool s_oemCharCacheSingleByte = false;
+    std::array<std::unique_ptr<OemCharEntry[]>, 256> s_oemCharCacheBlocks;
+}
+
+// Routine Description:
+// - Converts a single unicode code unit to ANSI through a cached per-codepage
+//   translation table. Equivalent to ConvertToOem with cchSource == 1, but a
+//   table lookup on all but the first call for any given 256-code-unit block.
+// Arguments:
+// - uiCodePage - codepage for use in conversion
+// - wchSource - unicode code unit to convert
+// - pchTarget - pointer to destination buffer, receives up to 2 bytes
+// Return Value:
+// - Returns the number of bytes written to pchTarget, or 0 on failure
+int ConvertToOemChar(const UINT uiCodePage,
+                     const wchar_t wchSource,
+                     _Out_writes_(2) CHAR* const pchTarget) noexcept
+try
+{
+    if (s_oemCharCacheCodepage != uiCodePage)
+    {
+        for (auto& block : s_oemCharCacheBlocks)
+        {
+            block.reset();
+        }
+        CPINFO cpInfo{};
+        s_oemCharCacheSingleByte = GetCPInfo(uiCodePage, &cpInfo) && cpInfo.MaxCharSize == 1;
+        s_oemCharCacheCodepage = uiCodePage;
+    }
+
+    auto& block = s_oemCharCacheBlocks[wchSource >> 8];
+    if (!block)
+    {
+        block = std::make_unique<OemCharEntry[]>(256);
+        const auto base = wchSource & 0xff00;
+
+        if (s_oemCharCacheSingleByte)
+        {
+            wchar_t wide[256];
+            CHAR narrow[256];
+            std::iota(&wide[0], &wide[256], static_cast<wchar_t>(base));
+            if (WideCharToMultiByte(uiCodePage, 0, &wide[0], 256, &narrow[0], 256, nullptr, nullptr) == 256)
+            {
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    block[i].bytes[0] = narrow[i];
+                    block[i].length = 1;
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < 256; ++i)
+            {
+                const auto wch = static_cast<wchar_t>(base + i);
+                const auto length = WideCharToMultiByte(uiCodePage, 0, &wch, 1, &block[i].bytes[0], 2, nullptr, nullptr);
+                block[i].length = gsl::narrow_cast<BYTE>(std::max(length, 0));
+            }
+        }
+    }
+
+    const auto& entry = block[wchSource & 0xff];
+    pchTarget[0] = entry.bytes[0];
+    pchTarget[1] = entry.bytes[1];
+    return entry.length;
+}
+catch (...)
+{
+    // Out of memory for a table block: fall back to the uncached conversion.
+    return ConvertToOem(uiCodePage, &wchSource, 1, pchTarget, 2);
+}
+
 // Output data is always translated via the ansi codepage so glyph translation works.
 int ConvertOutputToUnicode(_In_ UINT uiCodePage,
                            _In_reads_(cchSource) const CHAR* const pchSource,
@@ -34,6 +34,10 @@ int ConvertToOem(const UINT uiCodePage,
                  _Out_writes_(cchTarget) CHAR* const pchTarget,
                  const UINT cchTarget) noexcept;
 
+int ConvertToOemChar(const UINT uiCodePage,
+                     const wchar_t wchSource,
+                     _Out_writes_(2) CHAR* const pchTarget) noexcept;
+
 int ConvertOutputToUnicode(_In_ UINT uiCodePage,
                            _In_reads_(cchSource) const CHAR* const pchSource,
                            _In_ UINT cchSource,
@@ -14,6 +14,8 @@
 #include "../types/inc/Viewport.hpp"
 #include "../types/inc/convert.hpp"
 
+#include <til/rect_set.h>
+
 #pragma hdrstop
 
 using namespace Microsoft::Console::Types;
@@ -92,28 +94,12 @@ static void _CopyRectangle(SCREEN_INFORMATION& screenInfo,
         }
     }
 
-    // 2. We can move any other scenario in-place without copying. We just have to carefully
-    //    choose which direction we walk through filling up the target so it doesn't accidentally
-    //    erase the source material before it can be copied/moved to the new location.
-    {
-        const auto target = Viewport::FromDimensions(targetOrigin, source.Dimensions());
-        const auto walkDirection = Viewport::DetermineWalkDirection(source, target);
-
-        auto sourcePos = source.GetWalkOrigin(walkDirection);
-        auto targetPos = target.GetWalkOrigin(walkDirection);
-
-        // Note that we read two cells from the source before we start writing
-        // to the target, so a two-cell DBCS character can't accidentally delete
-        // itself when moving one cell horizontally.
-        auto next = OutputCell(*screenInfo.GetCellDataAt(sourcePos));
-        do
-        {
-            const auto current = next;
-            source.WalkInBounds(sourcePos, walkDirection);
-            next = OutputCell(*screenInfo.GetCellDataAt(sourcePos));
-            screenInfo.GetTextBuffer().WriteLine(OutputCellIterator({ &current, 1 }), targetPos);
-        } while (target.WalkInBounds(targetPos, walkDirection));
-    }
+    // 2. Any other scenario moves in bulk through the row storage. CopyRect walks
+    //    the rows in the direction that reads each source row before it can be
+    //    overwritten, and stages horizontal moves through the scratchpad row so a
+    //    two-cell DBCS character can't accidentally delete itself when moving one
+    //    cell horizontally.
+    screenInfo.GetTextBuffer().CopyRect(source.ToExclusive(), targetOrigin);
 }
 
 // Routine Description:
@@ -140,34 +126,52 @@ std::vector<WORD> ReadOutputAttributes(const SCREEN_INFORMATION& screenInfo,
         return {};
     }
 
-    // Get iterator to the position we should start reading at.
-    auto it = screenInfo.GetCellDataAt(coordRead);
-    // Count up the number of cells we've attempted to read.
-    ULONG amountRead = 0;
+    const auto& textBuffer = screenInfo.GetTextBuffer();
+    const auto bufferSize = screenInfo.GetBufferSize();
+    const auto width = bufferSize.Width();
+    const auto height = bufferSize.Height();
+
     // Prepare the return value string.
     std::vector<WORD> retVal;
-    // Reserve the number of cells. If we have >U+FFFF, it will auto-grow later and that's OK.
     retVal.reserve(amountToRead);
 
-    // While we haven't read enough cells yet and the iterator is still valid (hasn't reached end of buffer)
-    while (amountRead < amountToRead && it)
+    // Walk row by row, wrapping around to the next row until we've read enough
+    // cells or hit the end of the buffer.
+    auto remaining = amountToRead;
+    auto col = coordRead.x;
+    for (auto y = coordRead.y; remaining > 0 && y < height; y++, col = 0)
     {
-        const auto legacyAttributes = it->TextAttr().GetLegacyAttributes();
+        const auto& row = textBuffer.GetRowByOffset(y);
+        const auto cells = std::min(remaining, gsl::narrow_cast<size_t>(width - col));
+        const auto colEnd = col + gsl::narrow_cast<til::CoordType>(cells);
+        remaining -= cells;
+
+        auto runCol = col;
+        row.Attributes().for_each_run(gsl::narrow_cast<uint16_t>(col), gsl::narrow_cast<uint16_t>(colEnd), [&](const TextAttribute& attr, uint16_t length) {
+            // Translating to the legacy format goes through the color table;
+            // doing it once per run instead of once per cell is the bulk of
+            // the win over the old cell iterator.
+            const auto legacyAttributes = attr.GetLegacyAttributes();
+            for (const auto runColEnd = runCol + length; runCol < runColEnd; runCol++)
+            {
+                retVal.push_back(legacyAttributes | GeneratePublicApiAttributeFormat(row.DbcsAttrAt(runCol)));
+            }
+        });
+    }
 
-        // If the first thing we read is trailing, pad with a space.
-        // OR If the last thing we read is leading, pad with a space.
-        if ((amountRead == 0 && it->DbcsAttr() == DbcsAttribute::Trailing) ||
-            (amountRead == (amountToRead - 1) && it->DbcsAttr() == DbcsAttribute::Leading))
+    // A wide glyph only half covered by the request is reported without its
+    // lead/trail flag: if the first thing we read is trailing, or the last
+    // thing we read is leading, strip the flag.
+    if (!retVal.empty())
+    {
+        if (textBuffer.GetRowByOffset(coordRead.y).DbcsAttrAt(coordRead.x) == DbcsAttribute::Trailing)
         {
-            retVal.push_back(legacyAttributes);
+            retVal.front() &= ~COMMON_LVB_TRAILING_BYTE;
         }
-        else
+        if (retVal.size() == amountToRead)
         {
-            retVal.push_back(legacyAttributes | GeneratePublicApiAttributeFormat(it->DbcsAttr()));
+            retVal.back() &= ~COMMON_LVB_LEADING_BYTE;
         }
-
-        amountRead++;
-        it++;
     }
 
     return retVal;
@@ -197,37 +201,48 @@ std::wstring ReadOutputStringW(const SCREEN_INFORMATION& screenInfo,
         return {};
     }
 
-    // Get iterator to the position we should start reading at.
-    auto it = screenInfo.GetCellDataAt(coordRead);
-
-    // Count up the number of cells we've attempted to read.
-    ULONG amountRead = 0;
+    const auto& textBuffer = screenInfo.GetTextBuffer();
+    const auto bufferSize = screenInfo.GetBufferSize();
+    const auto width = bufferSize.Width();
+    const auto height = bufferSize.Height();
 
     // Prepare the return value string.
     std::wstring retVal;
     retVal.reserve(amountToRead); // Reserve the number of cells. If we have >U+FFFF, it will auto-grow later and that's OK.
 
-    // While we haven't read enough cells yet and the iterator is still valid (hasn't reached end of buffer)
-    while (amountRead < amountToRead && it)
+    auto remaining = amountToRead;
+    auto col = coordRead.x;
+
+    // If the first thing we read is trailing, its leading half lies outside
+    // the request; pad with a space in its place and skip past it.
+    if (textBuffer.GetRowByOffset(coordRead.y).DbcsAttrAt(col) == DbcsAttribute::Trailing)
+    {
+        retVal += UNICODE_SPACE;
+        remaining--;
+        col++;
+    }
+
+    // Walk row by row, appending each row's covered text span in one go.
+    // GetText() naturally returns each wide glyph just once (trailing cells
+    // are duplicate copies of the leading), just like the old per-cell read.
+    for (auto y = coordRead.y; remaining > 0 && y < height; y++, col = 0)
     {
-        // If the first thing we read is trailing, pad with a space.
-        // OR If the last thing we read is leading, pad with a space.
-        if ((amountRead == 0 && it->DbcsAttr() == DbcsAttribute::Trailing) ||
-            (amountRead == (amountToRead - 1) && it->DbcsAttr() == DbcsAttribute::Leading))
+        const auto& row = textBuffer.GetRowByOffset(y);
+        const auto cells = std::min(remaining, gsl::narrow_cast<size_t>(width - col));
+        const auto colEnd = col + gsl::narrow_cast<til::CoordType>(cells);
+        remaining -= cells;
+
+        // If the last thing we read is leading, its trailing half lies outside
+        // the request; emit the text up to the glyph and pad with a space.
+        if (remaining == 0 && cells > 0 && row.DbcsAttrAt(colEnd - 1) == DbcsAttribute::Leading)
         {
+            retVal += row.GetText(col, colEnd - 1);
             retVal += UNICODE_SPACE;
         }
         else
         {
-            // Otherwise, add anything that isn't a trailing cell. (Trailings are duplicate copies of the leading.)
-            if (it->DbcsAttr() != DbcsAttribute::Trailing)
-            {
-                retVal += it->Chars();
-            }
+            retVal += row.GetText(col, colEnd);
         }
-
-        amountRead++;
-        it++;
     }
 
     return retVal;
@@ -411,14 +426,15 @@ void ScrollRegion(SCREEN_INFORMATION& screenInfo,
     // Fill as a single viewport represents the entire region we were allowed to
     // write into. But since we already copied, filling the whole thing might
     // overwrite what we just placed at the target.
-    // So use the special subtraction function to get the viewports that fall
-    // within the fill area but outside of the target area.
-    const auto remaining = Viewport::Subtract(fill, target);
+    // So subtract the target region out of the fill region to get the
+    // rectangles that fall within the fill area but outside of the target area.
+    til::rect_set remaining{ fill.ToExclusive() };
+    remaining.subtract(target.ToExclusive());
 
-    // Apply the fill data to each of the viewports we're given here.
-    for (size_t i = 0; i < remaining.size(); i++)
+    // Apply the fill data to each of the rectangles we're given here.
+    for (const auto& rect : remaining)
     {
-        const auto& view = remaining.at(i);
+        const auto view = Viewport::FromExclusive(rect);
         screenInfo.WriteRect(fillData, view);
 
         // If we're scrolling an area that encompasses the full buffer width,
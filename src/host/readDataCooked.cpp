@@ -827,8 +827,23 @@ void COOKED_READ_DATA::_flushBuffer()
         // the relative "distance" to the current actual cursor position. That way _measureChars()
         // can still figure out what the logical cursor position is, when it handles tabs, etc.
         auto dirtyBegDistance = -_distanceCursor;
+        auto unmodifiedBeforeCursor = _buffer.GetUnmodifiedTextBeforeCursor();
+
+        // The previous _flushBuffer() call cached how many columns the text up to
+        // _measurementCache.offset takes up. If that text is still unchanged we don't
+        // need to measure it again. Since _handleChar() inserts text at the cursor
+        // position, this hits on every keystroke in the steady state and keeps the
+        // cost of a keystroke proportional to the edit and not the prompt length.
+        // The measurement only depends on the column the prompt starts in (for tabs),
+        // and anything that moves the prompt start marks the entire buffer as dirty,
+        // which makes unmodifiedBeforeCursor empty and skips the cache naturally.
+        if (_measurementCache.offset <= unmodifiedBeforeCursor.size())
+        {
+            unmodifiedBeforeCursor.remove_prefix(_measurementCache.offset);
+            distanceBeforeCursor = _measurementCache.distance;
+        }
 
-        distanceBeforeCursor = _measureChars(_buffer.GetUnmodifiedTextBeforeCursor(), dirtyBegDistance);
+        distanceBeforeCursor += _measureChars(unmodifiedBeforeCursor, dirtyBegDistance + distanceBeforeCursor);
         dirtyBegDistance += distanceBeforeCursor;
         distanceAfterCursor = _measureChars(_buffer.GetUnmodifiedTextAfterCursor(), dirtyBegDistance);
         dirtyBegDistance += distanceAfterCursor;
@@ -851,6 +866,7 @@ void COOKED_READ_DATA::_flushBuffer()
     _buffer.MarkAsClean();
     _distanceCursor = distanceBeforeCursor;
     _distanceEnd = distanceEnd;
+    _measurementCache = { _buffer.GetCursorPosition(), distanceBeforeCursor };
 }
 
 // This is just a small helper to fill the next N cells starting at the current cursor position with whitespace.
@@ -189,6 +189,15 @@ private:
     // _distanceEnd is the distance between the start of the prompt and its last
     // glyph at the end in columns (including wide glyph padding columns).
     ptrdiff_t _distanceEnd = 0;
+    // _flushBuffer() remembers the cursor offset within _buffer together with the
+    // number of columns the text up to that offset measured (= _distanceCursor).
+    // As long as the text up to that offset remains unmodified, the next
+    // _flushBuffer() call can reuse the distance instead of re-measuring the text.
+    struct
+    {
+        size_t offset = 0;
+        ptrdiff_t distance = 0;
+    } _measurementCache;
     bool _insertMode = false;
     State _state = State::Accumulating;
 
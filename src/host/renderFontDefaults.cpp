@@ -7,9 +7,13 @@
 
 #pragma hdrstop
 
+// Deliberately empty: the font list is loaded from the registry on first
+// lookup instead (see RetrieveDefaultFontNameForCodepage). This object is
+// created on every conhost launch, but most sessions - conpty ones in
+// particular - never ask for a default font name, so the registry enumeration
+// shouldn't be part of the startup path that every short-lived console pays.
 RenderFontDefaults::RenderFontDefaults()
 {
-    LOG_IF_NTSTATUS_FAILED(TrueTypeFontList::s_Initialize());
 }
 
 RenderFontDefaults::~RenderFontDefaults()
@@ -21,6 +25,11 @@ RenderFontDefaults::~RenderFontDefaults()
                                                                              std::wstring& outFaceName)
 try
 {
+    // Deferred from the constructor, see there.
+    std::call_once(_initOnce, []() {
+        LOG_IF_NTSTATUS_FAILED(TrueTypeFontList::s_Initialize());
+    });
+
     // GH#3123: Propagate font length changes up through Settings and propsheet
     wchar_t faceName[LF_FACESIZE]{ 0 };
     auto status = TrueTypeFontList::s_SearchByCodePage(codePage, faceName, ARRAYSIZE(faceName));
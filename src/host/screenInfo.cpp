@@ -451,7 +451,19 @@ til::size SCREEN_INFORMATION::GetLargestWindowSizeInCharacters(const til::size c
     FAIL_FAST_IF(coordFontSize.width == 0);
     FAIL_FAST_IF(coordFontSize.height == 0);
 
-    const auto rcClientInPixels = _pConsoleWindowMetrics->GetMaxClientRectInPixels();
+    // Computing the maximum client rect requires a number of user32 calls and
+    // this function sits on the GetConsoleScreenBufferInfoEx hot path, which
+    // some runtimes poll before every write. Cache the rect until the window
+    // message thread signals that the window or monitor situation changed.
+    // The font division below intentionally stays outside the cache, so that
+    // font changes don't need to invalidate it.
+    const auto generation = ServiceLocator::LocateGlobals().windowMetricsGeneration.load(std::memory_order_acquire);
+    if (generation != _maxClientRectGeneration)
+    {
+        _maxClientRectInPixels = _pConsoleWindowMetrics->GetMaxClientRectInPixels();
+        _maxClientRectGeneration = generation;
+    }
+    const auto rcClientInPixels = _maxClientRectInPixels;
 
     // first assign the pixel widths and heights to the final output
     til::size coordClientAreaSize;
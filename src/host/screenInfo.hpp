@@ -237,6 +237,14 @@ private:
     Microsoft::Console::Interactivity::IWindowMetrics* _pConsoleWindowMetrics;
     Microsoft::Console::Interactivity::IAccessibilityNotifier* _pAccessibilityNotifier;
 
+    // Caches IWindowMetrics::GetMaxClientRectInPixels() which involves a bunch
+    // of user32 calls, while GetConsoleScreenBufferInfoEx needs it and is
+    // polled constantly by some clients. The cache is invalidated through
+    // Globals::windowMetricsGeneration and both fields are only ever accessed
+    // under the console lock (hence mutable works out fine).
+    mutable til::rect _maxClientRectInPixels;
+    mutable uint32_t _maxClientRectGeneration = 0;
+
     [[nodiscard]] HRESULT _AdjustScreenBufferHelper(const til::rect* const prcClientNew,
                                                     const til::size coordBufferOld,
                                                     _Out_ til::size* const pcoordClientNewCharacters);
@@ -3,6 +3,7 @@
 
 #include "precomp.h"
 #include "tracing.hpp"
+#include "../server/ApiSorter.h"
 #include "../types/UiaTextRangeBase.hpp"
 #include "../types/ScreenInfoUiaProviderBase.h"
 
@@ -24,7 +25,7 @@ enum TraceKeywords
     Output = 0x008, // _DBGOUTPUT
     General = 0x100,
     Input = 0x200,
-    //API = 0x400, // No longer used
+    API = 0x400, // ApiSorter dispatch
     UIA = 0x800,
     CookedRead = 0x1000,
     ConsoleAttachDetach = 0x2000,
@@ -179,6 +180,54 @@ void Tracing::s_TraceInputRecord(const INPUT_RECORD& inputRecord)
     }
 }
 
+void Tracing::s_TraceApiCall(_In_z_ const char* pszApiName, const uint64_t callCount) noexcept
+{
+    // The enabled check is important here: this runs once per serviced API call
+    // and the cumulative count argument shouldn't be marshalled when nobody is
+    // listening.
+    if (TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider, WINEVENT_LEVEL_VERBOSE, TraceKeywords::API))
+    {
+        TraceLoggingWrite(
+            g_hConhostV2EventTraceProvider,
+            "ApiCall",
+            TraceLoggingString(pszApiName, "Api"),
+            TraceLoggingUInt64(callCount, "CallCount"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingKeyword(TIL_KEYWORD_TRACE),
+            TraceLoggingKeyword(TraceKeywords::API));
+    }
+}
+
+void Tracing::s_TraceApiLatencyHistogram(_In_z_ const char* pszApiName, const uint32_t apiNumber, const uint64_t callCount, _In_reads_(bucketCount) const uint64_t* buckets, const uint16_t bucketCount) noexcept
+{
+    // Bucket n counts calls whose inline service time fell into the
+    // [2^(n-1), 2^n) microsecond range; bucket 0 counts sub-microsecond calls.
+    TraceLoggingWrite(
+        g_hConhostV2EventTraceProvider,
+        "ApiLatencyHistogram",
+        TraceLoggingString(pszApiName, "Api"),
+        TraceLoggingUInt32(apiNumber, "ApiNumber"),
+        TraceLoggingUInt64(callCount, "CallCount"),
+        TraceLoggingUInt64Array(buckets, bucketCount, "MicrosecondBuckets"),
+        TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+        TraceLoggingKeyword(TIL_KEYWORD_TRACE),
+        TraceLoggingKeyword(TraceKeywords::API));
+}
+
+// Routine Description:
+// - ETW enable callback for g_hConhostV2EventTraceProvider. Its only job beyond
+//   the default behavior is reacting to capture state requests: a trace
+//   controller (EnableTraceEx2 with EVENT_CONTROL_CODE_CAPTURE_STATE) can ask a
+//   live console session to dump the per-API latency histograms it has
+//   accumulated so far, without having to wait for the process to exit.
+void NTAPI Tracing::s_EtwEnableCallback(LPCGUID /*sourceId*/, ULONG controlCode, UCHAR /*level*/, ULONGLONG /*matchAnyKeyword*/, ULONGLONG /*matchAllKeyword*/, PEVENT_FILTER_DESCRIPTOR /*filterData*/, PVOID /*callbackContext*/) noexcept
+{
+    if (controlCode == EVENT_CONTROL_CODE_CAPTURE_STATE)
+    {
+        ApiSorter::TraceApiLatencyHistograms();
+    }
+}
+
 void Tracing::s_TraceCookedRead(_In_ ConsoleProcessHandle* const pConsoleProcessHandle, const std::wstring_view& text)
 {
     if (TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider, 0, TraceKeywords::CookedRead))
@@ -50,6 +50,10 @@ public:
 
     static void s_TraceWindowMessage(const MSG& msg);
     static void s_TraceInputRecord(const INPUT_RECORD& inputRecord);
+    static void s_TraceApiCall(_In_z_ const char* pszApiName, const uint64_t callCount) noexcept;
+    static void s_TraceApiLatencyHistogram(_In_z_ const char* pszApiName, const uint32_t apiNumber, const uint64_t callCount, _In_reads_(bucketCount) const uint64_t* buckets, const uint16_t bucketCount) noexcept;
+
+    static void NTAPI s_EtwEnableCallback(LPCGUID sourceId, ULONG controlCode, UCHAR level, ULONGLONG matchAnyKeyword, ULONGLONG matchAllKeyword, PEVENT_FILTER_DESCRIPTOR filterData, PVOID callbackContext) noexcept;
 
     static void s_TraceCookedRead(_In_ ConsoleProcessHandle* const pConsoleProcessHandle, const std::wstring_view& text);
     static void s_TraceConsoleAttachDetach(_In_ ConsoleProcessHandle* const pConsoleProcessHandle, _In_ bool bIsAttach);
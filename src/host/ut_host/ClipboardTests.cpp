@@ -153,6 +153,72 @@ class ClipboardTests
         VERIFY_IS_NOT_NULL(ptr);
     }
 
+    TEST_METHOD(GenerateCFHTMLAndRTF)
+    {
+        // Hand-rolled text and color data: two rows, three runs of color
+        // (the second row continues the color the first row ended with).
+        const COLORREF red = RGB(255, 0, 0);
+        const COLORREF green = RGB(0, 255, 0);
+        const COLORREF black = RGB(0, 0, 0);
+
+        TextBuffer::TextAndColor rows;
+        rows.text = { L"ab<\r\n", L"cd\r\n" };
+        rows.FgAttr = { { red, red, green, green, green }, { green, green, green, green } };
+        rows.BkAttr = { { black, black, black, black, black }, { black, black, black, black } };
+
+        const auto count = [](const std::string& str, const char* needle) {
+            size_t n = 0;
+            for (auto pos = str.find(needle); pos != std::string::npos; pos = str.find(needle, pos + 1))
+            {
+                ++n;
+            }
+            return n;
+        };
+
+        const auto html = TextBuffer::GenHTML(rows, 12, L"Consolas", black);
+
+        // the CF_HTML clipboard header is fixed-size; the document starts right after it
+        constexpr size_t clipboardHeaderSize = 157;
+        VERIFY_ARE_EQUAL(clipboardHeaderSize, html.find("<!DOCTYPE"));
+
+        // the offsets patched into the header must describe the document and fragment bounds
+        const auto offsetOf = [&](const char* name) {
+            const auto pos = html.find(name);
+            VERIFY_ARE_NOT_EQUAL(std::string::npos, pos);
+            return static_cast<size_t>(std::stoul(html.substr(pos + strlen(name), 10)));
+        };
+        VERIFY_ARE_EQUAL(clipboardHeaderSize, offsetOf("StartHTML:"));
+        VERIFY_ARE_EQUAL(html.size(), offsetOf("EndHTML:"));
+        VERIFY_ARE_EQUAL(html.find("<!--StartFragment"), offsetOf("StartFragment:"));
+        VERIFY_ARE_EQUAL(html.find("</BODY>"), offsetOf("EndFragment:"));
+
+        // one span per color run, rows joined with <BR>, markup characters escaped,
+        // the line break characters themselves dropped
+        VERIFY_ARE_EQUAL(size_t{ 2 }, count(html, "<SPAN STYLE="));
+        VERIFY_ARE_EQUAL(size_t{ 1 }, count(html, "<BR>"));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, html.find("ab"));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, html.find("&lt;"));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, html.find("cd"));
+        VERIFY_ARE_EQUAL(std::string::npos, html.find('\r', clipboardHeaderSize));
+
+        const auto rtf = TextBuffer::GenRTF(rows, 12, L"Consolas", black);
+
+        VERIFY_ARE_EQUAL(size_t{ 0 }, rtf.find("{\\rtf1"));
+        VERIFY_ARE_EQUAL('}', rtf.back());
+
+        // one color table entry per unique color
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, rtf.find("\\red255\\green0\\blue0;"));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, rtf.find("\\red0\\green255\\blue0;"));
+
+        // one \cf per color run (not per character), rows joined with \line,
+        // the line break characters themselves dropped
+        VERIFY_ARE_EQUAL(size_t{ 2 }, count(rtf, "\\cf"));
+        VERIFY_ARE_EQUAL(size_t{ 1 }, count(rtf, "\\line "));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, rtf.find("ab"));
+        VERIFY_ARE_NOT_EQUAL(std::string::npos, rtf.find("cd"));
+        VERIFY_ARE_EQUAL(std::string::npos, rtf.find('\r'));
+    }
+
     TEST_METHOD(CanConvertText)
     {
         static constexpr std::wstring_view input{ L"HeLlO WoRlD" };
@@ -242,6 +242,28 @@ class HistoryTests
         VERIFY_ARE_EQUAL(2, history->GetNumberOfCommands());
     }
 
+    TEST_METHOD(FindMatchingCommands)
+    {
+        auto history = CommandHistory::s_Allocate(_manyApps[0], _MakeHandle(0));
+        VERIFY_IS_NOT_NULL(history);
+
+        VERIFY_SUCCEEDED(history->Add(L"dir", false));
+        VERIFY_SUCCEEDED(history->Add(L"cd ..", false));
+        VERIFY_SUCCEEDED(history->Add(L"dir /w", false));
+
+        // Searches start one entry before the given index and walk backwards.
+        CommandHistory::Index index = 0;
+        VERIFY_IS_TRUE(history->FindMatchingCommand(L"dir", history->LastDisplayed, index, CommandHistory::MatchOptions::JustLooking));
+        VERIFY_ARE_EQUAL(0, index);
+
+        VERIFY_IS_TRUE(history->FindMatchingCommand(L"cd ..", history->LastDisplayed, index, CommandHistory::MatchOptions::ExactMatch | CommandHistory::MatchOptions::JustLooking));
+        VERIFY_ARE_EQUAL(1, index);
+
+        VERIFY_IS_FALSE(history->FindMatchingCommand(L"ping", history->LastDisplayed, index, CommandHistory::MatchOptions::JustLooking));
+        // "dir /w /p" merely starts with an existing command, which is not an exact match.
+        VERIFY_IS_FALSE(history->FindMatchingCommand(L"dir /w /p", history->LastDisplayed, index, CommandHistory::MatchOptions::ExactMatch | CommandHistory::MatchOptions::JustLooking));
+    }
+
 private:
     const std::array<std::wstring, 5> _manyApps = {
         L"foo.exe",
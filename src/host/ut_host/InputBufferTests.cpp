@@ -642,4 +642,55 @@ class InputBufferTests
         VERIFY_ARE_EQUAL(inputBuffer._storage.front().Event.KeyEvent.wRepeatCount, repeatCount);
         VERIFY_ARE_EQUAL(outEvents.front().Event.KeyEvent.wRepeatCount, 1u);
     }
+
+    TEST_METHOD(UnreadMouseMovesCoalesce)
+    {
+        m_state->PrepareGlobalFont();
+        m_state->PrepareGlobalScreenBuffer();
+        auto cleanup = wil::scope_exit([&]() {
+            m_state->CleanupGlobalScreenBuffer();
+            m_state->CleanupGlobalFont();
+        });
+
+        using VTMode = Microsoft::Console::VirtualTerminal::TerminalInput::Mode;
+
+        InputBuffer inputBuffer;
+        inputBuffer.InputMode |= ENABLE_VIRTUAL_TERMINAL_INPUT;
+        inputBuffer._termInput.SetInputMode(VTMode::AnyEventMouseTracking, true);
+        inputBuffer._termInput.SetInputMode(VTMode::SgrMouseEncoding, true);
+
+        const auto storageText = [&]() {
+            std::wstring text;
+            for (const auto& record : inputBuffer._storage)
+            {
+                text.push_back(record.Event.KeyEvent.uChar.UnicodeChar);
+            }
+            return text;
+        };
+
+        // The second of two unread motion events supersedes the first.
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 1, 1 }, WM_MOUSEMOVE, 0, 0));
+        VERIFY_ARE_EQUAL(std::wstring{ L"\x1b[<35;2;2m" }, storageText());
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 2, 2 }, WM_MOUSEMOVE, 0, 0));
+        VERIFY_ARE_EQUAL(std::wstring{ L"\x1b[<35;3;3m" }, storageText());
+
+        // A button press is appended and is never replaced.
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 2, 2 }, WM_LBUTTONDOWN, 0, 0));
+        const auto afterPress = storageText();
+        VERIFY_ARE_EQUAL(std::wstring{ L"\x1b[<35;3;3m\x1b[<0;3;3M" }, afterPress);
+
+        // Motion behind the press is appended, then superseded in place.
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 3, 3 }, WM_MOUSEMOVE, 0, 0));
+        VERIFY_ARE_EQUAL(afterPress + L"\x1b[<35;4;4m", storageText());
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 4, 4 }, WM_MOUSEMOVE, 0, 0));
+        VERIFY_ARE_EQUAL(afterPress + L"\x1b[<35;5;5m", storageText());
+
+        // Once a reader has consumed anything, coalescing is disarmed and the
+        // next motion is simply appended.
+        InputEventQueue outEvents;
+        VERIFY_NT_SUCCESS(inputBuffer.Read(outEvents, 5, false, false, true, false));
+        const auto remaining = storageText();
+        VERIFY_IS_TRUE(inputBuffer.WriteMouseEvent({ 5, 5 }, WM_MOUSEMOVE, 0, 0));
+        VERIFY_ARE_EQUAL(remaining + L"\x1b[<35;6;6m", storageText());
+    }
 };
@@ -161,6 +161,9 @@ class TextBufferTests
 
     TEST_METHOD(HyperlinkTrim);
     TEST_METHOD(NoHyperlinkTrim);
+
+    TEST_METHOD(ColdScrollbackSpillRoundtrip);
+    TEST_METHOD(ColdScrollbackCompressionRoundtrip);
 };
 
 void TextBufferTests::TestBufferCreate()
@@ -2861,3 +2864,88 @@ void TextBufferTests::NoHyperlinkTrim()
     VERIFY_ARE_EQUAL(_buffer->GetHyperlinkUriFromId(id), url);
     VERIFY_ARE_EQUAL(_buffer->_hyperlinkCustomIdMap[finalCustomId], id);
 }
+
+// Exercises the cold scrollback spill path: rows outside the hot window are
+// flushed to the spill file and evicted from the working set, and reading
+// them through GetRowByOffset() faults them back in with their contents intact.
+void TextBufferTests::ColdScrollbackSpillRoundtrip()
+{
+    // Tall enough to span several row slabs.
+    static constexpr til::size bufferSize{ 20, 400 };
+    static constexpr UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    TextBuffer buffer{ bufferSize, attr, cursorSize, false, _renderer };
+
+    // Must be enabled before the writes below commit the slabs.
+    buffer.EnableColdScrollbackSpill();
+
+    const auto textFor = [](const til::CoordType y) {
+        return fmt::format(L"row {:04}", y);
+    };
+    for (til::CoordType y = 0; y < bufferSize.height; ++y)
+    {
+        buffer.GetMutableRowByOffset(y).ReplaceCharacters(0, 8, textFor(y));
+    }
+
+    // Evict everything above the bottommost 30 rows.
+    buffer.SpillRowsOutsideWindow(bufferSize.height - 30, bufferSize.height - 1);
+
+    // Every row must still read back intact, hot and spilled alike.
+    for (til::CoordType y = 0; y < bufferSize.height; ++y)
+    {
+        VERIFY_ARE_EQUAL(textFor(y), std::wstring{ buffer.GetRowByOffset(y).GetText(0, 8) });
+    }
+
+    // Rows that were faulted back in must be writable again, and surviving
+    // another eviction must preserve the new contents.
+    buffer.GetMutableRowByOffset(0).ReplaceCharacters(0, 8, L"rewrite!");
+    buffer.SpillRowsOutsideWindow(bufferSize.height - 30, bufferSize.height - 1);
+    VERIFY_ARE_EQUAL(L"rewrite!", std::wstring{ buffer.GetRowByOffset(0).GetText(0, 8) });
+}
+
+// Exercises the cold scrollback compression path: rows outside the hot window
+// are serialized into their compact cold representation and their backing
+// memory is released; reading them through GetRowByOffset() transparently
+// re-materializes them with text, attributes and flags intact.
+void TextBufferTests::ColdScrollbackCompressionRoundtrip()
+{
+    // Tall enough to span several row slabs.
+    static constexpr til::size bufferSize{ 20, 400 };
+    static constexpr UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    TextBuffer buffer{ bufferSize, attr, cursorSize, false, _renderer };
+
+    const auto textFor = [](const til::CoordType y) {
+        return fmt::format(L"row {:04}", y);
+    };
+    for (til::CoordType y = 0; y < bufferSize.height; ++y)
+    {
+        auto& row = buffer.GetMutableRowByOffset(y);
+        row.ReplaceCharacters(0, 8, textFor(y));
+        row.SetAttrToEnd(10, TextAttribute{ gsl::narrow_cast<WORD>(y & 0xff) });
+        row.SetWrapForced((y & 1) != 0);
+    }
+
+    // Compress everything above the bottommost 30 rows.
+    buffer.CompressRowsOutsideWindow(bufferSize.height - 30, bufferSize.height - 1);
+    VERIFY_IS_GREATER_THAN(buffer.GetMemoryUsage().coldSlabBytes, 0u);
+
+    // Every row must re-materialize with its exact contents.
+    for (til::CoordType y = 0; y < bufferSize.height; ++y)
+    {
+        const auto& row = buffer.GetRowByOffset(y);
+        VERIFY_ARE_EQUAL(textFor(y), std::wstring{ row.GetText(0, 8) });
+        VERIFY_ARE_EQUAL(TextAttribute{ gsl::narrow_cast<WORD>(y & 0xff) }, row.GetAttrByColumn(15));
+        VERIFY_ARE_EQUAL(attr, row.GetAttrByColumn(5));
+        VERIFY_ARE_EQUAL((y & 1) != 0, row.WasWrapForced());
+    }
+
+    // Touching every row rehydrated every slab; no cold bytes may remain.
+    VERIFY_ARE_EQUAL(0u, buffer.GetMemoryUsage().coldSlabBytes);
+
+    // Rehydrated rows must be writable, and a second compression round must
+    // preserve the new contents.
+    buffer.GetMutableRowByOffset(0).ReplaceCharacters(0, 8, L"rewrite!");
+    buffer.CompressRowsOutsideWindow(bufferSize.height - 30, bufferSize.height - 1);
+    VERIFY_ARE_EQUAL(L"rewrite!", std::wstring{ buffer.GetRowByOffset(0).GetText(0, 8) });
+}
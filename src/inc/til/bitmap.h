@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <bit>
+
 #include "rect.h"
 
 #ifdef UNIT_TESTING
@@ -547,13 +549,611 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 #endif
         };
 
+        // Returns the index of the first nonzero word in data[beg, end), or end if there is none.
+        inline size_t _find_nonzero_word(const uint64_t* data, size_t beg, size_t end) noexcept
+        {
+#ifdef TIL_SSE_INTRINSICS
+            for (; beg + 2 <= end; beg += 2)
+            {
+#pragma warning(suppress : 26481 26490) // pointer arithmetic / reinterpret_cast
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + beg));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(v, _mm_setzero_si128())) != 0xffff)
+                {
+                    break;
+                }
+            }
+#endif
+#pragma warning(suppress : 26481)
+            for (; beg < end && data[beg] == 0; ++beg)
+            {
+            }
+            return beg;
+        }
+
+        // Enumerates rectangular runs of set bits in a hierarchical_bitmap. Unlike
+        // _bitmap_const_iterator this never tests individual bits: it consults the
+        // summary level to find the next dirty word and extracts whole runs from a
+        // word at a time via countr_zero()/countr_one().
+        class _hierarchical_bitmap_const_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = const til::rect;
+            using difference_type = ptrdiff_t;
+            using pointer = const til::rect*;
+            using reference = const til::rect&;
+
+            _hierarchical_bitmap_const_iterator(const uint64_t* words, size_t wordCount, const uint64_t* summary, size_t summaryCount, til::rect rc, size_t pos) noexcept :
+                _words(words),
+                _summary(summary),
+                _wordCount(wordCount),
+                _summaryCount(summaryCount),
+                _rc(rc),
+                _pos(pos),
+                _end(gsl::narrow_cast<size_t>(rc.width()) * gsl::narrow_cast<size_t>(rc.height()))
+            {
+                _calculateArea();
+            }
+
+            _hierarchical_bitmap_const_iterator& operator++() noexcept
+            {
+                _pos = _nextPos;
+                _calculateArea();
+                return (*this);
+            }
+
+            _hierarchical_bitmap_const_iterator operator++(int) noexcept
+            {
+                const auto prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            constexpr bool operator==(const _hierarchical_bitmap_const_iterator& other) const noexcept
+            {
+                return _pos == other._pos && _words == other._words;
+            }
+
+            constexpr bool operator!=(const _hierarchical_bitmap_const_iterator& other) const noexcept
+            {
+                return !(*this == other);
+            }
+
+            constexpr bool operator<(const _hierarchical_bitmap_const_iterator& other) const noexcept
+            {
+                return _pos < other._pos;
+            }
+
+            constexpr bool operator>(const _hierarchical_bitmap_const_iterator& other) const noexcept
+            {
+                return _pos > other._pos;
+            }
+
+            constexpr reference operator*() const noexcept
+            {
+                return _run;
+            }
+
+            constexpr pointer operator->() const noexcept
+            {
+                return &_run;
+            }
+
+        private:
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+            // Returns the index of the first set bit at or past pos, or _end if there is none.
+            size_t _findNextSetBit(size_t pos) const noexcept
+            {
+                auto word = pos / 64;
+                if (word >= _wordCount)
+                {
+                    return _end;
+                }
+
+                // Check the remainder of the word the position lives in first.
+                if (const auto bits = _words[word] >> (pos % 64))
+                {
+                    return pos + std::countr_zero(bits);
+                }
+
+                // Past that, the summary level tells us which word is dirty next.
+                ++word;
+                auto summaryIdx = word / 64;
+                if (summaryIdx < _summaryCount)
+                {
+                    auto summaryBits = _summary[summaryIdx] & (~0ull << (word % 64));
+                    if (!summaryBits)
+                    {
+                        summaryIdx = _find_nonzero_word(_summary, summaryIdx + 1, _summaryCount);
+                        summaryBits = summaryIdx < _summaryCount ? _summary[summaryIdx] : 0;
+                    }
+                    if (summaryBits)
+                    {
+                        word = summaryIdx * 64 + std::countr_zero(summaryBits);
+                        return word * 64 + std::countr_zero(_words[word]);
+                    }
+                }
+
+                return _end;
+            }
+
+            // Update _run to contain the next rectangle of consecutively set bits within this bitmap.
+            // _calculateArea may be called repeatedly to yield all those rectangles.
+            void _calculateArea() noexcept
+            {
+                _nextPos = _findNextSetBit(_pos);
+
+                if (_nextPos < _end)
+                {
+                    const auto runBeg = _nextPos;
+                    const auto runStart = _rc.point_at(base::saturated_cast<CoordType>(runBeg));
+
+                    // We'll only count up until the end of this row.
+                    // A run can be a max of one row tall.
+                    const size_t rowEndIndex = _rc.index_of<size_t>(til::point(_rc.right - 1, runStart.y)) + 1;
+
+                    // Extend the run one word at a time: countr_one() hands us
+                    // up to 64 consecutive set bits per load.
+                    auto cur = runBeg;
+                    for (;;)
+                    {
+                        const auto avail = std::min(rowEndIndex - cur, size_t{ 64 } - (cur % 64));
+                        const auto ones = static_cast<size_t>(std::countr_one(_words[cur / 64] >> (cur % 64)));
+                        cur += std::min(ones, avail);
+                        if (ones < avail || cur >= rowEndIndex)
+                        {
+                            break;
+                        }
+                    }
+
+                    _nextPos = cur;
+                    _run = til::rect{ runStart, til::size{ base::saturated_cast<CoordType>(cur - runBeg), 1 } };
+                }
+                else
+                {
+                    // ---> Mark the end of the iterator by updating the state with _end.
+                    _pos = _end;
+                    _nextPos = _end;
+                    _run = til::rect{};
+                }
+            }
+#pragma warning(pop)
+
+            const uint64_t* _words;
+            const uint64_t* _summary;
+            size_t _wordCount;
+            size_t _summaryCount;
+            const til::rect _rc;
+            size_t _pos;
+            size_t _nextPos;
+            const size_t _end;
+            til::rect _run;
+        };
+
+        // A til::bitmap with a second, hierarchical level on top: one summary bit per
+        // 64-bit word of the primary bit plane, kept in sync on every mutation. This
+        // lets run enumeration over mostly-clean maps reject entire 4096-bit regions
+        // with a single load, which matters once invalidation maps span hundreds of
+        // thousands of cells.
+        template<typename Allocator = std::allocator<uint64_t>>
+        class hierarchical_bitmap
+        {
+        public:
+            using allocator_type = Allocator;
+            using const_iterator = _hierarchical_bitmap_const_iterator;
+
+        private:
+            using run_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<til::rect>;
+            using word_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<uint64_t>;
+
+            static constexpr size_t _wordsForBits(size_t bits) noexcept
+            {
+                return (bits + 63) / 64;
+            }
+
+        public:
+            explicit hierarchical_bitmap(const allocator_type& allocator) noexcept :
+                _alloc{ allocator },
+                _sz{},
+                _rc{},
+                _words{ _alloc },
+                _summary{ _alloc },
+                _runs{ _alloc }
+            {
+            }
+
+            hierarchical_bitmap() noexcept :
+                hierarchical_bitmap(allocator_type{})
+            {
+            }
+
+            hierarchical_bitmap(til::size sz) :
+                hierarchical_bitmap(sz, false, allocator_type{})
+            {
+            }
+
+            hierarchical_bitmap(til::size sz, const allocator_type& allocator) :
+                hierarchical_bitmap(sz, false, allocator)
+            {
+            }
+
+            hierarchical_bitmap(til::size sz, bool fill, const allocator_type& allocator) :
+                _alloc{ allocator },
+                _sz(sz),
+                _rc(sz),
+                _words(_wordsForBits(gsl::narrow_cast<size_t>(sz.area())), 0, _alloc),
+                _summary(_wordsForBits(_words.size()), 0, _alloc),
+                _runs{ _alloc }
+            {
+                if (fill)
+                {
+                    set_all();
+                }
+            }
+
+            hierarchical_bitmap(til::size sz, bool fill) :
+                hierarchical_bitmap(sz, fill, allocator_type{})
+            {
+            }
+
+            hierarchical_bitmap(const hierarchical_bitmap& other) :
+                _alloc{ std::allocator_traits<allocator_type>::select_on_container_copy_construction(other._alloc) },
+                _sz{ other._sz },
+                _rc{ other._rc },
+                _words{ other._words },
+                _summary{ other._summary },
+                _runs{ other._runs }
+            {
+                // copy constructor is required to call select_on_container_copy
+            }
+
+            hierarchical_bitmap& operator=(const hierarchical_bitmap& other)
+            {
+                if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value)
+                {
+                    _alloc = other._alloc;
+                }
+                _sz = other._sz;
+                _rc = other._rc;
+                _words = other._words;
+                _summary = other._summary;
+                _runs = other._runs;
+                return *this;
+            }
+
+            hierarchical_bitmap(hierarchical_bitmap&& other) noexcept :
+                _alloc{ std::move(other._alloc) },
+                _sz{ std::move(other._sz) },
+                _rc{ std::move(other._rc) },
+                _words{ std::move(other._words) },
+                _summary{ std::move(other._summary) },
+                _runs{ std::move(other._runs) }
+            {
+            }
+
+            hierarchical_bitmap& operator=(hierarchical_bitmap&& other) noexcept
+            {
+                if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
+                {
+                    _alloc = std::move(other._alloc);
+                }
+                _words = std::move(other._words);
+                _summary = std::move(other._summary);
+                _runs = std::move(other._runs);
+                _sz = std::move(other._sz);
+                _rc = std::move(other._rc);
+                return *this;
+            }
+
+            ~hierarchical_bitmap() {}
+
+            void swap(hierarchical_bitmap& other)
+            {
+                if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_swap::value)
+                {
+                    std::swap(_alloc, other._alloc);
+                }
+                std::swap(_words, other._words);
+                std::swap(_summary, other._summary);
+                std::swap(_runs, other._runs);
+                std::swap(_sz, other._sz);
+                std::swap(_rc, other._rc);
+            }
+
+            constexpr bool operator==(const hierarchical_bitmap& other) const noexcept
+            {
+                return _sz == other._sz &&
+                       _rc == other._rc &&
+                       _words == other._words;
+                // _summary is derived from _words, _runs is a cache of generated state.
+            }
+
+            constexpr bool operator!=(const hierarchical_bitmap& other) const noexcept
+            {
+                return !(*this == other);
+            }
+
+            const_iterator begin() const noexcept
+            {
+                return const_iterator(_words.data(), _words.size(), _summary.data(), _summary.size(), til::rect{ _sz }, 0);
+            }
+
+            const_iterator end() const noexcept
+            {
+                return const_iterator(_words.data(), _words.size(), _summary.data(), _summary.size(), til::rect{ _sz }, _bitCount());
+            }
+
+            const std::span<const til::rect> runs() const
+            {
+                // If we don't have cached runs, rebuild.
+                if (!_runs.has_value())
+                {
+                    _runs.emplace(begin(), end());
+                }
+
+                // Return the runs.
+                return _runs.value();
+            }
+
+            // optional fill the uncovered area with bits.
+            void translate(const til::point delta, bool fill = false)
+            {
+                // Unlike til::bitmap we don't shift the bit plane in place: scroll deltas
+                // typically carry only a few dirty runs and copying those over keeps the
+                // summary level trivially consistent.
+                hierarchical_bitmap other{ _sz, _alloc };
+
+                for (auto run : *this)
+                {
+                    // Offset by the delta
+                    run += delta;
+
+                    // Intersect with the bounds of our bitmap area
+                    // as part of it could have slid out of bounds.
+                    run &= _rc;
+
+                    // Set it into the new bitmap.
+                    other.set(run);
+                }
+
+                // If we were asked to fill... set anything the translation uncovered.
+                if (fill)
+                {
+                    const auto fillRects = _rc - (_rc + delta);
+                    for (const auto& f : fillRects)
+                    {
+                        other.set(f);
+                    }
+                }
+
+                // Swap us with the temporary one.
+                std::swap(other, *this);
+            }
+
+            void set(const til::point pt)
+            {
+                if (_rc.contains(pt))
+                {
+                    _runs.reset(); // reset cached runs on any non-const method
+                    _setBitRange(_rc.index_of<size_t>(pt), 1);
+                }
+            }
+
+            void set(til::rect rc)
+            {
+                _runs.reset(); // reset cached runs on any non-const method
+
+                rc &= _rc;
+
+                const auto width = gsl::narrow_cast<size_t>(rc.width());
+                const auto stride = gsl::narrow_cast<size_t>(_rc.width());
+                auto idx = _rc.index_of<size_t>({ rc.left, rc.top });
+
+                for (auto row = rc.top; row < rc.bottom; ++row, idx += stride)
+                {
+                    _setBitRange(idx, width);
+                }
+            }
+
+            void set_all() noexcept
+            {
+                _runs.reset(); // reset cached runs on any non-const method
+                std::fill(_words.begin(), _words.end(), UINT64_MAX);
+                std::fill(_summary.begin(), _summary.end(), UINT64_MAX);
+                _maskTails();
+            }
+
+            void reset_all() noexcept
+            {
+                _runs.reset(); // reset cached runs on any non-const method
+                std::fill(_words.begin(), _words.end(), 0);
+                std::fill(_summary.begin(), _summary.end(), 0);
+            }
+
+            // True if we resized. False if it was the same size as before.
+            // Set fill if you want the new region (on growing) to be marked dirty.
+            bool resize(til::size size, bool fill = false)
+            {
+                _runs.reset(); // reset cached runs on any non-const method
+
+                // Don't resize if it's not different
+                if (_sz != size)
+                {
+                    // Make a new bitmap for the other side, empty initially.
+                    hierarchical_bitmap newMap{ size, false, _alloc };
+
+                    // Copy any regions that overlap from this map to the new one.
+                    // Just iterate our runs...
+                    for (const auto& run : *this)
+                    {
+                        // intersect them with the new map
+                        // so we don't attempt to set bits that fit outside
+                        // the new one.
+                        const auto intersect = run & newMap._rc;
+
+                        // and if there is still anything left, set them.
+                        if (!intersect.empty())
+                        {
+                            newMap.set(intersect);
+                        }
+                    }
+
+                    // Then, if we were requested to fill the new space on growing,
+                    // find the space in the new rectangle that wasn't in the old
+                    // and fill it up.
+                    if (fill)
+                    {
+                        // A subtraction will yield anything in the new that isn't
+                        // a part of the old.
+                        const auto newAreas = newMap._rc - _rc;
+                        for (const auto& area : newAreas)
+                        {
+                            newMap.set(area);
+                        }
+                    }
+
+                    // Swap and return.
+                    std::swap(newMap, *this);
+
+                    return true;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            bool one() const noexcept
+            {
+                // The summary level takes us straight to the dirty words,
+                // so we only pay for popcounts where bits are actually set.
+                size_t count = 0;
+                const auto summaryCount = _summary.size();
+                for (auto i = _find_nonzero_word(_summary.data(), 0, summaryCount); i < summaryCount; i = _find_nonzero_word(_summary.data(), i + 1, summaryCount))
+                {
+                    auto summaryBits = til::at(_summary, i);
+                    do
+                    {
+                        const auto word = i * 64 + std::countr_zero(summaryBits);
+                        count += std::popcount(til::at(_words, word));
+                        if (count > 1)
+                        {
+                            return false;
+                        }
+                        summaryBits &= summaryBits - 1;
+                    } while (summaryBits);
+                }
+                return count == 1;
+            }
+
+            bool any() const noexcept
+            {
+                return !none();
+            }
+
+            bool none() const noexcept
+            {
+                return _find_nonzero_word(_summary.data(), 0, _summary.size()) == _summary.size();
+            }
+
+            bool all() const noexcept
+            {
+                const auto bits = _bitCount();
+                const auto fullWords = bits / 64;
+                for (size_t i = 0; i < fullWords; ++i)
+                {
+                    if (til::at(_words, i) != UINT64_MAX)
+                    {
+                        return false;
+                    }
+                }
+                if (const auto rem = bits % 64)
+                {
+                    return _words.back() == (uint64_t{ 1 } << rem) - 1;
+                }
+                return true;
+            }
+
+            constexpr til::size size() const noexcept
+            {
+                return _sz;
+            }
+
+            std::wstring to_string() const
+            {
+                std::wstringstream wss;
+                wss << std::endl
+                    << L"Bitmap of size " << _sz.to_string() << " contains the following dirty regions:" << std::endl;
+                wss << L"Runs:" << std::endl;
+
+                for (auto& item : *this)
+                {
+                    wss << L"\t- " << item.to_string() << std::endl;
+                }
+
+                return wss.str();
+            }
+
+        private:
+            // Sets count consecutive bits starting at idx and mirrors them into the summary level.
+            void _setBitRange(size_t idx, size_t count) noexcept
+            {
+                auto word = idx / 64;
+                auto bit = idx % 64;
+
+                while (count)
+                {
+                    const auto chunk = std::min(count, size_t{ 64 } - bit);
+                    const auto mask = (chunk == 64 ? UINT64_MAX : (uint64_t{ 1 } << chunk) - 1) << bit;
+                    til::at(_words, word) |= mask;
+                    til::at(_summary, word / 64) |= uint64_t{ 1 } << (word % 64);
+                    count -= chunk;
+                    bit = 0;
+                    ++word;
+                }
+            }
+
+            size_t _bitCount() const noexcept
+            {
+                return gsl::narrow_cast<size_t>(_sz.width) * gsl::narrow_cast<size_t>(_sz.height);
+            }
+
+            // Clears the bits past the end of the bit plane / the summary plane,
+            // which set_all() would otherwise leave dangling in the last word.
+            void _maskTails() noexcept
+            {
+                if (const auto rem = _bitCount() % 64; rem && !_words.empty())
+                {
+                    _words.back() &= (uint64_t{ 1 } << rem) - 1;
+                }
+                if (const auto rem = _words.size() % 64; rem && !_summary.empty())
+                {
+                    _summary.back() &= (uint64_t{ 1 } << rem) - 1;
+                }
+            }
+
+            allocator_type _alloc;
+            til::size _sz;
+            til::rect _rc;
+            std::vector<uint64_t, word_allocator_type> _words;
+            std::vector<uint64_t, word_allocator_type> _summary;
+
+            mutable std::optional<std::vector<til::rect, run_allocator_type>> _runs;
+
+#ifdef UNIT_TESTING
+            friend class ::BitmapTests;
+#endif
+        };
     }
 
     using bitmap = ::til::details::bitmap<>;
+    using hierarchical_bitmap = ::til::details::hierarchical_bitmap<>;
 
     namespace pmr
     {
         using bitmap = ::til::details::bitmap<std::pmr::polymorphic_allocator<unsigned long long>>;
+        using hierarchical_bitmap = ::til::details::hierarchical_bitmap<std::pmr::polymorphic_allocator<uint64_t>>;
     }
 }
 
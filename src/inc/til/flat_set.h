@@ -81,6 +81,70 @@ namespace til
             return { _map.get(), _capacity };
         }
 
+        // Grows the set ahead of time so that at least `count` items fit
+        // without any further rehashing. Useful right before bulk insertions.
+        void reserve(size_t count)
+        {
+            if (count <= 1 || count > std::numeric_limits<size_t>::max() / LoadFactor)
+            {
+                return;
+            }
+
+            const auto minCapacity = count * LoadFactor;
+            if (minCapacity <= _capacity)
+            {
+                return;
+            }
+
+            // The capacity is always 1 << (digits - _shift). Round the
+            // requested capacity up to the next power of 2 accordingly.
+            const auto newShift = digits - static_cast<size_t>(std::bit_width(minCapacity - 1));
+            if (newShift == 0)
+            {
+                throw std::bad_array_new_length{};
+            }
+
+            _resize(newShift);
+        }
+
+        struct probe_stats
+        {
+            size_t items = 0;
+            size_t capacity = 0;
+            size_t max_probe_length = 0;
+            size_t total_probe_length = 0;
+        };
+
+        // Computes occupancy and probe-length statistics by walking the
+        // entire table. This is O(capacity) and meant for occasional
+        // telemetry, which keeps lookup() and insert() entirely free of
+        // any bookkeeping in return.
+        probe_stats stats() const noexcept
+        {
+            probe_stats stats;
+            stats.capacity = _capacity;
+
+            for (size_t i = 0; i < _capacity; ++i)
+            {
+                const auto& slot = _map[i];
+                if (!slot)
+                {
+                    continue;
+                }
+
+                // The probe length is how far linear probing displaced the
+                // item from the slot its hash points at, modulo wraparound.
+                const auto ideal = ::std::hash<T>{}(slot) >> _shift;
+                const auto probes = (i - ideal) & _mask;
+
+                stats.items++;
+                stats.total_probe_length += probes;
+                stats.max_probe_length = std::max(stats.max_probe_length, probes);
+            }
+
+            return stats;
+        }
+
         void clear() noexcept
         {
             if (_map)
@@ -158,7 +222,11 @@ namespace til
                 throw std::bad_array_new_length{};
             }
 
-            const auto newShift = _shift - GrowthExponent;
+            _resize(_shift - GrowthExponent);
+        }
+
+        __declspec(noinline) void _resize(size_t newShift)
+        {
             const auto newCapacity = size_t{ 1 } << (digits - newShift);
             const auto newMask = newCapacity - 1;
             auto newMap = std::make_unique<T[]>(newCapacity);
@@ -28,6 +28,26 @@ namespace til
     template<typename T>
     struct hash_trait;
 
+    // til::hasher is an incremental interface around wyhash (final version),
+    // the same multiply-mix construction the rapidhash family descends from.
+    //
+    // A note on speed: there deliberately is no SIMD path for long inputs.
+    // wyhash's mixing primitive is a 64x64->128 bit multiply, which doesn't
+    // map onto SSE/NEON, and the bulk loop already runs three independent
+    // mixing streams per 48 bytes to saturate the multiplier's pipeline.
+    // That loop is what whole-row text hashing (renderer.cpp) ends up in.
+    //
+    // A note on collisions, for cache keys like the glyph/shaping caches:
+    // wyhash is a full-width 64-bit hash with no known cheap collision
+    // classes, so for n cached entries the expected collision rate is the
+    // birthday bound n^2/2^65 - irrelevant at cache sizes. What does matter
+    // is that containers truncate the hash to their table size, so probing
+    // quality depends on the high bits too (see flat_set's right-shift).
+    // On 32-bit targets the result is only 32 bits wide and row-level
+    // consumers shouldn't treat a matching hash as proof of equality.
+    // It is not seeded against adversarial inputs: anything hashing
+    // attacker-controlled text should salt the initial state the way
+    // Renderer::_rowHashSalt does.
     struct hasher
     {
         constexpr hasher() = default;
@@ -0,0 +1,444 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+// til::mpsc relies on std::atomic<T>::wait() and ::notify_one()/::notify_all().
+static_assert(__cpp_lib_atomic_wait >= 201907, "til::mpsc requires C++20 atomic waits");
+
+// til: Terminal Implementation Library. Also: "Today I Learned".
+// mpsc: Multi Producer Single Consumer. An MPSC queue/channel allows any number
+// of senders to funnel data into exactly one receiver. Compared to til::spsc the
+// producer end is copyable, so it can be handed to any number of threads, all of
+// which may push concurrently and lock-free.
+namespace til::mpsc
+{
+    using size_type = uint32_t;
+
+    namespace details
+    {
+        // The design is the classic bounded MPMC queue by Dmitry Vyukov
+        // (https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue),
+        // restricted to a single consumer. The ring buffer is allocated in one
+        // block, just like til::spsc's, but instead of two positions every slot
+        // carries its own sequence number encoding whose "turn" it is:
+        // * sequence == pos:     the slot is free, a producer may claim it
+        // * sequence == pos + 1: the slot holds a committed item for the consumer
+        // * anything else:       another producer or revolution owns the slot
+        // Producers claim slots with a CAS on _tail, construct their item and
+        // then publish it by bumping the slot's sequence. Claiming and
+        // publishing being separate steps is what makes concurrent producers
+        // safe: the consumer only ever trusts the per-slot sequence, never _tail.
+        //
+        // Blocking works differently than in til::spsc, too: both sides wait on
+        // epoch counters which get bumped on every commit (_commitEpoch) and on
+        // every freed slot (_headEpoch), as well as when the respective side
+        // hangs up. The epochs carry no meaning beyond "something changed, look
+        // again", which keeps them trivially correct under N producers.
+        template<typename T>
+        struct arc
+        {
+            static_assert(std::is_nothrow_move_constructible_v<T>);
+
+            explicit arc(size_type capacity) :
+                _slots{ std::make_unique<slot[]>(capacity) },
+                _mask{ capacity - 1 }
+            {
+                for (size_type i = 0; i < capacity; ++i)
+                {
+                    _slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~arc()
+            {
+                // By the time the last handle dropped us, no push or pop can be
+                // in flight anymore --> [_head, _tail) is exactly the range of
+                // committed but unconsumed items.
+                const auto tail = _tail.load(std::memory_order_relaxed);
+                for (auto i = _head; i != tail; ++i)
+                {
+                    std::destroy_at(_value(i));
+                }
+            }
+
+            void add_producer() noexcept
+            {
+                _producers.fetch_add(1, std::memory_order_relaxed);
+                _references.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void drop_producer() noexcept
+            {
+                if (_producers.fetch_sub(1, std::memory_order_release) == 1)
+                {
+                    // The last producer is gone. Wake the consumer so that it
+                    // can drain the remaining items and then return "done".
+                    _commitEpoch.fetch_add(1, std::memory_order_release);
+                    _commitEpoch.notify_one();
+                }
+                _drop_reference();
+            }
+
+            void drop_consumer() noexcept
+            {
+                _consumerAlive.store(false, std::memory_order_relaxed);
+                // Wake all producers stuck waiting for a free slot.
+                _headEpoch.fetch_add(1, std::memory_order_release);
+                _headEpoch.notify_all();
+                _drop_reference();
+            }
+
+            // Blocks while the queue is full and then pushes the item.
+            // Returns false if the consumer is gone.
+            template<typename... Args>
+            bool producer_emplace(Args&&... args)
+            {
+                auto pos = _tail.load(std::memory_order_relaxed);
+
+                for (;;)
+                {
+                    if (!_consumerAlive.load(std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+
+                    auto& slot = _slots[pos & _mask];
+                    const auto seq = slot.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<int32_t>(seq - pos);
+
+                    if (diff == 0)
+                    {
+                        // It's this position's turn and the slot is free: claim it.
+                        // On CAS failure pos has been updated to the current
+                        // _tail and we simply go around the loop again.
+                        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            new (&slot.storage) T(std::forward<Args>(args)...);
+                            // This release write publishes the item to the consumer.
+                            slot.sequence.store(pos + 1, std::memory_order_release);
+                            _commitEpoch.fetch_add(1, std::memory_order_release);
+                            _commitEpoch.notify_one();
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // The queue is full. Wait until the consumer frees a slot.
+                        // The recheck between loading the epoch and waiting on it
+                        // ensures we can't miss a wakeup that raced us here.
+                        const auto epoch = _headEpoch.load(std::memory_order_acquire);
+                        if (static_cast<int32_t>(slot.sequence.load(std::memory_order_acquire) - pos) < 0 &&
+                            _consumerAlive.load(std::memory_order_relaxed))
+                        {
+                            _headEpoch.wait(epoch, std::memory_order_relaxed);
+                        }
+                        pos = _tail.load(std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        // Another producer claimed the slot before us.
+                        pos = _tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Pushes the item if a slot is free, without ever blocking.
+            // Returns false if the queue is full or the consumer is gone.
+            template<typename... Args>
+            bool producer_try_emplace(Args&&... args)
+            {
+                auto pos = _tail.load(std::memory_order_relaxed);
+
+                for (;;)
+                {
+                    if (!_consumerAlive.load(std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+
+                    auto& slot = _slots[pos & _mask];
+                    const auto seq = slot.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<int32_t>(seq - pos);
+
+                    if (diff == 0)
+                    {
+                        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            new (&slot.storage) T(std::forward<Args>(args)...);
+                            slot.sequence.store(pos + 1, std::memory_order_release);
+                            _commitEpoch.fetch_add(1, std::memory_order_release);
+                            _commitEpoch.notify_one();
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // The queue is full and we're not willing to wait.
+                        return false;
+                    }
+                    else
+                    {
+                        // Another producer claimed the slot before us.
+                        pos = _tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Blocks until the next item is ready. Returns false once all
+            // producers are gone and the queue has been fully drained.
+            bool consumer_wait() noexcept
+            {
+                auto& slot = _slots[_head & _mask];
+
+                for (;;)
+                {
+                    const auto epoch = _commitEpoch.load(std::memory_order_acquire);
+                    if (_slot_ready(slot))
+                    {
+                        return true;
+                    }
+                    if (_producers.load(std::memory_order_acquire) == 0)
+                    {
+                        // The release decrement in drop_producer() happens after
+                        // that producer's last commit --> one final check.
+                        return _slot_ready(slot);
+                    }
+                    _commitEpoch.wait(epoch, std::memory_order_relaxed);
+                }
+            }
+
+            bool consumer_ready() noexcept
+            {
+                return _slot_ready(_slots[_head & _mask]);
+            }
+
+            T consumer_take() noexcept
+            {
+                auto& slot = _slots[_head & _mask];
+                const auto value = _value(_head);
+
+                T item{ std::move(*value) };
+                std::destroy_at(value);
+
+                // Hand the slot back to the producers, one revolution later.
+                slot.sequence.store(_head + _mask + 1, std::memory_order_release);
+                _head++;
+                _headEpoch.fetch_add(1, std::memory_order_release);
+                _headEpoch.notify_all();
+                return item;
+            }
+
+        private:
+            struct slot
+            {
+                std::atomic<size_type> sequence;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            bool _slot_ready(const slot& s) const noexcept
+            {
+                return s.sequence.load(std::memory_order_acquire) == _head + 1;
+            }
+
+            T* _value(size_type pos) noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&_slots[pos & _mask].storage));
+            }
+
+            void _drop_reference() noexcept
+            {
+                if (_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    delete this;
+                }
+            }
+
+            std::unique_ptr<slot[]> _slots;
+            size_type _mask;
+            size_type _head = 0; // owned by the consumer
+
+            std::atomic<size_type> _tail{ 0 };
+            std::atomic<size_type> _commitEpoch{ 0 };
+            std::atomic<size_type> _headEpoch{ 0 };
+            std::atomic<size_type> _producers{ 1 };
+            std::atomic<size_type> _references{ 2 };
+            std::atomic<bool> _consumerAlive{ true };
+        };
+    }
+
+    template<typename T>
+    struct producer
+    {
+        explicit producer(details::arc<T>* arc) noexcept :
+            _arc(arc) {}
+
+        producer(const producer& other) noexcept :
+            _arc(other._arc)
+        {
+            if (_arc)
+            {
+                _arc->add_producer();
+            }
+        }
+
+        producer& operator=(const producer& other) noexcept
+        {
+            if (this != &other)
+            {
+                drop();
+                _arc = other._arc;
+                if (_arc)
+                {
+                    _arc->add_producer();
+                }
+            }
+            return *this;
+        }
+
+        producer(producer&& other) noexcept :
+            _arc(std::exchange(other._arc, nullptr))
+        {
+        }
+
+        producer& operator=(producer&& other) noexcept
+        {
+            drop();
+            _arc = std::exchange(other._arc, nullptr);
+            return *this;
+        }
+
+        ~producer()
+        {
+            drop();
+        }
+
+        // emplace constructs an item in-place at the end of the queue,
+        // blocking while the queue is full.
+        // The return value will be false, if the consumer is gone.
+        template<typename... Args>
+        bool emplace(Args&&... args) const
+        {
+            return _arc->producer_emplace(std::forward<Args>(args)...);
+        }
+
+        // try_emplace is the non-blocking variant of emplace: if the queue is
+        // full the item is simply not pushed and false is returned, which is
+        // also the return value once the consumer is gone. Use it when
+        // dropping an item is preferable to stalling the producing thread.
+        template<typename... Args>
+        bool try_emplace(Args&&... args) const
+        {
+            return _arc->producer_try_emplace(std::forward<Args>(args)...);
+        }
+
+    private:
+        void drop() noexcept
+        {
+            if (_arc)
+            {
+                _arc->drop_producer();
+                _arc = nullptr;
+            }
+        }
+
+        details::arc<T>* _arc = nullptr;
+    };
+
+    template<typename T>
+    struct consumer
+    {
+        explicit consumer(details::arc<T>* arc) noexcept :
+            _arc(arc) {}
+
+        consumer(const consumer&) = delete;
+        consumer& operator=(const consumer&) = delete;
+
+        consumer(consumer&& other) noexcept :
+            _arc(std::exchange(other._arc, nullptr))
+        {
+        }
+
+        consumer& operator=(consumer&& other) noexcept
+        {
+            drop();
+            _arc = std::exchange(other._arc, nullptr);
+            return *this;
+        }
+
+        ~consumer()
+        {
+            drop();
+        }
+
+        // pop returns the next item in the queue, blocking until one is
+        // available. It returns std::nullopt once all producers are gone
+        // and the queue has been fully drained.
+        std::optional<T> pop() const
+        {
+            if (!_arc->consumer_wait())
+            {
+                return std::nullopt;
+            }
+            return _arc->consumer_take();
+        }
+
+        // pop_n blocks until at least one item is available and then reads up
+        // to count items into first, without ever blocking a second time.
+        // That makes it the natural way to drain the channel in batches.
+        // The amount of successfully read items is returned as the first pair
+        // field. The second pair field will be false once all producers are
+        // gone and the queue has been fully drained.
+        template<typename OutputIt>
+        std::pair<size_t, bool> pop_n(OutputIt first, size_t count) const
+        {
+            size_t read = 0;
+
+            if (count)
+            {
+                if (!_arc->consumer_wait())
+                {
+                    return { 0, false };
+                }
+
+                do
+                {
+                    *first++ = _arc->consumer_take();
+                    ++read;
+                } while (read < count && _arc->consumer_ready());
+            }
+
+            return { read, true };
+        }
+
+    private:
+        void drop() noexcept
+        {
+            if (_arc)
+            {
+                _arc->drop_consumer();
+                _arc = nullptr;
+            }
+        }
+
+        details::arc<T>* _arc = nullptr;
+    };
+
+    // channel returns a bounded, lock-free, multi-producer, single-consumer
+    // FIFO queue ("channel") with at least the given capacity.
+    // Copy the producer end to hand it to any number of threads.
+    template<typename T>
+    std::pair<producer<T>, consumer<T>> channel(size_type capacity)
+    {
+        // Slots are indexed with a bit mask --> the capacity gets rounded up
+        // to a power of 2. Positions are compared with signed 32-bit
+        // differences, which is what caps the capacity at 2^30.
+        if (capacity == 0 || capacity > (size_type{ 1 } << 30))
+        {
+            throw std::invalid_argument{ "invalid capacity" };
+        }
+
+        const auto arc = new details::arc<T>(std::bit_ceil(capacity));
+        return { std::piecewise_construct, std::forward_as_tuple(arc), std::forward_as_tuple(arc) };
+    }
+}
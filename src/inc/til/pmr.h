@@ -70,4 +70,37 @@ namespace til::pmr
         return std::pmr::get_default_resource();
     }
 #endif
+
+    // A monotonic arena for batch-scoped temporaries: allocations are simple
+    // pointer bumps out of an inline 1 KiB buffer, spilling into geometrically
+    // growing upstream blocks only if that runs out. Nothing is ever freed
+    // piecemeal - deallocate() is a no-op and all memory is returned at once,
+    // either by reset() or on destruction. Hand resource() to std::pmr
+    // containers whose lifetime is bounded by the arena's scope, for instance
+    // the transient vectors built up while parsing a single escape sequence.
+    class arena
+    {
+    public:
+        arena() noexcept = default;
+
+        // The inline buffer makes this type self-referential.
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        [[nodiscard]] std::pmr::memory_resource* resource() noexcept
+        {
+            return &_resource;
+        }
+
+        // Returns all upstream blocks at once and resumes
+        // allocating from the start of the inline buffer.
+        void reset() noexcept
+        {
+            _resource.release();
+        }
+
+    private:
+        char _buffer[1024];
+        std::pmr::monotonic_buffer_resource _resource{ &_buffer[0], sizeof(_buffer), get_default_resource() };
+    };
 }
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "rect.h"
+#include "small_vector.h"
+
+namespace til // Terminal Implementation Library. Also: "Today I Learned"
+{
+    // rect_set represents an arbitrary region as a list of non-overlapping
+    // rectangles and keeps that list normalized as rectangles are added and
+    // subtracted: pieces are carved in a single pass over the existing list and
+    // neighboring fragments are merged back together immediately. That keeps
+    // repeated region math linear in the number of stored rectangles, where
+    // composing the results of pairwise subtractions (Viewport::Subtract
+    // returns up to 4 pieces per call) fragments quadratically.
+    //
+    // Like Viewport::Subtract, carving is biased toward wide rectangles so that
+    // consumers which are optimized for whole rows (RLE attribute storage,
+    // row-based rendering) see as few row fragments as possible.
+    class rect_set
+    {
+    public:
+        rect_set() = default;
+
+        explicit rect_set(const rect& r)
+        {
+            add(r);
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return _rects.empty();
+        }
+
+        constexpr size_t size() const noexcept
+        {
+            return _rects.size();
+        }
+
+        constexpr auto begin() const noexcept
+        {
+            return _rects.begin();
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return _rects.end();
+        }
+
+        void clear() noexcept
+        {
+            _rects.clear();
+        }
+
+        // Adds `r` to the region. Only the parts of `r` that aren't covered yet
+        // are inserted, so the stored rectangles stay non-overlapping.
+        void add(const rect& r)
+        {
+            if (r.empty())
+            {
+                return;
+            }
+
+            // Carve the new rectangle against the existing coverage first...
+            small_vector<rect, 4> pieces;
+            pieces.push_back(r);
+            for (const auto& existing : _rects)
+            {
+                small_vector<rect, 4> remaining;
+                for (const auto& piece : pieces)
+                {
+                    _appendDifference(remaining, piece, existing);
+                }
+                pieces = std::move(remaining);
+                if (pieces.empty())
+                {
+                    return;
+                }
+            }
+
+            // ...and only then insert what was actually new.
+            for (const auto& piece : pieces)
+            {
+                _rects.push_back(piece);
+            }
+            _coalesce();
+        }
+
+        // Removes `r` from the region in a single pass over the stored rectangles.
+        void subtract(const rect& r)
+        {
+            if (r.empty() || _rects.empty())
+            {
+                return;
+            }
+
+            small_vector<rect, 4> remaining;
+            for (const auto& existing : _rects)
+            {
+                _appendDifference(remaining, existing, r);
+            }
+            _rects = std::move(remaining);
+            _coalesce();
+        }
+
+    private:
+        // Appends the up to 4 rectangles that make up `lhs` minus `rhs`,
+        // wide-biased: full-width top and bottom slabs, then the left and
+        // right remainders of the intersected rows.
+        static void _appendDifference(small_vector<rect, 4>& out, const rect& lhs, const rect& rhs)
+        {
+            const auto overlap = lhs & rhs;
+            if (overlap.empty())
+            {
+                out.push_back(lhs);
+                return;
+            }
+
+            if (lhs.top < overlap.top)
+            {
+                out.push_back({ lhs.left, lhs.top, lhs.right, overlap.top });
+            }
+            if (overlap.bottom < lhs.bottom)
+            {
+                out.push_back({ lhs.left, overlap.bottom, lhs.right, lhs.bottom });
+            }
+            if (lhs.left < overlap.left)
+            {
+                out.push_back({ lhs.left, overlap.top, overlap.left, overlap.bottom });
+            }
+            if (overlap.right < lhs.right)
+            {
+                out.push_back({ overlap.right, overlap.top, lhs.right, overlap.bottom });
+            }
+        }
+
+        // Merges rectangles that line up exactly, first within a row band and
+        // then across vertically adjacent bands, so that add/subtract churn
+        // doesn't accumulate fragments that describe a simpler shape.
+        void _coalesce()
+        {
+            std::sort(_rects.begin(), _rects.end(), [](const rect& a, const rect& b) noexcept {
+                return a.top != b.top ? a.top < b.top : a.left < b.left;
+            });
+
+            // Horizontally: same band, touching edges.
+            size_t count = 0;
+            for (size_t i = 0; i < _rects.size(); ++i)
+            {
+                auto r = _rects[i];
+                while (i + 1 < _rects.size() &&
+                       _rects[i + 1].top == r.top &&
+                       _rects[i + 1].bottom == r.bottom &&
+                       _rects[i + 1].left == r.right)
+                {
+                    r.right = _rects[++i].right;
+                }
+                _rects[count++] = r;
+            }
+            _rects.resize(count);
+
+            // Vertically: identical column span, touching bands. After the
+            // sort a mergeable lower band can't precede its upper band, but it
+            // may not be adjacent in the list, so search forward within reach.
+            for (size_t i = 0; i < _rects.size(); ++i)
+            {
+                for (auto j = i + 1; j < _rects.size() && _rects[j].top <= _rects[i].bottom; ++j)
+                {
+                    if (_rects[j].top == _rects[i].bottom &&
+                        _rects[j].left == _rects[i].left &&
+                        _rects[j].right == _rects[i].right)
+                    {
+                        _rects[i].bottom = _rects[j].bottom;
+                        _rects.erase(_rects.begin() + j);
+                        // The grown rectangle may now touch yet another band.
+                        --i;
+                        break;
+                    }
+                }
+            }
+        }
+
+        small_vector<rect, 4> _rects;
+    };
+}
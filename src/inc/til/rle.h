@@ -307,6 +307,15 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         using rle_type = rle_pair<value_type, size_type>;
         using container = Container;
 
+        // A single (range, value) replacement, for use with the batched
+        // replace() overload.
+        struct change_type
+        {
+            size_type start_index;
+            size_type end_index;
+            value_type value;
+        };
+
         // We don't check anywhere whether a size_type value is negative.
         // Having signed integers would break that.
         static_assert(std::is_unsigned_v<size_type>, "the run length S must be unsigned");
@@ -456,6 +465,37 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             return { std::move(slice), gsl::narrow_cast<size_type>(end_index - start_index) };
         }
 
+        // Visits the runs overlapping the range [start_index, end_index),
+        // invoking func(value, length) for each one, with the first and last
+        // lengths clamped to the range. Unlike slice() this doesn't copy
+        // anything, making it the preferred way to read a sub-range.
+        // If end_index is larger than size() it's set to size().
+        template<typename Func>
+        void for_each_run(size_type start_index, size_type end_index, Func&& func) const
+        {
+            if (end_index > _total_length)
+            {
+                end_index = _total_length;
+            }
+
+            if (start_index >= end_index)
+            {
+                return;
+            }
+
+            rle_scanner scanner(_runs.begin(), _runs.end());
+            auto [run, run_pos] = scanner.scan(start_index);
+
+            for (auto remaining = end_index - start_index; remaining;)
+            {
+                const auto length = std::min(gsl::narrow_cast<size_type>(run->length - run_pos), gsl::narrow_cast<size_type>(remaining));
+                func(run->value, length);
+                remaining -= length;
+                ++run;
+                run_pos = 0;
+            }
+        }
+
         // Replace the range [start_index, end_index) with the given value.
         // If end_index is larger than size() it's set to size().
         // start_index must be smaller or equal to end_index.
@@ -463,6 +503,21 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         {
             _check_indices(start_index, end_index);
 
+            // Writing text left to right produces plenty of replacements that don't
+            // change anything, because the range already carries the requested value
+            // (for instance plain uncolored output on a row that's filled with the
+            // default attributes). Bailing out early keeps those free of any run
+            // shuffling, at the cost of one extra scan when the range does differ.
+            if (start_index < end_index)
+            {
+                rle_scanner scanner(_runs.begin(), _runs.end());
+                const auto [run, run_pos] = scanner.scan(start_index);
+                if (run != _runs.end() && run->value == value && run->length - run_pos >= end_index - start_index)
+                {
+                    return;
+                }
+            }
+
             const rle_type replacement{ value, gsl::narrow_cast<size_type>(end_index - start_index) };
             _replace_unchecked(start_index, end_index, { &replacement, 1 });
         }
@@ -493,6 +548,102 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             _replace_unchecked(start_index, end_index, replacements._runs);
         }
 
+        // Applies a whole batch of single-value replacements at once.
+        // The changes must be sorted by start_index and must not overlap.
+        // Compared to calling replace() in a loop, this rebuilds the run
+        // storage exactly once, instead of shuffling it for every change.
+        void replace(const std::span<const change_type> changes)
+        {
+            if (changes.empty())
+            {
+                return;
+            }
+
+            container result;
+            // Each change contributes one run of its own and can split at most
+            // one existing run in two --> this reserve() never reallocates.
+            result.reserve(_runs.size() + changes.size() * 2);
+
+            auto run = _runs.cbegin();
+            size_type run_pos = 0; // offset of the next unconsumed cell in *run
+            size_type pos = 0; // absolute position of the next unconsumed cell
+
+            const auto append_run = [&result](const value_type& value, const size_type length) {
+                if (length)
+                {
+                    if (!result.empty() && result.back().value == value)
+                    {
+                        result.back().length += length;
+                    }
+                    else
+                    {
+                        result.emplace_back(value, length);
+                    }
+                }
+            };
+            const auto advance_until = [&](const size_type until, const bool copy) {
+                while (pos < until)
+                {
+                    const auto take = std::min(gsl::narrow_cast<size_type>(run->length - run_pos), gsl::narrow_cast<size_type>(until - pos));
+                    if (copy)
+                    {
+                        append_run(run->value, take);
+                    }
+                    pos += take;
+                    run_pos += take;
+                    if (run_pos == run->length)
+                    {
+                        ++run;
+                        run_pos = 0;
+                    }
+                }
+            };
+
+            size_type previous_end = 0;
+            for (const auto& change : changes)
+            {
+                const auto start_index = change.start_index;
+                const auto end_index = std::min(change.end_index, _total_length);
+
+                // The same contract _check_indices() enforces, extended to the batch:
+                // every change must be well-formed and come after its predecessor.
+                if (start_index > end_index || start_index < previous_end)
+                {
+                    throw std::out_of_range("changes must be sorted and non-overlapping");
+                }
+                previous_end = end_index;
+
+                advance_until(start_index, true);
+                append_run(change.value, gsl::narrow_cast<size_type>(end_index - start_index));
+                advance_until(end_index, false);
+            }
+            advance_until(_total_length, true);
+
+            _runs = std::move(result);
+        }
+
+        // Appends a run to the end of the vector. Sequential appends of the
+        // same value coalesce into a single run, making this the cheapest way
+        // to build a vector front to back.
+        void append(const value_type& value, const size_type length)
+        {
+            if (!length)
+            {
+                return;
+            }
+
+            if (!_runs.empty() && _runs.back().value == value)
+            {
+                _runs.back().length += length;
+            }
+            else
+            {
+                _runs.emplace_back(value, length);
+            }
+
+            _total_length += length;
+        }
+
         // Replaces every instance of old_value in this vector with new_value.
         void replace_values(const value_type& old_value, const value_type& new_value)
         {
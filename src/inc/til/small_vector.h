@@ -589,6 +589,31 @@ namespace til
             });
         }
 
+        // Identical to resize(), except that any newly added items are left
+        // uninitialized, in the same spirit as std::make_unique_for_overwrite.
+        // The caller is expected to fill them before reading them.
+        void resize_for_overwrite(size_type new_size)
+        {
+            static_assert(std::is_trivially_default_constructible_v<T>);
+            _generic_resize(new_size, [](auto&&, auto&&) noexcept {});
+        }
+
+        // Mirrors std::basic_string::resize_and_overwrite: Grows the buffer so
+        // that it can hold max_size items, calls `op(data, max_size)` with the
+        // (partially uninitialized) buffer and commits the returned count as
+        // the new size. Unlike resize_for_overwrite(), bulk fills don't need
+        // to know their final size up front. Any existing items survive the
+        // growth, exactly like they do with resize_for_overwrite().
+        template<typename Operation>
+        void resize_and_overwrite(size_type max_size, Operation op)
+        {
+            static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>);
+            reserve(max_size);
+            const auto new_size = static_cast<size_type>(std::move(op)(_data, max_size));
+            assert(new_size <= max_size);
+            _size = new_size;
+        }
+
         void shrink_to_fit()
         {
             if (_capacity == N || _size == _capacity)
@@ -7,8 +7,55 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 {
     _TIL_INLINEPREFIX std::wstring visualize_control_codes(std::wstring str) noexcept
     {
-        for (auto& ch : str)
+#pragma warning(push)
+#pragma warning(disable : 26429 26481 26490) // use not_null, pointer arithmetic, reinterpret_cast
+        const auto it = str.data();
+        const auto len = str.size();
+        size_t off = 0;
+
+        // The scalar loop below is equivalent to adding to each character:
+        //   0x2400 if ch <= 0x1f (C0 control -> its control picture)
+        //   0x2403 if ch == 0x20 (space -> ␣)
+        //   0x23a2 if ch == 0x7f (del -> ␡)
+        //   0 otherwise
+        // The vectorized variants below compute that addend branchlessly for
+        // 8 characters at a time and add it unconditionally. Spaces are too
+        // frequent in commandlines for a skip-ahead scan to ever skip ahead,
+        // so unlike findActionableFromGround this rewrites every block.
+#if defined(TIL_SSE_INTRINSICS)
+
+        for (; off + 8 <= len; off += 8)
+        {
+            const auto wch = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + off));
+            // "max(0, wch - 0x1f) == 0" is the unsigned equivalent of "wch <= 0x1f".
+            const auto isControl = _mm_cmpeq_epi16(_mm_subs_epu16(wch, _mm_set1_epi16(0x1f)), _mm_setzero_si128());
+            const auto isSpace = _mm_cmpeq_epi16(wch, _mm_set1_epi16(0x20));
+            const auto isDelete = _mm_cmpeq_epi16(wch, _mm_set1_epi16(0x7f));
+            auto addend = _mm_and_si128(isControl, _mm_set1_epi16(0x2400));
+            addend = _mm_or_si128(addend, _mm_and_si128(isSpace, _mm_set1_epi16(0x2403)));
+            addend = _mm_or_si128(addend, _mm_and_si128(isDelete, _mm_set1_epi16(0x23a2)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(it + off), _mm_add_epi16(wch, addend));
+        }
+
+#elif defined(TIL_ARM_NEON_INTRINSICS)
+
+        for (; off + 8 <= len; off += 8)
         {
+            const auto wch = vld1q_u16(reinterpret_cast<const uint16_t*>(it + off));
+            const auto isControl = vcleq_u16(wch, vdupq_n_u16(0x1f));
+            const auto isSpace = vceqq_u16(wch, vdupq_n_u16(0x20));
+            const auto isDelete = vceqq_u16(wch, vdupq_n_u16(0x7f));
+            auto addend = vandq_u16(isControl, vdupq_n_u16(0x2400));
+            addend = vorrq_u16(addend, vandq_u16(isSpace, vdupq_n_u16(0x2403)));
+            addend = vorrq_u16(addend, vandq_u16(isDelete, vdupq_n_u16(0x23a2)));
+            vst1q_u16(reinterpret_cast<uint16_t*>(it + off), vaddq_u16(wch, addend));
+        }
+
+#endif
+
+        for (; off < len; ++off)
+        {
+            auto& ch = it[off];
             if (ch < 0x20)
             {
                 ch += 0x2400;
@@ -22,6 +69,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 ch = 0x2421; // replace del with ␡
             }
         }
+#pragma warning(pop)
         return str;
     }
 
@@ -81,13 +81,27 @@ namespace til
         };
     } // namespace details
 
-    template<bool leading, typename... Args>
+    // Which edge(s) of the throttling window the callback runs on.
+    enum class throttled_func_edge
+    {
+        leading, // invoke immediately, then suppress further calls for `delay`
+        trailing, // invoke once, `delay` time after the first call
+        both, // invoke immediately and, if further calls arrive, once more at the trailing edge
+    };
+
+    template<throttled_func_edge Edge, typename... Args>
     class throttled_func
     {
     public:
         using filetime_duration = std::chrono::duration<int64_t, std::ratio<1, 10000000>>;
         using function = std::function<void(Args...)>;
 
+        struct statistics
+        {
+            uint64_t calls = 0; // how often operator() was called
+            uint64_t invocations = 0; // how often the callback actually ran
+        };
+
         // Throttles invocations to the given `func` to not occur more often than `delay`.
         //
         // If this is a:
@@ -95,19 +109,31 @@ namespace til
         //   further invocations prevented until `delay` time has passed.
         // * throttled_func_trailing: On the first invocation a timer of `delay` time will
         //   be started. After the timer has expired `func` will be invoked just once.
+        // * throttled_func_both: `func` will be invoked immediately. If any further
+        //   invocations occur before `delay` time has passed, `func` will be invoked
+        //   once more at the end of that window, with the latest arguments.
         //
         // After `func` was invoked the state is reset and this cycle is repeated again.
         throttled_func(filetime_duration delay, function func) :
+            throttled_func{ delay, delay, std::move(func) }
+        {
+        }
+
+        // Same as above, but with an adaptive delay: It starts out at `min_delay` and
+        // is recomputed after every invocation from the observed duration of `func`,
+        // clamped into [min_delay, max_delay]. Use this when a fixed interval would be
+        // wrong on either end of the hardware spectrum (high refresh rate vs. VDI).
+        throttled_func(filetime_duration min_delay, filetime_duration max_delay, function func) :
+            _delay{ min_delay.count() },
+            _delayMin{ min_delay.count() },
+            _delayMax{ max_delay.count() },
             _func{ std::move(func) },
             _timer{ _createTimer() }
         {
-            const auto d = -delay.count();
-            if (d >= 0)
+            if (_delayMin <= 0 || _delayMin > _delayMax)
             {
-                throw std::invalid_argument("non-positive delay specified");
+                throw std::invalid_argument("invalid delay specified");
             }
-
-            memcpy(&_delay, &d, sizeof(d));
         }
 
         // throttled_func uses its `this` pointer when creating _timer.
@@ -118,15 +144,32 @@ namespace til
         throttled_func& operator=(throttled_func&&) = delete;
 
         // Throttles the invocation of the function passed to the constructor.
-        // If this is a trailing_throttled_func:
+        //
+        // If this is a throttled_func_trailing or throttled_func_both:
         //   If you call this function again before the underlying
         //   timer has expired, the new arguments will be used.
         template<typename... MakeArgs>
         void operator()(MakeArgs&&... args)
         {
-            if (!_storage.emplace(std::forward<MakeArgs>(args)...))
+            _calls.fetch_add(1, std::memory_order_relaxed);
+
+            if constexpr (Edge == throttled_func_edge::both)
             {
-                _leading_edge();
+                // The storage only holds the latest arguments here. Whether a
+                // throttling window is open is tracked separately, because the
+                // leading edge consumes the arguments while keeping the window open.
+                _storage.emplace(std::forward<MakeArgs>(args)...);
+                if (!_windowOpen.exchange(true, std::memory_order_acq_rel))
+                {
+                    _leading_edge();
+                }
+            }
+            else
+            {
+                if (!_storage.emplace(std::forward<MakeArgs>(args)...))
+                {
+                    _leading_edge();
+                }
             }
         }
 
@@ -157,6 +200,17 @@ namespace til
             }
         }
 
+        // Returns how often operator() was called and how often the callback
+        // actually ran. The difference between the two is the number of calls
+        // that were coalesced away (modulo one pending invocation).
+        statistics stats() const noexcept
+        {
+            return {
+                _calls.load(std::memory_order_relaxed),
+                _invocations.load(std::memory_order_relaxed),
+            };
+        }
+
     private:
         static void __stdcall _timer_callback(PTP_CALLBACK_INSTANCE /*instance*/, PVOID context, PTP_TIMER /*timer*/) noexcept
         try
@@ -167,26 +221,95 @@ namespace til
 
         void _leading_edge()
         {
-            if constexpr (leading)
+            if constexpr (Edge == throttled_func_edge::leading)
+            {
+                _invoke();
+            }
+            else if constexpr (Edge == throttled_func_edge::both)
             {
-                _func();
+                _apply_invoke();
             }
 
-            SetThreadpoolTimerEx(_timer.get(), &_delay, 0, 0);
+            _arm_timer();
         }
 
         void _trailing_edge()
         {
-            if constexpr (leading)
+            if constexpr (Edge == throttled_func_edge::leading)
             {
                 _storage.reset();
             }
+            else if constexpr (Edge == throttled_func_edge::trailing)
+            {
+                _apply_invoke();
+            }
             else
             {
-                std::apply(_func, _storage.take());
+                if (_storage)
+                {
+                    // Calls arrived during the window: run the trailing edge and
+                    // open the next window right away, so that a steady stream of
+                    // calls results in a steady `delay` cadence rather than pairs
+                    // of back-to-back trailing + leading invocations.
+                    _apply_invoke();
+                    _arm_timer();
+                    return;
+                }
+
+                _windowOpen.store(false, std::memory_order_release);
+
+                // A call may have slipped in between the check above and closing
+                // the window, with its caller believing this trailing edge would
+                // pick it up. Recheck, and service it if we win the window back.
+                if (_storage && !_windowOpen.exchange(true, std::memory_order_acq_rel))
+                {
+                    _leading_edge();
+                }
             }
         }
 
+        void _apply_invoke()
+        {
+            std::apply(
+                [this](auto&&... args) {
+                    _invoke(std::forward<decltype(args)>(args)...);
+                },
+                _storage.take());
+        }
+
+        template<typename... InvokeArgs>
+        void _invoke(InvokeArgs&&... args)
+        {
+            _invocations.fetch_add(1, std::memory_order_relaxed);
+
+            if (_delayMin == _delayMax)
+            {
+                _func(std::forward<InvokeArgs>(args)...);
+                return;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            _func(std::forward<InvokeArgs>(args)...);
+            const auto duration = std::chrono::duration_cast<filetime_duration>(std::chrono::steady_clock::now() - start).count();
+
+            // Quarter-weight exponential moving average over the observed callback
+            // duration. The next delay targets 4x that average, which keeps the
+            // callback's overhead below roughly 25% of one core, while the
+            // [min, max] corridor remains under the consumer's control.
+            auto average = _durationAverage.load(std::memory_order_relaxed);
+            average += (duration - average) / 4;
+            _durationAverage.store(average, std::memory_order_relaxed);
+            _delay.store(std::clamp(average * 4, _delayMin, _delayMax), std::memory_order_relaxed);
+        }
+
+        void _arm_timer() noexcept
+        {
+            const auto d = -_delay.load(std::memory_order_relaxed);
+            FILETIME ft;
+            memcpy(&ft, &d, sizeof(d));
+            SetThreadpoolTimerEx(_timer.get(), &ft, 0, 0);
+        }
+
         inline wil::unique_threadpool_timer _createTimer()
         {
             wil::unique_threadpool_timer timer{ CreateThreadpoolTimer(&_timer_callback, this, nullptr) };
@@ -194,13 +317,21 @@ namespace til
             return timer;
         }
 
-        FILETIME _delay;
+        std::atomic<int64_t> _delay; // current interval in positive FILETIME (100ns) units
+        int64_t _delayMin;
+        int64_t _delayMax;
         function _func;
         wil::unique_threadpool_timer _timer;
         details::throttled_func_storage<Args...> _storage;
+        std::atomic<int64_t> _durationAverage{ 0 };
+        std::atomic<uint64_t> _calls{ 0 };
+        std::atomic<uint64_t> _invocations{ 0 };
+        std::atomic<bool> _windowOpen{ false }; // only used by throttled_func_edge::both
     };
 
     template<typename... Args>
-    using throttled_func_trailing = throttled_func<false, Args...>;
-    using throttled_func_leading = throttled_func<true>;
+    using throttled_func_trailing = throttled_func<throttled_func_edge::trailing, Args...>;
+    using throttled_func_leading = throttled_func<throttled_func_edge::leading>;
+    template<typename... Args>
+    using throttled_func_both = throttled_func<throttled_func_edge::both, Args...>;
 } // namespace til
@@ -9,6 +9,13 @@ namespace til
 {
     // ticket_lock implements a classic fair lock.
     //
+    // In addition to the exclusive lock()/unlock() it supports a shared mode
+    // (compatible with std::shared_lock): Shared holders are admitted in ticket
+    // order just like exclusive ones, but a run of consecutive shared tickets
+    // proceeds concurrently, while an exclusive ticket waits for all previously
+    // admitted shared holders to drain. This keeps the lock fair in both
+    // directions: A stream of readers can't starve a writer and vice versa.
+    //
     // Compared to a SRWLOCK this implementation is significantly more unsafe to use:
     // Forgetting to call unlock or calling unlock more than once, will lead to deadlocks,
     // as _now_serving will remain out of sync with _next_ticket and prevent any further lockings.
@@ -33,6 +40,20 @@ namespace til
 
                 til::atomic_wait(_now_serving, current);
             }
+
+            // Shared holders admitted by earlier tickets pass the baton on
+            // immediately (see lock_shared), so they may still be inside
+            // their critical section when our ticket comes up.
+            for (;;)
+            {
+                const auto readers = _active_readers.load(std::memory_order_acquire);
+                if (readers == 0)
+                {
+                    break;
+                }
+
+                til::atomic_wait(_active_readers, readers);
+            }
         }
 
         void unlock() noexcept
@@ -41,6 +62,48 @@ namespace til
             til::atomic_notify_all(_now_serving);
         }
 
+        void lock_shared() noexcept
+        {
+            const auto ticket = _next_ticket.fetch_add(1, std::memory_order_relaxed);
+
+            for (;;)
+            {
+                const auto current = _now_serving.load(std::memory_order_acquire);
+                if (current == ticket)
+                {
+                    break;
+                }
+
+                til::atomic_wait(_now_serving, current);
+            }
+
+            // Register as an active holder before passing the baton on: An
+            // exclusive ticket right behind us will then drain us in lock(),
+            // while another shared ticket gets admitted concurrently.
+            _active_readers.fetch_add(1, std::memory_order_relaxed);
+            _now_serving.fetch_add(1, std::memory_order_release);
+            til::atomic_notify_all(_now_serving);
+        }
+
+        void unlock_shared() noexcept
+        {
+            if (_active_readers.fetch_sub(1, std::memory_order_release) == 1)
+            {
+                til::atomic_notify_all(_active_readers);
+            }
+        }
+
+        // Returns true if another thread is currently waiting in lock().
+        // The holder of the lock accounts for one outstanding ticket, so any
+        // difference beyond that means someone is queued up behind it. This
+        // allows long-running holders to cooperatively yield the lock early.
+        // Only meaningful for exclusive holders: Shared holders release their
+        // ticket on entry and aren't accounted for here.
+        bool is_contended() const noexcept
+        {
+            return (_next_ticket.load(std::memory_order_relaxed) - _now_serving.load(std::memory_order_relaxed)) > 1;
+        }
+
     private:
         // You may be inclined to add alignas(std::hardware_destructive_interference_size)
         // here to force the two atomics on separate cache lines, but I suggest to carefully
@@ -52,6 +115,7 @@ namespace til
         // atomics are treated more like "IDs" and less like counters.
         std::atomic<uint32_t> _next_ticket{ 0 };
         std::atomic<uint32_t> _now_serving{ 0 };
+        std::atomic<uint32_t> _active_readers{ 0 };
     };
 
     struct recursive_ticket_lock
@@ -135,6 +199,13 @@ namespace til
             return { *this, owner, recursion };
         }
 
+        // Returns true if another thread is currently waiting in lock().
+        // Only meaningful when called by the current owner of the lock.
+        bool is_contended() const noexcept
+        {
+            return _lock.is_contended();
+        }
+
         uint32_t is_locked() const noexcept
         {
             const auto id = GetCurrentThreadId();
@@ -47,6 +47,54 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         }
     };
 
+    namespace details
+    {
+#pragma warning(push)
+#pragma warning(disable : 26429 26481 26490) // use not_null, pointer arithmetic, reinterpret_cast
+        // Routine Description:
+        // - Copies the leading run of ASCII characters from a UTF-8 string into a UTF-16
+        //   buffer. For ASCII the conversion is a plain zero-extension of each byte, which
+        //   vectorizes trivially, whereas MultiByteToWideChar has to assume the worst.
+        //   The destination must have room for at least len characters.
+        // Arguments:
+        // - in - pointer to the UTF-8 data
+        // - len - number of bytes available
+        // - out - pointer to the UTF-16 destination
+        // Return Value:
+        // - the number of characters copied (== len if the input was pure ASCII)
+        inline size_t u8u16AsciiPrefix(const char* in, const size_t len, wchar_t* out) noexcept
+        {
+            size_t off = 0;
+
+#if defined(TIL_SSE_INTRINSICS)
+            const auto z = _mm_setzero_si128();
+            for (; off + 16 <= len; off += 16)
+            {
+                const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + off));
+                if (_mm_movemask_epi8(chunk))
+                {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + off), _mm_unpacklo_epi8(chunk, z));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + off + 8), _mm_unpackhi_epi8(chunk, z));
+            }
+#endif
+
+            for (; off < len; ++off)
+            {
+                const auto ch = gsl::narrow_cast<uint8_t>(in[off]);
+                if (ch >= 0x80)
+                {
+                    break;
+                }
+                out[off] = ch;
+            }
+
+            return off;
+        }
+#pragma warning(pop)
+    }
+
     // Routine Description:
     // - Takes a UTF-8 string and performs the conversion to UTF-16. NOTE: The function relies on getting complete UTF-8 characters at the string boundaries.
     // Arguments:
@@ -156,6 +204,19 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 }
             }
 
+            if (len8)
+            {
+                // The conpty ingest path is overwhelmingly ASCII, which converts by plain
+                // zero-extension. Copy the leading ASCII run ourselves and only hand the
+                // remainder to MultiByteToWideChar. Any cached trailing partials are
+                // non-ASCII lead/continuation bytes, so the prefix scan can't touch them.
+                const auto asciiLen{ gsl::narrow_cast<int>(details::u8u16AsciiPrefix(cursor8, gsl::narrow_cast<size_t>(len8), out.data() + len16)) };
+                len16 += asciiLen;
+                capa16 -= asciiLen;
+                len8 -= asciiLen;
+                cursor8 += asciiLen;
+            }
+
             if (len8)
             {
                 const auto convLen{ MultiByteToWideChar(CP_UTF8, 0UL, cursor8, len8, out.data() + len16, capa16) };
@@ -175,6 +175,10 @@ void Window::_UpdateSystemMetrics() const
     auto& g = ServiceLocator::LocateGlobals();
     auto& gci = g.getConsoleInformation();
 
+    // DPI, display and system parameter changes all funnel through here and
+    // may all change the maximum client rect cached by SCREEN_INFORMATION.
+    g.windowMetricsGeneration.fetch_add(1, std::memory_order_release);
+
     Scrolling::s_UpdateSystemMetrics();
 
     g.sVerticalScrollSize = dpiApi->GetSystemMetricsForDpi(SM_CXVSCROLL, g.dpi);
@@ -1199,6 +1203,10 @@ void Window::SetIsFullscreen(const bool fFullscreenEnabled)
     const auto fChangingFullscreen = (fFullscreenEnabled != _fIsInFullscreen);
     _fIsInFullscreen = fFullscreenEnabled;
 
+    // Entering or leaving fullscreen changes the window chrome and thereby the
+    // maximum client rect cached by SCREEN_INFORMATION.
+    ServiceLocator::LocateGlobals().windowMetricsGeneration.fetch_add(1, std::memory_order_release);
+
     const auto hWnd = GetWindowHandle();
 
     // First, modify regular window styles as appropriate
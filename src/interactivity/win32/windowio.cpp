@@ -399,6 +399,60 @@ void HandleKeyEvent(const HWND hWnd,
         }
     }
 
+    // During auto-repeat storms and programmatic input streams (SendInput, paste tools), WM_CHAR
+    // messages pile up in the queue faster than we dispatch them, and each one pays for its own
+    // trip through the window proc, console lock acquisition and input buffer write. If this was a
+    // plain printable character that made it past all of the interception above, drain any further
+    // ones already queued up behind it and commit the whole run as a single write, the same
+    // batching the VT input path gets.
+    //
+    // We only do this for unmodified printable characters: anything carrying CTRL or ALT (or any
+    // control character) could hit one of the shortcut/selection paths above and has to take the
+    // full trip through this function, one message at a time.
+    if (Message == WM_CHAR &&
+        bKeyDown &&
+        !generateBreak &&
+        wParam >= UNICODE_SPACE &&
+        WI_AreAllFlagsClear(keyEvent.Event.KeyEvent.dwControlKeyState, CTRL_PRESSED | ALT_PRESSED) &&
+        WI_AreAllFlagsClear(gci.Flags, CONSOLE_SELECTING | CONSOLE_SCROLLING | CONSOLE_SCROLLBAR_TRACKING) &&
+        !Scrolling::s_IsInScrollMode())
+    {
+        // Bound the drain so that a producer hammering us with posted messages can't keep us
+        // spinning here forever while we hold the console lock.
+        constexpr size_t maxCharsPerWrite = 128;
+
+        InputEventQueue events;
+        events.push_back(keyEvent);
+
+        MSG msg;
+        while (events.size() < maxCharsPerWrite &&
+               PeekMessageW(&msg, hWnd, WM_CHAR, WM_CHAR, PM_NOREMOVE) &&
+               WI_IsFlagClear(msg.lParam, KEY_TRANSITION_UP) &&
+               msg.wParam >= UNICODE_SPACE &&
+               WI_AreAllFlagsClear(GetControlKeyState(msg.lParam), CTRL_PRESSED | ALT_PRESSED))
+        {
+            PeekMessageW(&msg, hWnd, WM_CHAR, WM_CHAR, PM_REMOVE);
+
+            // The same synthesis the top of this function performs for character messages,
+            // including the load bearing RetrieveKeyInfo call that matches the message back up
+            // with the scan code of the keystroke that produced it.
+            auto vkCode = LOWORD(msg.wParam);
+            WORD scanCode = LOBYTE(HIWORD(msg.lParam));
+            RetrieveKeyInfo(hWnd, &vkCode, &scanCode, !gci.pInputBuffer->fInComposition);
+
+            auto event = SynthesizeKeyEvent(true, LOWORD(msg.lParam), vkCode, scanCode, static_cast<wchar_t>(msg.wParam), GetControlKeyState(msg.lParam));
+            // If this is a fake character, zero the scancode.
+            if (msg.lParam & 0x02000000)
+            {
+                event.Event.KeyEvent.wVirtualScanCode = 0;
+            }
+            events.push_back(event);
+        }
+
+        gci.pInputBuffer->Write(events);
+        return;
+    }
+
     HandleGenericKeyEvent(keyEvent, generateBreak);
 }
 
@@ -779,6 +779,10 @@ void Window::_HandleWindowPosChanged(const LPARAM lParam)
 
     const auto lpWindowPos = (LPWINDOWPOS)lParam;
 
+    // The window may have moved to a different monitor, which invalidates the
+    // maximum client rect cached by SCREEN_INFORMATION.
+    ServiceLocator::LocateGlobals().windowMetricsGeneration.fetch_add(1, std::memory_order_release);
+
     // If the frame changed, update the system metrics.
     if (WI_IsFlagSet(lpWindowPos->flags, SWP_FRAMECHANGED))
     {
@@ -124,6 +124,12 @@ private:
         {
             InitializeFonts();
             hr = FindFontAndUpdateState();
+            if (SUCCEEDED(hr))
+            {
+                // Now that the current font is pinned down, enumerate everything
+                // else in the background so the font dialog opens instantly later.
+                PrefetchFonts();
+            }
         }
 
         return hr;
@@ -615,6 +615,10 @@ INT_PTR ConsolePropertySheet(__in HWND hWnd, __in PCONSOLE_STATE_INFO pStateInfo
     // since we just triggered font enumeration, recreate our font handles to adapt for DPI
     RecreateFontHandles(hWnd);
 
+    // Now that the current font is pinned down, enumerate everything else in
+    // the background so the font dialog opens instantly later.
+    PrefetchFonts();
+
     //
     // Find the available default console/terminal packages
     //
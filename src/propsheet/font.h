@@ -86,6 +86,9 @@ typedef struct tagFACENODE
 VOID
     InitializeFonts(VOID);
 
+VOID
+    PrefetchFonts(VOID);
+
 VOID
     DestroyFonts(VOID);
 
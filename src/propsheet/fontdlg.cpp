@@ -243,13 +243,17 @@ FontDlgProc(
 
         /* Save current font size as dialog window's user data */
 
-        if (g_fEastAsianSystem)
-        {
-            SetWindowLongPtr(hDlg, GWLP_USERDATA, MAKELONG(FontInfo[g_currentFontIndex].tmCharSet, FontInfo[g_currentFontIndex].Size.Y));
-        }
-        else
         {
-            SetWindowLongPtr(hDlg, GWLP_USERDATA, MAKELONG(FontInfo[g_currentFontIndex].Size.X, FontInfo[g_currentFontIndex].Size.Y));
+            // The background font prefetch may still be growing FontInfo.
+            const auto lock = gcsFontEnum.lock();
+            if (g_fEastAsianSystem)
+            {
+                SetWindowLongPtr(hDlg, GWLP_USERDATA, MAKELONG(FontInfo[g_currentFontIndex].tmCharSet, FontInfo[g_currentFontIndex].Size.Y));
+            }
+            else
+            {
+                SetWindowLongPtr(hDlg, GWLP_USERDATA, MAKELONG(FontInfo[g_currentFontIndex].Size.X, FontInfo[g_currentFontIndex].Size.Y));
+            }
         }
 
         if (g_fHostedInFileProperties || gpStateInfo->Defaults)
@@ -272,31 +276,37 @@ FontDlgProc(
         // Don't let this happen again.
 
         /* Create the list of suitable fonts */
-        gbEnumerateFaces = TRUE;
-        bLB = !TM_IS_TT_FONT(FontInfo[g_currentFontIndex].Family);
-
-        gbBold = IS_BOLD(FontInfo[g_currentFontIndex].Weight);
-        CheckDlgButton(hDlg, IDD_BOLDFONT, gbBold);
-        if (gbBold)
         {
-            // if we're bold, we need to figure out if it's because the user chose this font or if it's because the font
-            // is only available in bold
-            if (IsBoldOnlyTTFont(FontInfo[g_currentFontIndex].FaceName, nullptr))
-            {
-                // Bold-only TT font, disable the bold checkbox
-                EnableWindow(GetDlgItem(hDlg, IDD_BOLDFONT), FALSE);
-            }
-            else
+            // Holding the lock across FontListCreate also means we wait here
+            // for the background prefetch, instead of racing it on FontInfo.
+            const auto lock = gcsFontEnum.lock();
+
+            gbEnumerateFaces = TRUE;
+            bLB = !TM_IS_TT_FONT(FontInfo[g_currentFontIndex].Family);
+
+            gbBold = IS_BOLD(FontInfo[g_currentFontIndex].Weight);
+            CheckDlgButton(hDlg, IDD_BOLDFONT, gbBold);
+            if (gbBold)
             {
-                // Bold was a user choice. Leave the bold checkbox enabled, and keep track of the fact that the user
-                // chose this.
-                gbUserChoseBold = TRUE;
+                // if we're bold, we need to figure out if it's because the user chose this font or if it's because the font
+                // is only available in bold
+                if (IsBoldOnlyTTFont(FontInfo[g_currentFontIndex].FaceName, nullptr))
+                {
+                    // Bold-only TT font, disable the bold checkbox
+                    EnableWindow(GetDlgItem(hDlg, IDD_BOLDFONT), FALSE);
+                }
+                else
+                {
+                    // Bold was a user choice. Leave the bold checkbox enabled, and keep track of the fact that the user
+                    // chose this.
+                    gbUserChoseBold = TRUE;
+                }
             }
-        }
 
-        FontListCreate(hDlg,
-                       bLB ? nullptr : FontInfo[g_currentFontIndex].FaceName,
-                       TRUE);
+            FontListCreate(hDlg,
+                           bLB ? nullptr : FontInfo[g_currentFontIndex].FaceName,
+                           TRUE);
+        }
 
         /* Initialize the preview window - selects current face & size too */
         bLB = PreviewInit(hDlg);
@@ -1138,6 +1148,11 @@ int FindCreateFont(
     ULONG AltFontIndex = 0, i;
     LPWSTR pwszAltFace;
 
+    // The font tables we're about to search (and potentially extend via
+    // DoFontEnum) may still be getting populated by the background
+    // enumeration started in InitializeFonts.
+    const auto lock = gcsFontEnum.lock();
+
     auto CharSet = CodePageToCharSet(CodePage);
 
     FAIL_FAST_IF(!(OEMCP != 0));
@@ -46,6 +46,12 @@ ULONG FontInfoLength;
 BOOL gbEnumerateFaces = FALSE;
 PFACENODE gpFaceNames = nullptr;
 
+// Guards the font tables above (FontInfo, gpFaceNames et al.) against
+// concurrent use by the UI thread and the background font enumeration
+// started by InitializeFonts. Reentrant, since EnumerateFonts and
+// FindCreateFont nest into DoFontEnum.
+wil::critical_section gcsFontEnum;
+
 BOOL g_fSettingsDlgInitialized = FALSE;
 
 BOOL InEM_UNDO = FALSE;
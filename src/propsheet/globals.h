@@ -33,6 +33,7 @@ extern const wchar_t g_szPreviewText[];
 extern PFACENODE gpFaceNames;
 
 extern BOOL gbEnumerateFaces;
+extern wil::critical_section gcsFontEnum;
 extern LONG gcxScreen;
 extern LONG gcyScreen;
 extern BOOL g_fForceV2;
@@ -168,6 +168,10 @@ int GetDPIXScaledPixelSize(const HWND hWnd, const int px)
 // properties dialog is moved between monitors of differing DPIs.
 void RecreateFontHandles(const HWND hWnd)
 {
+    // The background enumeration started in InitializeFonts may still be
+    // appending to FontInfo while the first DPI scale pass comes through.
+    const auto lock = gcsFontEnum.lock();
+
     if (gpStateInfo->fIsV2Console)
     {
         for (UINT iCurrFont = 0; iCurrFont < NumberOfFonts; iCurrFont++)
@@ -433,15 +437,51 @@ CreateBoldFont:
     return FE_FONTOK; // and continue enumeration
 }
 
+// Keeps track of the background enumeration kicked off by InitializeFonts so
+// that DestroyFonts can wait for it before tearing the font tables down.
+static wil::unique_handle ghFontPrefetchThread;
+
+static DWORD WINAPI FontPrefetchThreadProc(LPVOID /*lpParameter*/)
+{
+    // Discover the face list and probe every face, exactly like the font
+    // dialog does when it opens.
+    gbEnumerateFaces = TRUE;
+    LOG_IF_FAILED(EnumerateFonts(EF_TTFONT | EF_OEMFONT));
+    return 0;
+}
+
 VOID InitializeFonts(VOID)
 {
     LOG_IF_FAILED(EnumerateFonts(EF_DEFFACE)); // Just the Default font
 }
 
+// Warms up the full font enumeration in the background. Probing every font
+// family at every hard-coded size is what used to make the font dialog take
+// seconds to open on font-heavy machines; done here, the faces are all marked
+// EF_ENUMERATED by the time the dialog's own EnumerateFonts call comes in,
+// which then returns almost immediately. If the dialog somehow beats the
+// prefetch, gcsFontEnum makes it wait its turn, which is no worse than doing
+// the enumeration itself. WM_FONTCHANGE keeps the cached result fresh, by
+// setting gbEnumerateFaces just like before.
+// Call this only after the initial font lookup (FindCreateFont) is done, so
+// that propsheet startup doesn't have to queue up behind the enumeration.
+VOID PrefetchFonts(VOID)
+{
+    ghFontPrefetchThread.reset(CreateThread(nullptr, 0, FontPrefetchThreadProc, nullptr, 0, nullptr));
+}
+
 VOID DestroyFonts(VOID)
 {
     ULONG FontIndex;
 
+    // Make sure the background enumeration isn't still
+    // populating the tables we're about to free.
+    if (ghFontPrefetchThread)
+    {
+        WaitForSingleObject(ghFontPrefetchThread.get(), INFINITE);
+        ghFontPrefetchThread.reset();
+    }
+
     if (FontInfo != nullptr)
     {
         for (FontIndex = 0; FontIndex < NumberOfFonts; FontIndex++)
@@ -784,6 +824,8 @@ BOOL DoFontEnum(
     FONTENUMDATA fed;
     LOGFONT LogFont;
 
+    const auto lock = gcsFontEnum.lock();
+
     DBGFONTS(("DoFontEnum \"%ls\"\n", ptszFace));
     if (hDC == nullptr)
     {
@@ -929,6 +971,8 @@ EnumerateFonts(
     DWORD FontIndex;
     DWORD dwFontType = 0;
 
+    const auto lock = gcsFontEnum.lock();
+
     DBGFONTS(("EnumerateFonts %lx\n", Flags));
 
     dwFontType = (EF_TTFONT | EF_OEMFONT | EF_DEFFACE) & Flags;
@@ -492,6 +492,36 @@ void AtlasEngine::UpdateHyperlinkHoveredId(const uint16_t hoveredId) noexcept
 
 #pragma endregion
 
+[[nodiscard]] HRESULT AtlasEngine::CaptureFrame(std::vector<BYTE>& pixels, til::size& pixelSize) noexcept
+try
+{
+    {
+        const std::lock_guard guard{ _frameCapture.lock };
+        RETURN_HR_IF(HRESULT_FROM_WIN32(ERROR_BUSY), _frameCapture.pixels != nullptr);
+        _frameCapture.fulfilled.ResetEvent();
+        _frameCapture.pixels = &pixels;
+    }
+
+    // The request is serviced by the render thread the next time it finishes a
+    // frame. We can't paint ourselves, so if no frame arrives the request expires.
+    if (!_frameCapture.fulfilled.wait(1000))
+    {
+        const std::lock_guard guard{ _frameCapture.lock };
+        if (std::exchange(_frameCapture.pixels, nullptr))
+        {
+            return HRESULT_FROM_WIN32(ERROR_TIMEOUT);
+        }
+        // The render thread picked the request up just as we timed out. It'll
+        // signal the event shortly; the results are valid once it has.
+        _frameCapture.fulfilled.wait();
+    }
+
+    RETURN_IF_FAILED(_frameCapture.result);
+    pixelSize = _frameCapture.size;
+    return S_OK;
+}
+CATCH_RETURN()
+
 void AtlasEngine::_resolveTransparencySettings() noexcept
 {
     // An opaque background allows us to use true "independent" flips. See AtlasEngine::_createSwapChain().
@@ -624,22 +654,11 @@ void AtlasEngine::_resolveFontMetrics(const wchar_t* requestedFaceName, const Fo
         THROW_IF_FAILED(_p.dwriteFactory->GetSystemFontCollection(fontCollection.addressof(), FALSE));
     }
 
-    u32 index = 0;
-    BOOL exists = false;
-    THROW_IF_FAILED(fontCollection->FindFamilyName(requestedFaceName, &index, &exists));
-    THROW_HR_IF(DWRITE_E_NOFONT, !exists);
-
-    wil::com_ptr<IDWriteFontFamily> fontFamily;
-    THROW_IF_FAILED(fontCollection->GetFontFamily(index, fontFamily.addressof()));
-
-    wil::com_ptr<IDWriteFont> font;
-    THROW_IF_FAILED(fontFamily->GetFirstMatchingFont(static_cast<DWRITE_FONT_WEIGHT>(requestedWeight), DWRITE_FONT_STRETCH_NORMAL, DWRITE_FONT_STYLE_NORMAL, font.addressof()));
-
-    wil::com_ptr<IDWriteFontFace> fontFace;
-    THROW_IF_FAILED(font->CreateFontFace(fontFace.addressof()));
-
-    DWRITE_FONT_METRICS metrics{};
-    fontFace->GetMetrics(&metrics);
+    // Resolving the family and its design metrics is the same for every pane
+    // showing this font, so the result is shared process-wide via the FontCache.
+    auto resolved = FontCache::GetCachedFontResolution(fontCollection, requestedFaceName, static_cast<DWRITE_FONT_WEIGHT>(requestedWeight));
+    auto fontFamily = std::move(resolved.fontFamily);
+    const auto& metrics = resolved.metrics;
 
     // Point sizes are commonly treated at a 72 DPI scale
     // (including by OpenType), whereas DirectWrite uses 96 DPI.
@@ -661,18 +680,9 @@ void AtlasEngine::_resolveFontMetrics(const wchar_t* requestedFaceName, const Fo
     // According to the CSS spec, if it's impossible to determine the advance width,
     // it must be assumed to be 0.5em wide. em in CSS refers to the computed font-size.
     auto advanceWidth = 0.5f * fontSizeInPx;
+    if (resolved.hasZeroGlyph)
     {
-        static constexpr u32 codePoint = '0';
-
-        u16 glyphIndex;
-        THROW_IF_FAILED(fontFace->GetGlyphIndicesW(&codePoint, 1, &glyphIndex));
-
-        if (glyphIndex)
-        {
-            DWRITE_GLYPH_METRICS glyphMetrics{};
-            THROW_IF_FAILED(fontFace->GetDesignGlyphMetrics(&glyphIndex, 1, &glyphMetrics, FALSE));
-            advanceWidth = static_cast<f32>(glyphMetrics.advanceWidth) * designUnitsPerPx;
-        }
+        advanceWidth = static_cast<f32>(resolved.zeroGlyphAdvance) * designUnitsPerPx;
     }
 
     auto adjustedWidth = std::roundf(fontInfoDesired.GetCellWidth().Resolve(advanceWidth, dpi, fontSizeInPx, advanceWidth));
@@ -4,6 +4,8 @@
 #include "pch.h"
 #include "AtlasEngine.h"
 
+#include <til/hash.h>
+
 #include "Backend.h"
 #include "DWriteTextAnalysis.h"
 #include "../../interactivity/win32/CustomWindowMessages.h"
@@ -24,9 +26,16 @@
 
 using namespace Microsoft::Console::Render::Atlas;
 
+std::atomic<size_t> AtlasEngine::_tracelogCount{ 0 };
+
 #pragma warning(suppress : 26455) // Default constructor may not throw. Declare it 'noexcept' (f.6).
 AtlasEngine::AtlasEngine()
 {
+    if (_tracelogCount.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        TraceLoggingRegister(g_hAtlasEngineTraceProvider);
+    }
+
 #ifdef NDEBUG
     THROW_IF_FAILED(D2D1CreateFactory(D2D1_FACTORY_TYPE_SINGLE_THREADED, __uuidof(_p.d2dFactory), nullptr, reinterpret_cast<void**>(_p.d2dFactory.addressof())));
 #else
@@ -45,6 +54,14 @@ AtlasEngine::AtlasEngine()
     _p.textAnalyzer = textAnalyzer.query<IDWriteTextAnalyzer1>();
 }
 
+AtlasEngine::~AtlasEngine()
+{
+    if (_tracelogCount.fetch_sub(1, std::memory_order_relaxed) == 1)
+    {
+        TraceLoggingUnregister(g_hAtlasEngineTraceProvider);
+    }
+}
+
 #pragma region IRenderEngine
 
 // StartPaint() is called while the console buffer lock is being held.
@@ -567,6 +584,13 @@ void AtlasEngine::_recreateFontDependentResources()
     _api.replacementCharacterGlyphIndex = 0;
     _api.replacementCharacterLookedUp = false;
 
+    // Cached shaping results bake in the font size, DPI and font faces.
+    _api.shapedRunCache.clear();
+    _api.shapedRunCachePrevious.clear();
+
+    // The ASCII tables bake in the resolved font face of each variant.
+    _api.asciiGlyphTables = {};
+
     {
         wchar_t localeName[LOCALE_NAME_MAX_LENGTH];
 
@@ -671,11 +695,84 @@ void AtlasEngine::_flushBufferLine()
 #pragma warning(suppress : 26494) // Variable 'mappedEnd' is uninitialized. Always initialize an object (type.5).
     for (u32 idx = 0, mappedEnd; idx < _api.bufferLine.size(); idx = mappedEnd)
     {
+        // Block elements and braille patterns are drawn procedurally by the backends,
+        // with pixel-perfect seams between neighboring cells at any font size.
+        // They skip the font fallback and shaper entirely (see GetBuiltinGlyphParts).
+        if (isBuiltinGlyph(_api.bufferLine[idx]))
+        {
+            mappedEnd = idx + 1;
+            while (mappedEnd < _api.bufferLine.size() && isBuiltinGlyph(_api.bufferLine[mappedEnd]))
+            {
+                ++mappedEnd;
+            }
+            _mapBuiltinGlyphs(idx, mappedEnd, row);
+            continue;
+        }
+
+        // The overwhelmingly common case - log output, compiler spew, shell prompts - is
+        // a run of plain printable ASCII in a font that maps it 1:1 without any shaping.
+        // _buildAsciiGlyphTable() verifies that property once per font variant, after
+        // which such runs can skip both MapCharacters() and GetTextComplexity().
+        if (_api.s->font->fontFeatures.empty() && isPrintableAscii(_api.bufferLine[idx]))
+        {
+            auto& table = _api.asciiGlyphTables[static_cast<size_t>(_api.attributes)];
+            if (!table.lookedUp)
+            {
+                _buildAsciiGlyphTable();
+            }
+            if (table.usable)
+            {
+                mappedEnd = idx + 1;
+                while (mappedEnd < _api.bufferLine.size() && isPrintableAscii(_api.bufferLine[mappedEnd]))
+                {
+                    ++mappedEnd;
+                }
+
+                const auto initialIndicesCount = row.glyphIndices.size();
+                const auto shift = gsl::narrow_cast<u8>(row.lineRendition != LineRendition::SingleWidth);
+                const auto colors = _p.foregroundBitmap.begin() + _p.colorBitmapRowStride * _api.lastPaintBufferLineCoord.y;
+
+                for (auto i = idx; i < mappedEnd; ++i)
+                {
+                    const size_t col1 = _api.bufferLineColumn[i + 0];
+                    const size_t col2 = _api.bufferLineColumn[i + 1];
+                    const auto glyphAdvance = (col2 - col1) * _p.s->font->cellSize.x;
+                    const auto fg = colors[col1 << shift];
+                    row.glyphIndices.emplace_back(table.glyphIndices[_api.bufferLine[i] - L' ']);
+                    row.glyphAdvances.emplace_back(static_cast<f32>(glyphAdvance));
+                    row.glyphOffsets.emplace_back();
+                    row.colors.emplace_back(fg);
+                }
+
+                const auto indicesCount = row.glyphIndices.size();
+                if (row.mappings.empty() || row.mappings.back().fontFace != table.fontFace)
+                {
+                    row.mappings.emplace_back(table.fontFace, gsl::narrow_cast<u32>(initialIndicesCount), gsl::narrow_cast<u32>(indicesCount));
+                }
+                else
+                {
+                    row.mappings.back().glyphsTo = gsl::narrow_cast<u32>(indicesCount);
+                }
+                continue;
+            }
+        }
+
         u32 mappedLength = 0;
         wil::com_ptr<IDWriteFontFace2> mappedFontFace;
         _mapCharacters(_api.bufferLine.data() + idx, gsl::narrow_cast<u32>(_api.bufferLine.size()) - idx, &mappedLength, mappedFontFace.addressof());
         mappedEnd = idx + mappedLength;
 
+        // IDWriteFontFallback::MapCharacters() doesn't stop at builtin glyphs of course.
+        // Clamp the mapping to the next one, so that the divert above can pick it up.
+        for (auto i = idx + 1; i < mappedEnd; ++i)
+        {
+            if (isBuiltinGlyph(_api.bufferLine[i]))
+            {
+                mappedEnd = i;
+                break;
+            }
+        }
+
         if (!mappedFontFace)
         {
             _mapReplacementCharacter(idx, mappedEnd, row);
@@ -803,8 +900,62 @@ void AtlasEngine::_mapCharacters(const wchar_t* text, const u32 textLength, u32*
     assert(scale == 1);
 }
 
+void AtlasEngine::_buildAsciiGlyphTable()
+{
+    auto& table = _api.asciiGlyphTables[static_cast<size_t>(_api.attributes)];
+    table.lookedUp = true;
+
+    std::array<wchar_t, 95> ascii;
+    for (size_t i = 0; i < ascii.size(); ++i)
+    {
+        ascii[i] = gsl::narrow_cast<wchar_t>(L' ' + i);
+    }
+
+    // The font fallback must cover all of printable ASCII with a single font face,
+    // as otherwise there's no single table we could build.
+    u32 mappedLength = 0;
+    _mapCharacters(ascii.data(), gsl::narrow_cast<u32>(ascii.size()), &mappedLength, table.fontFace.addressof());
+    if (!table.fontFace || mappedLength != ascii.size())
+    {
+        table.fontFace.reset();
+        return;
+    }
+
+    // If the entire printable ASCII range is "simple" in this font, any substring of
+    // it is too, and these glyph indices are exactly what GetTextComplexity() would
+    // have returned for each run. Fonts that fail this check - say, ones with
+    // mandatory contextual alternates - simply keep taking the per-run analysis.
+    BOOL isTextSimple = FALSE;
+    u32 complexityLength = 0;
+    if (FAILED(_p.textAnalyzer->GetTextComplexity(ascii.data(), gsl::narrow_cast<u32>(ascii.size()), table.fontFace.get(), &isTextSimple, &complexityLength, table.glyphIndices.data())) ||
+        !isTextSimple || complexityLength != ascii.size())
+    {
+        table.fontFace.reset();
+        return;
+    }
+
+    table.usable = true;
+}
+
 void AtlasEngine::_mapComplex(IDWriteFontFace2* mappedFontFace, u32 idx, u32 length, ShapedRow& row)
 {
+    // Text shaping is the most expensive part of rendering complex scripts, and
+    // terminal contents repeat a lot frame over frame: The row with the cursor on it
+    // is redrawn on every keypress, selections force row redraws, and logs repeat the
+    // same timestamps and tags all over. Results are thus cached keyed by a hash of
+    // the run's text, column layout and font face. The cluster boundaries are stored
+    // alongside (u16 pairs), which is also why overlong runs aren't cacheable.
+    auto cacheable = length <= UINT16_MAX;
+    const auto cacheHash = cacheable ? _shapedRunHash(mappedFontFace, idx, length) : 0;
+
+    if (cacheable && _tryApplyShapedRunCache(cacheHash, mappedFontFace, idx, length, row))
+    {
+        return;
+    }
+
+    const auto initialGlyphsCount = row.glyphIndices.size();
+    std::vector<std::pair<u16, u16>> clusters;
+
     _api.analysisResults.clear();
 
     TextAnalysisSource analysisSource{ _api.userLocaleName.c_str(), _api.bufferLine.data(), gsl::narrow<UINT32>(_api.bufferLine.size()) };
@@ -915,9 +1066,12 @@ void AtlasEngine::_mapComplex(IDWriteFontFace2* mappedFontFace, u32 idx, u32 len
 
         const auto shift = gsl::narrow_cast<u8>(row.lineRendition != LineRendition::SingleWidth);
         const auto colors = _p.foregroundBitmap.begin() + _p.colorBitmapRowStride * _api.lastPaintBufferLineCoord.y;
+        const auto glyphBase = row.glyphIndices.size() - initialGlyphsCount;
         auto prevCluster = _api.clusterMap[0];
         size_t beg = 0;
 
+        cacheable = cacheable && glyphBase + actualGlyphCount <= UINT16_MAX;
+
         for (size_t i = 1; i <= a.textLength; ++i)
         {
             const auto nextCluster = _api.clusterMap[i];
@@ -926,6 +1080,11 @@ void AtlasEngine::_mapComplex(IDWriteFontFace2* mappedFontFace, u32 idx, u32 len
                 continue;
             }
 
+            if (cacheable)
+            {
+                clusters.emplace_back(gsl::narrow_cast<u16>(a.textPosition - idx + beg), gsl::narrow_cast<u16>(glyphBase + prevCluster));
+            }
+
             const size_t col1 = _api.bufferLineColumn[a.textPosition + beg];
             const size_t col2 = _api.bufferLineColumn[a.textPosition + i];
             const auto fg = colors[col1 << shift];
@@ -948,6 +1107,152 @@ void AtlasEngine::_mapComplex(IDWriteFontFace2* mappedFontFace, u32 idx, u32 len
         row.glyphAdvances.insert(row.glyphAdvances.end(), _api.glyphAdvances.begin(), _api.glyphAdvances.begin() + actualGlyphCount);
         row.glyphOffsets.insert(row.glyphOffsets.end(), _api.glyphOffsets.begin(), _api.glyphOffsets.begin() + actualGlyphCount);
     }
+
+    if (cacheable)
+    {
+        _storeShapedRunCache(cacheHash, mappedFontFace, idx, length, row, initialGlyphsCount, std::move(clusters));
+    }
+}
+
+// Computes the cache key for one font-mapped run of text: its contents, its column
+// layout (the corrected advances depend on it) and the font face that shapes it.
+// Font size, DPI, locale, etc., don't need to be part of the key, because the cache
+// is flushed whenever they change (see _recreateFontDependentResources).
+size_t AtlasEngine::_shapedRunHash(const IDWriteFontFace2* fontFace, u32 idx, u32 length) const noexcept
+{
+    const auto colBase = _api.bufferLineColumn[idx];
+
+    til::hasher h;
+    h.write(fontFace);
+    h.write(_api.bufferLine.data() + idx, length);
+    for (u32 i = 1; i <= length; ++i)
+    {
+        h.write(gsl::narrow_cast<u16>(_api.bufferLineColumn[idx + i] - colBase));
+    }
+    return h.finalize();
+}
+
+// Looks the given run up in the shaping cache and on a hit appends the cached result
+// to the row, recomputing only the colors (which depend on the row being drawn, not
+// on the shaping). Returns false on a miss, or if the entry turns out to be a hash
+// collision: the key material is stored in full and verified before use.
+bool AtlasEngine::_tryApplyShapedRunCache(size_t hash, const IDWriteFontFace2* fontFace, u32 idx, u32 length, ShapedRow& row)
+{
+    auto it = _api.shapedRunCache.find(hash);
+    if (it == _api.shapedRunCache.end())
+    {
+        const auto prevIt = _api.shapedRunCachePrevious.find(hash);
+        if (prevIt == _api.shapedRunCachePrevious.end())
+        {
+            return false;
+        }
+
+        // Promote the entry into the current generation so that it survives the next flip.
+        it = _api.shapedRunCache.insert_or_assign(hash, std::move(prevIt->second)).first;
+        _api.shapedRunCachePrevious.erase(prevIt);
+    }
+
+    const auto& entry = it->second;
+
+    if (entry.fontFace.get() != fontFace || entry.text.size() != length || memcmp(entry.text.data(), _api.bufferLine.data() + idx, length * sizeof(wchar_t)) != 0)
+    {
+        return false;
+    }
+
+    const auto colBase = _api.bufferLineColumn[idx];
+    for (u32 i = 0; i <= length; ++i)
+    {
+        if (entry.relColumns[i] != gsl::narrow_cast<u16>(_api.bufferLineColumn[idx + i] - colBase))
+        {
+            return false;
+        }
+    }
+
+    row.glyphIndices.insert(row.glyphIndices.end(), entry.glyphIndices.begin(), entry.glyphIndices.end());
+    row.glyphAdvances.insert(row.glyphAdvances.end(), entry.glyphAdvances.begin(), entry.glyphAdvances.end());
+    row.glyphOffsets.insert(row.glyphOffsets.end(), entry.glyphOffsets.begin(), entry.glyphOffsets.end());
+
+    const auto shift = gsl::narrow_cast<u8>(row.lineRendition != LineRendition::SingleWidth);
+    const auto colors = _p.foregroundBitmap.begin() + _p.colorBitmapRowStride * _api.lastPaintBufferLineCoord.y;
+
+    for (size_t k = 0; k + 1 < entry.clusters.size(); ++k)
+    {
+        const size_t col = _api.bufferLineColumn[idx + entry.clusters[k].first];
+        const auto fg = colors[col << shift];
+        row.colors.insert(row.colors.end(), entry.clusters[k + 1].second - entry.clusters[k].second, fg);
+    }
+
+    return true;
+}
+
+void AtlasEngine::_storeShapedRunCache(size_t hash, IDWriteFontFace2* fontFace, u32 idx, u32 length, const ShapedRow& row, size_t initialGlyphsCount, std::vector<std::pair<u16, u16>>&& clusters)
+{
+    // Once the current generation holds a couple screens worth of runs,
+    // it replaces the previous one and starts over empty.
+    const auto capacity = static_cast<size_t>(_p.s->viewportCellCount.y) * 8;
+    if (_api.shapedRunCache.size() >= capacity)
+    {
+        _api.shapedRunCachePrevious = std::move(_api.shapedRunCache);
+        _api.shapedRunCache.clear();
+    }
+
+    const auto colBase = _api.bufferLineColumn[idx];
+    const auto glyphsCount = row.glyphIndices.size() - initialGlyphsCount;
+    clusters.emplace_back(gsl::narrow_cast<u16>(length), gsl::narrow_cast<u16>(glyphsCount));
+
+    auto& entry = _api.shapedRunCache[hash];
+    entry.fontFace = fontFace;
+    entry.text.assign(_api.bufferLine.data() + idx, length);
+    entry.relColumns.resize(static_cast<size_t>(length) + 1);
+    for (u32 i = 0; i <= length; ++i)
+    {
+        entry.relColumns[i] = gsl::narrow_cast<u16>(_api.bufferLineColumn[idx + i] - colBase);
+    }
+    entry.glyphIndices.assign(row.glyphIndices.begin() + initialGlyphsCount, row.glyphIndices.end());
+    entry.glyphAdvances.assign(row.glyphAdvances.begin() + initialGlyphsCount, row.glyphAdvances.end());
+    entry.glyphOffsets.assign(row.glyphOffsets.begin() + initialGlyphsCount, row.glyphOffsets.end());
+    entry.clusters = std::move(clusters);
+}
+
+// Appends a run of builtin glyphs (block elements, braille patterns) to the row.
+// They're encoded with their codepoint as the "glyph index" and a null font face,
+// and the backends turn them into plain rectangles at draw time.
+void AtlasEngine::_mapBuiltinGlyphs(u32 from, u32 to, ShapedRow& row)
+{
+    const auto initialIndicesCount = row.glyphIndices.size();
+    const auto shift = gsl::narrow_cast<u8>(row.lineRendition != LineRendition::SingleWidth);
+    const auto colors = _p.foregroundBitmap.begin() + _p.colorBitmapRowStride * _api.lastPaintBufferLineCoord.y;
+
+    for (auto pos = from; pos < to; ++pos)
+    {
+        const size_t col1 = _api.bufferLineColumn[pos + 0];
+        const size_t col2 = _api.bufferLineColumn[pos + 1];
+        if (col1 == col2)
+        {
+            continue;
+        }
+
+        const auto cols = col2 - col1;
+        row.glyphIndices.emplace_back(static_cast<u16>(_api.bufferLine[pos]));
+        row.glyphAdvances.emplace_back(static_cast<f32>(cols * _p.s->font->cellSize.x));
+        row.glyphOffsets.emplace_back();
+        row.colors.emplace_back(colors[col1 << shift]);
+    }
+
+    const auto indicesCount = row.glyphIndices.size();
+    if (indicesCount > initialIndicesCount)
+    {
+        // A preceding soft font run shares the null font face and can be merged,
+        // because the backends dispatch on the "glyph index" for each glyph anyways.
+        if (row.mappings.empty() || row.mappings.back().fontFace)
+        {
+            row.mappings.emplace_back(nullptr, gsl::narrow_cast<u32>(initialIndicesCount), gsl::narrow_cast<u32>(indicesCount));
+        }
+        else
+        {
+            row.mappings.back().glyphsTo = gsl::narrow_cast<u32>(indicesCount);
+        }
+    }
 }
 
 void AtlasEngine::_mapReplacementCharacter(u32 from, u32 to, ShapedRow& row)
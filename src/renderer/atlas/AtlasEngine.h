@@ -17,6 +17,7 @@ namespace Microsoft::Console::Render::Atlas
     {
     public:
         explicit AtlasEngine();
+        ~AtlasEngine() override;
 
         AtlasEngine(const AtlasEngine&) = delete;
         AtlasEngine& operator=(const AtlasEngine&) = delete;
@@ -25,6 +26,7 @@ namespace Microsoft::Console::Render::Atlas
         [[nodiscard]] HRESULT StartPaint() noexcept override;
         [[nodiscard]] HRESULT EndPaint() noexcept override;
         [[nodiscard]] bool RequiresContinuousRedraw() noexcept override;
+        [[nodiscard]] bool CanPaintWithoutConsoleLock() const noexcept override;
         void WaitUntilCanRender() noexcept override;
         [[nodiscard]] HRESULT Present() noexcept override;
         [[nodiscard]] HRESULT PrepareForTeardown(_Out_ bool* pForcePaint) noexcept override;
@@ -80,6 +82,11 @@ namespace Microsoft::Console::Render::Atlas
         [[nodiscard]] HRESULT UpdateFont(const FontInfoDesired& pfiFontInfoDesired, FontInfo& fiFontInfo, const std::unordered_map<std::wstring_view, uint32_t>& features, const std::unordered_map<std::wstring_view, float>& axes) noexcept override;
         void UpdateHyperlinkHoveredId(uint16_t hoveredId) noexcept override;
 
+        // Copies the next fully rendered frame into the caller-provided buffer as
+        // tightly packed 32bpp BGRA rows. Blocks until the render thread paints a
+        // frame, so callers should trigger a redraw before calling this.
+        [[nodiscard]] HRESULT CaptureFrame(std::vector<BYTE>& pixels, til::size& pixelSize) noexcept;
+
     private:
         // AtlasEngine.cpp
         ATLAS_ATTR_COLD void _handleSettingsUpdate();
@@ -88,7 +95,12 @@ namespace Microsoft::Console::Render::Atlas
         void _flushBufferLine();
         void _mapCharacters(const wchar_t* text, u32 textLength, u32* mappedLength, IDWriteFontFace2** mappedFontFace) const;
         void _mapComplex(IDWriteFontFace2* mappedFontFace, u32 idx, u32 length, ShapedRow& row);
+        void _mapBuiltinGlyphs(u32 from, u32 to, ShapedRow& row);
         ATLAS_ATTR_COLD void _mapReplacementCharacter(u32 from, u32 to, ShapedRow& row);
+        ATLAS_ATTR_COLD void _buildAsciiGlyphTable();
+        size_t _shapedRunHash(const IDWriteFontFace2* fontFace, u32 idx, u32 length) const noexcept;
+        bool _tryApplyShapedRunCache(size_t hash, const IDWriteFontFace2* fontFace, u32 idx, u32 length, ShapedRow& row);
+        void _storeShapedRunCache(size_t hash, IDWriteFontFace2* fontFace, u32 idx, u32 length, const ShapedRow& row, size_t initialGlyphsCount, std::vector<std::pair<u16, u16>>&& clusters);
 
         // AtlasEngine.api.cpp
         void _resolveTransparencySettings() noexcept;
@@ -105,6 +117,7 @@ namespace Microsoft::Console::Render::Atlas
         void _updateMatrixTransform();
         void _waitUntilCanRender() noexcept;
         void _present();
+        void _fulfillPendingFrameCapture() noexcept;
 
         static constexpr u16 u16min = 0x0000;
         static constexpr u16 u16max = 0xffff;
@@ -114,9 +127,55 @@ namespace Microsoft::Console::Render::Atlas
         static constexpr range<u16> invalidatedRowsNone{ u16max, u16min };
         static constexpr range<u16> invalidatedRowsAll{ u16min, u16max };
 
+        static std::atomic<size_t> _tracelogCount;
+
         std::unique_ptr<IBackend> _b;
         RenderingPayload _p;
 
+        // CaptureFrame() parks its request here. The render thread fulfills it in
+        // _fulfillPendingFrameCapture(), right after the backend has rendered a
+        // complete frame into the back buffer. `pixels` doubles as the "request
+        // pending" flag; `lock` arbitrates between the two threads.
+        struct
+        {
+            std::shared_mutex lock;
+            std::vector<BYTE>* pixels = nullptr;
+            til::size size;
+            HRESULT result = S_OK;
+            wil::unique_event fulfilled{ wil::EventOptions::ManualReset };
+        } _frameCapture;
+
+        // A cached _mapComplex() result for one font-mapped run of text. Text shaping is
+        // by far the most expensive part of rendering complex scripts, and terminal
+        // contents repeat a lot frame over frame (the cursor row alone is redrawn on
+        // every keypress). The arrays hold exactly what _mapComplex() would have
+        // appended to the ShapedRow, except for the colors, which depend on the row
+        // contents and get recomputed from `clusters` on every cache hit.
+        struct ShapedRunCacheEntry
+        {
+            wil::com_ptr<IDWriteFontFace2> fontFace;
+            std::wstring text;
+            std::vector<u16> relColumns; // columns relative to the run start, one per character plus a trailing end entry
+            std::vector<u16> glyphIndices;
+            std::vector<f32> glyphAdvances;
+            std::vector<DWRITE_GLYPH_OFFSET> glyphOffsets;
+            std::vector<std::pair<u16, u16>> clusters; // cluster boundaries as (character, glyph) pairs, plus a trailing (length, count) entry
+        };
+
+        // A precomputed printable-ASCII --> glyph index table for one font variant
+        // (regular/bold/italic/bold-italic). It's only `usable` if the variant's
+        // primary font covers all of ASCII with a trivial 1:1 cmap mapping and no
+        // shaping requirements, which _buildAsciiGlyphTable() verifies once via
+        // GetTextComplexity(). Runs that hit a usable table skip both the font
+        // fallback and the complexity analysis entirely.
+        struct AsciiGlyphTable
+        {
+            wil::com_ptr<IDWriteFontFace2> fontFace;
+            std::array<u16, 95> glyphIndices{};
+            bool lookedUp = false;
+            bool usable = false;
+        };
+
         struct ApiState
         {
             GenerationalSettings s = DirtyGenerationalSettings();
@@ -144,10 +203,19 @@ namespace Microsoft::Console::Render::Atlas
             Buffer<f32> glyphAdvances;
             Buffer<DWRITE_GLYPH_OFFSET> glyphOffsets;
 
+            // The shaping cache ages in two generations: lookups check both, insertions go
+            // into the first, and once it's full it replaces the second. That bounds the
+            // cache to roughly the most recently shaped couple of screens worth of runs.
+            std::unordered_map<size_t, ShapedRunCacheEntry> shapedRunCache;
+            std::unordered_map<size_t, ShapedRunCacheEntry> shapedRunCachePrevious;
+
             wil::com_ptr<IDWriteFontFace2> replacementCharacterFontFace;
             u16 replacementCharacterGlyphIndex = 0;
             bool replacementCharacterLookedUp = false;
 
+            // Indexed by `attributes`, just like textFormatAxes.
+            std::array<AsciiGlyphTable, 4> asciiGlyphTables;
+
             // PrepareLineTransform()
             LineRendition lineRendition = LineRendition::SingleWidth;
             // UpdateDrawingBrushes()
@@ -6,6 +6,7 @@
 
 #include "BackendD2D.h"
 #include "BackendD3D.h"
+#include "../base/FontCache.h"
 
 // #### NOTE ####
 // If you see any code in here that contains "_api." you might be seeing a race condition.
@@ -47,8 +48,28 @@ try
         _handleSwapChainUpdate();
     }
 
-    _b->Render(_p);
-    _present();
+    if (TraceLoggingProviderEnabled(g_hAtlasEngineTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
+    {
+        const auto renderBegin = std::chrono::steady_clock::now();
+        _b->Render(_p);
+        const auto presentBegin = std::chrono::steady_clock::now();
+        _present();
+        const auto presentEnd = std::chrono::steady_clock::now();
+
+#pragma warning(suppress : 26477 26485 26494 26482 26446 26447) // We don't control TraceLoggingWrite
+        TraceLoggingWrite(
+            g_hAtlasEngineTraceProvider,
+            "Frame",
+            TraceLoggingInt64(std::chrono::duration_cast<std::chrono::microseconds>(presentBegin - renderBegin).count(), "renderMicroseconds"),
+            TraceLoggingInt64(std::chrono::duration_cast<std::chrono::microseconds>(presentEnd - presentBegin).count(), "presentMicroseconds"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+    }
+    else
+    {
+        _b->Render(_p);
+        _present();
+    }
     return S_OK;
 }
 catch (const wil::ResultException& exception)
@@ -80,6 +101,14 @@ CATCH_RETURN()
     return ATLAS_DEBUG_CONTINUOUS_REDRAW || (_b && _b->RequiresContinuousRedraw());
 }
 
+[[nodiscard]] bool AtlasEngine::CanPaintWithoutConsoleLock() const noexcept
+{
+    // All paint-phase calls fill _api/_p state owned by the render thread;
+    // IRenderData is never consulted while painting (UpdateDrawingBrushes
+    // ignores it), so painting from the renderer's snapshot is safe.
+    return true;
+}
+
 void AtlasEngine::WaitUntilCanRender() noexcept
 {
     if constexpr (ATLAS_DEBUG_RENDER_DELAY)
@@ -109,26 +138,10 @@ void AtlasEngine::_recreateAdapter()
     }
 #endif
 
-#ifndef NDEBUG
-    static constexpr UINT flags = DXGI_CREATE_FACTORY_DEBUG;
-#else
-    static constexpr UINT flags = 0;
-#endif
-
-// IID_PPV_ARGS doesn't work here for some reason.
-#pragma warning(suppress : 26496) // The variable 'hr' does not change after construction, mark it as const (con.4).
-    auto hr = CreateDXGIFactory2(flags, __uuidof(_p.dxgi.factory), _p.dxgi.factory.put_void());
-
-#ifndef NDEBUG
-    // This might be due to missing the "Graphics debugger and GPU profiler for
-    // DirectX" tools. Just as a sanity check, try again without
-    // `DXGI_CREATE_FACTORY_DEBUG`
-    if (FAILED(hr))
-    {
-        hr = CreateDXGIFactory2(0, __uuidof(_p.dxgi.factory), _p.dxgi.factory.put_void());
-    }
-#endif
-    THROW_IF_FAILED(hr);
+    // The factory is shared across all engine instances in the process.
+    // GetCachedDXGIFactory() replaces it with a fresh one when it went stale,
+    // which is what makes the IsCurrent() check in Present() work.
+    _p.dxgi.factory = FontCache::GetCachedDXGIFactory();
 
     wil::com_ptr<IDXGIAdapter1> adapter;
     DXGI_ADAPTER_DESC1 desc{};
@@ -432,8 +445,17 @@ void AtlasEngine::_waitUntilCanRender() noexcept
     }
 }
 
+// A note on scrolling: Even though we pass a scroll rect and tight dirty rects to Present1()
+// below, the backends still re-render the entire target every frame. That's not an oversight:
+// With a flip model swap chain the back buffer we're rendering into contains the contents
+// from 2-3 frames ago, not the previous frame, so reusing its contents would require copying
+// the previous buffer forward first (see DxEngine::_CopyFrontToBack), which costs about as
+// much bandwidth as the redraw. The scroll/dirty rects still pay off, because they allow
+// DWM to limit composition and scanout updates to the parts that actually changed.
 void AtlasEngine::_present()
 {
+    _fulfillPendingFrameCapture();
+
     const RECT fullRect{ 0, 0, _p.swapChain.targetSize.x, _p.swapChain.targetSize.y };
 
     DXGI_PRESENT_PARAMETERS params{};
@@ -495,3 +517,63 @@ void AtlasEngine::_present()
 
     _p.swapChain.waitForPresentation = true;
 }
+
+// Copies the freshly rendered back buffer into a waiting CaptureFrame() request, if any.
+// This has to run between IBackend::Render() and Present1(): with a flip model swap chain
+// that's the only window in which the back buffer is guaranteed to contain a complete
+// frame, because the backends re-render the entire target every frame (see above).
+void AtlasEngine::_fulfillPendingFrameCapture() noexcept
+{
+    const std::lock_guard guard{ _frameCapture.lock };
+    if (!_frameCapture.pixels)
+    {
+        return;
+    }
+
+    const auto pixels = std::exchange(_frameCapture.pixels, nullptr);
+    auto hr = S_OK;
+
+    try
+    {
+        wil::com_ptr<ID3D11Texture2D> buffer;
+        THROW_IF_FAILED(_p.swapChain.swapChain->GetBuffer(0, IID_PPV_ARGS(buffer.addressof())));
+
+        D3D11_TEXTURE2D_DESC desc{};
+        buffer->GetDesc(&desc);
+        desc.BindFlags = 0;
+        desc.MiscFlags = 0;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        desc.Usage = D3D11_USAGE_STAGING;
+
+        wil::com_ptr<ID3D11Texture2D> staging;
+        THROW_IF_FAILED(_p.device->CreateTexture2D(&desc, nullptr, staging.addressof()));
+        _p.deviceContext->CopyResource(staging.get(), buffer.get());
+
+        D3D11_MAPPED_SUBRESOURCE mapped{};
+        THROW_IF_FAILED(_p.deviceContext->Map(staging.get(), 0, D3D11_MAP_READ, 0, &mapped));
+        const auto unmap = wil::scope_exit([&]() { _p.deviceContext->Unmap(staging.get(), 0); });
+
+        // The tight row size is Width * 4 bytes (B8G8R8A8), but the rows in the
+        // mapped texture are padded out to RowPitch.
+        const auto rowBytes = static_cast<size_t>(desc.Width) * 4;
+        pixels->resize(rowBytes * desc.Height);
+
+        auto dst = pixels->data();
+        auto src = static_cast<const BYTE*>(mapped.pData);
+        for (UINT i = 0; i < desc.Height; ++i)
+        {
+            memcpy(dst, src, rowBytes);
+            dst += rowBytes;
+            src += mapped.RowPitch;
+        }
+
+        _frameCapture.size = { static_cast<til::CoordType>(desc.Width), static_cast<til::CoordType>(desc.Height) };
+    }
+    catch (...)
+    {
+        hr = wil::ResultFromCaughtException();
+    }
+
+    _frameCapture.result = hr;
+    _frameCapture.fulfilled.SetEvent();
+}
@@ -15,6 +15,90 @@ TIL_FAST_MATH_BEGIN
 
 using namespace Microsoft::Console::Render::Atlas;
 
+#pragma warning(suppress : 26477) // We don't control tracelogging macros
+TRACELOGGING_DEFINE_PROVIDER(g_hAtlasEngineTraceProvider,
+                             "Microsoft.Windows.Terminal.Renderer.Atlas",
+                             // tl:{bbf79ab8-9708-715e-9e92-ac2ea9636456}
+                             (0xbbf79ab8, 0x9708, 0x715e, 0x9e, 0x92, 0xac, 0x2e, 0xa9, 0x63, 0x64, 0x56), );
+
+// Writes the rectangles that make up the given builtin glyph into `parts` and returns
+// their count. The coordinates are in 1/16ths of the cell, so that the caller can snap
+// the edges to whole pixels no matter the cell size. A braille pattern contributes one
+// rectangle per set dot, block elements consist of at most 2 rectangles.
+size_t Microsoft::Console::Render::Atlas::GetBuiltinGlyphParts(u32 ch, std::array<BuiltinGlyphPart, 8>& parts) noexcept
+{
+    assert(isBuiltinGlyph(ch));
+
+    if ((ch & 0xFFFFFF00) == 0x2800)
+    {
+        // Braille: 2 columns x 4 rows of dots, one per bit in the low byte.
+        // The bit order is historic: bits 0-2 are the left column rows 0-2, bits 3-5
+        // the right column rows 0-2, and bits 6/7 the left/right dot of the 4th row.
+        static constexpr u8 dotColumn[]{ 0, 0, 0, 1, 1, 1, 0, 1 };
+        static constexpr u8 dotRow[]{ 0, 1, 2, 0, 1, 2, 3, 3 };
+
+        size_t count = 0;
+        for (u8 bit = 0; bit < 8; ++bit)
+        {
+            if (ch & (1u << bit))
+            {
+                // Each dot is half the width/height of its 8x4 grid cell, centered.
+                parts[count++] = {
+                    .x = gsl::narrow_cast<u8>(dotColumn[bit] * 8 + 2),
+                    .y = gsl::narrow_cast<u8>(dotRow[bit] * 4 + 1),
+                    .w = 4,
+                    .h = 2,
+                };
+            }
+        }
+        return count;
+    }
+
+    struct BlockElement
+    {
+        BuiltinGlyphPart parts[2];
+        u8 count = 0;
+    };
+    static constexpr std::array<BlockElement, 32> blockElements{ {
+        /* U+2580 ▀ */ { { { 0, 0, 16, 8 } }, 1 },
+        /* U+2581 ▁ */ { { { 0, 14, 16, 2 } }, 1 },
+        /* U+2582 ▂ */ { { { 0, 12, 16, 4 } }, 1 },
+        /* U+2583 ▃ */ { { { 0, 10, 16, 6 } }, 1 },
+        /* U+2584 ▄ */ { { { 0, 8, 16, 8 } }, 1 },
+        /* U+2585 ▅ */ { { { 0, 6, 16, 10 } }, 1 },
+        /* U+2586 ▆ */ { { { 0, 4, 16, 12 } }, 1 },
+        /* U+2587 ▇ */ { { { 0, 2, 16, 14 } }, 1 },
+        /* U+2588 █ */ { { { 0, 0, 16, 16 } }, 1 },
+        /* U+2589 ▉ */ { { { 0, 0, 14, 16 } }, 1 },
+        /* U+258A ▊ */ { { { 0, 0, 12, 16 } }, 1 },
+        /* U+258B ▋ */ { { { 0, 0, 10, 16 } }, 1 },
+        /* U+258C ▌ */ { { { 0, 0, 8, 16 } }, 1 },
+        /* U+258D ▍ */ { { { 0, 0, 6, 16 } }, 1 },
+        /* U+258E ▎ */ { { { 0, 0, 4, 16 } }, 1 },
+        /* U+258F ▏ */ { { { 0, 0, 2, 16 } }, 1 },
+        /* U+2590 ▐ */ { { { 8, 0, 8, 16 } }, 1 },
+        /* U+2591 ░ */ {}, // the shades aren't solid rectangles --> drawn by the font
+        /* U+2592 ▒ */ {},
+        /* U+2593 ▓ */ {},
+        /* U+2594 ▔ */ { { { 0, 0, 16, 2 } }, 1 },
+        /* U+2595 ▕ */ { { { 14, 0, 2, 16 } }, 1 },
+        /* U+2596 ▖ */ { { { 0, 8, 8, 8 } }, 1 },
+        /* U+2597 ▗ */ { { { 8, 8, 8, 8 } }, 1 },
+        /* U+2598 ▘ */ { { { 0, 0, 8, 8 } }, 1 },
+        /* U+2599 ▙ */ { { { 0, 0, 8, 8 }, { 0, 8, 16, 8 } }, 2 },
+        /* U+259A ▚ */ { { { 0, 0, 8, 8 }, { 8, 8, 8, 8 } }, 2 },
+        /* U+259B ▛ */ { { { 0, 0, 16, 8 }, { 0, 8, 8, 8 } }, 2 },
+        /* U+259C ▜ */ { { { 0, 0, 16, 8 }, { 8, 8, 8, 8 } }, 2 },
+        /* U+259D ▝ */ { { { 8, 0, 8, 8 } }, 1 },
+        /* U+259E ▞ */ { { { 8, 0, 8, 8 }, { 0, 8, 8, 8 } }, 2 },
+        /* U+259F ▟ */ { { { 8, 0, 8, 8 }, { 0, 8, 16, 8 } }, 2 },
+    } };
+
+    const auto& b = blockElements[std::min<u32>(ch - 0x2580, 31)];
+    std::copy_n(&b.parts[0], b.count, parts.begin());
+    return b.count;
+}
+
 void Microsoft::Console::Render::Atlas::GlyphRunAccumulateBounds(const ID2D1DeviceContext* d2dRenderTarget, D2D1_POINT_2F baselineOrigin, const DWRITE_GLYPH_RUN* glyphRun, D2D1_RECT_F& bounds)
 {
     D2D1_RECT_F rect{};
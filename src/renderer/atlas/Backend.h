@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <TraceLoggingProvider.h>
+
 #include "common.h"
 
+TRACELOGGING_DECLARE_PROVIDER(g_hAtlasEngineTraceProvider);
+
 namespace Microsoft::Console::Render::Atlas
 {
     // If set to 1, this will cause the entire viewport to be invalidated at all times.
@@ -79,6 +83,31 @@ namespace Microsoft::Console::Render::Atlas
         return ch >= 0xEF20 && ch < 0xEF80;
     }
 
+    constexpr bool isPrintableAscii(wchar_t ch) noexcept
+    {
+        return ch >= 0x20 && ch < 0x7F;
+    }
+
+    // Returns true for codepoints the backends draw procedurally instead of asking
+    // DirectWrite: block elements (U+2580-U+259F, minus the shades which aren't solid
+    // rectangles) and braille patterns (U+2800-U+28FF). They all decompose into a few
+    // axis-aligned rectangles (see GetBuiltinGlyphParts), which gives us pixel-perfect
+    // seams between neighboring cells at any font size.
+    constexpr bool isBuiltinGlyph(u32 ch) noexcept
+    {
+        return (ch >= 0x2580 && ch <= 0x259F && (ch < 0x2591 || ch > 0x2593)) || (ch & 0xFFFFFF00) == 0x2800;
+    }
+
+    // One rectangle of a builtin glyph, in 1/16ths of the cell.
+    // (Block elements use 8ths of a cell, braille dots sit on a 2x4 grid with
+    // half-cell gaps in between. 16ths are the smallest unit covering both.)
+    struct BuiltinGlyphPart
+    {
+        u8 x, y, w, h;
+    };
+
+    size_t GetBuiltinGlyphParts(u32 ch, std::array<BuiltinGlyphPart, 8>& parts) noexcept;
+
     inline constexpr D2D1_RECT_F GlyphRunEmptyBounds{ 1e38f, 1e38f, -1e38f, -1e38f };
     void GlyphRunAccumulateBounds(const ID2D1DeviceContext* d2dRenderTarget, D2D1_POINT_2F baselineOrigin, const DWRITE_GLYPH_RUN* glyphRun, D2D1_RECT_F& bounds);
 
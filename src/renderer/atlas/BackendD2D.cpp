@@ -193,6 +193,16 @@ void BackendD2D::_drawText(RenderingPayload& p)
             auto it = colorsBegin + m.glyphsFrom;
             const auto end = colorsBegin + m.glyphsTo;
 
+            // Rows that alternate between a few colors every couple of cells (colored
+            // prompts, syntax highlighted output, etc.) would degrade into one tiny
+            // DrawGlyphRun call per cell below. Draw such mappings with one merged
+            // call per distinct color instead.
+            if (m.fontFace && std::find_if(it, end, [c = *it](u32 color) { return color != c; }) != end)
+            {
+                baselineX = _drawTextBatchedRuns(p, row, m, baselineX, baselineY);
+                continue;
+            }
+
             while (it != end)
             {
                 const auto beg = it;
@@ -250,6 +260,13 @@ void BackendD2D::_drawText(RenderingPayload& p)
                         }
                     }
                 }
+                else
+                {
+                    // A null font face marks builtin glyphs (block elements, braille patterns),
+                    // which we draw as plain rectangles ourselves; see GetBuiltinGlyphParts.
+                    // (Soft font glyphs land here as well, but BackendD2D doesn't support those.)
+                    _drawBuiltinGlyphs(p, glyphRun, baselineOrigin, brush);
+                }
 
                 for (UINT32 i = 0; i < glyphRun.glyphCount; ++i)
                 {
@@ -284,6 +301,113 @@ void BackendD2D::_drawText(RenderingPayload& p)
     }
 }
 
+// Draws a multi-colored mapping with one DrawGlyphRun call per distinct color, rather
+// than one per same-colored span. Glyphs that belong to another color are skipped by
+// folding their width into the advance of the preceding glyph, so a merged run still
+// positions all of its glyphs correctly with a single call. The cost is linear in the
+// number of distinct colors, which in practice is 2 or 3 (prompt decorations, etc.).
+f32 BackendD2D::_drawTextBatchedRuns(const RenderingPayload& p, ShapedRow* row, const FontMapping& m, f32 baselineX, f32 baselineY)
+{
+    const auto count = m.glyphsTo - m.glyphsFrom;
+
+    if (count > _batchGlyphIndices.size())
+    {
+        _batchGlyphIndices = Buffer<u16>{ count };
+        _batchGlyphAdvances = Buffer<f32>{ count };
+        _batchGlyphOffsets = Buffer<DWRITE_GLYPH_OFFSET>{ count };
+        _batchGlyphsDrawn = Buffer<bool>{ count };
+    }
+
+    memset(_batchGlyphsDrawn.data(), 0, count);
+
+    D2D1_RECT_F bounds = GlyphRunEmptyBounds;
+    // The advance of all glyphs in [m.glyphsFrom, m.glyphsFrom + next).
+    // Once the loop is done, this is the total advance of the mapping.
+    f32 prefixAdvance = 0;
+    u32 next = 0; // the first glyph that hasn't been drawn yet
+
+    while (next < count)
+    {
+        const auto fg = row->colors[m.glyphsFrom + next];
+        // The advance of all skipped glyphs between `next` and the first glyph of this color.
+        f32 startOffset = 0;
+        u32 len = 0;
+
+        for (auto i = next; i < count; ++i)
+        {
+            const auto idx = m.glyphsFrom + i;
+            const auto advance = row->glyphAdvances[idx];
+
+            if (!_batchGlyphsDrawn[i] && row->colors[idx] == fg)
+            {
+                _batchGlyphsDrawn[i] = true;
+                _batchGlyphIndices[len] = row->glyphIndices[idx];
+                _batchGlyphAdvances[len] = advance;
+                _batchGlyphOffsets[len] = row->glyphOffsets[idx];
+                ++len;
+            }
+            else if (len == 0)
+            {
+                startOffset += advance;
+            }
+            else
+            {
+                _batchGlyphAdvances[len - 1] += advance;
+            }
+        }
+
+        const auto brush = _brushWithColor(fg);
+        const DWRITE_GLYPH_RUN glyphRun{
+            .fontFace = m.fontFace.get(),
+            .fontEmSize = p.s->font->fontSize,
+            .glyphCount = len,
+            .glyphIndices = _batchGlyphIndices.data(),
+            .glyphAdvances = _batchGlyphAdvances.data(),
+            .glyphOffsets = _batchGlyphOffsets.data(),
+        };
+        const D2D1_POINT_2F baselineOrigin{
+            baselineX + prefixAdvance + startOffset,
+            baselineY,
+        };
+
+        if (const auto enumerator = TranslateColorGlyphRun(p.dwriteFactory4.get(), baselineOrigin, &glyphRun))
+        {
+            while (ColorGlyphRunMoveNext(enumerator.get()))
+            {
+                const auto colorGlyphRun = ColorGlyphRunGetCurrentRun(enumerator.get());
+                ColorGlyphRunDraw(_renderTarget4.get(), _emojiBrush.get(), brush, colorGlyphRun);
+                ColorGlyphRunAccumulateBounds(_renderTarget.get(), colorGlyphRun, bounds);
+            }
+        }
+        else
+        {
+            _renderTarget->DrawGlyphRun(baselineOrigin, &glyphRun, brush, DWRITE_MEASURING_MODE_NATURAL);
+            GlyphRunAccumulateBounds(_renderTarget.get(), baselineOrigin, &glyphRun, bounds);
+        }
+
+        while (next < count && _batchGlyphsDrawn[next])
+        {
+            prefixAdvance += row->glyphAdvances[m.glyphsFrom + next];
+            ++next;
+        }
+    }
+
+    if (bounds.top < bounds.bottom)
+    {
+        // Since we used SetUnitMode(D2D1_UNIT_MODE_PIXELS), bounds.top/bottom is in pixels already and requires no conversion/rounding.
+        if (row->lineRendition != LineRendition::DoubleHeightTop)
+        {
+            row->dirtyBottom = std::max(row->dirtyBottom, static_cast<i32>(lrintf(bounds.bottom)));
+        }
+        if (row->lineRendition != LineRendition::DoubleHeightBottom)
+        {
+            row->dirtyTop = std::min(row->dirtyTop, static_cast<i32>(lrintf(bounds.top)));
+        }
+    }
+
+    return baselineX + prefixAdvance;
+}
+
 f32 BackendD2D::_drawTextPrepareLineRendition(const RenderingPayload& p, const ShapedRow* row, f32 baselineY) const noexcept
 {
     const auto lineRendition = row->lineRendition;
@@ -332,6 +456,41 @@ void BackendD2D::_drawTextResetLineRendition(const ShapedRow* row) const noexcep
     }
 }
 
+// Draws a run of builtin glyphs (block elements, braille patterns) as plain rectangles;
+// see GetBuiltinGlyphParts. The edges are rounded to whole pixels, so that neighboring
+// cells of a braille graph or progress bar always join without a seam.
+void BackendD2D::_drawBuiltinGlyphs(const RenderingPayload& p, const DWRITE_GLYPH_RUN& glyphRun, D2D1_POINT_2F baselineOrigin, ID2D1Brush* brush) const noexcept
+{
+    const auto cellHeight = static_cast<f32>(p.s->font->cellSize.y);
+    const auto top = baselineOrigin.y - p.s->font->baseline;
+    auto left = baselineOrigin.x;
+
+    for (UINT32 i = 0; i < glyphRun.glyphCount; ++i)
+    {
+        const auto width = glyphRun.glyphAdvances[i];
+
+        if (isBuiltinGlyph(glyphRun.glyphIndices[i]))
+        {
+            std::array<BuiltinGlyphPart, 8> parts{};
+            const auto partsCount = GetBuiltinGlyphParts(glyphRun.glyphIndices[i], parts);
+
+            for (size_t j = 0; j < partsCount; ++j)
+            {
+                const auto& part = parts[j];
+                const D2D1_RECT_F rect{
+                    left + roundf(width * part.x / 16.0f),
+                    top + roundf(cellHeight * part.y / 16.0f),
+                    left + roundf(width * (part.x + part.w) / 16.0f),
+                    top + roundf(cellHeight * (part.y + part.h) / 16.0f),
+                };
+                _renderTarget->FillRectangle(&rect, brush);
+            }
+        }
+
+        left += width;
+    }
+}
+
 // Returns the theoretical/design design size of the given `DWRITE_GLYPH_RUN`, relative the given baseline origin.
 // This algorithm replicates what DirectWrite does internally to provide `IDWriteTextLayout::GetMetrics`.
 f32r BackendD2D::_getGlyphRunDesignBounds(const DWRITE_GLYPH_RUN& glyphRun, f32 baselineX, f32 baselineY)
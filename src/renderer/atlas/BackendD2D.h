@@ -21,6 +21,8 @@ namespace Microsoft::Console::Render::Atlas
         void _drawText(RenderingPayload& p);
         ATLAS_ATTR_COLD f32 _drawTextPrepareLineRendition(const RenderingPayload& p, const ShapedRow* row, f32 baselineY) const noexcept;
         ATLAS_ATTR_COLD void _drawTextResetLineRendition(const ShapedRow* row) const noexcept;
+        void _drawBuiltinGlyphs(const RenderingPayload& p, const DWRITE_GLYPH_RUN& glyphRun, D2D1_POINT_2F baselineOrigin, ID2D1Brush* brush) const noexcept;
+        f32 _drawTextBatchedRuns(const RenderingPayload& p, ShapedRow* row, const FontMapping& m, f32 baselineX, f32 baselineY);
         ATLAS_ATTR_COLD f32r _getGlyphRunDesignBounds(const DWRITE_GLYPH_RUN& glyphRun, f32 baselineX, f32 baselineY);
         ATLAS_ATTR_COLD void _drawGridlineRow(const RenderingPayload& p, const ShapedRow* row, u16 y);
         void _drawCursorPart1(const RenderingPayload& p);
@@ -50,6 +52,12 @@ namespace Microsoft::Console::Render::Atlas
 
         Buffer<DWRITE_GLYPH_METRICS> _glyphMetrics;
 
+        // Scratch buffers for _drawTextBatchedRuns().
+        Buffer<u16> _batchGlyphIndices;
+        Buffer<f32> _batchGlyphAdvances;
+        Buffer<DWRITE_GLYPH_OFFSET> _batchGlyphOffsets;
+        Buffer<bool> _batchGlyphsDrawn;
+
         til::generation_t _generation;
         til::generation_t _fontGeneration;
         til::generation_t _cursorGeneration;
@@ -4,6 +4,8 @@
 #include "pch.h"
 #include "BackendD3D.h"
 
+#include <til/hash.h>
+
 #include <custom_shader_ps.h>
 #include <custom_shader_vs.h>
 #include <shader_ps.h>
@@ -224,6 +226,8 @@ void BackendD3D::Render(RenderingPayload& p)
     _debugUpdateShaders(p);
 #endif
 
+    _updateCustomShader(p);
+
     // After a Present() the render target becomes unbound.
     p.deviceContext->OMSetRenderTargets(1, _customRenderTargetView ? _customRenderTargetView.addressof() : _renderTargetView.addressof(), nullptr);
 
@@ -235,25 +239,138 @@ void BackendD3D::Render(RenderingPayload& p)
     }
 #endif
 
+    // If an ETW session listens to our provider (wpr.exe, traceview.exe, ...), we measure
+    // how long each pass takes on the CPU, as well as the GPU cost of the entire frame via
+    // timestamp queries, and emit it all as one event per frame. Together with the "Frame"
+    // event in AtlasEngine::Present this makes jank attributable per stage in field traces.
+    // None of this costs anything while no session is listening.
+    const auto instrumented = TraceLoggingProviderEnabled(g_hAtlasEngineTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE);
+    std::chrono::steady_clock::time_point cpuTimes[4];
+    size_t cpuTimeCount = 0;
+    const auto recordCpuTime = [&]() noexcept {
+        if (instrumented && cpuTimeCount < std::size(cpuTimes))
+        {
+            cpuTimes[cpuTimeCount++] = std::chrono::steady_clock::now();
+        }
+    };
+
+    if (instrumented)
+    {
+        _beginGpuInstrumentation(p);
+    }
+
+    recordCpuTime();
     _drawBackground(p);
     _drawCursorBackground(p);
     _drawText(p);
     _drawSelection(p);
+    recordCpuTime();
 #if ATLAS_DEBUG_SHOW_DIRTY
     _debugShowDirty(p);
 #endif
     _flushQuads(p);
+    recordCpuTime();
 
     if (_customPixelShader)
     {
         _executeCustomShader(p);
     }
+    recordCpuTime();
+
+    _shrinkInstanceBuffers(p);
+
+    if (instrumented)
+    {
+        const auto gpuMicroseconds = _endGpuInstrumentation(p);
+        const auto microseconds = [&](size_t beg, size_t end) noexcept {
+            return std::chrono::duration_cast<std::chrono::microseconds>(cpuTimes[end] - cpuTimes[beg]).count();
+        };
+
+#pragma warning(suppress : 26477 26485 26494 26482 26446 26447) // We don't control TraceLoggingWrite
+        TraceLoggingWrite(
+            g_hAtlasEngineTraceProvider,
+            "RenderPasses",
+            TraceLoggingInt64(microseconds(0, 1), "instanceGenerationMicroseconds"),
+            TraceLoggingInt64(microseconds(1, 2), "drawMicroseconds"),
+            TraceLoggingInt64(microseconds(2, 3), "customShaderMicroseconds"),
+            TraceLoggingUInt64(gpuMicroseconds, "gpuMicroseconds"),
+            TraceLoggingUInt64(_instanceBufferHighWaterMark, "instanceBufferHighWaterMark"),
+            TraceLoggingUInt64(_instanceBufferCapacity, "instanceBufferCapacity"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+    }
 
 #if ATLAS_DEBUG_DUMP_RENDER_TARGET
     _debugDumpRenderTarget(p);
 #endif
 }
 
+void BackendD3D::_beginGpuInstrumentation(const RenderingPayload& p)
+{
+    auto& q = _timestampQueries[_timestampQueriesIndex];
+
+    if (!q.disjoint)
+    {
+        static constexpr D3D11_QUERY_DESC disjointDesc{ D3D11_QUERY_TIMESTAMP_DISJOINT };
+        static constexpr D3D11_QUERY_DESC timestampDesc{ D3D11_QUERY_TIMESTAMP };
+        THROW_IF_FAILED(p.device->CreateQuery(&disjointDesc, q.disjoint.addressof()));
+        THROW_IF_FAILED(p.device->CreateQuery(&timestampDesc, q.begin.addressof()));
+        THROW_IF_FAILED(p.device->CreateQuery(&timestampDesc, q.end.addressof()));
+    }
+
+    // If the slot is still pending, its results weren't ready when we last looked at it
+    // in _endGpuInstrumentation. Don't issue it again - we'll poll it again eventually.
+    if (!q.pending)
+    {
+        p.deviceContext->Begin(q.disjoint.get());
+        p.deviceContext->End(q.begin.get());
+    }
+}
+
+uint64_t BackendD3D::_endGpuInstrumentation(const RenderingPayload& p) noexcept
+{
+    {
+        auto& q = _timestampQueries[_timestampQueriesIndex];
+        if (!q.pending)
+        {
+            p.deviceContext->End(q.end.get());
+            p.deviceContext->End(q.disjoint.get());
+            q.pending = true;
+        }
+    }
+
+    _timestampQueriesIndex ^= 1;
+
+    // The other slot was issued a frame (or longer) ago, so its results
+    // should be ready by now. If they aren't, we simply don't reuse the slot
+    // and report 0. Stalling the render thread with a flush would be worse.
+    auto& q = _timestampQueries[_timestampQueriesIndex];
+    uint64_t gpuMicroseconds = 0;
+
+    if (q.pending)
+    {
+        D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint{};
+        uint64_t beginTime = 0;
+        uint64_t endTime = 0;
+
+        if (p.deviceContext->GetData(q.disjoint.get(), &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK &&
+            p.deviceContext->GetData(q.begin.get(), &beginTime, sizeof(beginTime), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK &&
+            p.deviceContext->GetData(q.end.get(), &endTime, sizeof(endTime), D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK)
+        {
+            q.pending = false;
+
+            // The counter may have been disjoint (power events, overclocking, ...),
+            // in which case the two timestamps aren't comparable.
+            if (!disjoint.Disjoint && disjoint.Frequency)
+            {
+                gpuMicroseconds = (endTime - beginTime) * 1'000'000 / disjoint.Frequency;
+            }
+        }
+    }
+
+    return gpuMicroseconds;
+}
+
 bool BackendD3D::RequiresContinuousRedraw() noexcept
 {
     return _requiresContinuousRedraw;
@@ -278,7 +395,7 @@ void BackendD3D::_handleSettingsUpdate(const RenderingPayload& p)
     }
     if (miscChanged)
     {
-        _recreateCustomShader(p);
+        _recreateCustomShader(p, true);
     }
     if (cellCountChanged)
     {
@@ -379,8 +496,71 @@ void BackendD3D::_d2dRenderTargetUpdateFontSettings(const RenderingPayload& p) c
     _d2dRenderTarget->SetTextAntialiasMode(static_cast<D2D1_TEXT_ANTIALIAS_MODE>(font.antialiasingMode));
 }
 
-void BackendD3D::_recreateCustomShader(const RenderingPayload& p)
+// Best effort: returns the contents of the given file, or an empty vector.
+static std::vector<char> readBinaryFile(const wchar_t* path)
+{
+    const wil::unique_hfile file{ CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+    LARGE_INTEGER size{};
+
+    // Shader sources and bytecode are tiny. Anything bigger than a few MB is not ours.
+    if (!file || !GetFileSizeEx(file.get(), &size) || size.QuadPart <= 0 || size.QuadPart > 0x1000000)
+    {
+        return {};
+    }
+
+    std::vector<char> buffer(gsl::narrow_cast<size_t>(size.QuadPart));
+    DWORD read = 0;
+    if (!ReadFile(file.get(), buffer.data(), gsl::narrow_cast<DWORD>(buffer.size()), &read, nullptr) || read != buffer.size())
+    {
+        return {};
+    }
+    return buffer;
+}
+
+static void writeBinaryFile(const wchar_t* path, const void* data, size_t size) noexcept
+{
+    const wil::unique_hfile file{ CreateFileW(path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr) };
+    if (file)
+    {
+        DWORD written = 0;
+        WriteFile(file.get(), data, gsl::narrow_cast<DWORD>(size), &written, nullptr);
+    }
+}
+
+// Returns where the compiled bytecode for the given shader source and compile
+// parameters is cached on disk, or an empty path if there's no cache directory.
+static std::filesystem::path customShaderCachePath(const std::vector<char>& source, const char* target, u32 flags)
+{
+    wchar_t localAppData[MAX_PATH];
+    if (!GetEnvironmentVariableW(L"LOCALAPPDATA", &localAppData[0], MAX_PATH))
+    {
+        return {};
+    }
+
+    til::hasher h;
+    h.write(source.data(), source.size());
+    h.write(target, strlen(target));
+    h.write(flags);
+    // D3DCompiler_47.dll gets updated in place. D3D_COMPILER_VERSION only tracks major
+    // releases, but a stale cache entry merely misses out on newer codegen.
+    h.write(static_cast<u32>(D3D_COMPILER_VERSION));
+
+    wchar_t name[32];
+    swprintf_s(name, L"%016llx.cso", static_cast<unsigned long long>(h.finalize()));
+
+    std::error_code ec;
+    auto dir = std::filesystem::path{ &localAppData[0] } / L"Microsoft" / L"Windows Terminal" / L"ShaderCache";
+    std::filesystem::create_directories(dir, ec);
+    if (ec)
+    {
+        return {};
+    }
+    return dir / &name[0];
+}
+
+void BackendD3D::_recreateCustomShader(const RenderingPayload& p, bool useCache)
 {
+    _customShaderWatcher.reset();
     _customRenderTargetView.reset();
     _customOffscreenTexture.reset();
     _customOffscreenTextureView.reset();
@@ -420,26 +600,73 @@ void BackendD3D::_recreateCustomShader(const RenderingPayload& p)
             | D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_WARNINGS_ARE_ERRORS | D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
 #endif
 
-        wil::com_ptr<ID3DBlob> error;
-        wil::com_ptr<ID3DBlob> blob;
-        const auto hr = D3DCompileFromFile(
-            /* pFileName   */ p.s->misc->customPixelShaderPath.c_str(),
-            /* pDefines    */ nullptr,
-            /* pInclude    */ D3D_COMPILE_STANDARD_FILE_INCLUDE,
-            /* pEntrypoint */ "main",
-            /* pTarget     */ target,
-            /* Flags1      */ flags,
-            /* Flags2      */ 0,
-            /* ppCode      */ blob.addressof(),
-            /* ppErrorMsgs */ error.addressof());
+        // Compiling a shader takes a couple hundred milliseconds, which is long enough
+        // to noticeably delay the first frame of every new pane with a retro shader.
+        // The compiled bytecode is thus cached on disk, keyed by the source contents,
+        // the compile parameters and the compiler version. #include'd files aren't part
+        // of the key, which is why the hot reload path (useCache=false) always recompiles.
+        const auto source = readBinaryFile(p.s->misc->customPixelShaderPath.c_str());
+        std::filesystem::path cachePath;
+        std::vector<char> bytecode;
+
+        if (!source.empty())
+        {
+            cachePath = customShaderCachePath(source, target, flags);
+        }
+        if (useCache && !cachePath.empty())
+        {
+            bytecode = readBinaryFile(cachePath.c_str());
+        }
+
+        if (bytecode.empty())
+        {
+            wil::com_ptr<ID3DBlob> error;
+            wil::com_ptr<ID3DBlob> blob;
+            const auto hr = D3DCompileFromFile(
+                /* pFileName   */ p.s->misc->customPixelShaderPath.c_str(),
+                /* pDefines    */ nullptr,
+                /* pInclude    */ D3D_COMPILE_STANDARD_FILE_INCLUDE,
+                /* pEntrypoint */ "main",
+                /* pTarget     */ target,
+                /* Flags1      */ flags,
+                /* Flags2      */ 0,
+                /* ppCode      */ blob.addressof(),
+                /* ppErrorMsgs */ error.addressof());
+
+            if (SUCCEEDED(hr))
+            {
+                const auto data = static_cast<const char*>(blob->GetBufferPointer());
+                bytecode.assign(data, data + blob->GetBufferSize());
+
+                if (!cachePath.empty())
+                {
+                    writeBinaryFile(cachePath.c_str(), bytecode.data(), bytecode.size());
+                }
+            }
+            else
+            {
+                if (error)
+                {
+                    LOG_HR_MSG(hr, "%*hs", error->GetBufferSize(), error->GetBufferPointer());
+                }
+                else
+                {
+                    LOG_HR(hr);
+                }
+                if (p.warningCallback)
+                {
+                    p.warningCallback(D2DERR_SHADER_COMPILE_FAILED);
+                }
+            }
+        }
 
-        if (SUCCEEDED(hr))
+        if (!bytecode.empty())
         {
-            THROW_IF_FAILED(p.device->CreatePixelShader(blob->GetBufferPointer(), blob->GetBufferSize(), nullptr, _customPixelShader.addressof()));
+            THROW_IF_FAILED(p.device->CreatePixelShader(bytecode.data(), bytecode.size(), nullptr, _customPixelShader.addressof()));
 
             // Try to determine whether the shader uses the Time variable
             wil::com_ptr<ID3D11ShaderReflection> reflector;
-            if (SUCCEEDED_LOG(D3DReflect(blob->GetBufferPointer(), blob->GetBufferSize(), IID_PPV_ARGS(reflector.addressof()))))
+            if (SUCCEEDED_LOG(D3DReflect(bytecode.data(), bytecode.size(), IID_PPV_ARGS(reflector.addressof()))))
             {
                 // Depending on the version of the d3dcompiler_*.dll, the next two functions either return nullptr
                 // on failure or an instance of CInvalidSRConstantBuffer or CInvalidSRVariable respectively,
@@ -464,21 +691,20 @@ void BackendD3D::_recreateCustomShader(const RenderingPayload& p)
                 _requiresContinuousRedraw = true;
             }
         }
-        else
-        {
-            if (error)
-            {
-                LOG_HR_MSG(hr, "%*hs", error->GetBufferSize(), error->GetBufferPointer());
-            }
-            else
-            {
-                LOG_HR(hr);
-            }
-            if (p.warningCallback)
-            {
-                p.warningCallback(D2DERR_SHADER_COMPILE_FAILED);
-            }
-        }
+
+        // Watch the shader's directory so that editing the file (or any of its #include's,
+        // which commonly live right next to it) swaps the pixel shader in on the next frame.
+        // The watcher is set up even if the compilation failed, so that fixing the mistake
+        // gets picked up as well. Since _executeCustomShader() binds the shader on every
+        // frame anyway, no other resources need to be recreated for the swap.
+        const auto directory = std::filesystem::path{ p.s->misc->customPixelShaderPath }.parent_path();
+        _customShaderWatcher = wil::make_folder_change_reader_nothrow(directory.c_str(), false, wil::FolderChangeEvents::FileName | wil::FolderChangeEvents::LastWriteTime, [this](wil::FolderChangeEvent, PCWSTR) {
+            // Updating the invalidation time with the compare_exchange saves us from
+            // constantly recompiling when the file is written to in rapid succession.
+            auto expected = INT64_MAX;
+            const auto invalidationTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+            _customShaderInvalidationTime.compare_exchange_strong(expected, invalidationTime.time_since_epoch().count(), std::memory_order_relaxed);
+        });
     }
     else if (p.s->misc->useRetroTerminalEffect)
     {
@@ -516,6 +742,29 @@ void BackendD3D::_recreateCustomShader(const RenderingPayload& p)
     }
 }
 
+void BackendD3D::_updateCustomShader(const RenderingPayload& p) noexcept
+try
+{
+    const auto invalidationTime = _customShaderInvalidationTime.load(std::memory_order_relaxed);
+
+    if (invalidationTime == INT64_MAX || invalidationTime > std::chrono::steady_clock::now().time_since_epoch().count())
+    {
+        return;
+    }
+
+    _customShaderInvalidationTime.store(INT64_MAX, std::memory_order_relaxed);
+
+    // The bytecode cache is only keyed off of the main source file,
+    // but the edit may have been made to an #include'd file.
+    _recreateCustomShader(p, false);
+
+    if (_customPixelShader && !_customRenderTargetView)
+    {
+        _recreateCustomRenderTargetView(p);
+    }
+}
+CATCH_LOG()
+
 void BackendD3D::_recreateCustomRenderTargetView(const RenderingPayload& p)
 {
     // Avoid memory usage spikes by releasing memory first.
@@ -767,6 +1016,13 @@ void BackendD3D::_resetGlyphAtlas(const RenderingPayload& p)
         if (slot.inner)
         {
             slot.inner->glyphs.clear();
+            // A font/DPI change invalidates the rasterized glyphs, so the ASCII set should
+            // be prewarmed again. If we got here via _drawGlyphPrepareRetry however, the
+            // atlas is under memory pressure and prewarming would just cause more retries.
+            if (_fontChangedResetGlyphAtlas)
+            {
+                slot.inner->prewarmed = false;
+            }
         }
     }
 
@@ -889,12 +1145,13 @@ void BackendD3D::_flushQuads(const RenderingPayload& p)
         _drawCursorForeground();
     }
 
-    // TODO: Shrink instances buffer
     if (_instancesCount > _instanceBufferCapacity)
     {
-        _recreateInstanceBuffers(p);
+        _recreateInstanceBuffers(p, _instancesCount);
     }
 
+    _instanceBufferHighWaterMark = std::max(_instanceBufferHighWaterMark, _instancesCount);
+
     {
         D3D11_MAPPED_SUBRESOURCE mapped{};
         THROW_IF_FAILED(p.deviceContext->Map(_instanceBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
@@ -925,11 +1182,11 @@ void BackendD3D::_flushQuads(const RenderingPayload& p)
     _instancesCount = 0;
 }
 
-void BackendD3D::_recreateInstanceBuffers(const RenderingPayload& p)
+void BackendD3D::_recreateInstanceBuffers(const RenderingPayload& p, size_t minInstanceCount)
 {
     // We use the viewport size of the terminal as the initial estimate for the amount of instances we'll see.
     const auto minCapacity = static_cast<size_t>(p.s->viewportCellCount.x) * p.s->viewportCellCount.y;
-    auto newCapacity = std::max(_instancesCount, minCapacity);
+    auto newCapacity = std::max(minInstanceCount, minCapacity);
     auto newSize = newCapacity * sizeof(QuadInstance);
     // Round up to multiples of 64kB to avoid reallocating too often.
     // 64kB is the minimum alignment for committed resources in D3D12.
@@ -958,6 +1215,34 @@ void BackendD3D::_recreateInstanceBuffers(const RenderingPayload& p)
     _instanceBufferCapacity = newCapacity;
 }
 
+// A single glyph storm (a full screen of overlap-split box drawing glyphs on a 4K display
+// and the like) can leave us with an instance buffer many times larger than what steady
+// state frames need, and one of these buffers exists per pane. This checks the high-water
+// mark every 256 frames and right-sizes the buffer if we consistently use less than a
+// quarter of it. 256 frames is long enough to never thrash on a buffer that's actually
+// in use, and short enough that the memory doesn't stick around for the rest of the session.
+void BackendD3D::_shrinkInstanceBuffers(const RenderingPayload& p)
+{
+    if (--_instanceBufferShrinkCountdown != 0)
+    {
+        return;
+    }
+    _instanceBufferShrinkCountdown = 256;
+
+    // _recreateInstanceBuffers rounds capacities up to multiples of 64kB,
+    // so the comparison needs to be done with the rounded size as well.
+    const auto minCapacity = static_cast<size_t>(p.s->viewportCellCount.x) * p.s->viewportCellCount.y;
+    auto wantedSize = std::max(_instanceBufferHighWaterMark, minCapacity) * sizeof(QuadInstance);
+    wantedSize = (wantedSize + 0xffff) & ~size_t{ 0xffff };
+
+    if (wantedSize * 4 <= _instanceBufferCapacity * sizeof(QuadInstance))
+    {
+        _recreateInstanceBuffers(p, _instanceBufferHighWaterMark);
+    }
+
+    _instanceBufferHighWaterMark = 0;
+}
+
 void BackendD3D::_drawBackground(const RenderingPayload& p)
 {
     // Not uploading the bitmap halves (!) the GPU load for any given frame on 2023 hardware.
@@ -1042,6 +1327,11 @@ void BackendD3D::_drawText(RenderingPayload& p)
                 _initializeFontFaceEntry(fontFaceEntry);
             }
 
+            if (!fontFaceEntry.prewarmed)
+            {
+                _prewarmGlyphAtlas(p, fontFaceEntry);
+            }
+
             while (x < m.glyphsTo)
             {
                 const auto [glyphEntry, inserted] = fontFaceEntry.glyphs.insert(row->glyphIndices[x]);
@@ -1208,6 +1498,11 @@ void BackendD3D::_initializeFontFaceEntry(AtlasFontFaceEntryInner& fontFaceEntry
         return;
     }
 
+    // IsColorFont() tells us whether the font contains any color tables at all (COLR,
+    // SVG, sbix, ...). If it doesn't, TranslateColorGlyphRun() can never return an
+    // enumerator for its glyphs, and _drawGlyph doesn't need to ask for each of them.
+    fontFaceEntry.isColorFont = fontFaceEntry.fontFace->IsColorFont();
+
     ALLOW_UNINITIALIZED_BEGIN
     std::array<u32, 0x100> codepoints;
     std::array<u16, 0x100> indices;
@@ -1229,11 +1524,71 @@ void BackendD3D::_initializeFontFaceEntry(AtlasFontFaceEntryInner& fontFaceEntry
     }
 }
 
+// Rasterizes the printable ASCII set for the given font face in one go. Practically every
+// new pane starts out by drawing a screenful of mostly ASCII text, and after a font or DPI
+// change the entire set needs to be rasterized again anyway. Doing it in a single batch
+// amortizes the D2D BeginDraw/EndDraw overhead across all glyphs and ensures that later
+// frames (scrolling, typing) don't trickle in additional rasterization passes for them.
+void BackendD3D::_prewarmGlyphAtlas(const RenderingPayload& p, AtlasFontFaceEntryInner& fontFaceEntry)
+{
+    fontFaceEntry.prewarmed = true;
+
+    // Soft fonts have no font face and double-width/height glyphs are far too rare to prewarm.
+    if (!fontFaceEntry.fontFace || fontFaceEntry.lineRendition != LineRendition::SingleWidth)
+    {
+        return;
+    }
+
+    static constexpr u32 codepointCount = 0x7f - 0x20;
+
+    // _resetGlyphAtlas() sizes the atlas to hold at least all printable ASCII characters,
+    // but the swap chain based clamp may shrink it below that if the window is tiny while
+    // the font is huge. Don't fight with the actual frame contents over the remaining space.
+    const auto cellArea = static_cast<u32>(p.s->font->cellSize.x) * p.s->font->cellSize.y;
+    const auto atlasArea = static_cast<u32>(_rectPacker.width) * _rectPacker.height;
+    if (atlasArea < cellArea * codepointCount * 2)
+    {
+        return;
+    }
+
+    ALLOW_UNINITIALIZED_BEGIN
+    std::array<u32, codepointCount> codepoints;
+    std::array<u16, codepointCount> indices;
+    ALLOW_UNINITIALIZED_END
+
+    for (u32 i = 0; i < codepoints.size(); ++i)
+    {
+        codepoints[i] = 0x20 + i;
+    }
+
+    THROW_IF_FAILED(fontFaceEntry.fontFace->GetGlyphIndicesW(codepoints.data(), codepoints.size(), indices.data()));
+
+    for (const auto idx : indices)
+    {
+        // Font fallback faces commonly cover none of ASCII, in which case
+        // GetGlyphIndicesW() returns the .notdef glyph 0 --> nothing to prewarm.
+        if (!idx)
+        {
+            continue;
+        }
+
+        const auto [glyphEntry, inserted] = fontFaceEntry.glyphs.insert(idx);
+
+        if (inserted && !_drawGlyph(p, fontFaceEntry, glyphEntry))
+        {
+            // _drawGlyph() failed to pack the glyph and reset the atlas, which cleared
+            // `glyphs`. Prewarming isn't worth a second reset --> bail out and let the
+            // retry loop in _drawText() rasterize just the glyphs it actually needs.
+            break;
+        }
+    }
+}
+
 bool BackendD3D::_drawGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry)
 {
     if (!fontFaceEntry.fontFace)
     {
-        return _drawSoftFontGlyph(p, fontFaceEntry, glyphEntry);
+        return isBuiltinGlyph(glyphEntry.glyphIndex) ? _drawBuiltinGlyph(p, fontFaceEntry, glyphEntry) : _drawSoftFontGlyph(p, fontFaceEntry, glyphEntry);
     }
 
     const DWRITE_GLYPH_RUN glyphRun{
@@ -1379,6 +1734,15 @@ bool BackendD3D::_drawGlyph(const RenderingPayload& p, const AtlasFontFaceEntryI
         }
     });
 
+    // TranslateColorGlyphRun() costs a couple microseconds even when it just returns
+    // DWRITE_E_NOCOLOR, which adds up on frames that introduce hundreds of new glyphs
+    // at once (think first paint of CJK logs). We can only skip asking when the font
+    // has no color tables whatsoever, which _initializeFontFaceEntry cached for us.
+    if (!fontFaceEntry.isColorFont)
+    {
+        THROW_IF_FAILED(_d2dRenderTarget->GetGlyphRunWorldBounds({}, &glyphRun, DWRITE_MEASURING_MODE_NATURAL, &bounds));
+    }
+    else
     {
         const auto enumerator = TranslateColorGlyphRun(p.dwriteFactory4.get(), {}, &glyphRun);
 
@@ -1508,6 +1872,81 @@ bool BackendD3D::_drawGlyph(const RenderingPayload& p, const AtlasFontFaceEntryI
     return true;
 }
 
+// Draws a builtin glyph (block elements, braille patterns) into the glyph atlas as a
+// handful of plain white rectangles; see GetBuiltinGlyphParts. Compared to letting the
+// font render them this is not just cheaper, it also snaps all edges to whole pixels:
+// Two neighboring cells of a braille graph or progress bar always join without a seam.
+bool BackendD3D::_drawBuiltinGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry)
+{
+    stbrp_rect rect{
+        .w = p.s->font->cellSize.x,
+        .h = p.s->font->cellSize.y,
+    };
+
+    const auto lineRendition = static_cast<LineRendition>(fontFaceEntry.lineRendition);
+    auto baseline = p.s->font->baseline;
+
+    if (lineRendition != LineRendition::SingleWidth)
+    {
+        const auto heightShift = static_cast<u8>(lineRendition >= LineRendition::DoubleHeightTop);
+        rect.w <<= 1;
+        rect.h <<= heightShift;
+        baseline <<= heightShift;
+    }
+
+    if (!stbrp_pack_rects(&_rectPacker, &rect, 1))
+    {
+        _drawGlyphPrepareRetry(p);
+        return false;
+    }
+
+    ALLOW_UNINITIALIZED_BEGIN
+    std::array<BuiltinGlyphPart, 8> parts;
+    ALLOW_UNINITIALIZED_END
+    const auto partsCount = GetBuiltinGlyphParts(glyphEntry.glyphIndex, parts);
+
+    _d2dBeginDrawing();
+
+    for (size_t i = 0; i < partsCount; ++i)
+    {
+        const auto& part = parts[i];
+        // Rounding to the nearest pixel is what gives us the perfect seams: The rounding
+        // is identical for all cells, and so two halves of a quadrant, or the left/right
+        // edges of two adjacent block elements, always end up on the exact same pixel.
+        auto l = (rect.w * part.x + 8) >> 4;
+        auto t = (rect.h * part.y + 8) >> 4;
+        auto r = (rect.w * (part.x + part.w) + 8) >> 4;
+        auto b = (rect.h * (part.y + part.h) + 8) >> 4;
+        // Braille dots would round down to nothing at tiny font sizes otherwise.
+        r += l == r;
+        b += t == b;
+
+        const D2D1_RECT_F rectF{
+            static_cast<f32>(rect.x + l),
+            static_cast<f32>(rect.y + t),
+            static_cast<f32>(rect.x + r),
+            static_cast<f32>(rect.y + b),
+        };
+        _d2dRenderTarget->FillRectangle(&rectF, _brush.get());
+    }
+
+    glyphEntry.data.shadingType = ShadingType::TextGrayscale;
+    glyphEntry.data.overlapSplit = 0;
+    glyphEntry.data.offset.x = 0;
+    glyphEntry.data.offset.y = -baseline;
+    glyphEntry.data.size.x = rect.w;
+    glyphEntry.data.size.y = rect.h;
+    glyphEntry.data.texcoord.x = rect.x;
+    glyphEntry.data.texcoord.y = rect.y;
+
+    if (lineRendition >= LineRendition::DoubleHeightTop)
+    {
+        _splitDoubleHeightGlyph(p, fontFaceEntry, glyphEntry);
+    }
+
+    return true;
+}
+
 bool BackendD3D::_drawSoftFontGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry)
 {
     stbrp_rect rect{
@@ -154,6 +154,11 @@ namespace Microsoft::Console::Render::Atlas
             // boxGlyphs gets an increased growth rate of 2^2 = 4x, because presumably fonts either contain very
             // few or almost all of the box glyphs. This reduces the cost of _initializeFontFaceEntry quite a bit.
             til::linear_flat_set<u16, 2, 2> boxGlyphs;
+            // Caches IDWriteFontFace2::IsColorFont. Monochrome fonts can never produce
+            // color glyph runs, which allows _drawGlyph to skip TranslateColorGlyphRun.
+            bool isColorFont = false;
+            // Whether _prewarmGlyphAtlas has rasterized the printable ASCII set for this entry.
+            bool prewarmed = false;
         };
 
         struct AtlasFontFaceEntry
@@ -196,7 +201,8 @@ namespace Microsoft::Console::Render::Atlas
         ATLAS_ATTR_COLD void _handleSettingsUpdate(const RenderingPayload& p);
         void _updateFontDependents(const RenderingPayload& p);
         void _d2dRenderTargetUpdateFontSettings(const RenderingPayload& p) const noexcept;
-        void _recreateCustomShader(const RenderingPayload& p);
+        void _recreateCustomShader(const RenderingPayload& p, bool useCache);
+        void _updateCustomShader(const RenderingPayload& p) noexcept;
         void _recreateCustomRenderTargetView(const RenderingPayload& p);
         void _recreateBackgroundColorBitmap(const RenderingPayload& p);
         void _recreateConstBuffer(const RenderingPayload& p) const;
@@ -212,13 +218,16 @@ namespace Microsoft::Console::Render::Atlas
         QuadInstance& _appendQuad();
         ATLAS_ATTR_COLD void _bumpInstancesSize();
         void _flushQuads(const RenderingPayload& p);
-        ATLAS_ATTR_COLD void _recreateInstanceBuffers(const RenderingPayload& p);
+        ATLAS_ATTR_COLD void _recreateInstanceBuffers(const RenderingPayload& p, size_t minInstanceCount);
+        void _shrinkInstanceBuffers(const RenderingPayload& p);
         void _drawBackground(const RenderingPayload& p);
         void _uploadBackgroundBitmap(const RenderingPayload& p);
         void _drawText(RenderingPayload& p);
         ATLAS_ATTR_COLD void _drawTextOverlapSplit(const RenderingPayload& p, u16 y);
         ATLAS_ATTR_COLD static void _initializeFontFaceEntry(AtlasFontFaceEntryInner& fontFaceEntry);
+        ATLAS_ATTR_COLD void _prewarmGlyphAtlas(const RenderingPayload& p, AtlasFontFaceEntryInner& fontFaceEntry);
         [[nodiscard]] ATLAS_ATTR_COLD bool _drawGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry);
+        bool _drawBuiltinGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry);
         bool _drawSoftFontGlyph(const RenderingPayload& p, const AtlasFontFaceEntryInner& fontFaceEntry, AtlasGlyphEntry& glyphEntry);
         void _drawSoftFontGlyphInBitmap(const RenderingPayload& p, const AtlasGlyphEntry& glyphEntry) const;
         void _drawGlyphPrepareRetry(const RenderingPayload& p);
@@ -229,6 +238,8 @@ namespace Microsoft::Console::Render::Atlas
         ATLAS_ATTR_COLD size_t _drawCursorForegroundSlowPath(const CursorRect& c, size_t offset);
         void _drawSelection(const RenderingPayload& p);
         void _executeCustomShader(RenderingPayload& p);
+        ATLAS_ATTR_COLD void _beginGpuInstrumentation(const RenderingPayload& p);
+        ATLAS_ATTR_COLD uint64_t _endGpuInstrumentation(const RenderingPayload& p) noexcept;
 
         wil::com_ptr<ID3D11RenderTargetView> _renderTargetView;
         wil::com_ptr<ID3D11InputLayout> _inputLayout;
@@ -243,6 +254,10 @@ namespace Microsoft::Console::Render::Atlas
         size_t _instanceBufferCapacity = 0;
         Buffer<QuadInstance, 32> _instances;
         size_t _instancesCount = 0;
+        // The largest _instancesCount seen since _shrinkInstanceBuffers last evaluated it.
+        // _flushQuads may run multiple times per frame, so this can't be tracked per frame.
+        size_t _instanceBufferHighWaterMark = 0;
+        u16 _instanceBufferShrinkCountdown = 256;
 
         wil::com_ptr<ID3D11RenderTargetView> _customRenderTargetView;
         wil::com_ptr<ID3D11Texture2D> _customOffscreenTexture;
@@ -252,6 +267,8 @@ namespace Microsoft::Console::Render::Atlas
         wil::com_ptr<ID3D11Buffer> _customShaderConstantBuffer;
         wil::com_ptr<ID3D11SamplerState> _customShaderSamplerState;
         std::chrono::steady_clock::time_point _customShaderStartTime;
+        wil::unique_folder_change_reader_nothrow _customShaderWatcher;
+        std::atomic<int64_t> _customShaderInvalidationTime{ INT64_MAX };
 
         wil::com_ptr<ID3D11Texture2D> _backgroundBitmap;
         wil::com_ptr<ID3D11ShaderResourceView> _backgroundBitmapView;
@@ -296,6 +313,19 @@ namespace Microsoft::Console::Render::Atlas
 
         bool _requiresContinuousRedraw = false;
 
+        // GPU timestamp queries measuring the GPU cost of an entire frame. They're double
+        // buffered so that resolving the results of frame N doesn't stall us during frame
+        // N+1, and they're only ever issued while an ETW session listens to our provider.
+        struct TimestampQueries
+        {
+            wil::com_ptr<ID3D11Query> disjoint;
+            wil::com_ptr<ID3D11Query> begin;
+            wil::com_ptr<ID3D11Query> end;
+            bool pending = false;
+        };
+        TimestampQueries _timestampQueries[2];
+        u8 _timestampQueriesIndex = 0;
+
 #if ATLAS_DEBUG_SHOW_DIRTY
         i32r _presentRects[9]{};
         size_t _presentRectsPos = 0;
@@ -3,12 +3,40 @@
 
 #pragma once
 
+#include <dxgi1_3.h>
+
 #include <til/mutex.h>
 
 namespace Microsoft::Console::Render::FontCache
 {
     namespace details
     {
+        inline wil::com_ptr<IDXGIFactory2> createDXGIFactory()
+        {
+#ifndef NDEBUG
+            static constexpr UINT flags = DXGI_CREATE_FACTORY_DEBUG;
+#else
+            static constexpr UINT flags = 0;
+#endif
+
+            wil::com_ptr<IDXGIFactory2> factory;
+// IID_PPV_ARGS doesn't work here for some reason.
+#pragma warning(suppress : 26496) // The variable 'hr' does not change after construction, mark it as const (con.4).
+            auto hr = CreateDXGIFactory2(flags, __uuidof(factory), factory.put_void());
+
+#ifndef NDEBUG
+            // This might be due to missing the "Graphics debugger and GPU profiler for
+            // DirectX" tools. Just as a sanity check, try again without
+            // `DXGI_CREATE_FACTORY_DEBUG`
+            if (FAILED(hr))
+            {
+                hr = CreateDXGIFactory2(0, __uuidof(factory), factory.put_void());
+            }
+#endif
+            THROW_IF_FAILED(hr);
+            return factory;
+        }
+
         inline wil::com_ptr<IDWriteFontCollection> getFontCollection()
         {
             wil::com_ptr<IDWriteFactory> factory;
@@ -90,4 +118,104 @@ namespace Microsoft::Console::Render::FontCache
         }
         return *guard;
     }
+
+    struct ResolvedFontMetrics
+    {
+        wil::com_ptr<IDWriteFontFamily> fontFamily;
+        DWRITE_FONT_METRICS metrics{};
+        UINT32 zeroGlyphAdvance = 0; // design units; the advance of "0", valid if hasZeroGlyph
+        bool hasZeroGlyph = false;
+    };
+
+    // Resolving a face name to a font family and its design metrics takes a
+    // handful of DirectWrite lookups that are identical for every pane showing
+    // the same font. Sharing the result means N panes pay for one resolution,
+    // for instance when a window full of panes crosses a DPI boundary. Design
+    // metrics are DPI- and size-independent, so entries stay valid across scale
+    // changes. They're keyed by collection instance; a fresh font collection
+    // (= a new font enumeration) naturally misses all old entries.
+    inline ResolvedFontMetrics GetCachedFontResolution(const wil::com_ptr<IDWriteFontCollection>& fontCollection, const wchar_t* faceName, DWRITE_FONT_WEIGHT weight)
+    {
+        struct CacheEntry
+        {
+            wil::com_ptr<IDWriteFontCollection> collection;
+            std::wstring faceName;
+            DWRITE_FONT_WEIGHT weight;
+            ResolvedFontMetrics resolved;
+        };
+        static til::shared_mutex<std::vector<CacheEntry>> cachedResolutions;
+
+        {
+            const auto guard = cachedResolutions.lock_shared();
+            for (const auto& entry : *guard)
+            {
+                if (entry.collection == fontCollection && entry.weight == weight && entry.faceName == faceName)
+                {
+                    return entry.resolved;
+                }
+            }
+        }
+
+        ResolvedFontMetrics resolved;
+
+        UINT32 index = 0;
+        BOOL exists = FALSE;
+        THROW_IF_FAILED(fontCollection->FindFamilyName(faceName, &index, &exists));
+        THROW_HR_IF(DWRITE_E_NOFONT, !exists);
+
+        THROW_IF_FAILED(fontCollection->GetFontFamily(index, resolved.fontFamily.addressof()));
+
+        wil::com_ptr<IDWriteFont> font;
+        THROW_IF_FAILED(resolved.fontFamily->GetFirstMatchingFont(weight, DWRITE_FONT_STRETCH_NORMAL, DWRITE_FONT_STYLE_NORMAL, font.addressof()));
+
+        wil::com_ptr<IDWriteFontFace> fontFace;
+        THROW_IF_FAILED(font->CreateFontFace(fontFace.addressof()));
+
+        fontFace->GetMetrics(&resolved.metrics);
+
+        // We use the same character to determine the advance width as CSS for its "ch" unit ("0").
+        {
+            static constexpr UINT32 codePoint = '0';
+
+            UINT16 glyphIndex;
+            THROW_IF_FAILED(fontFace->GetGlyphIndicesW(&codePoint, 1, &glyphIndex));
+
+            if (glyphIndex)
+            {
+                DWRITE_GLYPH_METRICS glyphMetrics{};
+                THROW_IF_FAILED(fontFace->GetDesignGlyphMetrics(&glyphIndex, 1, &glyphMetrics, FALSE));
+                resolved.zeroGlyphAdvance = glyphMetrics.advanceWidth;
+                resolved.hasZeroGlyph = true;
+            }
+        }
+
+        {
+            const auto guard = cachedResolutions.lock();
+            // A handful of entries covers every realistic multi-pane setup;
+            // drop the oldest ones once we're past that.
+            if (guard->size() >= 8)
+            {
+                guard->erase(guard->begin());
+            }
+            guard->push_back(CacheEntry{ fontCollection, faceName, weight, resolved });
+        }
+
+        return resolved;
+    }
+
+    // DXGI factories are process-wide state and every render engine needs one.
+    // Sharing a single instance avoids paying for its creation once per pane.
+    // A factory goes stale when the adapter topology changes (for instance when
+    // a graphics driver updates), in which case a fresh one is handed out.
+    inline wil::com_ptr<IDXGIFactory2> GetCachedDXGIFactory()
+    {
+        static til::shared_mutex<wil::com_ptr<IDXGIFactory2>> cachedFactory;
+
+        const auto guard = cachedFactory.lock();
+        if (!*guard || !(*guard)->IsCurrent())
+        {
+            *guard = details::createDXGIFactory();
+        }
+        return *guard;
+    }
 }
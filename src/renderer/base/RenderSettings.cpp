@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 
+#include <til/hash.h>
+
 #include "../inc/RenderSettings.hpp"
 #include "../base/renderer.hpp"
 #include "../../types/inc/ColorFix.hpp"
@@ -34,12 +36,17 @@ RenderSettings::RenderSettings() noexcept
 // - enabled - Set to true to enable the mode, false to disable it.
 void RenderSettings::SetRenderMode(const Mode mode, const bool enabled) noexcept
 {
+    if (_renderMode.test(mode) == enabled)
+    {
+        return;
+    }
     _renderMode.set(mode, enabled);
     // If blinking is disabled, make sure blinking content is not faint.
     if (mode == Mode::BlinkAllowed && !enabled)
     {
         _blinkShouldBeFaint = false;
     }
+    _colorGeneration++;
 }
 
 // Routine Description:
@@ -53,6 +60,15 @@ bool RenderSettings::GetRenderMode(const Mode mode) const noexcept
     return _renderMode.test(mode);
 }
 
+// Routine Description:
+// - Returns the current color generation. The generation changes whenever any
+//   setting that feeds into color resolution does, so callers can snapshot it
+//   to detect whether a batch of Set* calls actually changed anything.
+uint64_t RenderSettings::GetColorGeneration() const noexcept
+{
+    return _colorGeneration;
+}
+
 // Routine Description:
 // - Returns a reference to the active color table array.
 const std::array<COLORREF, TextColor::TABLE_SIZE>& RenderSettings::GetColorTable() const noexcept
@@ -65,6 +81,7 @@ const std::array<COLORREF, TextColor::TABLE_SIZE>& RenderSettings::GetColorTable
 void RenderSettings::ResetColorTable() noexcept
 {
     InitializeColorTable({ _colorTable.data(), 16 });
+    _colorGeneration++;
 }
 
 // Routine Description:
@@ -74,7 +91,12 @@ void RenderSettings::ResetColorTable() noexcept
 // - color - The new COLORREF to use as that color table value.
 void RenderSettings::SetColorTableEntry(const size_t tableIndex, const COLORREF color)
 {
-    _colorTable.at(tableIndex) = color;
+    auto& entry = _colorTable.at(tableIndex);
+    if (entry != color)
+    {
+        entry = color;
+        _colorGeneration++;
+    }
 }
 
 // Routine Description:
@@ -120,7 +142,12 @@ void RenderSettings::SetColorAliasIndex(const ColorAlias alias, const size_t tab
 {
     if (tableIndex < TextColor::TABLE_SIZE)
     {
-        gsl::at(_colorAliasIndices, static_cast<size_t>(alias)) = tableIndex;
+        auto& entry = gsl::at(_colorAliasIndices, static_cast<size_t>(alias));
+        if (entry != tableIndex)
+        {
+            entry = tableIndex;
+            _colorGeneration++;
+        }
     }
 }
 
@@ -146,6 +173,20 @@ std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttri
 {
     _blinkIsInUse = _blinkIsInUse || attr.IsBlinking();
 
+    // Attribute-dense frames resolve the same handful of attributes over and
+    // over, and the math below (in particular the perceivable-color
+    // adjustment) isn't free. Consult the direct-mapped cache first; entries
+    // survive until the palette, aliases, modes, or the blink phase change.
+    // TextAttribute is tightly packed, but contains a union (TextColor), so
+    // it's hashed through the raw-memory overload.
+    til::hasher hash;
+    hash.write(static_cast<const void*>(&attr), sizeof(attr));
+    auto& entry = _attributeColorCache[hash.finalize() % _attributeColorCache.size()];
+    if (entry.generation == _colorGeneration && entry.attr == attr)
+    {
+        return { entry.foreground, entry.background };
+    }
+
     const auto fgTextColor = attr.GetForeground();
     const auto bgTextColor = attr.GetBackground();
 
@@ -186,6 +227,7 @@ std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttri
         }
     }
 
+    entry = { attr, fg, bg, _colorGeneration };
     return { fg, bg };
 }
 
@@ -269,7 +311,12 @@ try
         // have a blink cycle that loops through four phases...
         _blinkCycle = (_blinkCycle + 1) % 4;
         // ... and two of those four render the blink attributes as faint.
-        _blinkShouldBeFaint = _blinkCycle >= 2;
+        const auto blinkShouldBeFaint = _blinkCycle >= 2;
+        if (blinkShouldBeFaint != _blinkShouldBeFaint)
+        {
+            _blinkShouldBeFaint = blinkShouldBeFaint;
+            _colorGeneration++;
+        }
         // Every two cycles (when the state changes), we need to trigger a
         // redraw, but only if there are actually blink attributes in use.
         if (_blinkIsInUse && _blinkCycle % 2 == 0)
@@ -4,6 +4,13 @@
 #include "precomp.h"
 #include "renderer.hpp"
 
+#include <future>
+
+#include <til/hash.h>
+
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+
 #pragma hdrstop
 
 using namespace Microsoft::Console::Render;
@@ -11,6 +18,14 @@ using namespace Microsoft::Console::Types;
 
 using PointTree = interval_tree::IntervalTree<til::point, size_t>;
 
+#pragma warning(suppress : 26477) // We don't control tracelogging macros
+TRACELOGGING_DEFINE_PROVIDER(g_hRendererTraceProvider,
+                             "Microsoft.Windows.Terminal.Renderer",
+                             // tl:{426bac2b-61e5-d851-6859-73debbef2cb8}
+                             (0x426bac2b, 0x61e5, 0xd851, 0x68, 0x59, 0x73, 0xde, 0xbb, 0xef, 0x2c, 0xb8), );
+
+std::atomic<size_t> Renderer::_tracelogCount{ 0 };
+
 static constexpr auto maxRetriesForRenderEngine = 3;
 // The renderer will wait this number of milliseconds * how many tries have elapsed before trying again.
 static constexpr auto renderBackoffBaseTimeMilliseconds{ 150 };
@@ -37,6 +52,11 @@ Renderer::Renderer(const RenderSettings& renderSettings,
     _pData(pData),
     _pThread{ std::move(thread) }
 {
+    if (_tracelogCount.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        TraceLoggingRegister(g_hRendererTraceProvider);
+    }
+
     for (size_t i = 0; i < cEngines; i++)
     {
         AddRenderEngine(rgpEngines[i]);
@@ -54,6 +74,11 @@ Renderer::~Renderer()
     // RenderThread blocks until it has shut down.
     _destructing = true;
     _pThread.reset();
+
+    if (_tracelogCount.fetch_sub(1, std::memory_order_relaxed) == 1)
+    {
+        TraceLoggingUnregister(g_hRendererTraceProvider);
+    }
 }
 
 // Routine Description:
@@ -64,45 +89,75 @@ Renderer::~Renderer()
 // - HRESULT S_OK, GDI error, Safe Math error, or state/argument errors.
 [[nodiscard]] HRESULT Renderer::PaintFrame()
 {
-    FOREACH_ENGINE(pEngine)
+    // When more than one engine is attached (conpty with accessibility enabled, for
+    // instance) their frame costs used to add up on this thread, even though most of
+    // the cost doesn't need the console lock: painting copies the buffer contents
+    // into the engine under the lock, while Present() only works off of that copy.
+    // Painting the second engine on a parallel task lets the paint phases serialize
+    // naturally on the console lock while the Present() phases run concurrently.
+    std::future<HRESULT> secondary;
+    if (_engines[0] && _engines[1])
     {
-        auto tries = maxRetriesForRenderEngine;
-        while (tries > 0)
+        secondary = std::async(std::launch::async, [this, pEngine = _engines[1]]() {
+            return _PaintFrameForEngineWithRetries(pEngine);
+        });
+    }
+
+    auto hr = _engines[0] ? _PaintFrameForEngineWithRetries(_engines[0]) : S_OK;
+    if (secondary.valid())
+    {
+        const auto hrSecondary = secondary.get();
+        if (SUCCEEDED(hr))
         {
-            if (_destructing)
-            {
-                return S_FALSE;
-            }
+            hr = hrSecondary;
+        }
+    }
 
-            const auto hr = _PaintFrameForEngine(pEngine);
-            if (SUCCEEDED(hr))
-            {
-                break;
-            }
+    if (FAILED(hr))
+    {
+        // Stop trying.
+        _pThread->DisablePainting();
+        if (_pfnRendererEnteredErrorState)
+        {
+            _pfnRendererEnteredErrorState();
+        }
+        // If there's no callback, we still don't want to FAIL_FAST: the renderer going black
+        // isn't near as bad as the entire application aborting. We're a component. We shouldn't
+        // abort applications that host us.
+    }
 
-            LOG_HR_IF(hr, hr != E_PENDING);
+    // Any failure is translated to S_FALSE, because a failure of the renderer
+    // isn't near as bad as the entire application aborting (see above).
+    return SUCCEEDED(hr) ? S_OK : S_FALSE;
+}
 
-            if (--tries == 0)
-            {
-                // Stop trying.
-                _pThread->DisablePainting();
-                if (_pfnRendererEnteredErrorState)
-                {
-                    _pfnRendererEnteredErrorState();
-                }
-                // If there's no callback, we still don't want to FAIL_FAST: the renderer going black
-                // isn't near as bad as the entire application aborting. We're a component. We shouldn't
-                // abort applications that host us.
-                return S_FALSE;
-            }
+[[nodiscard]] HRESULT Renderer::_PaintFrameForEngineWithRetries(_In_ IRenderEngine* const pEngine) noexcept
+{
+    auto tries = maxRetriesForRenderEngine;
+    for (;;)
+    {
+        if (_destructing)
+        {
+            return S_FALSE;
+        }
 
-            // Add a bit of backoff.
-            // Sleep 150ms, 300ms, 450ms before failing out and disabling the renderer.
-            Sleep(renderBackoffBaseTimeMilliseconds * (maxRetriesForRenderEngine - tries));
+        const auto hr = _PaintFrameForEngine(pEngine);
+        if (SUCCEEDED(hr))
+        {
+            return hr;
         }
-    }
 
-    return S_OK;
+        LOG_HR_IF(hr, hr != E_PENDING);
+
+        if (--tries == 0)
+        {
+            return hr;
+        }
+
+        // Add a bit of backoff.
+        // Sleep 150ms, 300ms, 450ms before failing out and disabling the renderer.
+        Sleep(renderBackoffBaseTimeMilliseconds * (maxRetriesForRenderEngine - tries));
+    }
 }
 
 [[nodiscard]] HRESULT Renderer::_PaintFrameForEngine(_In_ IRenderEngine* const pEngine) noexcept
@@ -110,14 +165,21 @@ try
 {
     FAIL_FAST_IF_NULL(pEngine); // This is a programming error. Fail fast.
 
+    const auto frameStart = std::chrono::steady_clock::now();
+
     _pData->LockConsole();
     auto unlock = wil::scope_exit([&]() {
         _pData->UnlockConsole();
     });
 
+    const auto lockAcquired = std::chrono::steady_clock::now();
+
     // Last chance check if anything scrolled without an explicit invalidate notification since the last frame.
     _CheckViewportAndScroll();
 
+    // Apply any selection change that accumulated since the last frame.
+    _FlushSelectionUpdates();
+
     // Try to start painting a frame
     const auto hr = pEngine->StartPaint();
     RETURN_IF_FAILED(hr);
@@ -130,7 +192,34 @@ try
         return S_OK;
     }
 
+    // Snapshot the dirty region for the painted callback now; the engine's
+    // dirty tracking is consumed by the paint pass below.
+    const auto reportPainted = _pfnPainted && pEngine == _engines[0];
+    if (reportPainted)
+    {
+        std::span<const til::rect> dirtyAreas;
+        LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
+        _paintedRegion.assign(dirtyAreas.begin(), dirtyAreas.end());
+    }
+
+    // True while this paint pass reads _snapshot instead of _pData. It's
+    // deliberately a local of the pass: the two engines' passes can run
+    // concurrently (see PaintFrame), and only one of them may have published
+    // a snapshot, so a shared member would let one pass flip the other's
+    // state mid-frame.
+    auto paintingFromSnapshot = false;
+
     auto endPaint = wil::scope_exit([&]() {
+        // If the paint phases ran from a snapshot, the console lock was
+        // dropped along the way. EndPaint consumes the engine's invalidation
+        // state, which concurrent Trigger* calls append to under that lock,
+        // so it has to be taken back for the duration of the call.
+        const auto relock = paintingFromSnapshot;
+        if (relock)
+        {
+            _pData->LockConsole();
+        }
+
         LOG_IF_FAILED(pEngine->EndPaint());
 
         // If the engine tells us it really wants to redraw immediately,
@@ -140,10 +229,15 @@ try
         {
             NotifyPaintFrame();
         }
+
+        if (relock)
+        {
+            _pData->UnlockConsole();
+        }
     });
 
     // A. Prep Colors
-    RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, {}, false, true));
+    RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, {}, false, true, false));
 
     // B. Perform Scroll Operations
     RETURN_IF_FAILED(_PerformScrolling(pEngine));
@@ -154,35 +248,125 @@ try
     // 1. Paint Background
     RETURN_IF_FAILED(_PaintBackground(pEngine));
 
+    // If the engine can paint from a published snapshot, copy everything the
+    // remaining phases read out of the console state now and let go of the
+    // console lock, so the output thread can keep ingesting while this frame
+    // is composed. The title is still read live, so it's painted before the
+    // lock is released.
+    std::unique_lock paintLock{ _paintMutex, std::defer_lock };
+    paintingFromSnapshot = _PublishRenderSnapshot(pEngine);
+    if (paintingFromSnapshot)
+    {
+        RETURN_IF_FAILED(_PaintTitle(pEngine));
+
+        // Take the paint mutex while the console lock is still held so the
+        // lock order is console -> paint everywhere, then drop the console
+        // lock for the phases below.
+        paintLock.lock();
+        unlock.reset();
+    }
+
     // 2. Paint Rows of Text
-    _PaintBufferOutput(pEngine);
+    _PaintBufferOutput(pEngine, paintingFromSnapshot);
 
     // 3. Paint overlays that reside above the text buffer
-    _PaintOverlays(pEngine);
+    // (overlays force the locked path; see _PublishRenderSnapshot)
+    if (!paintingFromSnapshot)
+    {
+        _PaintOverlays(pEngine);
+    }
 
     // 4. Paint Selection
-    _PaintSelection(pEngine);
+    _PaintSelection(pEngine, paintingFromSnapshot);
 
     // 5. Paint Cursor
-    _PaintCursor(pEngine);
+    _PaintCursor(pEngine, paintingFromSnapshot);
 
     // 6. Paint window title
-    RETURN_IF_FAILED(_PaintTitle(pEngine));
+    if (!paintingFromSnapshot)
+    {
+        RETURN_IF_FAILED(_PaintTitle(pEngine));
+    }
+
+    const auto rowsPainted = _rowsPainted.load(std::memory_order_relaxed);
+    const auto rowsElided = _rowsElided.load(std::memory_order_relaxed);
 
-    // Force scope exit end paint to finish up collecting information and possibly painting
+    // Force scope exit end paint to finish up collecting information and possibly painting.
+    // In snapshot mode it briefly re-acquires the console lock; release the
+    // paint mutex first to keep the console -> paint lock order.
+    if (paintLock.owns_lock())
+    {
+        paintLock.unlock();
+    }
     endPaint.reset();
 
     // Force scope exit unlock to let go of global lock so other threads can run
     unlock.reset();
 
+    const auto paintDone = std::chrono::steady_clock::now();
+
     // Trigger out-of-lock presentation for renderers that can support it
     RETURN_IF_FAILED(pEngine->Present());
 
+    const auto presentDone = std::chrono::steady_clock::now();
+
+    if (reportPainted)
+    {
+        _pfnPainted(_paintedRegion);
+    }
+
+    const FrameTiming timing{
+        .lockWait = lockAcquired - frameStart,
+        .paint = paintDone - lockAcquired,
+        .present = presentDone - paintDone,
+    };
+    const auto timingIndex = _frameTimingIndex.fetch_add(1, std::memory_order_relaxed) % _frameTimings.size();
+    _frameTimings[timingIndex] = timing;
+
+    if (TraceLoggingProviderEnabled(g_hRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+        static constexpr auto microseconds = [](std::chrono::steady_clock::duration d) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+        };
+#pragma warning(suppress : 26477) // We don't control TraceLoggingWrite
+        TraceLoggingWrite(
+            g_hRendererTraceProvider,
+            "PaintFrame",
+            TraceLoggingInt64(microseconds(timing.lockWait), "lockWaitMicroseconds"),
+            TraceLoggingInt64(microseconds(timing.paint), "paintMicroseconds"),
+            TraceLoggingInt64(microseconds(timing.present), "presentMicroseconds"),
+            TraceLoggingUInt64(rowsPainted, "rowsPainted"),
+            TraceLoggingUInt64(rowsElided, "rowsElided"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
     // As we leave the scope, EndPaint will be called (declared above)
     return S_OK;
 }
 CATCH_RETURN()
 
+// Routine Description:
+// - Returns copies of the timing records of the most recently completed frames,
+//   ordered oldest to newest. The ring holds the last couple dozen frames; frames
+//   that ended early (nothing to paint, errors) aren't recorded.
+// Arguments:
+// - <none>
+// Return Value:
+// - The recorded frame timings.
+std::vector<Renderer::FrameTiming> Renderer::GetFrameTimings() const
+{
+    const auto count = std::min(_frameTimingIndex.load(std::memory_order_relaxed), _frameTimings.size());
+    const auto next = _frameTimingIndex.load(std::memory_order_relaxed) % _frameTimings.size();
+
+    std::vector<FrameTiming> timings;
+    timings.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        timings.emplace_back(_frameTimings[(next + _frameTimings.size() - count + i) % _frameTimings.size()]);
+    }
+    return timings;
+}
+
 void Renderer::NotifyPaintFrame() noexcept
 {
     // If we're running in the unittests, we might not have a render thread.
@@ -193,6 +377,20 @@ void Renderer::NotifyPaintFrame() noexcept
     }
 }
 
+// Routine Description:
+// - Voids the row content hashes of the previous frame, forcing the next paint to
+//   repaint every invalidated row even if its buffer contents are unchanged.
+// - This must be called whenever anything that affects the rendered output beyond
+//   the row contents themselves may have changed.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Renderer::_InvalidateRowContentHashes() noexcept
+{
+    _rowHashSalt.fetch_add(1, std::memory_order_relaxed);
+}
+
 // Routine Description:
 // - Called when the system has requested we redraw a portion of the console.
 // Arguments:
@@ -201,6 +399,8 @@ void Renderer::NotifyPaintFrame() noexcept
 // - <none>
 void Renderer::TriggerSystemRedraw(const til::rect* const prcDirtyClient)
 {
+    _InvalidateRowContentHashes();
+
     FOREACH_ENGINE(pEngine)
     {
         LOG_IF_FAILED(pEngine->InvalidateSystem(prcDirtyClient));
@@ -285,6 +485,8 @@ void Renderer::TriggerRedrawCursor(const til::point* const pcoord)
         auto updateRect = til::rect{ cursorRect };
         if (view.TrimToViewport(&updateRect))
         {
+            _InvalidateRowContentHashes();
+
             view.ConvertToOrigin(&updateRect);
             FOREACH_ENGINE(pEngine)
             {
@@ -306,6 +508,8 @@ void Renderer::TriggerRedrawCursor(const til::point* const pcoord)
 // - <none>
 void Renderer::TriggerRedrawAll(const bool backgroundChanged, const bool frameChanged)
 {
+    _InvalidateRowContentHashes();
+
     FOREACH_ENGINE(pEngine)
     {
         LOG_IF_FAILED(pEngine->InvalidateAll());
@@ -358,6 +562,31 @@ void Renderer::TriggerTeardown() noexcept
 // - <none>
 void Renderer::TriggerSelection()
 {
+    // Pointer-driven selection updates arrive as fast as the mouse reports,
+    // which on a high polling rate mouse is far more often than we paint.
+    // Rather than walking the selection and invalidating on every call, just
+    // note that the selection changed; _FlushSelectionUpdates computes the
+    // delta once per frame, right before painting.
+    _selectionDirty.store(true, std::memory_order_release);
+    NotifyPaintFrame();
+}
+
+// Routine Description:
+// - Applies any pending selection change to the engines: computes the current
+//   selection rectangles, diffs them against the previous frame's and
+//   invalidates the difference. Called with the console lock held, once per
+//   engine paint; the first engine to get here services all of them.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Renderer::_FlushSelectionUpdates()
+{
+    if (!_selectionDirty.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
     try
     {
         // Get selection rectangles
@@ -373,22 +602,92 @@ void Renderer::TriggerSelection()
             sr &= viewport;
         }
 
+        // While a selection is dragged, consecutive selections overlap almost
+        // entirely: whole rows in the middle are identical and only a few columns
+        // around the moving endpoint differ. Invalidating the union of the old and
+        // new rectangles would repaint all of them on every mouse move, so only
+        // the parts whose selection state actually changed get invalidated.
+        const auto searchDelta = _CalculateSelectionDelta(_previousSearchSelection, searchSelections);
+        const auto selectionDelta = _CalculateSelectionDelta(_previousSelection, rects);
+
         FOREACH_ENGINE(pEngine)
         {
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSearchSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(searchSelections));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(rects));
+            LOG_IF_FAILED(pEngine->InvalidateSelection(searchDelta));
+            LOG_IF_FAILED(pEngine->InvalidateSelection(selectionDelta));
         }
 
         _previousSelection = std::move(rects);
         _previousSearchSelection = std::move(searchSelections);
 
-        NotifyPaintFrame();
+        _InvalidateRowContentHashes();
     }
     CATCH_LOG();
 }
 
+// Routine Description:
+// - Computes the symmetric difference of two sets of selection rectangles: the
+//   cells that are covered by one of them but not the other. Both lists are
+//   expected in row-major order with one rectangle per row, the way
+//   _GetSelectionRects produces them.
+// Arguments:
+// - previous - The selection rectangles from the last TriggerSelection call.
+// - current - The selection rectangles as they are now.
+// Return Value:
+// - The rectangles that need to be repainted.
+std::vector<til::rect> Renderer::_CalculateSelectionDelta(const std::vector<til::rect>& previous, const std::vector<til::rect>& current)
+{
+    std::vector<til::rect> delta;
+    delta.reserve(previous.size() + current.size());
+
+    auto prevIt = previous.begin();
+    auto currIt = current.begin();
+
+    while (prevIt != previous.end() && currIt != current.end())
+    {
+        if (prevIt->top < currIt->top)
+        {
+            // This row is no longer selected.
+            delta.push_back(*prevIt++);
+        }
+        else if (currIt->top < prevIt->top)
+        {
+            // This row is newly selected.
+            delta.push_back(*currIt++);
+        }
+        else if (*prevIt == *currIt)
+        {
+            // Same cells on both sides - nothing to repaint.
+            ++prevIt;
+            ++currIt;
+        }
+        else if (prevIt->bottom == currIt->bottom && prevIt->left < currIt->right && currIt->left < prevIt->right)
+        {
+            // The two ranges overlap, so only the cells around the differing
+            // endpoints changed. This is the common case while dragging.
+            if (prevIt->left != currIt->left)
+            {
+                delta.push_back({ std::min(prevIt->left, currIt->left), prevIt->top, std::max(prevIt->left, currIt->left), prevIt->bottom });
+            }
+            if (prevIt->right != currIt->right)
+            {
+                delta.push_back({ std::min(prevIt->right, currIt->right), prevIt->top, std::max(prevIt->right, currIt->right), prevIt->bottom });
+            }
+            ++prevIt;
+            ++currIt;
+        }
+        else
+        {
+            // Disjoint ranges on the same row - repaint both.
+            delta.push_back(*prevIt++);
+            delta.push_back(*currIt++);
+        }
+    }
+
+    delta.insert(delta.end(), prevIt, previous.end());
+    delta.insert(delta.end(), currIt, current.end());
+    return delta;
+}
+
 // Routine Description:
 // - Called when we want to check if the viewport has moved and scroll accordingly if so.
 // Arguments:
@@ -407,6 +706,7 @@ bool Renderer::_CheckViewportAndScroll()
 
     _viewport = Viewport::FromInclusive(srNewViewport);
     _forceUpdateViewport = false;
+    _InvalidateRowContentHashes();
 
     til::point coordDelta;
     coordDelta.x = srOldViewport.left - srNewViewport.left;
@@ -448,6 +748,8 @@ void Renderer::TriggerScroll()
 // - <none>
 void Renderer::TriggerScroll(const til::point* const pcoordDelta)
 {
+    _InvalidateRowContentHashes();
+
     FOREACH_ENGINE(pEngine)
     {
         LOG_IF_FAILED(pEngine->InvalidateScroll(pcoordDelta));
@@ -467,6 +769,8 @@ void Renderer::TriggerScroll(const til::point* const pcoordDelta)
 // - <none>
 void Renderer::TriggerFlush(const bool circling)
 {
+    _InvalidateRowContentHashes();
+
     const auto rects = _GetSelectionRects();
 
     FOREACH_ENGINE(pEngine)
@@ -531,6 +835,12 @@ HRESULT Renderer::_PaintTitle(IRenderEngine* const pEngine)
 // - <none>
 void Renderer::TriggerFontChange(const int iDpi, const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo)
 {
+    // Engine mutations used to be ordered against painting by the console
+    // lock alone; snapshot paint passes drop it, so take the paint mutex.
+    std::lock_guard paintGuard{ _paintMutex };
+
+    _InvalidateRowContentHashes();
+
     FOREACH_ENGINE(pEngine)
     {
         LOG_IF_FAILED(pEngine->UpdateDpi(iDpi));
@@ -555,11 +865,17 @@ void Renderer::UpdateSoftFont(const std::span<const uint16_t> bitPattern, const
     // bitPattern. If it's empty (i.e. no soft font is set), then nothing will
     // match, and those code points will be treated the same as everything else.
     const auto softFontCharCount = cellSize.height ? bitPattern.size() / cellSize.height : 0;
-    _lastSoftFontChar = _firstSoftFontChar + softFontCharCount - 1;
 
-    FOREACH_ENGINE(pEngine)
     {
-        LOG_IF_FAILED(pEngine->UpdateSoftFont(bitPattern, cellSize, centeringHint));
+        // Ordered against snapshot paint passes, see TriggerFontChange.
+        std::lock_guard paintGuard{ _paintMutex };
+
+        _lastSoftFontChar = _firstSoftFontChar + softFontCharCount - 1;
+
+        FOREACH_ENGINE(pEngine)
+        {
+            LOG_IF_FAILED(pEngine->UpdateSoftFont(bitPattern, cellSize, centeringHint));
+        }
     }
     TriggerRedrawAll();
 }
@@ -583,6 +899,9 @@ bool Renderer::s_IsSoftFontChar(const std::wstring_view& v, const size_t firstSo
 // - S_OK if set successfully or relevant GDI error via HRESULT.
 [[nodiscard]] HRESULT Renderer::GetProposedFont(const int iDpi, const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo)
 {
+    // Ordered against snapshot paint passes, see TriggerFontChange.
+    std::lock_guard paintGuard{ _paintMutex };
+
     // There will only every really be two engines - the real head and the VT
     //      renderer. We won't know which is which, so iterate over them.
     //      Only return the result of the successful one if it's not S_FALSE (which is the VT renderer)
@@ -614,6 +933,9 @@ bool Renderer::IsGlyphWideByFont(const std::wstring_view glyph)
 {
     auto fIsFullWidth = false;
 
+    // Ordered against snapshot paint passes, see TriggerFontChange.
+    std::lock_guard paintGuard{ _paintMutex };
+
     // There will only every really be two engines - the real head and the VT
     //      renderer. We won't know which is which, so iterate over them.
     //      Only return the result of the successful one if it's not S_FALSE (which is the VT renderer)
@@ -651,6 +973,43 @@ void Renderer::EnablePainting()
     }
 }
 
+// Routine Description:
+// - Resets the event in the render thread, pausing painting at the next frame
+//      boundary. Invalidations and scroll deltas keep accumulating in the
+//      engines while paused, so the first frame painted after EnablePainting()
+//      catches the display up in one go. Used while the window is hidden or
+//      minimized, when nobody could see the frames anyways.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void Renderer::DisablePainting()
+{
+    if (_pThread)
+    {
+        _pThread->DisablePainting();
+    }
+}
+
+// Routine Description:
+// - Limits how often the render thread will start consecutive paced paints,
+//      coalescing the invalidations that accumulate in between into fewer,
+//      larger frames. Used by conpty, where the consumer is another terminal
+//      that can only present at its own refresh rate anyways.
+// Arguments:
+// - interval - the shortest allowed time between the start of two paced
+//      paints. Zero removes the limit.
+// Return Value:
+// - <none>
+void Renderer::SetMinimumFrameInterval(const std::chrono::nanoseconds interval) noexcept
+{
+    // When running the unit tests, we may be using a renderer without a render thread.
+    if (_pThread)
+    {
+        _pThread->SetMinimumFrameInterval(interval);
+    }
+}
+
 // Routine Description:
 // - Waits for the current paint operation to complete, if any, up to the specified timeout.
 // - Resets an event in the render thread that precludes it from advancing, thus disabling rendering.
@@ -683,18 +1042,46 @@ void Renderer::WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs)
 // - <none>
 // Return Value:
 // - <none>
-void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
+void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine, const bool fromSnapshot)
 {
     // This is the subsection of the entire screen buffer that is currently being presented.
     // It can move left/right or top/bottom depending on how the viewport is scrolled
     // relative to the entire buffer.
-    const auto view = _pData->GetViewport();
+    const auto view = fromSnapshot ? _snapshot.view : _pData->GetViewport();
+
+    // When painting from the snapshot, the shadow buffer only holds the
+    // viewport's rows and its row 0 is the viewport's top row, so row indices
+    // into it have to be shifted down by the viewport offset.
+    const auto& buffer = fromSnapshot ? *_snapshot.buffer : _pData->GetTextBuffer();
+    const auto rowOffset = fromSnapshot ? view.Top() : 0;
 
     // This is effectively the number of cells on the visible screen that need to be redrawn.
     // The origin is always 0, 0 because it represents the screen itself, not the underlying buffer.
     std::span<const til::rect> dirtyAreas;
     LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
 
+    // Overlays (conhost's IME composition) are drawn on top of the buffer rows in
+    // _PaintOverlays, so rows underneath them don't match their content hash anymore.
+    // Elision stays disabled until the first frame after all overlays are gone,
+    // which repaints the rows they covered.
+    // (The snapshot path is only taken when there are no overlays at all.)
+    const auto hasOverlays = !fromSnapshot && !_pData->GetOverlays().empty();
+    if (hasOverlays || _hadOverlays)
+    {
+        _InvalidateRowContentHashes();
+    }
+    _hadOverlays = hasOverlays;
+
+    const size_t engineSlot = _engines[1] == pEngine ? 1 : 0;
+    auto& lastRowHashes = _lastRowHashes[engineSlot];
+    auto& freshRowHashes = _freshRowHashes[engineSlot];
+    const auto viewportHeight = gsl::narrow_cast<size_t>(std::max(0, view.Height()));
+    if (lastRowHashes.size() != viewportHeight)
+    {
+        lastRowHashes.assign(viewportHeight, 0);
+    }
+    freshRowHashes.assign(viewportHeight, 0);
+
     // This is to make sure any transforms are reset when this paint is finished.
     auto resetLineTransform = wil::scope_exit([&]() {
         LOG_IF_FAILED(pEngine->ResetLineTransform());
@@ -718,9 +1105,6 @@ void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
         // we need to walk through line-by-line and repaint onto the screen.
         const auto redraw = Viewport::Intersect(dirty, view);
 
-        // Retrieve the text buffer so we can read information out of it.
-        const auto& buffer = _pData->GetTextBuffer();
-
         // Now walk through each row of text that we need to redraw.
         for (auto row = redraw.Top(); row < redraw.BottomExclusive(); row++)
         {
@@ -730,7 +1114,7 @@ void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
 
             // Convert the screen coordinates of the line to an equivalent
             // range of buffer cells, taking line rendition into account.
-            const auto lineRendition = buffer.GetLineRendition(row);
+            const auto lineRendition = buffer.GetLineRendition(row - rowOffset);
             const auto bufferLine = Viewport::FromInclusive(ScreenToBufferLine(screenLine, lineRendition));
 
             // Find where on the screen we should place this line information. This requires us to re-map
@@ -741,20 +1125,64 @@ void Renderer::_PaintBufferOutput(_In_ IRenderEngine* const pEngine)
             const auto screenPosition = bufferLine.Origin() - til::point{ 0, view.Top() };
 
             // Retrieve the cell information iterator limited to just this line we want to redraw.
-            auto it = buffer.GetCellDataAt(bufferLine.Origin(), bufferLine);
+            auto it = buffer.GetCellDataAt(bufferLine.Origin() - til::point{ 0, rowOffset }, Viewport::Offset(bufferLine, { 0, -rowOffset }));
 
             // Calculate if two things are true:
             // 1. this row wrapped
             // 2. We're painting the last col of the row.
             // In that case, set lineWrapped=true for the _PaintBufferOutputHelper call.
-            const auto lineWrapped = (buffer.GetRowByOffset(bufferLine.Origin().y).WasWrapForced()) &&
+            const auto lineWrapped = (buffer.GetRowByOffset(bufferLine.Origin().y - rowOffset).WasWrapForced()) &&
                                      (bufferLine.RightExclusive() == buffer.GetSize().Width());
 
+            // TUI applications commonly rewrite their entire screen contents on every tick,
+            // even if nothing changed, which invalidates the affected rows and makes us
+            // reproduce a pixel-identical frame. A hash of each row's contents lets us
+            // elide such repaints: If it matches what was painted for the previous frame,
+            // the engine would render the exact same output again. Everything that affects
+            // the output beyond the row contents themselves (the cursor, selection,
+            // overlays, scrolling, color mappings, ...) bumps _rowHashSalt and thereby
+            // voids all stored hashes.
+            const auto rowIndex = gsl::narrow_cast<size_t>(screenPosition.y);
+            size_t rowHash = 0;
+            if (rowIndex < viewportHeight)
+            {
+                const auto& bufferRow = buffer.GetRowByOffset(bufferLine.Origin().y - rowOffset);
+                const auto rowText = bufferRow.GetText();
+                const auto& runs = bufferRow.Attributes().runs();
+
+                til::hasher h{ _rowHashSalt.load(std::memory_order_relaxed) };
+                h.write(rowText.data(), rowText.size());
+                h.write(static_cast<const void*>(runs.data()), runs.size() * sizeof(*runs.data()));
+                h.write(lineRendition);
+                h.write(lineWrapped);
+                rowHash = h.finalize();
+                freshRowHashes[rowIndex] = rowHash;
+
+                if (rowHash != 0 && rowHash == lastRowHashes[rowIndex])
+                {
+                    _rowsElided.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+            }
+            _rowsPainted.fetch_add(1, std::memory_order_relaxed);
+
             // Prepare the appropriate line transform for the current row and viewport offset.
             LOG_IF_FAILED(pEngine->PrepareLineTransform(lineRendition, screenPosition.y, view.Left()));
 
             // Ask the helper to paint through this specific line.
-            _PaintBufferOutputHelper(pEngine, it, screenPosition, lineWrapped);
+            _PaintBufferOutputHelper(pEngine, it, screenPosition, lineWrapped, fromSnapshot);
+        }
+    }
+
+    // The fresh hashes are only committed after all dirty rects were handled:
+    // Two rects may cover different parts of the same row and the second one must
+    // compare against the hash of the previous frame, not the hash the first one
+    // just stored (which would always match and wrongly elide the second part).
+    for (size_t i = 0; i < viewportHeight; ++i)
+    {
+        if (const auto hash = freshRowHashes[i])
+        {
+            lastRowHashes[i] = hash;
         }
     }
 }
@@ -768,9 +1196,11 @@ static bool _IsAllSpaces(const std::wstring_view v)
 void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                                         TextBufferCellIterator it,
                                         const til::point target,
-                                        const bool lineWrapped)
+                                        const bool lineWrapped,
+                                        const bool fromSnapshot)
 {
-    auto globalInvert{ _renderSettings.GetRenderMode(RenderSettings::Mode::ScreenReversed) };
+    const auto& renderSettings = fromSnapshot ? _snapshot.settings : _renderSettings;
+    auto globalInvert{ renderSettings.GetRenderMode(RenderSettings::Mode::ScreenReversed) };
 
     // If we have valid data, let's figure out how to draw it.
     if (it)
@@ -784,7 +1214,7 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
         // Retrieve the first color.
         auto color = it->TextAttr();
         // Retrieve the first pattern id
-        auto patternIds = _pData->GetPatternId(target);
+        auto patternIds = _GetPatternIdForPaint(target, fromSnapshot);
         // Determine whether we're using a soft font.
         auto usingSoftFont = s_IsSoftFontChar(it->Chars(), _firstSoftFontChar, _lastSoftFontChar);
 
@@ -804,7 +1234,7 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
             const auto currentPatternId = patternIds;
 
             // Update the drawing brushes with our color and font usage.
-            THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, currentRunColor, usingSoftFont, false));
+            THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, currentRunColor, usingSoftFont, false, fromSnapshot));
 
             // Advance the point by however many columns we've just outputted and reset the accumulator.
             screenPoint.x += cols;
@@ -832,7 +1262,7 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
             do
             {
                 til::point thisPoint{ screenPoint.x + cols, screenPoint.y };
-                const auto thisPointPatterns = _pData->GetPatternId(thisPoint);
+                const auto thisPointPatterns = _GetPatternIdForPaint(thisPoint, fromSnapshot);
                 const auto thisUsingSoftFont = s_IsSoftFontChar(it->Chars(), _firstSoftFontChar, _lastSoftFontChar);
                 const auto changedPatternOrFont = patternIds != thisPointPatterns || usingSoftFont != thisUsingSoftFont;
                 if (color != it->TextAttr() || changedPatternOrFont)
@@ -882,7 +1312,7 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
 
             // If we're allowed to do grid drawing, draw that now too (since it will be coupled with the color data)
             // We're only allowed to draw the grid lines under certain circumstances.
-            if (_pData->IsGridLineDrawingAllowed())
+            if (fromSnapshot ? _snapshot.gridLineDrawingAllowed : _pData->IsGridLineDrawingAllowed())
             {
                 // See GH: 803
                 // If we found a wide character while we looped above, it's possible we skipped over the right half
@@ -904,13 +1334,13 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                     for (til::CoordType colsPainted = 0; colsPainted < cols; ++colsPainted, ++lineIt, ++lineTarget.x)
                     {
                         auto lines = lineIt->TextAttr();
-                        _PaintBufferOutputGridLineHelper(pEngine, lines, 1, lineTarget);
+                        _PaintBufferOutputGridLineHelper(pEngine, lines, 1, lineTarget, fromSnapshot);
                     }
                 }
                 else
                 {
                     // If nothing exciting is going on, draw the lines in bulk.
-                    _PaintBufferOutputGridLineHelper(pEngine, currentRunColor, cols, screenPoint);
+                    _PaintBufferOutputGridLineHelper(pEngine, currentRunColor, cols, screenPoint, fromSnapshot);
                 }
             }
         }
@@ -999,13 +1429,14 @@ GridLineSet Renderer::s_GetGridlines(const TextAttribute& textAttribute) noexcep
 void Renderer::_PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine,
                                                 const TextAttribute textAttribute,
                                                 const size_t cchLine,
-                                                const til::point coordTarget)
+                                                const til::point coordTarget,
+                                                const bool fromSnapshot)
 {
     // Convert console grid line representations into rendering engine enum representations.
     auto lines = Renderer::s_GetGridlines(textAttribute);
 
     // For now, we dash underline patterns and switch to regular underline on hover
-    if (_isHoveredHyperlink(textAttribute) || _isInHoveredInterval(coordTarget))
+    if (_isHoveredHyperlink(textAttribute, fromSnapshot) || _isInHoveredInterval(coordTarget, fromSnapshot))
     {
         lines.reset(GridLines::HyperlinkUnderline);
         lines.set(GridLines::Underline);
@@ -1015,23 +1446,26 @@ void Renderer::_PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngin
     if (lines.any())
     {
         // Get the current foreground and underline colors to render the lines.
-        const auto fg = _renderSettings.GetAttributeColors(textAttribute).first;
-        const auto underlineColor = _renderSettings.GetAttributeUnderlineColor(textAttribute);
+        const auto& renderSettings = fromSnapshot ? _snapshot.settings : _renderSettings;
+        const auto fg = renderSettings.GetAttributeColors(textAttribute).first;
+        const auto underlineColor = renderSettings.GetAttributeUnderlineColor(textAttribute);
         // Draw the lines
         LOG_IF_FAILED(pEngine->PaintBufferGridLines(lines, fg, underlineColor, cchLine, coordTarget));
     }
 }
 
-bool Renderer::_isHoveredHyperlink(const TextAttribute& textAttribute) const noexcept
+bool Renderer::_isHoveredHyperlink(const TextAttribute& textAttribute, const bool fromSnapshot) const noexcept
 {
-    return _hyperlinkHoveredId && _hyperlinkHoveredId == textAttribute.GetHyperlinkId();
+    const auto hoveredId = fromSnapshot ? _snapshot.hyperlinkHoveredId : _hyperlinkHoveredId;
+    return hoveredId && hoveredId == textAttribute.GetHyperlinkId();
 }
 
-bool Renderer::_isInHoveredInterval(const til::point coordTarget) const noexcept
+bool Renderer::_isInHoveredInterval(const til::point coordTarget, const bool fromSnapshot) const noexcept
 {
-    return _hoveredInterval &&
-           _hoveredInterval->start <= coordTarget && coordTarget <= _hoveredInterval->stop &&
-           _pData->GetPatternId(coordTarget).size() > 0;
+    const auto& hoveredInterval = fromSnapshot ? _snapshot.hoveredInterval : _hoveredInterval;
+    return hoveredInterval &&
+           hoveredInterval->start <= coordTarget && coordTarget <= hoveredInterval->stop &&
+           _GetPatternIdForPaint(coordTarget, fromSnapshot).size() > 0;
 }
 
 // Routine Description:
@@ -1041,10 +1475,12 @@ bool Renderer::_isInHoveredInterval(const til::point coordTarget) const noexcept
 //   this will return nullopt (indicating the cursor shouldn't be painted this
 //   frame)
 // Arguments:
-// - <none>
+// - renderSettings - The settings to take the cursor color from. Snapshot
+//   publication hands in the snapshot's copy so the captured cursor is
+//   consistent with the rest of the frame; everyone else passes the live one.
 // Return Value:
 // - nullopt if the cursor is off or out-of-frame, otherwise a CursorOptions
-[[nodiscard]] std::optional<CursorOptions> Renderer::_GetCursorInfo()
+[[nodiscard]] std::optional<CursorOptions> Renderer::_GetCursorInfo(const RenderSettings& renderSettings)
 {
     if (_pData->IsCursorVisible())
     {
@@ -1076,7 +1512,7 @@ bool Renderer::_isInHoveredInterval(const til::point coordTarget) const noexcept
             // The viewport X offset is saved in the options and handled with a transform.
             coordCursor.y -= view.top;
 
-            auto cursorColor = _renderSettings.GetColorTableEntry(TextColor::CURSOR_COLOR);
+            auto cursorColor = renderSettings.GetColorTableEntry(TextColor::CURSOR_COLOR);
             auto useColor = cursorColor != INVALID_COLOR;
 
             // Build up the cursor parameters including position, color, and drawing options
@@ -1104,9 +1540,9 @@ bool Renderer::_isInHoveredInterval(const til::point coordTarget) const noexcept
 // - engine - The render engine that we're targeting.
 // Return Value:
 // - <none>
-void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine)
+void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine, const bool fromSnapshot)
 {
-    const auto cursorInfo = _GetCursorInfo();
+    const auto cursorInfo = fromSnapshot ? _snapshot.cursorInfo : _GetCursorInfo(_renderSettings);
     if (cursorInfo.has_value())
     {
         LOG_IF_FAILED(pEngine->PaintCursor(cursorInfo.value()));
@@ -1127,10 +1563,121 @@ void Renderer::_PaintCursor(_In_ IRenderEngine* const pEngine)
 [[nodiscard]] HRESULT Renderer::_PrepareRenderInfo(_In_ IRenderEngine* const pEngine)
 {
     RenderFrameInfo info;
-    info.cursorInfo = _GetCursorInfo();
+    info.cursorInfo = _GetCursorInfo(_renderSettings);
     return pEngine->PrepareRenderInfo(info);
 }
 
+// Routine Description:
+// - Copies everything the paint phases read (the viewport rows, pattern ids,
+//   cursor, selection, color settings and hover state) into _snapshot, so the
+//   remainder of the frame can be composed without the console lock held.
+// - Must be called under the console lock.
+// Arguments:
+// - pEngine - The render engine that we're targeting.
+// Return Value:
+// - true if the snapshot was published and the paint phases may run unlocked.
+bool Renderer::_PublishRenderSnapshot(_In_ IRenderEngine* const pEngine)
+try
+{
+    if (!pEngine->CanPaintWithoutConsoleLock())
+    {
+        return false;
+    }
+
+    // Overlays (conhost's IME composition) paint straight out of _pData and
+    // are rare; let those frames take the fully locked path.
+    if (!_pData->GetOverlays().empty())
+    {
+        return false;
+    }
+
+    const auto view = _pData->GetViewport();
+    const auto& liveBuffer = _pData->GetTextBuffer();
+    const auto width = liveBuffer.GetSize().Width();
+    const auto height = view.Height();
+    if (width <= 0 || height <= 0)
+    {
+        return false;
+    }
+
+    // The shadow buffer spans the full buffer width (pattern/grid line
+    // lookups use buffer columns) but only the viewport's rows, with shadow
+    // row 0 holding the viewport's top row.
+    if (!_snapshot.buffer || _snapshot.buffer->GetSize().Width() != width || _snapshot.buffer->GetSize().Height() != height)
+    {
+        _snapshot.buffer = std::make_unique<TextBuffer>(til::size{ width, height }, TextAttribute{}, 0, false, *this);
+    }
+    for (til::CoordType y = 0; y < height; ++y)
+    {
+        _snapshot.buffer->GetMutableRowByOffset(y).CopyFrom(liveBuffer.GetRowByOffset(view.Top() + y));
+    }
+
+    // Pattern ids are only consulted for the rows this frame will actually
+    // paint, so only those need to be resolved here. The coordinates handed
+    // to GetPatternId mirror the ones painting uses: x in buffer columns,
+    // y in viewport rows.
+    _snapshot.patternIds.assign(gsl::narrow_cast<size_t>(width) * gsl::narrow_cast<size_t>(height), {});
+    std::span<const til::rect> dirtyAreas;
+    LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
+    for (const auto& dirtyRect : dirtyAreas)
+    {
+        const auto top = std::max(dirtyRect.top, 0);
+        const auto bottom = std::min(dirtyRect.bottom, height);
+        for (auto y = top; y < bottom; ++y)
+        {
+            for (til::CoordType x = 0; x < width; ++x)
+            {
+                auto ids = _pData->GetPatternId({ x, y });
+                if (!ids.empty())
+                {
+                    _snapshot.patternIds[gsl::narrow_cast<size_t>(y) * width + x] = std::move(ids);
+                }
+            }
+        }
+    }
+
+    _snapshot.view = view;
+    // RenderSettings is trivially copyable; a full copy shields the paint
+    // phases from concurrent palette changes (its mutable color cache then
+    // mutates thread-locally). Copied before the cursor is captured so its
+    // color comes from the same settings the rest of the frame paints with.
+    _snapshot.settings = _renderSettings;
+    _snapshot.cursorInfo = _GetCursorInfo(_snapshot.settings);
+    _snapshot.selectionRects = _GetSelectionRects();
+    _snapshot.searchSelectionRects = _GetSearchSelectionRects();
+    _snapshot.hoveredInterval = _hoveredInterval;
+    _snapshot.hyperlinkHoveredId = _hyperlinkHoveredId;
+    _snapshot.gridLineDrawingAllowed = _pData->IsGridLineDrawingAllowed();
+    return true;
+}
+catch (...)
+{
+    LOG_CAUGHT_EXCEPTION();
+    return false;
+}
+
+// Routine Description:
+// - Resolves the pattern ids for a cell, either from the published snapshot
+//   (when painting without the console lock) or live from the render data.
+// Arguments:
+// - target - The cell to query, x in buffer columns, y in viewport rows.
+// Return Value:
+// - The ids of the patterns covering the cell.
+std::vector<size_t> Renderer::_GetPatternIdForPaint(const til::point target, const bool fromSnapshot) const
+{
+    if (fromSnapshot)
+    {
+        const auto width = _snapshot.buffer->GetSize().Width();
+        const auto height = _snapshot.buffer->GetSize().Height();
+        if (target.x < 0 || target.x >= width || target.y < 0 || target.y >= height)
+        {
+            return {};
+        }
+        return _snapshot.patternIds[gsl::narrow_cast<size_t>(target.y) * width + target.x];
+    }
+    return _pData->GetPatternId(target);
+}
+
 // Routine Description:
 // - Paint helper to draw text that overlays the main buffer to provide user interactivity regions
 // - This supports IME composition.
@@ -1165,7 +1712,8 @@ void Renderer::_PaintOverlay(IRenderEngine& engine,
 
                     auto it = overlay.buffer.GetCellLineDataAt(source);
 
-                    _PaintBufferOutputHelper(&engine, it, target, false);
+                    // Overlays always paint on the fully locked path.
+                    _PaintBufferOutputHelper(&engine, it, target, false, false);
                 }
             }
         }
@@ -1201,7 +1749,7 @@ void Renderer::_PaintOverlays(_In_ IRenderEngine* const pEngine)
 // - <none>
 // Return Value:
 // - <none>
-void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
+void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine, const bool fromSnapshot)
 {
     try
     {
@@ -1209,8 +1757,8 @@ void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
         LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
 
         // Get selection rectangles
-        const auto rectangles = _GetSelectionRects();
-        const auto searchRectangles = _GetSearchSelectionRects();
+        const auto rectangles = fromSnapshot ? _snapshot.selectionRects : _GetSelectionRects();
+        const auto searchRectangles = fromSnapshot ? _snapshot.searchSelectionRects : _GetSearchSelectionRects();
 
         std::vector<til::rect> dirtySearchRectangles;
         for (auto& dirtyRect : dirtyAreas)
@@ -1255,11 +1803,16 @@ void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
 [[nodiscard]] HRESULT Renderer::_UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine,
                                                       const TextAttribute textAttributes,
                                                       const bool usingSoftFont,
-                                                      const bool isSettingDefaultBrushes)
+                                                      const bool isSettingDefaultBrushes,
+                                                      const bool fromSnapshot)
 {
     // The last color needs to be each engine's responsibility. If it's local to this function,
     //      then on the next engine we might not update the color.
-    return pEngine->UpdateDrawingBrushes(textAttributes, _renderSettings, _pData, usingSoftFont, isSettingDefaultBrushes);
+    // When painting from the snapshot, hand out its settings copy so that
+    // concurrent palette changes can't be observed mid-frame. (Engines that
+    // opt into unlocked painting never consult pData here.)
+    const auto& renderSettings = fromSnapshot ? _snapshot.settings : _renderSettings;
+    return pEngine->UpdateDrawingBrushes(textAttributes, renderSettings, _pData, usingSoftFont, isSettingDefaultBrushes);
 }
 
 // Routine Description:
@@ -1356,11 +1909,17 @@ void Renderer::AddRenderEngine(_In_ IRenderEngine* const pEngine)
 {
     THROW_HR_IF_NULL(E_INVALIDARG, pEngine);
 
-    for (auto& p : _engines)
+    // Ordered against snapshot paint passes, see TriggerFontChange.
+    std::lock_guard paintGuard{ _paintMutex };
+
+    for (size_t i = 0; i < _engines.size(); i++)
     {
-        if (!p)
+        if (!_engines[i])
         {
-            p = pEngine;
+            _engines[i] = pEngine;
+            // The slot may have previously been used by another engine
+            // whose row content hashes the new one must not inherit.
+            _lastRowHashes[i].clear();
             return;
         }
     }
@@ -1372,6 +1931,9 @@ void Renderer::RemoveRenderEngine(_In_ IRenderEngine* const pEngine)
 {
     THROW_HR_IF_NULL(E_INVALIDARG, pEngine);
 
+    // Ordered against snapshot paint passes, see TriggerFontChange.
+    std::lock_guard paintGuard{ _paintMutex };
+
     for (auto& p : _engines)
     {
         if (p == pEngine)
@@ -1416,6 +1978,20 @@ void Renderer::SetRendererEnteredErrorStateCallback(std::function<void()> pfn)
     _pfnRendererEnteredErrorState = std::move(pfn);
 }
 
+// Method Description:
+// - Registers a callback that will be called on the render thread after each
+//   presented frame with the region (in cells) that the frame repainted.
+//   An application hosting the renderer in a foreign surface can use this
+//   to invalidate only the parts of that surface that actually changed.
+// Arguments:
+// - pfn: the callback
+// Return Value:
+// - <none>
+void Renderer::SetPaintedCallback(std::function<void(std::span<const til::rect>)> pfn)
+{
+    _pfnPainted = std::move(pfn);
+}
+
 // Method Description:
 // - Attempts to restart the renderer.
 void Renderer::ResetErrorStateAndResume()
@@ -1427,6 +2003,7 @@ void Renderer::ResetErrorStateAndResume()
 void Renderer::UpdateHyperlinkHoveredId(uint16_t id) noexcept
 {
     _hyperlinkHoveredId = id;
+    _InvalidateRowContentHashes();
     FOREACH_ENGINE(pEngine)
     {
         pEngine->UpdateHyperlinkHoveredId(id);
@@ -1436,6 +2013,7 @@ void Renderer::UpdateHyperlinkHoveredId(uint16_t id) noexcept
 void Renderer::UpdateLastHoveredInterval(const std::optional<PointTree::interval>& newInterval)
 {
     _hoveredInterval = newInterval;
+    _InvalidateRowContentHashes();
 }
 
 // Method Description:
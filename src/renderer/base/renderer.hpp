@@ -36,6 +36,15 @@ namespace Microsoft::Console::Render
     class Renderer
     {
     public:
+        // A per-frame timing record, used to attribute slow frames to one of the
+        // stages of _PaintFrameForEngine. All durations are wall clock time.
+        struct FrameTiming
+        {
+            std::chrono::steady_clock::duration lockWait{}; // waiting on the console lock
+            std::chrono::steady_clock::duration paint{}; // composing the frame under the lock
+            std::chrono::steady_clock::duration present{}; // the engine's out-of-lock Present()
+        };
+
         Renderer(const RenderSettings& renderSettings,
                  IRenderData* pData,
                  _In_reads_(cEngines) IRenderEngine** const pEngine,
@@ -78,6 +87,8 @@ namespace Microsoft::Console::Render
         bool IsGlyphWideByFont(const std::wstring_view glyph);
 
         void EnablePainting();
+        void DisablePainting();
+        void SetMinimumFrameInterval(const std::chrono::nanoseconds interval) noexcept;
         void WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs);
         void WaitUntilCanRender();
 
@@ -87,35 +98,44 @@ namespace Microsoft::Console::Render
         void SetBackgroundColorChangedCallback(std::function<void()> pfn);
         void SetFrameColorChangedCallback(std::function<void()> pfn);
         void SetRendererEnteredErrorStateCallback(std::function<void()> pfn);
+        void SetPaintedCallback(std::function<void(std::span<const til::rect>)> pfn);
         void ResetErrorStateAndResume();
 
         void UpdateHyperlinkHoveredId(uint16_t id) noexcept;
         void UpdateLastHoveredInterval(const std::optional<interval_tree::IntervalTree<til::point, size_t>::interval>& newInterval);
 
+        std::vector<FrameTiming> GetFrameTimings() const;
+
     private:
         static GridLineSet s_GetGridlines(const TextAttribute& textAttribute) noexcept;
         static bool s_IsSoftFontChar(const std::wstring_view& v, const size_t firstSoftFontChar, const size_t lastSoftFontChar);
 
+        [[nodiscard]] HRESULT _PaintFrameForEngineWithRetries(_In_ IRenderEngine* const pEngine) noexcept;
         [[nodiscard]] HRESULT _PaintFrameForEngine(_In_ IRenderEngine* const pEngine) noexcept;
         bool _CheckViewportAndScroll();
+        void _FlushSelectionUpdates();
+        void _InvalidateRowContentHashes() noexcept;
         [[nodiscard]] HRESULT _PaintBackground(_In_ IRenderEngine* const pEngine);
-        void _PaintBufferOutput(_In_ IRenderEngine* const pEngine);
-        void _PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine, TextBufferCellIterator it, const til::point target, const bool lineWrapped);
-        void _PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine, const TextAttribute textAttribute, const size_t cchLine, const til::point coordTarget);
-        bool _isHoveredHyperlink(const TextAttribute& textAttribute) const noexcept;
-        void _PaintSelection(_In_ IRenderEngine* const pEngine);
-        void _PaintCursor(_In_ IRenderEngine* const pEngine);
+        void _PaintBufferOutput(_In_ IRenderEngine* const pEngine, const bool fromSnapshot);
+        void _PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine, TextBufferCellIterator it, const til::point target, const bool lineWrapped, const bool fromSnapshot);
+        void _PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngine, const TextAttribute textAttribute, const size_t cchLine, const til::point coordTarget, const bool fromSnapshot);
+        bool _isHoveredHyperlink(const TextAttribute& textAttribute, const bool fromSnapshot) const noexcept;
+        void _PaintSelection(_In_ IRenderEngine* const pEngine, const bool fromSnapshot);
+        void _PaintCursor(_In_ IRenderEngine* const pEngine, const bool fromSnapshot);
         void _PaintOverlays(_In_ IRenderEngine* const pEngine);
         void _PaintOverlay(IRenderEngine& engine, const RenderOverlay& overlay);
-        [[nodiscard]] HRESULT _UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const TextAttribute attr, const bool usingSoftFont, const bool isSettingDefaultBrushes);
+        [[nodiscard]] HRESULT _UpdateDrawingBrushes(_In_ IRenderEngine* const pEngine, const TextAttribute attr, const bool usingSoftFont, const bool isSettingDefaultBrushes, const bool fromSnapshot);
         [[nodiscard]] HRESULT _PerformScrolling(_In_ IRenderEngine* const pEngine);
         std::vector<til::rect> _GetSelectionRects() const;
         std::vector<til::rect> _GetSearchSelectionRects() const;
+        static std::vector<til::rect> _CalculateSelectionDelta(const std::vector<til::rect>& previous, const std::vector<til::rect>& current);
         void _ScrollPreviousSelection(const til::point delta);
         [[nodiscard]] HRESULT _PaintTitle(IRenderEngine* const pEngine);
-        bool _isInHoveredInterval(til::point coordTarget) const noexcept;
-        [[nodiscard]] std::optional<CursorOptions> _GetCursorInfo();
+        bool _isInHoveredInterval(til::point coordTarget, const bool fromSnapshot) const noexcept;
+        [[nodiscard]] std::optional<CursorOptions> _GetCursorInfo(const RenderSettings& renderSettings);
         [[nodiscard]] HRESULT _PrepareRenderInfo(_In_ IRenderEngine* const pEngine);
+        bool _PublishRenderSnapshot(_In_ IRenderEngine* const pEngine);
+        std::vector<size_t> _GetPatternIdForPaint(const til::point target, const bool fromSnapshot) const;
 
         const RenderSettings& _renderSettings;
         std::array<IRenderEngine*, 2> _engines{};
@@ -129,12 +149,74 @@ namespace Microsoft::Console::Render
         std::vector<Cluster> _clusterBuffer;
         std::vector<til::rect> _previousSelection;
         std::vector<til::rect> _previousSearchSelection;
+        // Set by TriggerSelection, consumed by _FlushSelectionUpdates at paint
+        // time so that pointer-driven selection updates cost one delta
+        // computation per frame instead of one per mouse message.
+        std::atomic<bool> _selectionDirty{ false };
         std::function<void()> _pfnBackgroundColorChanged;
         std::function<void()> _pfnFrameColorChanged;
         std::function<void()> _pfnRendererEnteredErrorState;
+        std::function<void(std::span<const til::rect>)> _pfnPainted;
+        std::vector<til::rect> _paintedRegion;
         bool _destructing = false;
         bool _forceUpdateViewport = false;
 
+        // Content hashes of the rows painted in the previous frame, one entry per
+        // viewport row and engine slot. _PaintBufferOutput uses them to elide the
+        // repaint of invalidated rows whose contents haven't actually changed.
+        // The hashes are seeded with _rowHashSalt; bumping it (via
+        // _InvalidateRowContentHashes) voids all previously stored hashes.
+        // Both the stored hashes and the scratch vector for the current frame
+        // are per engine slot, since the two engines' passes can paint
+        // concurrently. The counters and the salt are atomic for the same
+        // reason (relaxed; they only feed elision and diagnostics).
+        std::array<std::vector<size_t>, 2> _lastRowHashes;
+        std::array<std::vector<size_t>, 2> _freshRowHashes;
+        std::atomic<size_t> _rowHashSalt{ 1 };
+        std::atomic<uint64_t> _rowsPainted{ 0 };
+        std::atomic<uint64_t> _rowsElided{ 0 };
+        bool _hadOverlays = false;
+
+        // A copy of everything the paint phases read, published under the
+        // console lock by _PublishRenderSnapshot so that engines which opt in
+        // (CanPaintWithoutConsoleLock) can paint without holding the lock.
+        // The shadow buffer spans the full buffer width but only the
+        // viewport's rows; shadow row 0 is the viewport's top row, matching
+        // the hybrid x-in-buffer/y-in-viewport coordinates painting uses.
+        struct RenderSnapshot
+        {
+            std::unique_ptr<TextBuffer> buffer;
+            Microsoft::Console::Types::Viewport view;
+            // One entry per shadow buffer cell, row-major.
+            std::vector<std::vector<size_t>> patternIds;
+            std::optional<CursorOptions> cursorInfo;
+            std::vector<til::rect> selectionRects;
+            std::vector<til::rect> searchSelectionRects;
+            RenderSettings settings;
+            std::optional<interval_tree::IntervalTree<til::point, size_t>::interval> hoveredInterval;
+            uint16_t hyperlinkHoveredId = 0;
+            bool gridLineDrawingAllowed = false;
+        };
+        RenderSnapshot _snapshot;
+        // Whether a paint pass reads _snapshot instead of _pData is a local of
+        // that pass (the "fromSnapshot" parameter the paint helpers thread
+        // through): the two engines' passes can run concurrently, and only one
+        // of them may have published a snapshot.
+        // Serializes snapshot paint passes against the rare engine-mutating
+        // entry points (font/DPI changes, engine addition), which used to be
+        // ordered by the console lock alone. Always acquired while the
+        // console lock is held, never the other way around.
+        std::mutex _paintMutex;
+
+        // A ring buffer of the most recent frame timings, see GetFrameTimings().
+        // Slots are claimed with the atomic index since engines can paint on
+        // parallel tasks; the records themselves are written unsynchronized,
+        // which can tear a concurrent read. That's fine for diagnostics.
+        std::array<FrameTiming, 32> _frameTimings{};
+        std::atomic<size_t> _frameTimingIndex{ 0 };
+
+        static std::atomic<size_t> _tracelogCount;
+
 #ifdef UNIT_TESTING
         friend class ConptyOutputTests;
         friend class TerminalCoreUnitTests::ConptyRoundtripTests;
@@ -6,15 +6,22 @@
 
 #include "renderer.hpp"
 
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+
 #pragma hdrstop
 
 using namespace Microsoft::Console::Render;
 
+// Defined (and registered) in renderer.cpp.
+TRACELOGGING_DECLARE_PROVIDER(g_hRendererTraceProvider);
+
 RenderThread::RenderThread() :
     _pRenderer(nullptr),
     _hThread(nullptr),
     _hEvent(nullptr),
     _hPaintCompletedEvent(nullptr),
+    _hPaceTimer(nullptr),
     _fKeepRunning(true),
     _hPaintEnabledEvent(nullptr),
     _fNextFrameRequested(false),
@@ -51,6 +58,12 @@ RenderThread::~RenderThread()
         CloseHandle(_hPaintCompletedEvent);
         _hPaintCompletedEvent = nullptr;
     }
+
+    if (_hPaceTimer)
+    {
+        CloseHandle(_hPaceTimer);
+        _hPaceTimer = nullptr;
+    }
 }
 
 // Method Description:
@@ -120,6 +133,20 @@ RenderThread::~RenderThread()
         }
     }
 
+    if (SUCCEEDED(hr))
+    {
+        // Used by _pacePaint() to delay a paint by a few milliseconds. The high
+        // resolution variant requires Windows 10 1803, so fall back to a regular
+        // timer (and its ~15ms granularity) on older builds. If even that fails,
+        // it's no big deal either: we simply paint as fast as frames are requested.
+        auto hPaceTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (hPaceTimer == nullptr)
+        {
+            hPaceTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+        }
+        _hPaceTimer = hPaceTimer;
+    }
+
     if (SUCCEEDED(hr))
     {
         auto hThread = CreateThread(nullptr, // non-inheritable security attributes
@@ -211,16 +238,109 @@ DWORD WINAPI RenderThread::_ThreadProc()
 
             // see comment above
             ResetEvent(_hEvent);
+
+            // We actually went idle, so the frame that woke us up is something like a
+            // keystroke and should be painted immediately, without any batch window.
+            _paceBurstLength = 0;
+        }
+        else
+        {
+            // The next frame was requested before the previous one even finished:
+            // the output is arriving faster than we can paint it. Painting again
+            // right away would just present another frame that's immediately
+            // superseded, so wait a moment and let more of the pending output
+            // collapse into a single present.
+            _pacePaint();
         }
 
         ResetEvent(_hPaintCompletedEvent);
+
+        const auto paintStart = std::chrono::steady_clock::now();
+        _lastPaintStart = paintStart;
         LOG_IF_FAILED(_pRenderer->PaintFrame());
+        const auto paintDuration = std::chrono::steady_clock::now() - paintStart;
+        // An exponential moving average over recent paints. It tracks how quickly the
+        // pipeline can actually deliver frames, which is the cadence _pacePaint() targets.
+        _paintDurationEst += (paintDuration - _paintDurationEst) / 4;
+
         SetEvent(_hPaintCompletedEvent);
     }
 
     return S_OK;
 }
 
+// Delays the next paint by about one frame time. Painting at half the rate we're able
+// to halves the number of presents, without making the output look any less smooth:
+// the contents of the skipped frame would have been replaced right away regardless.
+// The window is adaptive in both directions: a frame that arrives after idle is never
+// delayed at all (see _ThreadProc), while a sustained burst of output (a large paste,
+// `cat`ing a big file) doubles the window every `burstRampFrames` consecutive paced
+// paints up to `burstMaxDelay`, so megabyte bursts collapse into far fewer presents.
+// A keypress arriving mid-burst thus pays at most `burstMaxDelay` of latency, and the
+// common post-idle keypress pays none.
+void RenderThread::_pacePaint() noexcept
+{
+    static constexpr std::chrono::steady_clock::duration maxDelay{ std::chrono::milliseconds{ 8 } };
+    static constexpr std::chrono::steady_clock::duration minDelay{ std::chrono::milliseconds{ 1 } };
+    static constexpr std::chrono::steady_clock::duration burstMaxDelay{ std::chrono::milliseconds{ 32 } };
+    static constexpr uint32_t burstRampFrames = 8;
+    static constexpr uint32_t burstMaxDoublings = 5;
+
+    const auto doublings = std::min(_paceBurstLength / burstRampFrames, burstMaxDoublings);
+    _paceBurstLength++;
+
+    auto delay = std::min(std::min(_paintDurationEst, maxDelay) * (1 << doublings), burstMaxDelay);
+
+    // If a consumer has declared its presentation rate (conpty does, see
+    // SetMinimumFrameInterval), there's no point in starting another paced
+    // frame before one interval has elapsed since the previous frame began:
+    // the terminal on the other end can't present it any sooner, it just has
+    // to parse it. Invalidations keep merging while we wait. Note that this
+    // only applies to paced paints; a frame that arrives after idle (say, a
+    // keystroke) is still painted immediately.
+    const std::chrono::nanoseconds minFrameInterval{ _minFrameIntervalNanos.load(std::memory_order_relaxed) };
+    if (minFrameInterval.count() > 0)
+    {
+        const auto untilDeadline = _lastPaintStart + minFrameInterval - std::chrono::steady_clock::now();
+        delay = std::max<std::chrono::steady_clock::duration>(delay, untilDeadline);
+    }
+
+    if (!_hPaceTimer || delay < minDelay)
+    {
+        return;
+    }
+
+    if (TraceLoggingProviderEnabled(g_hRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, 0))
+    {
+#pragma warning(suppress : 26477) // We don't control TraceLoggingWrite
+        TraceLoggingWrite(
+            g_hRendererTraceProvider,
+            "PacePaint",
+            TraceLoggingInt64(std::chrono::duration_cast<std::chrono::microseconds>(delay).count(), "delayMicroseconds"),
+            TraceLoggingUInt32(_paceBurstLength, "burstLength"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE));
+    }
+
+    // Negative due times are relative, in 100ns units.
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>>(delay).count();
+
+    if (SetWaitableTimer(_hPaceTimer, &dueTime, 0, nullptr, nullptr, FALSE))
+    {
+        WaitForSingleObject(_hPaceTimer, INFINITE);
+    }
+}
+
+// Method Description:
+// - Sets the shortest allowed time between the start of two consecutive paced
+//      paints. Pass a zero duration to remove the limit again. Used by conpty
+//      to coalesce rapid-fire client updates into frames at a rate the
+//      connected terminal can actually present (see VtIo::StartIfNeeded).
+void RenderThread::SetMinimumFrameInterval(const std::chrono::nanoseconds interval) noexcept
+{
+    _minFrameIntervalNanos.store(interval.count(), std::memory_order_relaxed);
+}
+
 void RenderThread::NotifyPaint() noexcept
 {
     if (_fWaiting.load(std::memory_order_acquire))
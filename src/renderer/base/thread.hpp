@@ -26,6 +26,7 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT Initialize(Renderer* const pRendererParent) noexcept;
 
+        void SetMinimumFrameInterval(const std::chrono::nanoseconds interval) noexcept;
         void NotifyPaint() noexcept;
         void EnablePainting() noexcept;
         void DisablePainting() noexcept;
@@ -34,17 +35,24 @@ namespace Microsoft::Console::Render
     private:
         static DWORD WINAPI s_ThreadProc(_In_ LPVOID lpParameter);
         DWORD WINAPI _ThreadProc();
+        void _pacePaint() noexcept;
 
         HANDLE _hThread;
         HANDLE _hEvent;
 
         HANDLE _hPaintEnabledEvent;
         HANDLE _hPaintCompletedEvent;
+        HANDLE _hPaceTimer;
 
         Renderer* _pRenderer; // Non-ownership pointer
 
         bool _fKeepRunning;
         std::atomic<bool> _fNextFrameRequested;
         std::atomic<bool> _fWaiting;
+
+        std::chrono::steady_clock::duration _paintDurationEst{};
+        std::chrono::steady_clock::time_point _lastPaintStart{};
+        uint32_t _paceBurstLength = 0;
+        std::atomic<int64_t> _minFrameIntervalNanos{ 0 };
     };
 }
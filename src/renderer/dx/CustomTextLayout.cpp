@@ -28,7 +28,8 @@ CustomTextLayout::CustomTextLayout(const gsl::not_null<DxFontRenderData*> fontRe
     _breakpoints{},
     _runIndex{ 0 },
     _width{ gsl::narrow_cast<size_t>(fontRenderData->GlyphCell().width) },
-    _isEntireTextSimple{ false }
+    _isEntireTextSimple{ false },
+    _shaped{ false }
 {
     _localeName.resize(gsl::narrow_cast<size_t>(fontRenderData->DefaultTextFormat()->GetLocaleNameLength()) + 1); // +1 for null
     THROW_IF_FAILED(fontRenderData->DefaultTextFormat()->GetLocaleName(_localeName.data(), gsl::narrow<UINT32>(_localeName.size())));
@@ -47,6 +48,7 @@ try
     _breakpoints.clear();
     _runIndex = 0;
     _isEntireTextSimple = false;
+    _shaped = false;
     _textClusterColumns.clear();
     _text.clear();
     _glyphScaleCorrections.clear();
@@ -68,6 +70,7 @@ CATCH_RETURN()
 [[nodiscard]] HRESULT STDMETHODCALLTYPE CustomTextLayout::AppendClusters(const std::span<const ::Microsoft::Console::Render::Cluster> clusters)
 try
 {
+    _shaped = false;
     _textClusterColumns.reserve(_textClusterColumns.size() + clusters.size());
 
     for (const auto& cluster : clusters)
@@ -159,17 +162,32 @@ try
         style = DWRITE_FONT_STYLE_ITALIC;
     }
 
-    _formatInUse = _fontRenderData->TextFormatWithAttribute(weight, style, stretch).Get();
-    _fontInUse = _fontRenderData->FontFaceWithAttribute(weight, style, stretch).Get();
+    const auto formatInUse = _fontRenderData->TextFormatWithAttribute(weight, style, stretch).Get();
+    const auto fontInUse = _fontRenderData->FontFaceWithAttribute(weight, style, stretch).Get();
 
-    RETURN_IF_FAILED(_AnalyzeTextComplexity());
-    RETURN_IF_FAILED(_AnalyzeRuns());
-    RETURN_IF_FAILED(_ShapeGlyphRuns());
-    RETURN_IF_FAILED(_CorrectGlyphRuns());
-    // Correcting box drawing has to come after both font fallback and
-    // the glyph run advance correction (which will apply a font size scaling factor).
-    // We need to know all the proposed X and Y dimension metrics to get this right.
-    RETURN_IF_FAILED(_CorrectBoxDrawing());
+    // If the current text was already analyzed and shaped with the same format
+    // and font (DxEngine caches layouts and draws repeated rows through them
+    // again), the steps below would just reproduce the state we're already
+    // holding, so we skip straight to handing the glyph runs to the renderer.
+    // Only the drawing context differs between such draws, and it doesn't
+    // participate in shaping; it's consumed by the renderer's callbacks.
+    if (!_shaped || _formatInUse != formatInUse || _fontInUse != fontInUse)
+    {
+        _shaped = false;
+        _formatInUse = formatInUse;
+        _fontInUse = fontInUse;
+
+        RETURN_IF_FAILED(_AnalyzeTextComplexity());
+        RETURN_IF_FAILED(_AnalyzeRuns());
+        RETURN_IF_FAILED(_ShapeGlyphRuns());
+        RETURN_IF_FAILED(_CorrectGlyphRuns());
+        // Correcting box drawing has to come after both font fallback and
+        // the glyph run advance correction (which will apply a font size scaling factor).
+        // We need to know all the proposed X and Y dimension metrics to get this right.
+        RETURN_IF_FAILED(_CorrectBoxDrawing());
+
+        _shaped = true;
+    }
 
     RETURN_IF_FAILED(_DrawGlyphRuns(clientDrawingContext, renderer, { originX, originY }));
 
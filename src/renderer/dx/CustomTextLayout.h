@@ -29,6 +29,12 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT STDMETHODCALLTYPE GetColumns(_Out_ UINT32* columns);
 
+        // The accumulated text and its cluster columns - the part of this layout's
+        // state that determines the shaping results. DxEngine's layout cache uses
+        // these to verify a hash hit against the actual key material.
+        [[nodiscard]] const std::wstring& Text() const noexcept { return _text; }
+        [[nodiscard]] const std::vector<UINT16>& ClusterColumns() const noexcept { return _textClusterColumns; }
+
         // IDWriteTextLayout methods (but we don't actually want to implement them all, so just this one matching the existing interface)
         [[nodiscard]] HRESULT STDMETHODCALLTYPE Draw(_In_opt_ void* clientDrawingContext,
                                                      _In_ IDWriteTextRenderer* renderer,
@@ -180,6 +186,10 @@ namespace Microsoft::Console::Render
         // Whether the entire text is determined to be simple and does not require full script shaping.
         bool _isEntireTextSimple;
 
+        // Whether the current text has already been analyzed and shaped, in which
+        // case Draw() can skip straight to handing the glyph runs to the renderer.
+        bool _shaped;
+
         std::vector<DWRITE_GLYPH_OFFSET> _glyphOffsets;
 
         // Clusters are complicated. They're in respect to each individual run.
@@ -11,6 +11,7 @@
 #include "../../inc/unicode.hpp"
 #include "../../inc/DefaultSettings.h"
 #include <VersionHelpers.h>
+#include <til/hash.h>
 
 #include "ScreenPixelShader.h"
 #include "ScreenVertexShader.h"
@@ -1680,18 +1681,104 @@ try
     }
     else
     {
-        // Create the text layout
-        RETURN_IF_FAILED(_customLayout->Reset());
-        RETURN_IF_FAILED(_customLayout->AppendClusters(clusters));
-
-        // Layout then render the text
-        RETURN_IF_FAILED(_customLayout->Draw(_drawingContext.get(), _customRenderer.Get(), origin.x, origin.y));
+        // Layout then render the text, reusing an already shaped layout if this
+        // line came through recently.
+        RETURN_IF_FAILED(_DrawTextViaLayoutCache(clusters, origin));
     }
 
     return S_OK;
 }
 CATCH_RETURN()
 
+// Routine Description:
+// - Draws one line of text through the layout cache, analyzing and shaping it
+//   only if no identical line was drawn recently. See _textLayoutCache.
+// Arguments:
+// - clusters - Iterable collection of cluster information (text and columns it should consume)
+// - origin - Pixel coordinate position of the top left corner of the line
+// Return Value:
+// - S_OK or relevant DirectX error
+[[nodiscard]] HRESULT DxEngine::_DrawTextViaLayoutCache(const std::span<const Cluster> clusters, const D2D1_POINT_2F origin) noexcept
+try
+{
+    const auto drawingContext = _drawingContext.get();
+
+    til::hasher hasher;
+    for (const auto& cluster : clusters)
+    {
+        const auto text = cluster.GetText();
+        hasher.write(text.data(), text.size());
+        hasher.write(gsl::narrow_cast<UINT16>(cluster.GetColumns()));
+    }
+    hasher.write(gsl::narrow_cast<uint8_t>((drawingContext->useBoldFont ? 1 : 0) | (drawingContext->useItalicFont ? 2 : 0)));
+    const auto hash = hasher.finalize();
+
+    const auto matches = [&](const CachedTextLayout& entry) {
+        if (entry.usedBoldFont != drawingContext->useBoldFont || entry.usedItalicFont != drawingContext->useItalicFont)
+        {
+            return false;
+        }
+
+        const auto& text = entry.layout->Text();
+        const auto& columns = entry.layout->ClusterColumns();
+        size_t pos = 0;
+        for (const auto& cluster : clusters)
+        {
+            const auto clusterText = cluster.GetText();
+            if (pos + clusterText.size() > text.size() ||
+                text.compare(pos, clusterText.size(), clusterText) != 0 ||
+                til::at(columns, pos) != cluster.GetColumns())
+            {
+                return false;
+            }
+            // AppendClusters fills the columns of a multi-character cluster with 0s past the first.
+            for (size_t i = 1; i < clusterText.size(); ++i)
+            {
+                if (til::at(columns, pos + i) != 0)
+                {
+                    return false;
+                }
+            }
+            pos += clusterText.size();
+        }
+        return pos == text.size();
+    };
+
+    auto it = _textLayoutCache.find(hash);
+    if (it == _textLayoutCache.end())
+    {
+        const auto prevIt = _textLayoutCachePrevious.find(hash);
+        if (prevIt != _textLayoutCachePrevious.end())
+        {
+            // Promote the entry into the current generation so that it survives the next flip.
+            it = _textLayoutCache.insert_or_assign(hash, std::move(prevIt->second)).first;
+            _textLayoutCachePrevious.erase(prevIt);
+        }
+    }
+
+    if (it == _textLayoutCache.end() || !matches(it->second))
+    {
+        // Once the current generation holds a couple screens worth of rows,
+        // it replaces the previous one and starts over empty.
+        if (it == _textLayoutCache.end() && _textLayoutCache.size() >= 256)
+        {
+            _textLayoutCachePrevious = std::move(_textLayoutCache);
+            _textLayoutCache.clear();
+        }
+
+        CachedTextLayout entry;
+        entry.layout = WRL::Make<CustomTextLayout>(_fontRenderData.get());
+        RETURN_HR_IF_NULL(E_OUTOFMEMORY, entry.layout);
+        RETURN_IF_FAILED(entry.layout->AppendClusters(clusters));
+        entry.usedBoldFont = drawingContext->useBoldFont;
+        entry.usedItalicFont = drawingContext->useItalicFont;
+        it = _textLayoutCache.insert_or_assign(hash, std::move(entry)).first;
+    }
+
+    return it->second.layout->Draw(_drawingContext.get(), _customRenderer.Get(), origin.x, origin.y);
+}
+CATCH_RETURN()
+
 // Routine Description:
 // - Paints lines around cells (draws in pieces of the grid)
 // Arguments:
@@ -2028,6 +2115,10 @@ try
     // Prepare the text layout.
     _customLayout = WRL::Make<CustomTextLayout>(_fontRenderData.get());
 
+    // The cached layouts were shaped with the old font.
+    _textLayoutCache.clear();
+    _textLayoutCachePrevious.clear();
+
     // Inform the soft font of the new cell size so it can scale appropriately.
     return _softFont.SetTargetSize(_fontRenderData->GlyphCell());
 }
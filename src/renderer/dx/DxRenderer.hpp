@@ -182,7 +182,7 @@ namespace Microsoft::Console::Render
 
         bool _firstFrame;
         std::pmr::unsynchronized_pool_resource _pool;
-        til::pmr::bitmap _invalidMap;
+        til::pmr::hierarchical_bitmap _invalidMap;
         til::point _invalidScroll;
         bool _allInvalid;
 
@@ -202,6 +202,25 @@ namespace Microsoft::Console::Render
         ::Microsoft::WRL::ComPtr<IDWriteFactory1> _dwriteFactory;
         ::Microsoft::WRL::ComPtr<CustomTextLayout> _customLayout;
         ::Microsoft::WRL::ComPtr<CustomTextRenderer> _customRenderer;
+
+        // A cache of already shaped per-row text layouts, mirroring the shaped run
+        // cache in AtlasEngine: the WPF control still renders through this engine,
+        // and during fast output the same rows come through over and over while
+        // the DirectWrite analysis and shaping dominate the cost of painting them.
+        // Colors aren't part of the key because they flow through the drawing
+        // context at draw time and don't participate in shaping. The key material
+        // is stored in full (the layout itself holds it) and verified before reuse.
+        struct CachedTextLayout
+        {
+            ::Microsoft::WRL::ComPtr<CustomTextLayout> layout;
+            bool usedBoldFont = false;
+            bool usedItalicFont = false;
+        };
+        // The cache ages in two generations: lookups check both, insertions go into
+        // the first, and once it's full it replaces the second. That bounds it to
+        // roughly the most recently painted couple of screens worth of rows.
+        std::unordered_map<size_t, CachedTextLayout> _textLayoutCache;
+        std::unordered_map<size_t, CachedTextLayout> _textLayoutCachePrevious;
         ::Microsoft::WRL::ComPtr<ID2D1StrokeStyle> _strokeStyle;
         ::Microsoft::WRL::ComPtr<ID2D1StrokeStyle> _dashStrokeStyle;
 
@@ -302,6 +321,8 @@ namespace Microsoft::Console::Render
             _In_ size_t StringLength,
             _Out_ IDWriteTextLayout** ppTextLayout) noexcept;
 
+        [[nodiscard]] HRESULT _DrawTextViaLayoutCache(const std::span<const Cluster> clusters, const D2D1_POINT_2F origin) noexcept;
+
         [[nodiscard]] HRESULT _CopyFrontToBack() noexcept;
 
         [[nodiscard]] HRESULT _EnableDisplayAccess(const bool outputEnabled) noexcept;
@@ -269,13 +269,31 @@ GdiEngine::~GdiEngine()
                                                       const bool usingSoftFont,
                                                       const bool isSettingDefaultBrushes) noexcept
 {
-    RETURN_IF_FAILED(_FlushBufferLines());
-
     RETURN_HR_IF_NULL(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), _hdcMemoryContext);
 
     // Set the colors for painting text
     const auto [colorForeground, colorBackground] = renderSettings.GetAttributeColors(textAttributes);
 
+    // If the font type has changed, select an appropriate font variant or soft font.
+    const auto usingItalicFont = textAttributes.IsItalic();
+    const auto fontType = usingSoftFont   ? FontType::Soft :
+                          usingItalicFont ? FontType::Italic :
+                                            FontType::Default;
+
+    // The buffered PolyText lines were queued against the current DC state, so
+    // they have to be drawn out before that state changes. But only then:
+    // distinct attributes frequently resolve to the same colors and font (think
+    // of text that only toggles intense, or stripes of colors dim maps onto one
+    // another), and flushing on every run boundary regardless degrades the
+    // batching to one ExtTextOut per run.
+    const auto stateChanged = colorForeground != _lastFg ||
+                              colorBackground != _lastBg ||
+                              fontType != _lastFontType;
+    if (stateChanged || isSettingDefaultBrushes)
+    {
+        RETURN_IF_FAILED(_FlushBufferLines());
+    }
+
     if (colorForeground != _lastFg)
     {
         RETURN_HR_IF(E_FAIL, CLR_INVALID == SetTextColor(_hdcMemoryContext, colorForeground));
@@ -296,11 +314,6 @@ GdiEngine::~GdiEngine()
         RETURN_IF_FAILED(s_SetWindowLongWHelper(_hwndTargetWindow, GWL_CONSOLE_BKCOLOR, colorBackground));
     }
 
-    // If the font type has changed, select an appropriate font variant or soft font.
-    const auto usingItalicFont = textAttributes.IsItalic();
-    const auto fontType = usingSoftFont   ? FontType::Soft :
-                          usingItalicFont ? FontType::Italic :
-                                            FontType::Default;
     if (fontType != _lastFontType)
     {
         switch (fontType)
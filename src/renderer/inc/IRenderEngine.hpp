@@ -58,6 +58,12 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT StartPaint() noexcept = 0;
         [[nodiscard]] virtual HRESULT EndPaint() noexcept = 0;
         [[nodiscard]] virtual bool RequiresContinuousRedraw() noexcept = 0;
+        // Whether the paint-phase methods (PaintBufferLine, PaintSelection,
+        // PaintCursor, ...) may be called without the console lock held,
+        // reading from the renderer's published snapshot instead of live
+        // console state. Engines that consult IRenderData while painting
+        // must leave this at false.
+        [[nodiscard]] virtual bool CanPaintWithoutConsoleLock() const noexcept { return false; }
         virtual void WaitUntilCanRender() noexcept = 0;
         [[nodiscard]] virtual HRESULT Present() noexcept = 0;
         [[nodiscard]] virtual HRESULT PrepareForTeardown(_Out_ bool* pForcePaint) noexcept = 0;
@@ -31,6 +31,7 @@ namespace Microsoft::Console::Render
         RenderSettings() noexcept;
         void SetRenderMode(const Mode mode, const bool enabled) noexcept;
         bool GetRenderMode(const Mode mode) const noexcept;
+        uint64_t GetColorGeneration() const noexcept;
         const std::array<COLORREF, TextColor::TABLE_SIZE>& GetColorTable() const noexcept;
         void ResetColorTable() noexcept;
         void SetColorTableEntry(const size_t tableIndex, const COLORREF color);
@@ -45,9 +46,23 @@ namespace Microsoft::Console::Render
         void ToggleBlinkRendition(class Renderer& renderer) noexcept;
 
     private:
+        // A resolved fg/bg pair for one attribute, as produced by
+        // GetAttributeColors. Entries are only valid while their generation
+        // matches _colorGeneration; anything that feeds into the color math
+        // bumps the generation to void the cache wholesale.
+        struct ResolvedAttributeColors
+        {
+            TextAttribute attr;
+            COLORREF foreground = 0;
+            COLORREF background = 0;
+            uint64_t generation = 0;
+        };
+
         til::enumset<Mode> _renderMode{ Mode::BlinkAllowed, Mode::IntenseIsBright };
         std::array<COLORREF, TextColor::TABLE_SIZE> _colorTable;
         std::array<size_t, static_cast<size_t>(ColorAlias::ENUM_COUNT)> _colorAliasIndices;
+        mutable std::array<ResolvedAttributeColors, 64> _attributeColorCache{};
+        uint64_t _colorGeneration = 1;
         size_t _blinkCycle = 0;
         mutable bool _blinkIsInUse = false;
         bool _blinkShouldBeFaint = false;
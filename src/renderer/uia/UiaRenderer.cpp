@@ -20,12 +20,23 @@ UiaEngine::UiaEngine(IUiaEventDispatcher* dispatcher) :
     _textBufferChanged{ false },
     _cursorChanged{ false },
     _isEnabled{ true },
-    _prevSelection{},
     _prevCursorRegion{},
+    _dispatchThrottle{ std::chrono::milliseconds{ 50 }, [this]() { _dispatchSignals(); } },
     RenderEngineBase()
 {
 }
 
+UiaEngine::~UiaEngine()
+{
+    // Deliver anything still pending while the dispatcher is alive, and make
+    // sure no threadpool dispatch is left racing against a destroyed engine.
+    try
+    {
+        _dispatchThrottle.flush();
+    }
+    CATCH_LOG();
+}
+
 // Routine Description:
 // - Sets this engine to enabled allowing presentation to occur
 // Arguments:
@@ -52,6 +63,12 @@ UiaEngine::UiaEngine(IUiaEventDispatcher* dispatcher) :
     // back around to actually paint, we will just no-op. No sense in keeping
     // the data buffered.
     _newOutput = std::wstring{};
+    try
+    {
+        std::unique_lock guard{ _pendingSignalsLock };
+        _pendingOutput = std::wstring{};
+    }
+    CATCH_LOG();
 
     return S_OK;
 }
@@ -107,43 +124,14 @@ CATCH_RETURN();
 // - Notifies us that the console has changed the selection region and would
 //      like it updated
 // Arguments:
-// - rectangles - One or more rectangles describing character positions on the grid
+// - rectangles - The character positions on the grid whose selection state
+//      changed. The renderer only hands us the difference between the old and
+//      new selections, so an empty list means the selection is unchanged.
 // Return Value:
 // - S_OK
 [[nodiscard]] HRESULT UiaEngine::InvalidateSelection(const std::vector<til::rect>& rectangles) noexcept
 {
-    // early exit: different number of rows
-    if (_prevSelection.size() != rectangles.size())
-    {
-        try
-        {
-            _selectionChanged = true;
-            _prevSelection = rectangles;
-        }
-        CATCH_LOG_RETURN_HR(E_FAIL);
-        return S_OK;
-    }
-
-    for (size_t i = 0; i < rectangles.size(); i++)
-    {
-        try
-        {
-            const auto prevRect = _prevSelection.at(i);
-            const auto newRect = rectangles.at(i);
-
-            // if any value is different, selection has changed
-            if (prevRect.top != newRect.top || prevRect.right != newRect.right || prevRect.left != newRect.left || prevRect.bottom != newRect.bottom)
-            {
-                _selectionChanged = true;
-                _prevSelection = rectangles;
-                return S_OK;
-            }
-        }
-        CATCH_LOG_RETURN_HR(E_FAIL);
-    }
-
-    // assume selection has not changed
-    _selectionChanged = false;
+    _selectionChanged = _selectionChanged || !rectangles.empty();
     return S_OK;
 }
 
@@ -264,8 +252,57 @@ void UiaEngine::WaitUntilCanRender() noexcept
 {
     RETURN_HR_IF(S_FALSE, !_isEnabled);
 
-    // Fire UIA Events here
-    if (_selectionChanged)
+    // Don't fire the UIA events here: raising them crosses the process
+    // boundary to the automation client, and a slow screen reader would back
+    // up the render thread. Instead, accumulate this frame's signals and let
+    // the throttle dispatch them on a threadpool thread. The delay window also
+    // coalesces the per-paint notification flood that fast output produces
+    // into one consolidated update, so clients don't get swamped.
+    try
+    {
+        std::unique_lock guard{ _pendingSignalsLock };
+        _pendingSelectionChanged |= _selectionChanged;
+        _pendingTextBufferChanged |= _textBufferChanged;
+        _pendingCursorChanged |= _cursorChanged;
+        _pendingOutput.append(_queuedOutput);
+    }
+    CATCH_LOG();
+
+    _dispatchThrottle();
+
+    _selectionChanged = false;
+    _textBufferChanged = false;
+    _cursorChanged = false;
+    _isPainting = false;
+    _queuedOutput.clear();
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Fires the accumulated automation events. Runs on a threadpool thread, at
+//      most once per throttle window; see Present for why this is detached
+//      from the render thread.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void UiaEngine::_dispatchSignals() noexcept
+try
+{
+    auto selectionChanged = false;
+    auto textBufferChanged = false;
+    auto cursorChanged = false;
+    std::wstring output;
+    {
+        std::unique_lock guard{ _pendingSignalsLock };
+        selectionChanged = std::exchange(_pendingSelectionChanged, false);
+        textBufferChanged = std::exchange(_pendingTextBufferChanged, false);
+        cursorChanged = std::exchange(_pendingCursorChanged, false);
+        output.swap(_pendingOutput);
+    }
+
+    if (selectionChanged)
     {
         try
         {
@@ -273,7 +310,7 @@ void UiaEngine::WaitUntilCanRender() noexcept
         }
         CATCH_LOG();
     }
-    if (_textBufferChanged)
+    if (textBufferChanged)
     {
         try
         {
@@ -281,7 +318,7 @@ void UiaEngine::WaitUntilCanRender() noexcept
         }
         CATCH_LOG();
     }
-    if (_cursorChanged)
+    if (cursorChanged)
     {
         try
         {
@@ -295,22 +332,15 @@ void UiaEngine::WaitUntilCanRender() noexcept
         // Break up the output into 1000 character chunks to ensure
         // the output isn't cut off.
         static constexpr size_t sapiLimit{ 1000 };
-        const std::wstring_view output{ _queuedOutput };
-        for (size_t offset = 0; offset < output.size(); offset += sapiLimit)
+        const std::wstring_view outputView{ output };
+        for (size_t offset = 0; offset < outputView.size(); offset += sapiLimit)
         {
-            _dispatcher->NotifyNewOutput(output.substr(offset, sapiLimit));
+            _dispatcher->NotifyNewOutput(outputView.substr(offset, sapiLimit));
         }
     }
     CATCH_LOG();
-
-    _selectionChanged = false;
-    _textBufferChanged = false;
-    _cursorChanged = false;
-    _isPainting = false;
-    _queuedOutput.clear();
-
-    return S_OK;
 }
+CATCH_LOG()
 
 // Routine Description:
 // - This is currently unused.
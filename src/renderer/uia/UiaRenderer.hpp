@@ -20,12 +20,15 @@ Author(s):
 #include "../../types/IUiaEventDispatcher.h"
 #include "../../types/inc/Viewport.hpp"
 
+#include <til/throttled_func.h>
+
 namespace Microsoft::Console::Render
 {
     class UiaEngine final : public RenderEngineBase
     {
     public:
         UiaEngine(Microsoft::Console::Types::IUiaEventDispatcher* dispatcher);
+        ~UiaEngine();
 
         // Only one UiaEngine may present information at a time.
         // This ensures that an automation client isn't overwhelmed
@@ -66,6 +69,8 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _DoUpdateTitle(const std::wstring_view newTitle) noexcept override;
 
     private:
+        void _dispatchSignals() noexcept;
+
         bool _isEnabled;
         bool _isPainting;
         bool _selectionChanged;
@@ -76,7 +81,16 @@ namespace Microsoft::Console::Render
 
         Microsoft::Console::Types::IUiaEventDispatcher* _dispatcher;
 
-        std::vector<til::rect> _prevSelection;
         til::rect _prevCursorRegion;
+
+        // Signal state accumulated across frames until _dispatchThrottle fires
+        // _dispatchSignals on a threadpool thread. Guarded by
+        // _pendingSignalsLock, since Present and the dispatch race.
+        std::shared_mutex _pendingSignalsLock;
+        bool _pendingSelectionChanged = false;
+        bool _pendingTextBufferChanged = false;
+        bool _pendingCursorChanged = false;
+        std::wstring _pendingOutput;
+        til::throttled_func_trailing<> _dispatchThrottle;
     };
 }
@@ -18,10 +18,38 @@ using namespace Microsoft::Console::Types;
 // Return Value:
 // - S_OK.
 [[nodiscard]] HRESULT VtEngine::GetDirtyArea(std::span<const til::rect>& area) noexcept
+try
 {
-    area = _invalidMap.runs();
+    const auto runs = _invalidMap.runs();
+
+    // Coalesce runs in the same row(s) that are separated by only a handful of
+    // unchanged columns. Merging them means we'll repaint the few cells in
+    // between, but that costs at most a couple bytes per column, while
+    // addressing each run separately costs a cursor-forward sequence (CSI n C)
+    // and potentially another round of SGR transitions at the run boundary.
+    // The runs are produced in row-major order, so only neighboring entries
+    // can ever merge.
+    _coalescedRuns.clear();
+    _coalescedRuns.reserve(runs.size());
+    for (const auto& run : runs)
+    {
+        if (!_coalescedRuns.empty())
+        {
+            auto& last = _coalescedRuns.back();
+            if (last.top == run.top && last.bottom == run.bottom &&
+                run.left >= last.right && run.left - last.right <= RUN_COALESCE_MAX_GAP)
+            {
+                last.right = run.right;
+                continue;
+            }
+        }
+        _coalescedRuns.push_back(run);
+    }
+
+    area = _coalescedRuns;
     return S_OK;
 }
+CATCH_RETURN();
 
 // Routine Description:
 // - Uses the currently selected font to determine how wide the given character will be when rendered.
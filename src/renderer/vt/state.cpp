@@ -63,6 +63,27 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
     // member is only defined when UNIT_TESTING is.
     _usingTestCallback = false;
 #endif
+
+    // When unit testing without a pipe there's nothing to write to either.
+    if (_hFile)
+    {
+        _writerThread = std::thread(&VtEngine::_writerThreadProc, this);
+    }
+}
+
+VtEngine::~VtEngine()
+{
+    if (_writerThread.joinable())
+    {
+        {
+            std::lock_guard lock{ _writerMutex };
+            _writerExit = true;
+        }
+        // The writer drains whatever is still pending before it exits, so that
+        // the final frame isn't lost when the console shuts down.
+        _writerWork.notify_one();
+        _writerThread.join();
+    }
 }
 
 // Method Description:
@@ -147,18 +168,143 @@ void VtEngine::_flushImpl() noexcept
 {
     if (_hFile)
     {
-        const auto fSuccess = WriteFile(_hFile.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), nullptr, nullptr);
-        _buffer.clear();
-        if (!fSuccess)
+        const auto bytes = _buffer.size();
+        if (!_enqueueWrite(_buffer))
         {
-            LOG_LAST_ERROR();
-            _hFile.reset();
-            if (_terminalOwner)
+            _buffer.clear();
+            _closeOutput();
+            return;
+        }
+        _trace.TraceFlush(bytes, _buffer.capacity());
+
+        // clear() retains the allocation, so steady-state rendering doesn't
+        // exercise the allocator at all. But a single giant frame (a full
+        // repaint of a large viewport, say) would pin its allocation forever.
+        // Track the high-water mark over a window of flushes and release the
+        // excess once it's clear the capacity is no longer being used.
+        static constexpr size_t trimFlushInterval = 256;
+        static constexpr size_t trimCapacityFloor = 16 * 1024;
+        _flushHighWater = std::max(_flushHighWater, bytes);
+        if (++_flushesSinceTrim >= trimFlushInterval)
+        {
+            if (_buffer.capacity() > std::max(_flushHighWater * 2, trimCapacityFloor))
             {
-                _terminalOwner->CloseOutput();
+                _buffer.shrink_to_fit();
+                _buffer.reserve(_flushHighWater);
             }
+            _flushHighWater = 0;
+            _flushesSinceTrim = 0;
+        }
+    }
+}
+
+// Hands the accumulated bytes off to the writer thread and empties str.
+// Returns false if the writer has failed, in which case the caller owns the
+// error handling (see _closeOutput).
+bool VtEngine::_enqueueWrite(std::string& str) noexcept
+{
+    {
+        std::lock_guard lock{ _writerMutex };
+        if (_writerError)
+        {
+            return false;
+        }
+        if (_writerPending.empty())
+        {
+            std::swap(_writerPending, str);
+        }
+        else
+        {
+            // The writer is still draining an earlier batch. Ride along with
+            // it: both leave in a single WriteFile once the pipe has room.
+            _writerPending.append(str);
+        }
+    }
+    _writerWork.notify_one();
+    str.clear();
+    return true;
+}
+
+// Same as above for borrowed bytes, which always have to be copied.
+bool VtEngine::_enqueueWrite(const std::string_view str) noexcept
+{
+    {
+        std::lock_guard lock{ _writerMutex };
+        if (_writerError)
+        {
+            return false;
+        }
+        _writerPending.append(str);
+    }
+    _writerWork.notify_one();
+    return true;
+}
+
+// Called on the render thread once a write has failed (the writer thread only
+// records the failure, because this cleanup runs under the console lock).
+// Mirrors what a failed synchronous WriteFile used to do: drop the handle and
+// tell VtIo that the output is gone.
+void VtEngine::_closeOutput() noexcept
+{
+    _hFile.reset();
+    if (_terminalOwner)
+    {
+        _terminalOwner->CloseOutput();
+    }
+}
+
+// The writer thread's loop. Every iteration grabs everything that has
+// accumulated in _writerPending and writes it to the pipe in one go, so the
+// effective batch size grows automatically whenever the terminal reads more
+// slowly than we produce. Exits when asked to (draining what's left first) or
+// when a write fails.
+void VtEngine::_writerThreadProc() noexcept
+{
+    LOG_IF_FAILED(SetThreadDescription(GetCurrentThread(), L"ConPTY Output Writer Thread"));
+
+    std::string work;
+    std::unique_lock lock{ _writerMutex };
+    for (;;)
+    {
+        _writerWork.wait(lock, [this]() { return !_writerPending.empty() || _writerExit; });
+        if (_writerPending.empty())
+        {
+            break;
+        }
+
+        std::swap(work, _writerPending);
+        lock.unlock();
+        // Anyone blocked in WaitUntilCanRender can produce the next frame
+        // while this batch drains.
+        _writerDrained.notify_all();
+
+        const auto fSuccess = WriteFile(_hFile.get(), work.data(), gsl::narrow_cast<DWORD>(work.size()), nullptr, nullptr);
+
+        lock.lock();
+        work.clear();
+        if (!fSuccess)
+        {
+            LOG_LAST_ERROR();
+            _writerError = true;
+            break;
         }
     }
+    lock.unlock();
+    _writerDrained.notify_all();
+}
+
+// Method Description:
+// - Blocks the render thread, outside the console lock, until the writer
+//   thread has drained its backlog to something reasonable. This is the
+//   backpressure that the synchronous WriteFile used to apply: without it a
+//   terminal that stops reading would let _writerPending grow without bound.
+//   The base class implementation additionally throttled the render loop with
+//   a fixed sleep, which is no longer needed now that conpty frames are paced
+//   by the renderer's minimum frame interval.
+void VtEngine::WaitUntilCanRender() noexcept
+{
+    std::unique_lock lock{ _writerMutex };
+    _writerDrained.wait(lock, [this]() { return _writerPending.size() < _writerBacklogLimit || _writerError; });
 }
 
 // The name of this method is an analogy to TCP_CORK. It instructs
@@ -174,6 +320,28 @@ void VtEngine::Cork(bool corked) noexcept
 // - Wrapper for _Write.
 [[nodiscard]] HRESULT VtEngine::WriteTerminalUtf8(const std::string_view str) noexcept
 {
+#ifdef UNIT_TESTING
+    if (_usingTestCallback)
+    {
+        return _Write(str);
+    }
+#endif
+
+    // This method only serves the ConPTY passthrough path (VtApiRoutines), which
+    // hands us whole client writes verbatim and flushes immediately afterwards.
+    // Large payloads skip the staging buffer and go straight to the writer, so
+    // passthrough throughput isn't capped by an extra full-size memcpy.
+    if (str.size() >= 4096 && _buffer.empty() && !_corked && _hFile)
+    {
+        _trace.TraceString(str);
+        if (!_enqueueWrite(str))
+        {
+            _closeOutput();
+            return E_FAIL;
+        }
+        return S_OK;
+    }
+
     return _Write(str);
 }
 
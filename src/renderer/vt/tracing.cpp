@@ -81,6 +81,23 @@ void RenderTracing::TraceStringFill(const size_t n, const char c) const
     UNREFERENCED_PARAMETER(c);
 #endif // UNIT_TESTING
 }
+void RenderTracing::TraceFlush(const size_t bytes, const size_t capacity) const
+{
+#ifndef UNIT_TESTING
+    if (TraceLoggingProviderEnabled(g_hConsoleVtRendererTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
+    {
+        TraceLoggingWrite(g_hConsoleVtRendererTraceProvider,
+                          "VtEngine_TraceFlush",
+                          TraceLoggingUInt64(gsl::narrow_cast<uint64_t>(bytes), "bytes"),
+                          TraceLoggingUInt64(gsl::narrow_cast<uint64_t>(capacity), "capacity"),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                          TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+    }
+#else
+    UNREFERENCED_PARAMETER(bytes);
+    UNREFERENCED_PARAMETER(capacity);
+#endif // UNIT_TESTING
+}
 void RenderTracing::TraceString(const std::string_view& instr) const
 {
 #ifndef UNIT_TESTING
@@ -167,7 +184,7 @@ void RenderTracing::TraceInvalidateScroll(const til::point scroll) const
 }
 
 void RenderTracing::TraceStartPaint(const bool quickReturn,
-                                    const til::pmr::bitmap& invalidMap,
+                                    const til::pmr::hierarchical_bitmap& invalidMap,
                                     const til::rect& lastViewport,
                                     const til::point scrollDelt,
                                     const bool cursorMoved,
@@ -28,6 +28,7 @@ namespace Microsoft::Console::VirtualTerminal
         ~RenderTracing();
         void TraceStringFill(const size_t n, const char c) const;
         void TraceString(const std::string_view& str) const;
+        void TraceFlush(const size_t bytes, const size_t capacity) const;
         void TraceInvalidate(const til::rect& view) const;
         void TraceLastText(const til::point lastText) const;
         void TraceScrollFrame(const til::point scrollDelta) const;
@@ -40,7 +41,7 @@ namespace Microsoft::Console::VirtualTerminal
         void TraceTriggerCircling(const bool newFrame) const;
         void TraceInvalidateScroll(const til::point scroll) const;
         void TraceStartPaint(const bool quickReturn,
-                             const til::pmr::bitmap& invalidMap,
+                             const til::pmr::hierarchical_bitmap& invalidMap,
                              const til::rect& lastViewport,
                              const til::point scrollDelta,
                              const bool cursorMoved,
@@ -18,8 +18,11 @@ Author(s):
 #include "../inc/RenderEngineBase.hpp"
 #include "../../types/inc/Viewport.hpp"
 #include "tracing.hpp"
-#include <string>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
 
 // fwdecl unittest classes
 #ifdef UNIT_TESTING
@@ -42,15 +45,21 @@ namespace Microsoft::Console::Render
     public:
         // See _PaintUtf8BufferLine for explanation of this value.
         static const size_t ERASE_CHARACTER_STRING_LENGTH = 8;
+        // See GetDirtyArea. A cursor-forward sequence is up to 6 bytes
+        // (CSI %d %d C), so overwriting a gap of this many columns is no more
+        // expensive than skipping over it.
+        static const til::CoordType RUN_COALESCE_MAX_GAP = 4;
         static const til::point INVALID_COORDS;
 
         VtEngine(_In_ wil::unique_hfile hPipe,
                  const Microsoft::Console::Types::Viewport initialViewport);
+        ~VtEngine() override;
 
         // IRenderEngine
         [[nodiscard]] HRESULT StartPaint() noexcept override;
         [[nodiscard]] HRESULT EndPaint() noexcept override;
         [[nodiscard]] HRESULT Present() noexcept override;
+        void WaitUntilCanRender() noexcept override;
         [[nodiscard]] HRESULT PrepareForTeardown(_Out_ bool* pForcePaint) noexcept override;
         [[nodiscard]] HRESULT Invalidate(const til::rect* psrRegion) noexcept override;
         [[nodiscard]] HRESULT InvalidateCursor(const til::rect* psrRegion) noexcept override;
@@ -95,6 +104,27 @@ namespace Microsoft::Console::Render
     protected:
         wil::unique_hfile _hFile;
         std::string _buffer;
+        // See _flushImpl: the largest flush seen in the current trim window,
+        // and how many flushes that window has covered so far.
+        size_t _flushHighWater = 0;
+        size_t _flushesSinceTrim = 0;
+
+        // All pipe writes happen on a dedicated writer thread: _flushImpl()
+        // hands the finished frame over via _writerPending and returns, so a
+        // slow terminal can't stall the render thread, which paints while
+        // holding the console lock. While the writer drains one batch, further
+        // frames pile into _writerPending and leave in a single WriteFile, so
+        // the batch size adapts to however slowly the pipe drains; when the
+        // pipe is idle, a flush is picked up immediately. WaitUntilCanRender()
+        // supplies the backpressure the blocking WriteFile used to provide.
+        static constexpr size_t _writerBacklogLimit = 1024 * 1024;
+        std::mutex _writerMutex;
+        std::condition_variable _writerWork;
+        std::condition_variable _writerDrained;
+        std::string _writerPending;
+        bool _writerExit = false;
+        bool _writerError = false;
+        std::thread _writerThread;
 
         std::string _formatBuffer;
         std::string _conversionBuffer;
@@ -109,7 +139,8 @@ namespace Microsoft::Console::Render
         Microsoft::Console::Types::Viewport _lastViewport;
 
         std::pmr::unsynchronized_pool_resource _pool;
-        til::pmr::bitmap _invalidMap;
+        til::pmr::hierarchical_bitmap _invalidMap;
+        std::vector<til::rect> _coalescedRuns;
 
         til::point _lastText;
         til::point _scrollDelta;
@@ -145,6 +176,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _Write(std::string_view const str) noexcept;
         void _Flush() noexcept;
         void _flushImpl() noexcept;
+        bool _enqueueWrite(std::string& str) noexcept;
+        bool _enqueueWrite(const std::string_view str) noexcept;
+        void _closeOutput() noexcept;
+        void _writerThreadProc() noexcept;
 
         template<typename S, typename... Args>
         [[nodiscard]] HRESULT _WriteFormatted(S&& format, Args&&... args)
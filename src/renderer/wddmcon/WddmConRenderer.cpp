@@ -214,6 +214,40 @@ CATCH_RETURN()
 try
 {
     RETURN_LAST_ERROR_IF(_hWddmConCtx == INVALID_HANDLE_VALUE);
+
+    // Submit each row that actually changed since the last frame in a single
+    // call. `Old` holds what was last handed to the driver, so rows whose
+    // contents came out identical (the common case: most of the screen stays
+    // static while a line or two scrolls in) are skipped entirely.
+    for (LONG rowIndex = 0; rowIndex < _displayHeight; rowIndex++)
+    {
+        const auto Row = _displayState[rowIndex];
+
+        auto changed = false;
+        for (LONG colIndex = 0; colIndex < _displayWidth; colIndex++)
+        {
+            const auto OldChar = &Row->Old[colIndex];
+            const auto NewChar = &Row->New[colIndex];
+
+            if (OldChar->Character != NewChar->Character || OldChar->Attribute != NewChar->Attribute)
+            {
+                changed = true;
+                break;
+            }
+        }
+
+        if (changed)
+        {
+            RETURN_IF_FAILED(WDDMConUpdateDisplay(_hWddmConCtx, Row, FALSE));
+
+            for (LONG colIndex = 0; colIndex < _displayWidth; colIndex++)
+            {
+                Row->Old[colIndex].Character = Row->New[colIndex].Character;
+                Row->Old[colIndex].Attribute = Row->New[colIndex].Attribute;
+            }
+        }
+    }
+
     return WDDMConEndUpdateDisplayBatch(_hWddmConCtx);
 }
 CATCH_RETURN()
@@ -240,16 +274,14 @@ CATCH_RETURN()
 {
     RETURN_LAST_ERROR_IF(_hWddmConCtx == INVALID_HANDLE_VALUE);
 
+    // Only reset the staging buffer here. `Old` keeps the last submitted frame
+    // so that EndPaint() can skip rows that didn't change; see EndPaint().
     for (LONG rowIndex = 0; rowIndex < _displayHeight; rowIndex++)
     {
         for (LONG colIndex = 0; colIndex < _displayWidth; colIndex++)
         {
-            const auto OldChar = &_displayState[rowIndex]->Old[colIndex];
             const auto NewChar = &_displayState[rowIndex]->New[colIndex];
 
-            OldChar->Character = NewChar->Character;
-            OldChar->Attribute = NewChar->Attribute;
-
             NewChar->Character = L' ';
             NewChar->Attribute = 0x0;
         }
@@ -267,19 +299,20 @@ CATCH_RETURN()
     {
         RETURN_LAST_ERROR_IF(_hWddmConCtx == INVALID_HANDLE_VALUE);
 
-        for (size_t i = 0; i < clusters.size() && i < gsl::narrow_cast<size_t>(_displayWidth); i++)
+        // Only stage the new cell contents here. The renderer calls this method
+        // once per attribute run, so submitting to the display driver from here
+        // would cost one kernel round trip per run. EndPaint() submits each
+        // changed row exactly once per frame instead.
+        const auto limit = gsl::narrow_cast<size_t>(std::max<LONG>(0, _displayWidth - coord.x));
+        for (size_t i = 0; i < clusters.size() && i < limit; i++)
         {
-            const auto OldChar = &_displayState[coord.y]->Old[coord.x + i];
             const auto NewChar = &_displayState[coord.y]->New[coord.x + i];
 
-            OldChar->Character = NewChar->Character;
-            OldChar->Attribute = NewChar->Attribute;
-
             NewChar->Character = til::at(clusters, i).GetTextAsSingle();
             NewChar->Attribute = _currentLegacyColorAttribute;
         }
 
-        return WDDMConUpdateDisplay(_hWddmConCtx, _displayState[coord.y], FALSE);
+        return S_OK;
     }
     CATCH_RETURN();
 }
@@ -113,7 +113,10 @@ try
             _inputBuffer.shrink_to_fit();
         }
 
-        _inputBuffer.resize(cbReadSize);
+        // No point in zeroing the buffer: ReadMessageInput overwrites all of it
+        // right away, and for multi-megabyte WriteConsole payloads that memset
+        // costs as much as the copy itself.
+        _inputBuffer.resize_for_overwrite(cbReadSize);
 
         RETURN_IF_FAILED(ReadMessageInput(0, _inputBuffer.data(), cbReadSize));
 
@@ -156,9 +159,11 @@ try
             _outputBuffer.shrink_to_fit();
         }
 
-        _outputBuffer.resize(cbWriteSize);
-
-        // 0 it out.
+        // The zeroing is intentional and stays: API handlers aren't guaranteed
+        // to fill the entire buffer and we must not leak stale heap contents
+        // back to the client. But resize() would value-initialize the buffer
+        // first, so going through resize_for_overwrite() halves the memsets.
+        _outputBuffer.resize_for_overwrite(cbWriteSize);
         std::fill_n(_outputBuffer.data(), _outputBuffer.size(), BYTE(0));
 
         State.OutputBuffer = _outputBuffer.data();
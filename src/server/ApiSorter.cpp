@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 
+#include <bit>
+
 #include "ApiSorter.h"
 
 #include "ApiDispatchers.h"
@@ -34,13 +36,20 @@ typedef struct _CONSOLE_API_DESCRIPTOR
     PCSTR TraceName;
 } CONSOLE_API_DESCRIPTOR, *PCONSOLE_API_DESCRIPTOR;
 
+// The number of power-of-two latency buckets kept per API. Bucket 0 counts
+// sub-microsecond calls and bucket n counts calls that took [2^(n-1), 2^n)
+// microseconds, so 32 buckets comfortably cover anything up to half an hour.
+constexpr ULONG ConsoleApiLatencyBucketCount = 32;
+
 typedef struct _CONSOLE_API_LAYER_DESCRIPTOR
 {
     const CONSOLE_API_DESCRIPTOR* Descriptor;
+    uint64_t* CallCounts;
+    uint64_t (*LatencyBuckets)[ConsoleApiLatencyBucketCount];
     ULONG Count;
 } CONSOLE_API_LAYER_DESCRIPTOR, *PCONSOLE_API_LAYER_DESCRIPTOR;
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleCP, CONSOLE_GETCP_MSG, "GetConsoleCP"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMode, CONSOLE_MODE_MSG, "GetConsoleMode"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleMode, CONSOLE_MODE_MSG, "SetConsoleMode"),
@@ -53,7 +62,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_MAPBITMAP_MSG),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerFillConsoleOutput, CONSOLE_FILLCONSOLEOUTPUT_MSG, "FillConsoleOutput"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGenerateConsoleCtrlEvent, CONSOLE_CTRLEVENT_MSG, "GenerateConsoleCtrlEvent"),
     CONSOLE_API_NO_PARAMETER(ApiDispatchers::ServerSetConsoleActiveScreenBuffer, "SetConsoleActiveScreenBuffer"),
@@ -78,7 +87,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleTitle, CONSOLE_SETTITLE_MSG, "SetConsoleTitle"),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_GETNUMBEROFFONTS_MSG),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMouseInfo, CONSOLE_GETMOUSEINFO_MSG, "GetNumberOfConsoleMouseButtons"),
     CONSOLE_API_DEPRECATED(CONSOLE_GETFONTINFO_MSG),
@@ -126,12 +135,45 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleCurrentFont, CONSOLE_CURRENTFONT_MSG, "SetConsoleCurrentFont")
 };
 
-const CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
-    { ConsoleApiLayer1, RTL_NUMBER_OF(ConsoleApiLayer1) },
-    { ConsoleApiLayer2, RTL_NUMBER_OF(ConsoleApiLayer2) },
-    { ConsoleApiLayer3, RTL_NUMBER_OF(ConsoleApiLayer3) },
+// Per-API call counters, indexed like the descriptor tables. Dispatch happens
+// exclusively on the IO thread, so plain integers suffice.
+uint64_t ConsoleApiCallCounts1[RTL_NUMBER_OF(ConsoleApiLayer1)]{};
+uint64_t ConsoleApiCallCounts2[RTL_NUMBER_OF(ConsoleApiLayer2)]{};
+uint64_t ConsoleApiCallCounts3[RTL_NUMBER_OF(ConsoleApiLayer3)]{};
+
+// Per-API latency histograms, indexed like the descriptor tables. Same deal as
+// the call counts: only the IO thread writes them. The ETW capture state
+// callback reads them from another thread and may see a histogram mid-update,
+// which is acceptable for a diagnostic dump.
+uint64_t ConsoleApiLatency1[RTL_NUMBER_OF(ConsoleApiLayer1)][ConsoleApiLatencyBucketCount]{};
+uint64_t ConsoleApiLatency2[RTL_NUMBER_OF(ConsoleApiLayer2)][ConsoleApiLatencyBucketCount]{};
+uint64_t ConsoleApiLatency3[RTL_NUMBER_OF(ConsoleApiLayer3)][ConsoleApiLatencyBucketCount]{};
+
+constexpr CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
+    { ConsoleApiLayer1, ConsoleApiCallCounts1, ConsoleApiLatency1, RTL_NUMBER_OF(ConsoleApiLayer1) },
+    { ConsoleApiLayer2, ConsoleApiCallCounts2, ConsoleApiLatency2, RTL_NUMBER_OF(ConsoleApiLayer2) },
+    { ConsoleApiLayer3, ConsoleApiCallCounts3, ConsoleApiLatency3, RTL_NUMBER_OF(ConsoleApiLayer3) },
 };
 
+// QPF is constant after boot, so it only needs to be asked for once.
+static uint64_t QpcFrequency() noexcept
+{
+    static const auto frequency = []() {
+        LARGE_INTEGER li;
+        QueryPerformanceFrequency(&li);
+        return static_cast<uint64_t>(li.QuadPart);
+    }();
+    return frequency;
+}
+
+// The ApiNumber encoding is contractual: the top byte holds the 1-based layer,
+// the bottom three bytes the 0-based index into that layer. The wait routines
+// identify pended calls through the API_NUMBER_* constants, so make sure at
+// compile time that those still point at the routines they name.
+static_assert((API_NUMBER_GETCONSOLEINPUT >> 24) == 1 && ConsoleApiLayer1[API_NUMBER_GETCONSOLEINPUT & 0xffffff].Routine == ApiDispatchers::ServerGetConsoleInput);
+static_assert((API_NUMBER_READCONSOLE >> 24) == 1 && ConsoleApiLayer1[API_NUMBER_READCONSOLE & 0xffffff].Routine == ApiDispatchers::ServerReadConsole);
+static_assert((API_NUMBER_WRITECONSOLE >> 24) == 1 && ConsoleApiLayer1[API_NUMBER_WRITECONSOLE & 0xffffff].Routine == ApiDispatchers::ServerWriteConsole);
+
 // Routine Description:
 // - This routine validates a user IO and dispatches it to the appropriate worker routine.
 // Arguments:
@@ -152,6 +194,9 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
 
     auto Descriptor = &ConsoleApiLayerTable[LayerNumber].Descriptor[ApiNumber];
 
+    const auto CallCount = ++ConsoleApiLayerTable[LayerNumber].CallCounts[ApiNumber];
+    Tracing::s_TraceApiCall(Descriptor->TraceName, CallCount);
+
     // Validate the argument size and call the API.
     if ((Message->Descriptor.InputSize < sizeof(CONSOLE_MSG_HEADER)) ||
         (Message->msgHeader.ApiDescriptorSize > sizeof(Message->u)) ||
@@ -172,10 +217,24 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
     // hard dependencies on NTSTATUS codes that aren't readily expressible as an HRESULT. There's currently only one
     // such known code -- STATUS_BUFFER_TOO_SMALL. There's a conlibk dependency on this being returned from the console
     // alias API.
+    // The QPC pair around the call feeds the latency histogram. Calls that pend
+    // here (e.g. reads with no input available) only have their inline portion
+    // measured, which is intentional: the time a client spends waiting for
+    // input isn't service time.
+    LARGE_INTEGER timeBeg;
+    QueryPerformanceCounter(&timeBeg);
+
     NTSTATUS Status = S_OK;
     {
         Status = (*Descriptor->Routine)(Message, &ReplyPending);
     }
+
+    LARGE_INTEGER timeEnd;
+    QueryPerformanceCounter(&timeEnd);
+    const auto elapsedUs = static_cast<uint64_t>(timeEnd.QuadPart - timeBeg.QuadPart) * 1'000'000 / QpcFrequency();
+    const auto bucket = std::min<size_t>(std::bit_width(elapsedUs), ConsoleApiLatencyBucketCount - 1);
+    ConsoleApiLayerTable[LayerNumber].LatencyBuckets[ApiNumber][bucket]++;
+
     if (Status != STATUS_BUFFER_TOO_SMALL)
     {
         Status = NTSTATUS_FROM_HRESULT(Status);
@@ -189,3 +248,26 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
 
     return nullptr;
 }
+
+// Routine Description:
+// - Emits one TraceLogging event per serviced API carrying its cumulative call
+//   count and latency histogram. See ApiSorter.h for when this gets invoked.
+void ApiSorter::TraceApiLatencyHistograms() noexcept
+{
+    for (ULONG LayerNumber = 0; LayerNumber < std::size(ConsoleApiLayerTable); LayerNumber++)
+    {
+        const auto& Layer = ConsoleApiLayerTable[LayerNumber];
+        for (ULONG ApiNumber = 0; ApiNumber < Layer.Count; ApiNumber++)
+        {
+            const auto CallCount = Layer.CallCounts[ApiNumber];
+            if (CallCount != 0)
+            {
+                Tracing::s_TraceApiLatencyHistogram(Layer.Descriptor[ApiNumber].TraceName,
+                                                    ((LayerNumber + 1) << 24) | ApiNumber,
+                                                    CallCount,
+                                                    Layer.LatencyBuckets[ApiNumber],
+                                                    ConsoleApiLatencyBucketCount);
+            }
+        }
+    }
+}
@@ -41,4 +41,9 @@ public:
     // Return Value:
     // - A pointer to the reply message, if this message is to be completed inline; nullptr if this message will pend now and complete later.
     static PCONSOLE_API_MSG ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Message);
+
+    // Routine Description:
+    // - Emits the accumulated per-API call counts and latency histograms as TraceLogging events.
+    //   Wired up to the ETW capture state request, so a trace controller can pull the data out of a live session at any time.
+    static void TraceApiLatencyHistograms() noexcept;
 };
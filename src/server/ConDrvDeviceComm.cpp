@@ -157,9 +157,15 @@ ConDrvDeviceComm::~ConDrvDeviceComm() = default;
 // - The opposite of GetHandle
 [[nodiscard]] ULONG_PTR ConDrvDeviceComm::PutHandle(const void* handle)
 {
-    // ConDrv will pass back whatever large integer we send it, as an opaque data blob
-    // We'll use that to smuggle the actual pointer value to the handle.
-    return reinterpret_cast<ULONG_PTR>(handle);
+    // ConDrv will pass back whatever large integer we send it, as an opaque data blob.
+    // Hand out a key into our handle table rather than smuggling the raw pointer value
+    // through it: a bogus or stale id coming back from the driver then fails the
+    // lookup in GetHandle instead of getting dereferenced.
+    const auto lock = _handleTableLock.lock_exclusive();
+    const auto id = _nextHandleId++;
+    _handles.emplace(id, handle);
+    _handlesOpened++;
+    return id;
 }
 
 // Routine Description:
@@ -169,7 +175,33 @@ ConDrvDeviceComm::~ConDrvDeviceComm() = default;
 // - The opposite of PutHandle
 [[nodiscard]] void* ConDrvDeviceComm::GetHandle(ULONG_PTR handleId) const
 {
-    return reinterpret_cast<void*>(handleId);
+    // Messages that carry no object (the connect sequence, for instance) have a
+    // zeroed descriptor. That's not a table miss, it's just "no handle".
+    if (handleId == 0)
+    {
+        return nullptr;
+    }
+
+    const auto lock = _handleTableLock.lock_shared();
+    const auto it = _handles.find(handleId);
+    if (it == _handles.end())
+    {
+        _handleLookupMisses++;
+        LOG_HR_MSG(E_HANDLE, "rejected unknown console object handle id");
+        return nullptr;
+    }
+
+    return const_cast<void*>(it->second);
+}
+
+// Routine Description:
+// - Retires a handle id previously given out by PutHandle.
+// - Any subsequent GetHandle for the id will fail the lookup, so this must be
+//   called when the object behind the id is freed.
+void ConDrvDeviceComm::DestroyHandle(ULONG_PTR handleId)
+{
+    const auto lock = _handleTableLock.lock_exclusive();
+    _handlesClosed += _handles.erase(handleId);
 }
 
 // Routine Description:
@@ -39,6 +39,7 @@ public:
 
     [[nodiscard]] ULONG_PTR PutHandle(const void*) override;
     [[nodiscard]] void* GetHandle(ULONG_PTR) const override;
+    void DestroyHandle(ULONG_PTR) override;
 
     [[nodiscard]] HRESULT GetServerHandle(_Out_ HANDLE* pHandle) const override;
 
@@ -50,4 +51,17 @@ private:
                                      _In_ DWORD cbOutBufferSize) const;
 
     wil::unique_handle _Server;
+
+    // Objects are registered here when their pointers are exchanged for
+    // driver-facing handle ids. Ids count up and are never reused, so a
+    // stale id presented after its object was closed misses the table
+    // instead of being reinterpreted as a pointer to freed memory.
+    std::unordered_map<ULONG_PTR, const void*> _handles;
+    ULONG_PTR _nextHandleId = 1;
+    mutable wil::srwlock _handleTableLock;
+
+    // Telemetry/debugging counters for the handle table.
+    size_t _handlesOpened = 0;
+    size_t _handlesClosed = 0;
+    mutable size_t _handleLookupMisses = 0;
 };
@@ -35,6 +35,7 @@ public:
 
     [[nodiscard]] virtual ULONG_PTR PutHandle(const void*) = 0;
     [[nodiscard]] virtual void* GetHandle(ULONG_PTR) const = 0;
+    virtual void DestroyHandle(ULONG_PTR) = 0;
 
     [[nodiscard]] virtual HRESULT GetServerHandle(_Out_ HANDLE* pHandle) const = 0;
 };
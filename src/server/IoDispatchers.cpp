@@ -99,14 +99,20 @@ PCONSOLE_API_MSG IoDispatchers::ConsoleCreateObject(_In_ PCONSOLE_API_MSG pMessa
     auto deviceComm{ ServiceLocator::LocateGlobals().pDeviceComm };
 
     // Complete the request.
+    const auto handleId = deviceComm->PutHandle(handle.get());
     pMessage->SetReplyStatus(STATUS_SUCCESS);
-    pMessage->SetReplyInformation(deviceComm->PutHandle(handle.get()));
+    pMessage->SetReplyInformation(handleId);
 
     if (SUCCEEDED(deviceComm->CompleteIo(&pMessage->Complete)))
     {
         // We've successfully transferred ownership of the handle to the driver. We can release and not free it.
         handle.release();
     }
+    else
+    {
+        // The driver never learned about the id; retire it along with the handle.
+        deviceComm->DestroyHandle(handleId);
+    }
 
     UnlockConsole();
 
@@ -124,6 +130,7 @@ PCONSOLE_API_MSG IoDispatchers::ConsoleCloseObject(_In_ PCONSOLE_API_MSG pMessag
     LockConsole();
 
     delete pMessage->GetObjectHandle();
+    ServiceLocator::LocateGlobals().pDeviceComm->DestroyHandle(pMessage->Descriptor.Object);
     pMessage->SetReplyStatus(STATUS_SUCCESS);
 
     UnlockConsole();
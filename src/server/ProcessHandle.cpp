@@ -37,12 +37,15 @@ ConsoleProcessHandle::ConsoleProcessHandle(const DWORD dwProcessId,
 //   DeviceComm's handle exchanger.
 // Arguments:
 // - deviceComm: IDeviceComm implementation with which to exchange handles.
-CD_CONNECTION_INFORMATION ConsoleProcessHandle::GetConnectionInformation(IDeviceComm* deviceComm) const
+CD_CONNECTION_INFORMATION ConsoleProcessHandle::GetConnectionInformation(IDeviceComm* deviceComm)
 {
     CD_CONNECTION_INFORMATION result = { 0 };
-    result.Process = deviceComm->PutHandle(this);
-    result.Input = deviceComm->PutHandle(pInputHandle.get());
-    result.Output = deviceComm->PutHandle(pOutputHandle.get());
+    _processHandleId = deviceComm->PutHandle(this);
+    _inputHandleId = deviceComm->PutHandle(pInputHandle.get());
+    _outputHandleId = deviceComm->PutHandle(pOutputHandle.get());
+    result.Process = _processHandleId;
+    result.Input = _inputHandleId;
+    result.Output = _outputHandleId;
     return result;
 }
 
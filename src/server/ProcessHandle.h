@@ -51,7 +51,7 @@ public:
 
     const HANDLE GetRawHandle() const;
 
-    CD_CONNECTION_INFORMATION GetConnectionInformation(IDeviceComm* deviceComm) const;
+    CD_CONNECTION_INFORMATION GetConnectionInformation(IDeviceComm* deviceComm);
 
     const FILETIME GetProcessCreationTime() const;
 
@@ -62,6 +62,12 @@ private:
 
     mutable FILETIME _processCreationTime;
 
+    // The driver-facing handle ids registered for this process and its connect
+    // handles, kept so they can be retired again when the process detaches.
+    ULONG_PTR _processHandleId = 0;
+    ULONG_PTR _inputHandleId = 0;
+    ULONG_PTR _outputHandleId = 0;
+
     const ConsoleProcessPolicy _policy;
     const ConsoleShimPolicy _shimPolicy;
 
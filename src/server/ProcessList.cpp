@@ -40,6 +40,10 @@ using namespace Microsoft::Console::Interactivity;
     try
     {
         pProcessData = std::make_unique<ConsoleProcessHandle>(dwProcessId, dwThreadId, ulProcessGroupId);
+        // Reserve ahead of the index insertion so that the emplace_back
+        // afterwards cannot throw and leave the two containers out of sync.
+        _processes.reserve(_processes.size() + 1);
+        _processIndex.emplace(dwProcessId, pProcessData.get());
         _processes.emplace_back(pProcessData.get());
     }
     CATCH_RETURN();
@@ -63,6 +67,17 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
     if (it != _processes.end())
     {
         _processes.erase(it);
+        _processIndex.erase(pProcessData->dwProcessId);
+
+        // Retire the driver-facing handle ids registered at connect time so
+        // that stale ids can no longer resolve to the freed objects.
+        if (const auto pDeviceComm = ServiceLocator::LocateGlobals().pDeviceComm)
+        {
+            pDeviceComm->DestroyHandle(pProcessData->_processHandleId);
+            pDeviceComm->DestroyHandle(pProcessData->_inputHandleId);
+            pDeviceComm->DestroyHandle(pProcessData->_outputHandleId);
+        }
+
         delete pProcessData;
     }
     else
@@ -84,15 +99,8 @@ ConsoleProcessHandle* ConsoleProcessList::FindProcessInList(const DWORD dwProces
 {
     assert(ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked());
 
-    for (const auto& p : _processes)
-    {
-        if (p->dwProcessId == dwProcessId)
-        {
-            return p;
-        }
-    }
-
-    return nullptr;
+    const auto it = _processIndex.find(dwProcessId);
+    return it != _processIndex.end() ? it->second : nullptr;
 }
 
 // Routine Description:
@@ -210,6 +218,7 @@ ConsoleProcessHandle* ConsoleProcessList::GetOldestProcess() const
     try
     {
         termRecords.clear();
+        termRecords.reserve(_processes.size());
 
         // Dig through known processes looking for a match
         for (const auto& p : _processes)
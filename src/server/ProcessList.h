@@ -58,7 +58,12 @@ public:
     bool IsEmpty() const;
 
 private:
+    // _processes preserves attach order: the front is the oldest process,
+    // which is what root reassignment and GetProcessList rely on.
+    // _processIndex shadows it keyed by PID for O(1) lookup, since every
+    // client API call resolves its calling process through here.
     std::vector<ConsoleProcessHandle*> _processes;
+    std::unordered_map<DWORD, ConsoleProcessHandle*> _processIndex;
 
     void _ModifyProcessForegroundRights(const HANDLE hProcess, const bool fForeground) const;
 };
@@ -68,14 +68,17 @@ bool InteractDispatch::WriteString(const std::wstring_view string)
     if (!string.empty())
     {
         const auto codepage = _api.GetConsoleOutputCP();
-        InputEventQueue keyEvents;
+
+        // _keyEventBuffer is a member so that paste bursts, which arrive as a rapid
+        // series of these calls, don't reallocate the event storage on every call.
+        _keyEventBuffer.clear();
 
         for (const auto& wch : string)
         {
-            CharToKeyEvents(wch, codepage, keyEvents);
+            CharToKeyEvents(wch, codepage, _keyEventBuffer);
         }
 
-        WriteInput(keyEvents);
+        WriteInput(_keyEventBuffer);
     }
     return true;
 }
@@ -39,5 +39,6 @@ namespace Microsoft::Console::VirtualTerminal
 
     private:
         ConhostInternalGetSet _api;
+        InputEventQueue _keyEventBuffer;
     };
 }
@@ -55,15 +55,19 @@ void AdaptDispatch::Print(const wchar_t wchPrintable)
 // - <none>
 void AdaptDispatch::PrintString(const std::wstring_view string)
 {
+    // NeedToTranslate() is the run-level check: with the default ASCII/Latin1
+    // designations it returns false and the whole span passes through untouched.
+    // Only an actively designated DEC line drawing or NRCS charset (or a pending
+    // single shift) drops us into the per-character translation loop.
     if (_termOutput.NeedToTranslate())
     {
-        std::wstring buffer;
-        buffer.reserve(string.size());
+        _translationBuffer.clear();
+        _translationBuffer.reserve(string.size());
         for (auto& wch : string)
         {
-            buffer.push_back(_termOutput.TranslateKey(wch));
+            _translationBuffer.push_back(_termOutput.TranslateKey(wch));
         }
-        _WriteToBuffer(buffer);
+        _WriteToBuffer(_translationBuffer);
     }
     else
     {
@@ -124,14 +128,9 @@ void AdaptDispatch::_WriteToBuffer(const std::wstring_view string)
             // If insert-replace mode is enabled, we first measure how many cells
             // the string will occupy, and scroll the target area right by that
             // amount to make space for the incoming text.
-            const OutputCellIterator it(state.text, attributes);
-            auto measureIt = it;
-            while (measureIt && measureIt.GetCellDistance(it) < state.columnLimit)
-            {
-                ++measureIt;
-            }
+            til::CoordType cellCount = 0;
+            TextBuffer::FitTextIntoColumns(state.text, state.columnLimit, cellCount);
             const auto row = cursorPosition.y;
-            const auto cellCount = measureIt.GetCellDistance(it);
             _ScrollRectHorizontally(textBuffer, { cursorPosition.x, row, state.columnLimit, row + 1 }, cellCount);
         }
 
@@ -620,21 +619,9 @@ void AdaptDispatch::_ScrollRectVertically(TextBuffer& textBuffer, const til::rec
         }
         else
         {
-            // Otherwise we have to move the content up or down by copying the
-            // requested buffer range one cell at a time.
-            const auto srcOrigin = til::point{ scrollRect.left, top };
-            const auto dstOrigin = til::point{ scrollRect.left, top + actualDelta };
-            const auto srcView = Viewport::FromDimensions(srcOrigin, width, height);
-            const auto dstView = Viewport::FromDimensions(dstOrigin, width, height);
-            const auto walkDirection = Viewport::DetermineWalkDirection(srcView, dstView);
-            auto srcPos = srcView.GetWalkOrigin(walkDirection);
-            auto dstPos = dstView.GetWalkOrigin(walkDirection);
-            do
-            {
-                const auto current = OutputCell(*textBuffer.GetCellDataAt(srcPos));
-                textBuffer.WriteLine(OutputCellIterator({ &current, 1 }), dstPos);
-                srcView.WalkInBounds(srcPos, walkDirection);
-            } while (dstView.WalkInBounds(dstPos, walkDirection));
+            // Otherwise we move the content up or down in bulk, row span by
+            // row span through the row storage.
+            textBuffer.CopyRect({ scrollRect.left, top, scrollRect.right, top + height }, { scrollRect.left, top + actualDelta });
         }
     }
 
@@ -668,22 +655,10 @@ void AdaptDispatch::_ScrollRectHorizontally(TextBuffer& textBuffer, const til::r
         const auto height = scrollRect.height();
         const auto actualDelta = delta > 0 ? absoluteDelta : -absoluteDelta;
 
-        const auto source = Viewport::FromDimensions({ left, top }, width, height);
-        const auto target = Viewport::Offset(source, { actualDelta, 0 });
-        const auto walkDirection = Viewport::DetermineWalkDirection(source, target);
-        auto sourcePos = source.GetWalkOrigin(walkDirection);
-        auto targetPos = target.GetWalkOrigin(walkDirection);
-        // Note that we read two cells from the source before we start writing
-        // to the target, so a two-cell DBCS character can't accidentally delete
-        // itself when moving one cell horizontally.
-        auto next = OutputCell(*textBuffer.GetCellDataAt(sourcePos));
-        do
-        {
-            const auto current = next;
-            source.WalkInBounds(sourcePos, walkDirection);
-            next = OutputCell(*textBuffer.GetCellDataAt(sourcePos));
-            textBuffer.WriteLine(OutputCellIterator({ &current, 1 }), targetPos);
-        } while (target.WalkInBounds(targetPos, walkDirection));
+        // CopyRect stages the span through the scratchpad row, so a two-cell
+        // DBCS character can't accidentally delete itself when moving one cell
+        // horizontally.
+        textBuffer.CopyRect({ left, top, left + width, top + height }, { left + actualDelta, top });
     }
 
     // Columns revealed by the scroll are filled with standard erase attributes.
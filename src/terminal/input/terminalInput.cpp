@@ -257,6 +257,16 @@ bool TerminalInput::GetInputMode(const Mode mode) const noexcept
     return _inputMode.test(mode);
 }
 
+// Returns an opaque value identifying the encoding-relevant mode state.
+// Two instances with equal fingerprints translate any given input event
+// into the same sequence, so a caller fanning one event out to several
+// terminals can encode it once and reuse the bytes wherever the
+// fingerprints match.
+uint64_t TerminalInput::GetModeFingerprint() const noexcept
+{
+    return (static_cast<uint64_t>(_inputMode.bits()) << 1) | static_cast<uint64_t>(_forceDisableWin32InputMode);
+}
+
 void TerminalInput::ResetInputModes() noexcept
 {
     _inputMode = { Mode::Ansi, Mode::AutoRepeat, Mode::AlternateScroll };
@@ -737,5 +747,27 @@ TerminalInput::OutputType TerminalInput::_makeWin32Output(const KEY_EVENT_RECORD
     //      Kd: the value of bKeyDown - either a '0' or '1'. If omitted, defaults to '0'.
     //      Cs: the value of dwControlKeyState - any number. If omitted, defaults to '0'.
     //      Rc: the value of wRepeatCount - any number. If omitted, defaults to '1'.
-    return fmt::format(FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"), vk, sc, uc, kd, cs, rc);
+    //
+    // Auto-repeat sends the exact same event over and over, so look for the
+    // encoding in the cache first. (Unused entries have an empty sequence and
+    // thus never match a real event.)
+    const std::array<uint16_t, 6> cacheKey{ vk, sc, uc, kd, cs, rc };
+    for (const auto& entry : _win32SequenceCache)
+    {
+        if (entry.key == cacheKey && !entry.sequence.empty())
+        {
+            return entry.sequence;
+        }
+    }
+
+    auto sequence = fmt::format(FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"), vk, sc, uc, kd, cs, rc);
+
+    // Replace the oldest entry round-robin; with auto-repeat there's only one
+    // hot key anyways, so anything fancier wouldn't pay for itself.
+    auto& entry = til::at(_win32SequenceCache, _win32SequenceCacheNext);
+    _win32SequenceCacheNext = gsl::narrow_cast<uint8_t>((_win32SequenceCacheNext + 1) % _win32SequenceCache.size());
+    entry.key = cacheKey;
+    entry.sequence = std::move(sequence);
+
+    return entry.sequence;
 }
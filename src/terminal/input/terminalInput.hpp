@@ -48,6 +48,7 @@ namespace Microsoft::Console::VirtualTerminal
 
         void SetInputMode(const Mode mode, const bool enabled) noexcept;
         bool GetInputMode(const Mode mode) const noexcept;
+        uint64_t GetModeFingerprint() const noexcept;
         void ResetInputModes() noexcept;
         void ForceDisableWin32InputMode(const bool win32InputMode) noexcept;
 
@@ -75,9 +76,21 @@ namespace Microsoft::Console::VirtualTerminal
 
         [[nodiscard]] OutputType _makeCharOutput(wchar_t ch);
         [[nodiscard]] static OutputType _makeEscapedOutput(wchar_t wch);
-        [[nodiscard]] static OutputType _makeWin32Output(const KEY_EVENT_RECORD& key);
+        [[nodiscard]] OutputType _makeWin32Output(const KEY_EVENT_RECORD& key);
         [[nodiscard]] static OutputType _searchWithModifier(const KEY_EVENT_RECORD& keyEvent);
 
+        // A tiny cache of recently encoded win32-input-mode sequences. Key
+        // auto-repeat re-encodes the identical KEY_EVENT_RECORD thousands of
+        // times in a row, and even alternating key-down/key-up pairs only
+        // touch a handful of distinct encodings at a time.
+        struct Win32SequenceCacheEntry
+        {
+            std::array<uint16_t, 6> key{};
+            StringType sequence;
+        };
+        std::array<Win32SequenceCacheEntry, 4> _win32SequenceCache;
+        uint8_t _win32SequenceCacheNext = 0;
+
 #pragma region MouseInputState Management
         // These methods are defined in mouseInputState.cpp
         struct MouseInputState
@@ -30,6 +30,12 @@ namespace Microsoft::Console::VirtualTerminal
 
         virtual bool EncounteredWin32InputModeSequence() const noexcept = 0;
 
+        // Returns true if the engine may respond to an unhandled sequence by asking
+        // the state machine to pass the raw sequence text through to the terminal
+        // (StateMachine::FlushToTerminal). When this returns false, the state machine
+        // doesn't need to keep a copy of in-flight sequences across chunk boundaries.
+        virtual bool WillPassThroughUnhandledSequences() const noexcept = 0;
+
         virtual bool ActionExecute(const wchar_t wch) = 0;
         virtual bool ActionExecuteFromEscape(const wchar_t wch) = 0;
         virtual bool ActionPrint(const wchar_t wch) = 0;
@@ -107,6 +107,13 @@ bool InputStateMachineEngine::EncounteredWin32InputModeSequence() const noexcept
     return _encounteredWin32InputModeSequence;
 }
 
+bool InputStateMachineEngine::WillPassThroughUnhandledSequences() const noexcept
+{
+    // The input engine flushes via _pfnFlushToInputQueue, which only ever
+    // passes the current run through - it never consumes the cached sequence.
+    return false;
+}
+
 void InputStateMachineEngine::SetLookingForDSR(const bool looking) noexcept
 {
     _lookingForDSR = looking;
@@ -286,12 +293,16 @@ bool InputStateMachineEngine::ActionPassThroughString(const std::wstring_view st
         // similar to TerminalInput::_SendInputSequence
         if (!string.empty())
         {
-            InputEventQueue inputEvents;
+            // _batchedInput is a member so that paste storms, which arrive as a rapid
+            // series of these calls, only pay for its allocation once. The entire
+            // burst is surfaced to the dispatcher as a single batched write.
+            _batchedInput.clear();
+            _batchedInput.reserve(string.size());
             for (const auto& wch : string)
             {
-                inputEvents.push_back(SynthesizeKeyEvent(true, 1, 0, 0, wch, 0));
+                _batchedInput.push_back(SynthesizeKeyEvent(true, 1, 0, 0, wch, 0));
             }
-            return _pDispatch->WriteInput(inputEvents);
+            return _pDispatch->WriteInput(_batchedInput);
         }
     }
     return ActionPrintString(string);
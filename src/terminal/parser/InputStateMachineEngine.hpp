@@ -125,7 +125,7 @@ namespace Microsoft::Console::VirtualTerminal
         SS3_F4 = L'S',
     };
 
-    class InputStateMachineEngine : public IStateMachineEngine
+    class InputStateMachineEngine final : public IStateMachineEngine
     {
     public:
         InputStateMachineEngine(std::unique_ptr<IInteractDispatch> pDispatch);
@@ -133,6 +133,8 @@ namespace Microsoft::Console::VirtualTerminal
                                 const bool lookingForDSR);
 
         bool EncounteredWin32InputModeSequence() const noexcept override;
+
+        bool WillPassThroughUnhandledSequences() const noexcept override;
         void SetLookingForDSR(const bool looking) noexcept;
 
         bool ActionExecute(const wchar_t wch) override;
@@ -174,6 +176,7 @@ namespace Microsoft::Console::VirtualTerminal
         std::optional<til::point> _lastMouseClickPos{};
         std::optional<std::chrono::steady_clock::time_point> _lastMouseClickTime{};
         std::optional<size_t> _lastMouseClickButton{};
+        InputEventQueue _batchedInput;
 
         DWORD _GetCursorKeysModifierState(const VTParameters parameters, const VTID id) noexcept;
         DWORD _GetGenericKeysModifierState(const VTParameters parameters) noexcept;
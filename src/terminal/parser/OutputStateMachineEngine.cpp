@@ -4,6 +4,8 @@
 #include "precomp.h"
 #include "OutputStateMachineEngine.hpp"
 
+#include <til/static_map.h>
+
 #include "ascii.hpp"
 #include "base64.hpp"
 #include "stateMachine.hpp"
@@ -28,6 +30,13 @@ bool OutputStateMachineEngine::EncounteredWin32InputModeSequence() const noexcep
     return false;
 }
 
+bool OutputStateMachineEngine::WillPassThroughUnhandledSequences() const noexcept
+{
+    // Only the conhost side of a ConPTY connection ever asks for unhandled
+    // sequences back, so it can forward their raw text to the terminal.
+    return _pfnFlushToTerminal != nullptr;
+}
+
 const ITermDispatch& OutputStateMachineEngine::Dispatch() const noexcept
 {
     return *_dispatch;
@@ -410,6 +419,30 @@ bool OutputStateMachineEngine::ActionVt52EscDispatch(const VTID id, const VTPara
     return success;
 }
 
+namespace
+{
+    // Describes whether and where a CSI sequence accepts sub parameters.
+    enum class SubParamSupport : uint8_t
+    {
+        None, // received sub parameters make the sequence fail
+        AnyParameter, // sub parameters are accepted on any parameter (SGR)
+        AttributeParametersOnly, // accepted, except on the four leading geometry parameters (DECCARA/DECRARA)
+    };
+
+    using CsiHandler = bool (*)(ITermDispatch& dispatch, const VTParameters parameters);
+
+    struct CsiDispatchEntry
+    {
+        CsiHandler handler = nullptr;
+        SubParamSupport subParams = SubParamSupport::None;
+    };
+
+    constexpr std::pair<uint64_t, CsiDispatchEntry> csiEntry(const uint64_t id, const CsiHandler handler, const SubParamSupport subParams = SubParamSupport::None) noexcept
+    {
+        return { id, { handler, subParams } };
+    }
+}
+
 // Routine Description:
 // - Triggers the CsiDispatch action to indicate that the listener should handle
 //      a control sequence. These sequences perform various API-type commands
@@ -421,163 +454,273 @@ bool OutputStateMachineEngine::ActionVt52EscDispatch(const VTID id, const VTPara
 // - true iff we successfully dispatched the sequence.
 bool OutputStateMachineEngine::ActionCsiDispatch(const VTID id, const VTParameters parameters)
 {
+    // The dispatch table below is built and sorted at compile time, so routing
+    // a sequence is a binary search over a read-only array instead of a long
+    // cascade of comparisons. REP is intentionally absent from the table, since
+    // it's the one sequence that isn't routed through ITermDispatch (see below).
+    static constexpr til::static_map table{
+        csiEntry(CsiActionCodes::CUU_CursorUp, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorUp(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CUD_CursorDown, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorDown(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CUF_CursorForward, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorForward(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CUB_CursorBackward, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorBackward(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CNL_CursorNextLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorNextLine(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CPL_CursorPrevLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorPrevLine(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CHA_CursorHorizontalAbsolute, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorHorizontalPositionAbsolute(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::HPA_HorizontalPositionAbsolute, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorHorizontalPositionAbsolute(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::VPA_VerticalLinePositionAbsolute, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.VerticalLinePositionAbsolute(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::HPR_HorizontalPositionRelative, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.HorizontalPositionRelative(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::VPR_VerticalPositionRelative, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.VerticalPositionRelative(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CUP_CursorPosition, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorPosition(params.at(0), params.at(1));
+        }),
+        csiEntry(CsiActionCodes::HVP_HorizontalVerticalPosition, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CursorPosition(params.at(0), params.at(1));
+        }),
+        csiEntry(CsiActionCodes::DECSTBM_SetTopBottomMargins, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.SetTopBottomScrollingMargins(params.at(0).value_or(0), params.at(1).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECSLRM_SetLeftRightMargins, [](ITermDispatch& dispatch, const VTParameters params) {
+            // Note that this can also be ANSISYSSC, depending on the state of DECLRMM.
+            return dispatch.SetLeftRightScrollingMargins(params.at(0).value_or(0), params.at(1).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::ICH_InsertCharacter, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.InsertCharacter(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DCH_DeleteCharacter, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.DeleteCharacter(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::ED_EraseDisplay, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto eraseType) {
+                return dispatch.EraseInDisplay(eraseType);
+            });
+        }),
+        csiEntry(CsiActionCodes::DECSED_SelectiveEraseDisplay, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto eraseType) {
+                return dispatch.SelectiveEraseInDisplay(eraseType);
+            });
+        }),
+        csiEntry(CsiActionCodes::EL_EraseLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto eraseType) {
+                return dispatch.EraseInLine(eraseType);
+            });
+        }),
+        csiEntry(CsiActionCodes::DECSEL_SelectiveEraseLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto eraseType) {
+                return dispatch.SelectiveEraseInLine(eraseType);
+            });
+        }),
+        csiEntry(CsiActionCodes::SM_SetMode, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto mode) {
+                return dispatch.SetMode(DispatchTypes::ANSIStandardMode(mode));
+            });
+        }),
+        csiEntry(CsiActionCodes::DECSET_PrivateModeSet, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto mode) {
+                return dispatch.SetMode(DispatchTypes::DECPrivateMode(mode));
+            });
+        }),
+        csiEntry(CsiActionCodes::RM_ResetMode, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto mode) {
+                return dispatch.ResetMode(DispatchTypes::ANSIStandardMode(mode));
+            });
+        }),
+        csiEntry(CsiActionCodes::DECRST_PrivateModeReset, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto mode) {
+                return dispatch.ResetMode(DispatchTypes::DECPrivateMode(mode));
+            });
+        }),
+        csiEntry(
+            CsiActionCodes::SGR_SetGraphicsRendition, [](ITermDispatch& dispatch, const VTParameters params) {
+                return dispatch.SetGraphicsRendition(params);
+            },
+            SubParamSupport::AnyParameter),
+        csiEntry(CsiActionCodes::DSR_DeviceStatusReport, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.DeviceStatusReport(DispatchTypes::ANSIStandardStatus(params.at(0)), params.at(1));
+        }),
+        csiEntry(CsiActionCodes::DSR_PrivateDeviceStatusReport, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.DeviceStatusReport(DispatchTypes::DECPrivateStatus(params.at(0)), params.at(1));
+        }),
+        csiEntry(CsiActionCodes::DA_DeviceAttributes, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.at(0).value_or(0) == 0 && dispatch.DeviceAttributes();
+        }),
+        csiEntry(CsiActionCodes::DA2_SecondaryDeviceAttributes, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.at(0).value_or(0) == 0 && dispatch.SecondaryDeviceAttributes();
+        }),
+        csiEntry(CsiActionCodes::DA3_TertiaryDeviceAttributes, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.at(0).value_or(0) == 0 && dispatch.TertiaryDeviceAttributes();
+        }),
+        csiEntry(CsiActionCodes::DECREQTPARM_RequestTerminalParameters, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.RequestTerminalParameters(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::SU_ScrollUp, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.ScrollUp(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::SD_ScrollDown, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.ScrollDown(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::ANSISYSRC_CursorRestore, [](ITermDispatch& dispatch, const VTParameters /*params*/) {
+            return dispatch.CursorRestoreState();
+        }),
+        csiEntry(CsiActionCodes::IL_InsertLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.InsertLine(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DL_DeleteLine, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.DeleteLine(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CHT_CursorForwardTab, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.ForwardTab(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::CBT_CursorBackTab, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.BackwardsTab(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::TBC_TabClear, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto clearType) {
+                return dispatch.TabClear(clearType);
+            });
+        }),
+        csiEntry(CsiActionCodes::DECST8C_SetTabEvery8Columns, [](ITermDispatch& dispatch, const VTParameters params) {
+            return params.for_each([&](const auto setType) {
+                return dispatch.TabSet(setType);
+            });
+        }),
+        csiEntry(CsiActionCodes::ECH_EraseCharacters, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.EraseCharacters(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DTTERM_WindowManipulation, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.WindowManipulation(params.at(0), params.at(1), params.at(2));
+        }),
+        csiEntry(CsiActionCodes::DECSCUSR_SetCursorStyle, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.SetCursorStyle(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DECSTR_SoftReset, [](ITermDispatch& dispatch, const VTParameters /*params*/) {
+            return dispatch.SoftReset();
+        }),
+        csiEntry(CsiActionCodes::DECSCA_SetCharacterProtectionAttribute, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.SetCharacterProtectionAttribute(params);
+        }),
+        csiEntry(CsiActionCodes::XT_PushSgr, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.PushGraphicsRendition(params);
+        }),
+        csiEntry(CsiActionCodes::XT_PushSgrAlias, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.PushGraphicsRendition(params);
+        }),
+        csiEntry(CsiActionCodes::XT_PopSgr, [](ITermDispatch& dispatch, const VTParameters /*params*/) {
+            return dispatch.PopGraphicsRendition();
+        }),
+        csiEntry(CsiActionCodes::XT_PopSgrAlias, [](ITermDispatch& dispatch, const VTParameters /*params*/) {
+            return dispatch.PopGraphicsRendition();
+        }),
+        csiEntry(CsiActionCodes::DECRQM_RequestMode, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.RequestMode(DispatchTypes::ANSIStandardMode(params.at(0)));
+        }),
+        csiEntry(CsiActionCodes::DECRQM_PrivateRequestMode, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.RequestMode(DispatchTypes::DECPrivateMode(params.at(0)));
+        }),
+        csiEntry(
+            CsiActionCodes::DECCARA_ChangeAttributesRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+                return dispatch.ChangeAttributesRectangularArea(params.at(0), params.at(1), params.at(2).value_or(0), params.at(3).value_or(0), params.subspan(4));
+            },
+            SubParamSupport::AttributeParametersOnly),
+        csiEntry(
+            CsiActionCodes::DECRARA_ReverseAttributesRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+                return dispatch.ReverseAttributesRectangularArea(params.at(0), params.at(1), params.at(2).value_or(0), params.at(3).value_or(0), params.subspan(4));
+            },
+            SubParamSupport::AttributeParametersOnly),
+        csiEntry(CsiActionCodes::DECCRA_CopyRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.CopyRectangularArea(params.at(0), params.at(1), params.at(2).value_or(0), params.at(3).value_or(0), params.at(4), params.at(5), params.at(6), params.at(7));
+        }),
+        csiEntry(CsiActionCodes::DECRQPSR_RequestPresentationStateReport, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.RequestPresentationStateReport(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DECFRA_FillRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.FillRectangularArea(params.at(0), params.at(1), params.at(2), params.at(3).value_or(0), params.at(4).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECERA_EraseRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.EraseRectangularArea(params.at(0), params.at(1), params.at(2).value_or(0), params.at(3).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECSERA_SelectiveEraseRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.SelectiveEraseRectangularArea(params.at(0), params.at(1), params.at(2).value_or(0), params.at(3).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECIC_InsertColumn, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.InsertColumn(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DECDC_DeleteColumn, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.DeleteColumn(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DECSACE_SelectAttributeChangeExtent, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.SelectAttributeChangeExtent(params.at(0));
+        }),
+        csiEntry(CsiActionCodes::DECRQCRA_RequestChecksumRectangularArea, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.RequestChecksumRectangularArea(params.at(0).value_or(0), params.at(1).value_or(0), params.at(2), params.at(3), params.at(4).value_or(0), params.at(5).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECINVM_InvokeMacro, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.InvokeMacro(params.at(0).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECAC_AssignColor, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.AssignColor(params.at(0), params.at(1).value_or(0), params.at(2).value_or(0));
+        }),
+        csiEntry(CsiActionCodes::DECPS_PlaySound, [](ITermDispatch& dispatch, const VTParameters params) {
+            return dispatch.PlaySounds(params);
+        }),
+    };
+
+    const auto entry = table.find(static_cast<uint64_t>(id));
+    const auto found = entry != table.end();
+
     // Bail out if we receive subparameters, but we don't accept them in the sequence.
-    if (parameters.hasSubParams() && !_CanSeqAcceptSubParam(id, parameters)) [[unlikely]]
+    if (parameters.hasSubParams()) [[unlikely]]
     {
-        return false;
+        auto accepted = false;
+        if (found)
+        {
+            switch (entry->second.subParams)
+            {
+            case SubParamSupport::AnyParameter:
+                accepted = true;
+                break;
+            case SubParamSupport::AttributeParametersOnly:
+                accepted = !parameters.hasSubParamsFor(0) && !parameters.hasSubParamsFor(1) && !parameters.hasSubParamsFor(2) && !parameters.hasSubParamsFor(3);
+                break;
+            default:
+                break;
+            }
+        }
+        if (!accepted)
+        {
+            return false;
+        }
     }
 
     auto success = false;
 
-    switch (id)
+    if (found)
+    {
+        success = entry->second.handler(*_dispatch, parameters);
+    }
+    else if (id == CsiActionCodes::REP_RepeatCharacter)
     {
-    case CsiActionCodes::CUU_CursorUp:
-        success = _dispatch->CursorUp(parameters.at(0));
-        break;
-    case CsiActionCodes::CUD_CursorDown:
-        success = _dispatch->CursorDown(parameters.at(0));
-        break;
-    case CsiActionCodes::CUF_CursorForward:
-        success = _dispatch->CursorForward(parameters.at(0));
-        break;
-    case CsiActionCodes::CUB_CursorBackward:
-        success = _dispatch->CursorBackward(parameters.at(0));
-        break;
-    case CsiActionCodes::CNL_CursorNextLine:
-        success = _dispatch->CursorNextLine(parameters.at(0));
-        break;
-    case CsiActionCodes::CPL_CursorPrevLine:
-        success = _dispatch->CursorPrevLine(parameters.at(0));
-        break;
-    case CsiActionCodes::CHA_CursorHorizontalAbsolute:
-    case CsiActionCodes::HPA_HorizontalPositionAbsolute:
-        success = _dispatch->CursorHorizontalPositionAbsolute(parameters.at(0));
-        break;
-    case CsiActionCodes::VPA_VerticalLinePositionAbsolute:
-        success = _dispatch->VerticalLinePositionAbsolute(parameters.at(0));
-        break;
-    case CsiActionCodes::HPR_HorizontalPositionRelative:
-        success = _dispatch->HorizontalPositionRelative(parameters.at(0));
-        break;
-    case CsiActionCodes::VPR_VerticalPositionRelative:
-        success = _dispatch->VerticalPositionRelative(parameters.at(0));
-        break;
-    case CsiActionCodes::CUP_CursorPosition:
-    case CsiActionCodes::HVP_HorizontalVerticalPosition:
-        success = _dispatch->CursorPosition(parameters.at(0), parameters.at(1));
-        break;
-    case CsiActionCodes::DECSTBM_SetTopBottomMargins:
-        success = _dispatch->SetTopBottomScrollingMargins(parameters.at(0).value_or(0), parameters.at(1).value_or(0));
-        break;
-    case CsiActionCodes::DECSLRM_SetLeftRightMargins:
-        // Note that this can also be ANSISYSSC, depending on the state of DECLRMM.
-        success = _dispatch->SetLeftRightScrollingMargins(parameters.at(0).value_or(0), parameters.at(1).value_or(0));
-        break;
-    case CsiActionCodes::ICH_InsertCharacter:
-        success = _dispatch->InsertCharacter(parameters.at(0));
-        break;
-    case CsiActionCodes::DCH_DeleteCharacter:
-        success = _dispatch->DeleteCharacter(parameters.at(0));
-        break;
-    case CsiActionCodes::ED_EraseDisplay:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->EraseInDisplay(eraseType);
-        });
-        break;
-    case CsiActionCodes::DECSED_SelectiveEraseDisplay:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->SelectiveEraseInDisplay(eraseType);
-        });
-        break;
-    case CsiActionCodes::EL_EraseLine:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->EraseInLine(eraseType);
-        });
-        break;
-    case CsiActionCodes::DECSEL_SelectiveEraseLine:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->SelectiveEraseInLine(eraseType);
-        });
-        break;
-    case CsiActionCodes::SM_SetMode:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->SetMode(DispatchTypes::ANSIStandardMode(mode));
-        });
-        break;
-    case CsiActionCodes::DECSET_PrivateModeSet:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->SetMode(DispatchTypes::DECPrivateMode(mode));
-        });
-        break;
-    case CsiActionCodes::RM_ResetMode:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->ResetMode(DispatchTypes::ANSIStandardMode(mode));
-        });
-        break;
-    case CsiActionCodes::DECRST_PrivateModeReset:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->ResetMode(DispatchTypes::DECPrivateMode(mode));
-        });
-        break;
-    case CsiActionCodes::SGR_SetGraphicsRendition:
-        success = _dispatch->SetGraphicsRendition(parameters);
-        break;
-    case CsiActionCodes::DSR_DeviceStatusReport:
-        success = _dispatch->DeviceStatusReport(DispatchTypes::ANSIStandardStatus(parameters.at(0)), parameters.at(1));
-        break;
-    case CsiActionCodes::DSR_PrivateDeviceStatusReport:
-        success = _dispatch->DeviceStatusReport(DispatchTypes::DECPrivateStatus(parameters.at(0)), parameters.at(1));
-        break;
-    case CsiActionCodes::DA_DeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->DeviceAttributes();
-        break;
-    case CsiActionCodes::DA2_SecondaryDeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->SecondaryDeviceAttributes();
-        break;
-    case CsiActionCodes::DA3_TertiaryDeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->TertiaryDeviceAttributes();
-        break;
-    case CsiActionCodes::DECREQTPARM_RequestTerminalParameters:
-        success = _dispatch->RequestTerminalParameters(parameters.at(0));
-        break;
-    case CsiActionCodes::SU_ScrollUp:
-        success = _dispatch->ScrollUp(parameters.at(0));
-        break;
-    case CsiActionCodes::SD_ScrollDown:
-        success = _dispatch->ScrollDown(parameters.at(0));
-        break;
-    case CsiActionCodes::ANSISYSRC_CursorRestore:
-        success = _dispatch->CursorRestoreState();
-        break;
-    case CsiActionCodes::IL_InsertLine:
-        success = _dispatch->InsertLine(parameters.at(0));
-        break;
-    case CsiActionCodes::DL_DeleteLine:
-        success = _dispatch->DeleteLine(parameters.at(0));
-        break;
-    case CsiActionCodes::CHT_CursorForwardTab:
-        success = _dispatch->ForwardTab(parameters.at(0));
-        break;
-    case CsiActionCodes::CBT_CursorBackTab:
-        success = _dispatch->BackwardsTab(parameters.at(0));
-        break;
-    case CsiActionCodes::TBC_TabClear:
-        success = parameters.for_each([&](const auto clearType) {
-            return _dispatch->TabClear(clearType);
-        });
-        break;
-    case CsiActionCodes::DECST8C_SetTabEvery8Columns:
-        success = parameters.for_each([&](const auto setType) {
-            return _dispatch->TabSet(setType);
-        });
-        break;
-    case CsiActionCodes::ECH_EraseCharacters:
-        success = _dispatch->EraseCharacters(parameters.at(0));
-        break;
-    case CsiActionCodes::DTTERM_WindowManipulation:
-        success = _dispatch->WindowManipulation(parameters.at(0), parameters.at(1), parameters.at(2));
-        break;
-    case CsiActionCodes::REP_RepeatCharacter:
         // Handled w/o the dispatch. This function is unique in that way
         // If this were in the ITerminalDispatch, then each
         // implementation would effectively be the same, calling only
@@ -590,76 +733,6 @@ bool OutputStateMachineEngine::ActionCsiDispatch(const VTID id, const VTParamete
             _dispatch->PrintString(wstr);
         }
         success = true;
-        break;
-    case CsiActionCodes::DECSCUSR_SetCursorStyle:
-        success = _dispatch->SetCursorStyle(parameters.at(0));
-        break;
-    case CsiActionCodes::DECSTR_SoftReset:
-        success = _dispatch->SoftReset();
-        break;
-    case CsiActionCodes::DECSCA_SetCharacterProtectionAttribute:
-        success = _dispatch->SetCharacterProtectionAttribute(parameters);
-        break;
-    case CsiActionCodes::XT_PushSgr:
-    case CsiActionCodes::XT_PushSgrAlias:
-        success = _dispatch->PushGraphicsRendition(parameters);
-        break;
-    case CsiActionCodes::XT_PopSgr:
-    case CsiActionCodes::XT_PopSgrAlias:
-        success = _dispatch->PopGraphicsRendition();
-        break;
-    case CsiActionCodes::DECRQM_RequestMode:
-        success = _dispatch->RequestMode(DispatchTypes::ANSIStandardMode(parameters.at(0)));
-        break;
-    case CsiActionCodes::DECRQM_PrivateRequestMode:
-        success = _dispatch->RequestMode(DispatchTypes::DECPrivateMode(parameters.at(0)));
-        break;
-    case CsiActionCodes::DECCARA_ChangeAttributesRectangularArea:
-        success = _dispatch->ChangeAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4));
-        break;
-    case CsiActionCodes::DECRARA_ReverseAttributesRectangularArea:
-        success = _dispatch->ReverseAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4));
-        break;
-    case CsiActionCodes::DECCRA_CopyRectangularArea:
-        success = _dispatch->CopyRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.at(4), parameters.at(5), parameters.at(6), parameters.at(7));
-        break;
-    case CsiActionCodes::DECRQPSR_RequestPresentationStateReport:
-        success = _dispatch->RequestPresentationStateReport(parameters.at(0));
-        break;
-    case CsiActionCodes::DECFRA_FillRectangularArea:
-        success = _dispatch->FillRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2), parameters.at(3).value_or(0), parameters.at(4).value_or(0));
-        break;
-    case CsiActionCodes::DECERA_EraseRectangularArea:
-        success = _dispatch->EraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0));
-        break;
-    case CsiActionCodes::DECSERA_SelectiveEraseRectangularArea:
-        success = _dispatch->SelectiveEraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0));
-        break;
-    case CsiActionCodes::DECIC_InsertColumn:
-        success = _dispatch->InsertColumn(parameters.at(0));
-        break;
-    case CsiActionCodes::DECDC_DeleteColumn:
-        success = _dispatch->DeleteColumn(parameters.at(0));
-        break;
-    case CsiActionCodes::DECSACE_SelectAttributeChangeExtent:
-        success = _dispatch->SelectAttributeChangeExtent(parameters.at(0));
-        break;
-    case CsiActionCodes::DECRQCRA_RequestChecksumRectangularArea:
-        success = _dispatch->RequestChecksumRectangularArea(parameters.at(0).value_or(0), parameters.at(1).value_or(0), parameters.at(2), parameters.at(3), parameters.at(4).value_or(0), parameters.at(5).value_or(0));
-        break;
-    case CsiActionCodes::DECINVM_InvokeMacro:
-        success = _dispatch->InvokeMacro(parameters.at(0).value_or(0));
-        break;
-    case CsiActionCodes::DECAC_AssignColor:
-        success = _dispatch->AssignColor(parameters.at(0), parameters.at(1).value_or(0), parameters.at(2).value_or(0));
-        break;
-    case CsiActionCodes::DECPS_PlaySound:
-        success = _dispatch->PlaySounds(parameters);
-        break;
-    default:
-        // If no functions to call, overall dispatch was a failure.
-        success = false;
-        break;
     }
 
     // If we were unable to process the string, and there's a TTY attached to us,
@@ -775,8 +848,12 @@ bool OutputStateMachineEngine::ActionOscDispatch(const wchar_t /*wch*/,
     }
     case OscActionCodes::SetColor:
     {
-        std::vector<size_t> tableIndexes;
-        std::vector<DWORD> colors;
+        // Sequences like OSC 4 arrive in bursts when color schemes change.
+        // The parsed pairs are batch-scoped, so they live in an arena which
+        // hands them all back at once when this dispatch returns.
+        til::pmr::arena arena;
+        std::pmr::vector<size_t> tableIndexes{ arena.resource() };
+        std::pmr::vector<DWORD> colors{ arena.resource() };
         success = _GetOscSetColorTable(string, tableIndexes, colors);
         for (size_t i = 0; i < tableIndexes.size(); i++)
         {
@@ -790,7 +867,8 @@ bool OutputStateMachineEngine::ActionOscDispatch(const wchar_t /*wch*/,
     case OscActionCodes::SetBackgroundColor:
     case OscActionCodes::SetCursorColor:
     {
-        std::vector<DWORD> colors;
+        til::pmr::arena arena;
+        std::pmr::vector<DWORD> colors{ arena.resource() };
         success = _GetOscSetColor(string, colors);
         if (success)
         {
@@ -946,8 +1024,8 @@ bool OutputStateMachineEngine::_GetOscTitle(const std::wstring_view string,
 // Return Value:
 // - True if at least one table index and color was parsed successfully. False otherwise.
 bool OutputStateMachineEngine::_GetOscSetColorTable(const std::wstring_view string,
-                                                    std::vector<size_t>& tableIndexes,
-                                                    std::vector<DWORD>& rgbs) const
+                                                    std::pmr::vector<size_t>& tableIndexes,
+                                                    std::pmr::vector<DWORD>& rgbs) const
 {
     const auto parts = Utils::SplitString(string, L';');
     if (parts.size() < 2)
@@ -955,8 +1033,8 @@ bool OutputStateMachineEngine::_GetOscSetColorTable(const std::wstring_view stri
         return false;
     }
 
-    std::vector<size_t> newTableIndexes;
-    std::vector<DWORD> newRgbs;
+    std::pmr::vector<size_t> newTableIndexes{ tableIndexes.get_allocator() };
+    std::pmr::vector<DWORD> newRgbs{ rgbs.get_allocator() };
 
     for (size_t i = 0, j = 1; j < parts.size(); i += 2, j += 2)
     {
@@ -1041,7 +1119,7 @@ bool OutputStateMachineEngine::_ParseHyperlink(const std::wstring_view string,
 // Return Value:
 // - True if at least one color was parsed successfully. False otherwise.
 bool OutputStateMachineEngine::_GetOscSetColor(const std::wstring_view string,
-                                               std::vector<DWORD>& rgbs) const
+                                               std::pmr::vector<DWORD>& rgbs) const
 {
     const auto parts = Utils::SplitString(string, L';');
     if (parts.size() < 1)
@@ -1049,7 +1127,7 @@ bool OutputStateMachineEngine::_GetOscSetColor(const std::wstring_view string,
         return false;
     }
 
-    std::vector<DWORD> newRgbs;
+    std::pmr::vector<DWORD> newRgbs{ rgbs.get_allocator() };
     for (size_t i = 0; i < parts.size(); i++)
     {
         const auto colorOptional = Utils::ColorFromXTermColor(til::at(parts, i));
@@ -1119,26 +1197,6 @@ bool OutputStateMachineEngine::_GetOscSetClipboard(const std::wstring_view strin
     return SUCCEEDED_LOG(Base64::Decode(substr, content));
 }
 
-// Routine Description:
-// - Takes a sequence id ("final byte") and determines if it accepts sub parameters.
-// Arguments:
-// - id - The sequence id to check for.
-// Return Value:
-// - True, if it accepts sub parameters or else False.
-bool OutputStateMachineEngine::_CanSeqAcceptSubParam(const VTID id, const VTParameters& parameters) noexcept
-{
-    switch (id)
-    {
-    case SGR_SetGraphicsRendition:
-        return true;
-    case DECCARA_ChangeAttributesRectangularArea:
-    case DECRARA_ReverseAttributesRectangularArea:
-        return !parameters.hasSubParamsFor(0) && !parameters.hasSubParamsFor(1) && !parameters.hasSubParamsFor(2) && !parameters.hasSubParamsFor(3);
-    default:
-        return false;
-    }
-}
-
 // Method Description:
 // - Clears our last stored character. The last stored character is the last
 //      graphical character we printed, which is reset if any other action is
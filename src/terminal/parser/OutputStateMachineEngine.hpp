@@ -22,7 +22,7 @@ namespace Microsoft::Console::Render
 
 namespace Microsoft::Console::VirtualTerminal
 {
-    class OutputStateMachineEngine : public IStateMachineEngine
+    class OutputStateMachineEngine final : public IStateMachineEngine
     {
     public:
         static constexpr size_t MAX_URL_LENGTH = 2 * 1048576; // 2MB, like iTerm2
@@ -31,6 +31,8 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool EncounteredWin32InputModeSequence() const noexcept override;
 
+        bool WillPassThroughUnhandledSequences() const noexcept override;
+
         bool ActionExecute(const wchar_t wch) override;
         bool ActionExecuteFromEscape(const wchar_t wch) override;
 
@@ -225,11 +227,11 @@ namespace Microsoft::Console::VirtualTerminal
                           std::wstring& title) const;
 
         bool _GetOscSetColorTable(const std::wstring_view string,
-                                  std::vector<size_t>& tableIndexes,
-                                  std::vector<DWORD>& rgbs) const;
+                                  std::pmr::vector<size_t>& tableIndexes,
+                                  std::pmr::vector<DWORD>& rgbs) const;
 
         bool _GetOscSetColor(const std::wstring_view string,
-                             std::vector<DWORD>& rgbs) const;
+                             std::pmr::vector<DWORD>& rgbs) const;
 
         bool _GetOscSetClipboard(const std::wstring_view string,
                                  std::wstring& content,
@@ -240,8 +242,6 @@ namespace Microsoft::Console::VirtualTerminal
                              std::wstring& params,
                              std::wstring& uri) const;
 
-        bool _CanSeqAcceptSubParam(const VTID id, const VTParameters& parameters) noexcept;
-
         void _ClearLastChar() noexcept;
     };
 }
@@ -13,6 +13,10 @@ void PrintUsage()
 {
     wprintf(L"Usage: conterm.parser.fuzzwrapper.exe <input file name> <codepage>\r\n");
     wprintf(L"Use codepage 1200 for Unicode. 437 for US English. 0 for reading straight as ASCII.\r\n");
+    wprintf(L"\r\n");
+    wprintf(L"       conterm.parser.fuzzwrapper.exe --replay <corpus file or directory> [threshold]\r\n");
+    wprintf(L"Replays the fuzz corpus (plus built-in pathological cases) through the parser with\r\n");
+    wprintf(L"timing, and flags entries whose cost exceeds <threshold> ns per byte (default 50).\r\n");
 }
 
 const UINT UNICODE_CP = 1200;
@@ -42,10 +46,196 @@ bool GetChar(wchar_t* pwch)
     }
 }
 
+namespace
+{
+    // The replay benchmark measures the parser itself, so unlike EchoDispatch
+    // it deliberately does nothing with the dispatched output.
+    class SilentDispatch final : public TermDispatch
+    {
+    public:
+        void Print(const wchar_t /*wchPrintable*/) override {}
+        void PrintString(const std::wstring_view /*string*/) override {}
+    };
+
+    struct ReplayEntry
+    {
+        std::wstring name;
+        std::wstring payload;
+    };
+
+    // Corpus files are raw byte streams (the fuzzer mutates bytes, not text),
+    // so replay them the same way the ASCII codepage path above does: one
+    // byte per wchar_t, no decoding.
+    std::wstring WidenBytes(const std::string& bytes)
+    {
+        std::wstring wide;
+        wide.reserve(bytes.size());
+        for (const auto ch : bytes)
+        {
+            wide.push_back(static_cast<wchar_t>(static_cast<unsigned char>(ch)));
+        }
+        return wide;
+    }
+
+    bool ReadEntireFile(const std::filesystem::path& path, std::string& bytes)
+    {
+        const auto file = _wfopen(path.c_str(), L"rb");
+        if (!file)
+        {
+            return false;
+        }
+        fseek(file, 0, SEEK_END);
+        const auto size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        bytes.resize(size > 0 ? static_cast<size_t>(size) : 0);
+        const auto read = fread(bytes.data(), 1, bytes.size(), file);
+        fclose(file);
+        bytes.resize(read);
+        return true;
+    }
+
+    // Hand-minimized streams that have historically hit parser slow paths.
+    // These run on every invocation, even with an empty corpus directory, so
+    // a quadratic regression in one of them is caught without needing the
+    // fuzzer to rediscover it.
+    std::vector<ReplayEntry> BuildPathologicalCases()
+    {
+        std::vector<ReplayEntry> cases;
+
+        {
+            // Attribute churn: every printed glyph is bracketed by SGR changes.
+            std::wstring s;
+            for (auto i = 0; i < 100000; i++)
+            {
+                s.append(L"\x1b[31mA\x1b[0mB");
+            }
+            cases.push_back({ L"alternating-sgr", std::move(s) });
+        }
+        {
+            // One CSI with an enormous parameter list.
+            std::wstring s{ L"\x1b[" };
+            for (auto i = 0; i < 30000; i++)
+            {
+                s.append(L"38;2;12;34;56;");
+            }
+            s.append(L"m");
+            cases.push_back({ L"giant-sgr-parameter-list", std::move(s) });
+        }
+        {
+            // Many small DCS sequences back to back; each one spins up and
+            // tears down the string handler.
+            std::wstring s;
+            for (auto i = 0; i < 20000; i++)
+            {
+                s.append(L"\x1bP1;2;3|payload\x1b\\");
+            }
+            cases.push_back({ L"dcs-churn", std::move(s) });
+        }
+        {
+            // One DCS whose passthrough string contains nested ESC re-entries
+            // that are not string terminators.
+            std::wstring s{ L"\x1bPq" };
+            for (auto i = 0; i < 100000; i++)
+            {
+                s.append(L"#1;\x1b\x1b");
+            }
+            s.append(L"\x1b\\");
+            cases.push_back({ L"dcs-nested-esc", std::move(s) });
+        }
+        {
+            // A long OSC that never terminates; the parser buffers it all.
+            std::wstring s{ L"\x1b]0;" };
+            s.append(500000, L'x');
+            cases.push_back({ L"unterminated-osc", std::move(s) });
+        }
+        {
+            // Cursor addressing storm: full-screen random access repaint.
+            std::wstring s;
+            wchar_t run[16];
+            for (auto i = 0; i < 50000; i++)
+            {
+                swprintf_s(run, L"\x1b[%d;%dHZ", (i % 30) + 1, (i % 120) + 1);
+                s.append(run);
+            }
+            cases.push_back({ L"cursor-address-storm", std::move(s) });
+        }
+
+        return cases;
+    }
+
+    int RunReplay(const std::filesystem::path& corpusPath, const double thresholdNsPerByte)
+    {
+        auto entries = BuildPathologicalCases();
+
+        std::error_code ec;
+        if (std::filesystem::is_directory(corpusPath, ec))
+        {
+            for (const auto& file : std::filesystem::recursive_directory_iterator(corpusPath, ec))
+            {
+                if (!file.is_regular_file())
+                {
+                    continue;
+                }
+                std::string bytes;
+                if (ReadEntireFile(file.path(), bytes) && !bytes.empty())
+                {
+                    entries.push_back({ file.path().filename().wstring(), WidenBytes(bytes) });
+                }
+            }
+        }
+        else
+        {
+            std::string bytes;
+            if (!ReadEntireFile(corpusPath, bytes))
+            {
+                wprintf(L"Failed to open '%s'.\r\n", corpusPath.c_str());
+                return E_INVALIDARG;
+            }
+            entries.push_back({ corpusPath.filename().wstring(), WidenBytes(bytes) });
+        }
+
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+
+        auto flagged = 0;
+        wprintf(L"%-28s %12s %12s\r\n", L"entry", L"bytes", L"ns/byte");
+        for (const auto& entry : entries)
+        {
+            // Best of three runs, each against a fresh state machine so that
+            // one entry's dangling string sequence can't taint the next.
+            auto bestTicks = LLONG_MAX;
+            for (auto run = 0; run < 3; run++)
+            {
+                StateMachine machine(std::make_unique<OutputStateMachineEngine>(std::make_unique<SilentDispatch>()));
+
+                LARGE_INTEGER start, end;
+                QueryPerformanceCounter(&start);
+                machine.ProcessString(entry.payload);
+                QueryPerformanceCounter(&end);
+                bestTicks = std::min(bestTicks, end.QuadPart - start.QuadPart);
+            }
+
+            const auto nsPerByte = (static_cast<double>(bestTicks) * 1e9) / (static_cast<double>(freq.QuadPart) * static_cast<double>(entry.payload.size()));
+            const auto slow = nsPerByte > thresholdNsPerByte;
+            flagged += slow ? 1 : 0;
+            wprintf(L"%-28s %12zu %12.1f%s\r\n", entry.name.c_str(), entry.payload.size(), nsPerByte, slow ? L"  <-- SLOW" : L"");
+        }
+
+        wprintf(L"\r\n%d of %zu entries exceeded %.1f ns/byte.\r\n", flagged, entries.size(), thresholdNsPerByte);
+        return flagged > 0 ? 1 : 0;
+    }
+}
+
 int __cdecl wmain(int argc, wchar_t* argv[])
 {
     auto ret = 0;
 
+    if (argc >= 3 && wcscmp(argv[1], L"--replay") == 0)
+    {
+        const auto threshold = argc >= 4 ? _wtof(argv[3]) : 50.0;
+        return RunReplay(argv[2], threshold);
+    }
+
     if (argc != 3)
     {
         PrintUsage();
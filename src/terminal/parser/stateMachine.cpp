@@ -7,6 +7,11 @@
 
 #include "ascii.hpp"
 
+// The concrete engine headers are needed so that _EngineDispatch can call
+// them devirtualized; see the comment on that method.
+#include "InputStateMachineEngine.hpp"
+#include "OutputStateMachineEngine.hpp"
+
 using namespace Microsoft::Console::VirtualTerminal;
 
 //Takes ownership of the pEngine.
@@ -380,7 +385,7 @@ void StateMachine::_ActionExecute(const wchar_t wch)
 {
     _trace.TraceOnExecute(wch);
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionExecute(wch);
+        return _EngineDispatch([=](auto& engine) { return engine.ActionExecute(wch); });
     }));
 }
 
@@ -396,7 +401,7 @@ void StateMachine::_ActionExecuteFromEscape(const wchar_t wch)
 {
     _trace.TraceOnExecuteFromEscape(wch);
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionExecuteFromEscape(wch);
+        return _EngineDispatch([=](auto& engine) { return engine.ActionExecuteFromEscape(wch); });
     }));
 }
 
@@ -410,7 +415,7 @@ void StateMachine::_ActionPrint(const wchar_t wch)
 {
     _trace.TraceOnAction(L"Print");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionPrint(wch);
+        return _EngineDispatch([=](auto& engine) { return engine.ActionPrint(wch); });
     }));
 }
 
@@ -423,7 +428,7 @@ void StateMachine::_ActionPrint(const wchar_t wch)
 void StateMachine::_ActionPrintString(const std::wstring_view string)
 {
     _SafeExecute([=]() {
-        return _engine->ActionPrintString(string);
+        return _EngineDispatch([=](auto& engine) { return engine.ActionPrintString(string); });
     });
     _trace.DispatchPrintRunTrace(string);
 }
@@ -439,7 +444,7 @@ void StateMachine::_ActionEscDispatch(const wchar_t wch)
 {
     _trace.TraceOnAction(L"EscDispatch");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionEscDispatch(_identifier.Finalize(wch));
+        return _EngineDispatch([=](auto& engine) { return engine.ActionEscDispatch(_identifier.Finalize(wch)); });
     }));
 }
 
@@ -454,7 +459,9 @@ void StateMachine::_ActionVt52EscDispatch(const wchar_t wch)
 {
     _trace.TraceOnAction(L"Vt52EscDispatch");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionVt52EscDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
+        return _EngineDispatch([=](auto& engine) {
+            return engine.ActionVt52EscDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
+        });
     }));
 }
 
@@ -469,8 +476,10 @@ void StateMachine::_ActionCsiDispatch(const wchar_t wch)
 {
     _trace.TraceOnAction(L"CsiDispatch");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionCsiDispatch(_identifier.Finalize(wch),
-                                          { _parameters, _subParameters, _subParameterRanges });
+        return _EngineDispatch([=](auto& engine) {
+            return engine.ActionCsiDispatch(_identifier.Finalize(wch),
+                                            { _parameters, _subParameters, _subParameterRanges });
+        });
     }));
 }
 
@@ -625,7 +634,7 @@ void StateMachine::_ActionClear()
 
     _dcsStringHandler = nullptr;
 
-    _engine->ActionClear();
+    _EngineDispatch([](auto& engine) { engine.ActionClear(); });
 }
 
 // Routine Description:
@@ -695,7 +704,7 @@ void StateMachine::_ActionOscDispatch(const wchar_t wch)
 {
     _trace.TraceOnAction(L"OscDispatch");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionOscDispatch(wch, _oscParameter, _oscString);
+        return _EngineDispatch([=](auto& engine) { return engine.ActionOscDispatch(wch, _oscParameter, _oscString); });
     }));
 }
 
@@ -710,7 +719,9 @@ void StateMachine::_ActionSs3Dispatch(const wchar_t wch)
 {
     _trace.TraceOnAction(L"Ss3Dispatch");
     _trace.DispatchSequenceTrace(_SafeExecute([=]() {
-        return _engine->ActionSs3Dispatch(wch, { _parameters.data(), _parameters.size() });
+        return _EngineDispatch([=](auto& engine) {
+            return engine.ActionSs3Dispatch(wch, { _parameters.data(), _parameters.size() });
+        });
     }));
 }
 
@@ -726,7 +737,9 @@ void StateMachine::_ActionDcsDispatch(const wchar_t wch)
     _trace.TraceOnAction(L"DcsDispatch");
 
     const auto success = _SafeExecute([=]() {
-        _dcsStringHandler = _engine->ActionDcsDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
+        _dcsStringHandler = _EngineDispatch([=](auto& engine) {
+            return engine.ActionDcsDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
+        });
         // If the returned handler is null, the sequence is not supported.
         return _dcsStringHandler != nullptr;
     });
@@ -1990,16 +2003,12 @@ static size_t findActionableFromGround(const wchar_t* data, size_t count) noexce
 #if defined(TIL_SSE_INTRINSICS)
 
     auto it = data;
+    const auto z = _mm_setzero_si128();
 
-    for (const auto end = data + (count & ~size_t{ 7 }); it < end; it += 8)
-    {
-        const auto wch = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
-        const auto z = _mm_setzero_si128();
-
-        // Dealing with unsigned numbers in SSE2 is annoying because it has poor support for that.
-        // We'll use subtractions with saturation ("SubS") to work around that. A check like
-        // a < b can be implemented as "max(0, a - b) == 0" and "max(0, a - b)" is what "SubS" is.
-
+    // Dealing with unsigned numbers in SSE2 is annoying because it has poor support for that.
+    // We'll use subtractions with saturation ("SubS") to work around that. A check like
+    // a < b can be implemented as "max(0, a - b) == 0" and "max(0, a - b)" is what "SubS" is.
+    const auto classify = [=](const __m128i wch) noexcept {
         // Check for (wch < 0x20)
         auto a = _mm_subs_epu16(wch, _mm_set1_epi16(0x1f));
         // Check for "((wch - 0x7f) <= 0x20)" by adding 0x10000-0x7f, which overflows to a
@@ -2008,8 +2017,31 @@ static size_t findActionableFromGround(const wchar_t* data, size_t count) noexce
         auto b = _mm_subs_epu16(_mm_add_epi16(wch, _mm_set1_epi16(static_cast<short>(0xff81))), _mm_set1_epi16(0x20));
         a = _mm_cmpeq_epi16(a, z);
         b = _mm_cmpeq_epi16(b, z);
+        return _mm_or_si128(a, b);
+    };
 
-        const auto c = _mm_or_si128(a, b);
+    // Main loop: 16 characters (32 bytes) per iteration. Bulk output is
+    // overwhelmingly printable text, so the wider stride halves the loop
+    // overhead for the common case of not finding anything actionable.
+    for (const auto end = data + (count & ~size_t{ 15 }); it < end; it += 16)
+    {
+        const auto lo = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)));
+        const auto hi = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 8)));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(lo)) | (static_cast<uint32_t>(_mm_movemask_epi8(hi)) << 16);
+
+        if (mask)
+        {
+            unsigned long offset;
+            _BitScanForward(&offset, mask);
+            it += offset / 2;
+            return it - data;
+        }
+    }
+
+    // At most one more 8-character block remains before the scalar tail.
+    for (const auto end = data + (count & ~size_t{ 7 }); it < end; it += 8)
+    {
+        const auto c = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)));
         const auto mask = _mm_movemask_epi8(c);
 
         if (mask)
@@ -2116,6 +2148,45 @@ void StateMachine::ProcessString(const std::wstring_view string)
 
         do
         {
+            // DCS payloads (think multi-megabyte sixel images) would otherwise go
+            // through ProcessCharacter for every single byte, which costs several
+            // branches and a state switch per character before the string handler
+            // is finally invoked. While we're in the passthrough state we can feed
+            // the handler in a tight loop instead, stopping at anything that could
+            // interrupt or terminate the sequence (CAN, SUB, ESC, C1 controls).
+            if (_state == VTStates::DcsPassThrough)
+            {
+                while (i < string.size())
+                {
+                    const auto wch = til::at(string, i);
+                    if (wch == AsciiChars::CAN || wch == AsciiChars::SUB || _isEscape(wch) || _isC1ControlCharacter(wch))
+                    {
+                        break;
+                    }
+
+                    _runSize++;
+                    _processingLastCharacter = i + 1 >= string.size();
+                    ++i;
+
+                    if (_isC0Code(wch) || _isDcsPassThroughValid(wch))
+                    {
+                        if (!_dcsStringHandler(wch))
+                        {
+                            _EnterDcsIgnore();
+                            break;
+                        }
+                    }
+                }
+                if (i >= string.size() || _state != VTStates::DcsPassThrough)
+                {
+                    // The chunk is exhausted, or the handler bailed out into the
+                    // ignore state: the loop condition sorts out what comes next.
+                    continue;
+                }
+                // Otherwise we stopped at an interrupting character, which takes
+                // the regular single-character path below.
+            }
+
             _runSize++;
             _processingLastCharacter = i + 1 >= string.size();
             // If we're processing characters individually, send it to the state machine.
@@ -2174,13 +2245,23 @@ void StateMachine::ProcessString(const std::wstring_view string)
             // thing to the terminal later. There is no need to do this if we've
             // reached one of the string processing states, though, since that data
             // will be dealt with as soon as it is received.
-            if (!_cachedSequence)
+            //
+            // The parse state itself (parameters, intermediates, the collected OSC
+            // string, ...) is carried across chunk boundaries in our members either
+            // way; this copy exists solely so FlushToTerminal can replay the raw
+            // text. Engines that never ask for that (anything without a ConPTY
+            // connection) shouldn't pay for an ever-growing copy of long chunked
+            // payloads that nobody will ever read.
+            if (_engine->WillPassThroughUnhandledSequences())
             {
-                _cachedSequence.emplace(std::wstring{});
-            }
+                if (!_cachedSequence)
+                {
+                    _cachedSequence.emplace(std::wstring{});
+                }
 
-            auto& cachedSequence = *_cachedSequence;
-            cachedSequence.append(run);
+                auto& cachedSequence = *_cachedSequence;
+                cachedSequence.append(run);
+            }
         }
     }
 }
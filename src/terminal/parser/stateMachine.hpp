@@ -49,6 +49,18 @@ namespace Microsoft::Console::VirtualTerminal
         StateMachine(std::unique_ptr<T> engine) :
             StateMachine(std::move(engine), std::is_same_v<T, class InputStateMachineEngine>)
         {
+            // Each instance is permanently bound to its engine, so when it's
+            // one of the two engines we ship we remember the concrete type:
+            // the action dispatch can then call it directly instead of going
+            // through the vtable on every action (see _EngineDispatch).
+            if constexpr (std::is_same_v<T, class OutputStateMachineEngine>)
+            {
+                _outputEngine = static_cast<T*>(_engine.get());
+            }
+            else if constexpr (std::is_same_v<T, class InputStateMachineEngine>)
+            {
+                _inputEngine = static_cast<T*>(_engine.get());
+            }
         }
         StateMachine(std::unique_ptr<IStateMachineEngine> engine, const bool isEngineForInput);
 
@@ -147,6 +159,25 @@ namespace Microsoft::Console::VirtualTerminal
 
         void _AccumulateTo(const wchar_t wch, VTInt& value) noexcept;
 
+        // Invokes func with the engine devirtualized to its concrete type
+        // when it's one of the two engines we ship. Both are final, so the
+        // compiler can turn the engine action into a direct call and inline
+        // it into the parse loop. Other engines (test mocks) take the
+        // regular virtual call.
+        template<typename TFunc>
+        auto _EngineDispatch(TFunc&& func)
+        {
+            if (_outputEngine)
+            {
+                return func(*_outputEngine);
+            }
+            if (_inputEngine)
+            {
+                return func(*_inputEngine);
+            }
+            return func(*_engine);
+        }
+
         template<typename TLambda>
         bool _SafeExecute(TLambda&& lambda);
 
@@ -179,6 +210,10 @@ namespace Microsoft::Console::VirtualTerminal
         Microsoft::Console::VirtualTerminal::ParserTracing _trace;
 
         std::unique_ptr<IStateMachineEngine> _engine;
+        // At most one of these aliases _engine; both stay null for engine
+        // types we don't know about (see the templated constructor).
+        class OutputStateMachineEngine* _outputEngine = nullptr;
+        class InputStateMachineEngine* _inputEngine = nullptr;
         const bool _isEngineForInput;
 
         VTStates _state;
@@ -45,6 +45,11 @@ public:
         return false;
     }
 
+    bool WillPassThroughUnhandledSequences() const noexcept override
+    {
+        return true;
+    }
+
     bool ActionExecute(const wchar_t wch) override
     {
         executed += wch;
@@ -1092,4 +1092,150 @@ class BitmapTests
         }
         VERIFY_ARE_EQUAL(expected, actual);
     }
+
+    TEST_METHOD(HierarchicalConstruct)
+    {
+        const til::hierarchical_bitmap defaultMap;
+        VERIFY_ARE_EQUAL(til::size{}, defaultMap.size());
+        VERIFY_IS_TRUE(defaultMap.none());
+        VERIFY_IS_FALSE(defaultMap.any());
+
+        const til::size expectedSize{ 5, 10 };
+        const til::hierarchical_bitmap emptyMap{ expectedSize };
+        VERIFY_ARE_EQUAL(expectedSize, emptyMap.size());
+        VERIFY_IS_TRUE(emptyMap.none());
+        VERIFY_IS_FALSE(emptyMap.all());
+
+        const til::hierarchical_bitmap fullMap{ expectedSize, true };
+        VERIFY_ARE_EQUAL(expectedSize, fullMap.size());
+        VERIFY_IS_TRUE(fullMap.all());
+        VERIFY_IS_FALSE(fullMap.none());
+    }
+
+    TEST_METHOD(HierarchicalSetAndRuns)
+    {
+        // Use a map wider than one summary region (>64 bits total)
+        // so the second-level acceleration actually gets exercised.
+        // This map --> Those runs
+        // 1 1 0 1      A A _ B
+        // 1 0 1 1      C _ D D
+        // 0 0 1 0      _ _ E _
+        // 0 1 1 0      _ F F _
+        Log::Comment(L"Set up a hierarchical bitmap with some runs.");
+
+        til::hierarchical_bitmap map{ til::size{ 4, 4 }, false };
+
+        map.set(til::rect{ til::point{ 0, 0 }, til::size{ 2, 1 } });
+        map.set(til::rect{ til::point{ 2, 1 }, til::size{ 1, 3 } });
+        map.set(til::rect{ til::point{ 3, 0 }, til::size{ 1, 2 } });
+        map.set(til::point{ 0, 1 });
+        map.set(til::point{ 1, 3 });
+
+        til::some<til::rect, 6> expected;
+        expected.push_back(til::rect{ til::point{ 0, 0 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 3, 0 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 1 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 1 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 2 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 1, 3 }, til::size{ 2, 1 } });
+
+        til::some<til::rect, 6> actual;
+        for (auto run : map.runs())
+        {
+            actual.push_back(run);
+        }
+        VERIFY_ARE_EQUAL(expected, actual);
+
+        Log::Comment(L"Now a sparse bit in a large map, which crosses several summary words.");
+        til::hierarchical_bitmap large{ til::size{ 120, 80 }, false };
+        VERIFY_IS_TRUE(large.none());
+        VERIFY_IS_FALSE(large.one());
+
+        const til::point lonely{ 97, 63 };
+        large.set(lonely);
+        VERIFY_IS_TRUE(large.any());
+        VERIFY_IS_TRUE(large.one());
+
+        std::vector<til::rect> largeActual;
+        for (auto run : large.runs())
+        {
+            largeActual.push_back(run);
+        }
+        VERIFY_ARE_EQUAL(1u, largeActual.size());
+        const til::rect lonelyRect{ lonely, til::size{ 1, 1 } };
+        VERIFY_ARE_EQUAL(lonelyRect, largeActual.front());
+
+        large.reset_all();
+        VERIFY_IS_TRUE(large.none());
+
+        large.set_all();
+        VERIFY_IS_TRUE(large.all());
+        VERIFY_IS_FALSE(large.one());
+    }
+
+    TEST_METHOD(HierarchicalTranslateAndResize)
+    {
+        til::hierarchical_bitmap map{ til::size{ 6, 6 }, false };
+        map.set(til::rect{ til::point{ 1, 1 }, til::size{ 2, 2 } });
+
+        Log::Comment(L"Translate the contents down and right by one, filling uncovered space.");
+        map.translate(til::point{ 1, 1 }, true);
+
+        std::vector<til::rect> actual;
+        for (auto run : map.runs())
+        {
+            actual.push_back(run);
+        }
+
+        // The translated block lives at 2,2 and the revealed top row and
+        // left column are filled.
+        std::vector<til::rect> expected;
+        expected.push_back(til::rect{ til::point{ 0, 0 }, til::size{ 6, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 1 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 2 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 2 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 3 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 3 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 4 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 5 }, til::size{ 1, 1 } });
+        VERIFY_ARE_EQUAL(expected, actual);
+
+        Log::Comment(L"Resize with fill marks only the newly revealed region.");
+        til::hierarchical_bitmap grown{ til::size{ 2, 2 }, false };
+        grown.resize(til::size{ 4, 3 }, true);
+
+        actual.clear();
+        for (auto run : grown.runs())
+        {
+            actual.push_back(run);
+        }
+
+        expected.clear();
+        expected.push_back(til::rect{ til::point{ 2, 0 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 1 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 0, 2 }, til::size{ 4, 1 } });
+        VERIFY_ARE_EQUAL(expected, actual);
+    }
+
+    TEST_METHOD(HierarchicalRunsWithPmr)
+    {
+        std::pmr::unsynchronized_pool_resource pool{ til::pmr::get_default_resource() };
+
+        til::pmr::hierarchical_bitmap map{ til::size{ 4, 4 }, false, &pool };
+        map.set(til::rect{ til::point{ 0, 0 }, til::size{ 2, 1 } });
+        map.set(til::rect{ til::point{ 2, 1 }, til::size{ 1, 3 } });
+
+        til::some<til::rect, 4> expected;
+        expected.push_back(til::rect{ til::point{ 0, 0 }, til::size{ 2, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 1 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 2 }, til::size{ 1, 1 } });
+        expected.push_back(til::rect{ til::point{ 2, 3 }, til::size{ 1, 1 } });
+
+        til::some<til::rect, 4> actual;
+        for (auto run : map.runs())
+        {
+            actual.push_back(run);
+        }
+        VERIFY_ARE_EQUAL(expected, actual);
+    }
 };
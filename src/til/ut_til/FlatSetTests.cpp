@@ -65,4 +65,49 @@ class FlatSetTests
         VERIFY_ARE_EQUAL(&entry1, &entry2);
         VERIFY_ARE_EQUAL(123u, entry2.value);
     }
+
+    TEST_METHOD(Reserve)
+    {
+        til::linear_flat_set<Data> set;
+
+        set.reserve(100);
+        const auto capacity = set.container().size();
+        // A LoadFactor of 2 means 100 items need at least 200 slots,
+        // rounded up to the next power of 2.
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(capacity, 200u);
+
+        // Inserting the reserved amount must not rehash.
+        for (int i = 0; i < 100; ++i)
+        {
+            set.insert(i);
+        }
+        VERIFY_ARE_EQUAL(capacity, set.container().size());
+        VERIFY_ARE_EQUAL(100u, set.size());
+
+        // Reserving less than the current capacity is a no-op.
+        set.reserve(10);
+        VERIFY_ARE_EQUAL(capacity, set.container().size());
+    }
+
+    TEST_METHOD(Stats)
+    {
+        til::linear_flat_set<Data> set;
+
+        const auto emptyStats = set.stats();
+        VERIFY_ARE_EQUAL(0u, emptyStats.items);
+        VERIFY_ARE_EQUAL(0u, emptyStats.capacity);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            set.insert(i);
+        }
+
+        const auto stats = set.stats();
+        VERIFY_ARE_EQUAL(100u, stats.items);
+        VERIFY_ARE_EQUAL(set.container().size(), stats.capacity);
+        // With linear probing the longest probe sequence is bounded by the
+        // number of items, and the total can't exceed items * max.
+        VERIFY_IS_LESS_THAN(stats.max_probe_length, 100u);
+        VERIFY_IS_LESS_THAN_OR_EQUAL(stats.total_probe_length, stats.items * (stats.max_probe_length + 1));
+    }
 };
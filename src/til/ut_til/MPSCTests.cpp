@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+
+#include <til/mpsc.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+namespace
+{
+    template<typename T>
+    void drop(T&& val)
+    {
+        auto _ = std::move(val);
+    }
+}
+
+class MPSCTests
+{
+    BEGIN_TEST_CLASS(MPSCTests)
+        TEST_CLASS_PROPERTY(L"TestTimeout", L"0:0:10") // 10s timeout
+    END_TEST_CLASS()
+
+    TEST_METHOD(SmokeTest);
+    TEST_METHOD(TryEmplaceTest);
+    TEST_METHOD(DropProducersTest);
+    TEST_METHOD(DropConsumerTest);
+    TEST_METHOD(IntegrationTest);
+};
+
+void MPSCTests::SmokeTest()
+{
+    // This test mostly ensures that the API wasn't broken.
+
+    // construction
+    auto [tx, rx] = til::mpsc::channel<int>(32);
+    std::array<int, 3> buffer{};
+
+    // the producer end is copyable, the consumer end is move-only
+    auto tx2(tx);
+    auto tx3 = tx;
+    auto rx2(std::move(rx));
+    rx = std::move(rx2);
+
+    // push from any handle
+    VERIFY_IS_TRUE(tx.emplace(1));
+    VERIFY_IS_TRUE(tx2.emplace(2));
+    VERIFY_IS_TRUE(tx3.emplace(3));
+
+    // pop preserves FIFO order
+    VERIFY_ARE_EQUAL(1, rx.pop());
+    rx.pop_n(buffer.begin(), buffer.size());
+    VERIFY_ARE_EQUAL(2, buffer[0]);
+    VERIFY_ARE_EQUAL(3, buffer[1]);
+}
+
+void MPSCTests::TryEmplaceTest()
+{
+    auto [tx, rx] = til::mpsc::channel<int>(4);
+
+    // try_emplace pushes like emplace while there's room...
+    for (auto i = 0; i < 4; ++i)
+    {
+        VERIFY_IS_TRUE(tx.try_emplace(i));
+    }
+
+    // ...but fails instead of blocking once the queue is full.
+    VERIFY_IS_FALSE(tx.try_emplace(4));
+
+    // Freeing a slot makes it succeed again, preserving FIFO order.
+    VERIFY_ARE_EQUAL(0, rx.pop());
+    VERIFY_IS_TRUE(tx.try_emplace(4));
+    for (auto i = 1; i <= 4; ++i)
+    {
+        VERIFY_ARE_EQUAL(i, rx.pop());
+    }
+
+    // Like emplace, it fails once the consumer is gone.
+    drop(rx);
+    VERIFY_IS_FALSE(tx.try_emplace(5));
+}
+
+void MPSCTests::DropProducersTest()
+{
+    auto [tx, rx] = til::mpsc::channel<int>(4);
+    auto tx2 = tx;
+
+    VERIFY_IS_TRUE(tx.emplace(1));
+    VERIFY_IS_TRUE(tx2.emplace(2));
+
+    // Dropping all producers still allows the consumer to drain the
+    // remaining items before it's told the channel is done.
+    drop(tx);
+    drop(tx2);
+
+    VERIFY_ARE_EQUAL(1, rx.pop());
+    VERIFY_ARE_EQUAL(2, rx.pop());
+    VERIFY_ARE_EQUAL(std::nullopt, rx.pop());
+
+    std::array<int, 4> buffer{};
+    const auto [read, ok] = rx.pop_n(buffer.begin(), buffer.size());
+    VERIFY_ARE_EQUAL(0u, read);
+    VERIFY_IS_FALSE(ok);
+}
+
+void MPSCTests::DropConsumerTest()
+{
+    auto [tx, rx] = til::mpsc::channel<int>(4);
+
+    VERIFY_IS_TRUE(tx.emplace(1));
+
+    drop(rx);
+
+    // Once the consumer is gone, pushes fail instead of blocking,
+    // even when the queue is full.
+    for (auto i = 0; i < 8; ++i)
+    {
+        VERIFY_IS_FALSE(tx.emplace(i));
+    }
+}
+
+void MPSCTests::IntegrationTest()
+{
+    static constexpr auto threadCount = 4;
+    static constexpr auto itemsPerThread = 1000;
+
+    auto [tx, rx] = til::mpsc::channel<int>(7);
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < threadCount; ++t)
+    {
+        // Each producer thread gets its own copy of the producer end and
+        // pushes its own range of values, all racing for the tiny queue.
+        threads.emplace_back([tx, t]() {
+            for (auto i = 0; i < itemsPerThread; ++i)
+            {
+                tx.emplace(t * itemsPerThread + i);
+            }
+        });
+    }
+    drop(tx);
+
+    // Drain in batches until all producers hung up. Values from different
+    // threads interleave arbitrarily, but each thread's values must arrive
+    // in order and exactly once.
+    std::array<int, 16> buffer{};
+    std::array<int, threadCount> expected{};
+    auto total = 0;
+
+    for (;;)
+    {
+        const auto [read, ok] = rx.pop_n(buffer.begin(), buffer.size());
+        for (size_t i = 0; i < read; ++i)
+        {
+            const auto value = buffer[i];
+            const auto thread = value / itemsPerThread;
+            VERIFY_ARE_EQUAL(expected[thread], value % itemsPerThread);
+            expected[thread]++;
+            total++;
+        }
+        if (!ok)
+        {
+            break;
+        }
+    }
+
+    VERIFY_ARE_EQUAL(threadCount * itemsPerThread, total);
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class PmrTests
+{
+    TEST_CLASS(PmrTests);
+
+    TEST_METHOD(Arena)
+    {
+        til::pmr::arena arena;
+
+        // Small allocations come out of the inline buffer, back to back.
+        const auto a = arena.resource()->allocate(16, 8);
+        const auto b = arena.resource()->allocate(16, 8);
+        VERIFY_ARE_NOT_EQUAL(a, b);
+
+        // deallocate() is a no-op, reset() returns everything at once and
+        // resumes allocating from the start of the inline buffer.
+        arena.resource()->deallocate(a, 16, 8);
+        arena.reset();
+        const auto c = arena.resource()->allocate(16, 8);
+        VERIFY_ARE_EQUAL(a, c);
+    }
+
+    TEST_METHOD(ArenaContainers)
+    {
+        til::pmr::arena arena;
+
+        std::pmr::vector<size_t> vec{ arena.resource() };
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        // Allocations larger than the inline buffer spill upstream.
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            VERIFY_ARE_EQUAL(i, vec[i]);
+        }
+    }
+};
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include <til/rect_set.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class RectSetTests
+{
+    TEST_CLASS(RectSetTests);
+
+    TEST_METHOD(SubtractCenter)
+    {
+        til::rect_set region{ til::rect{ 0, 0, 10, 10 } };
+        region.subtract(til::rect{ 3, 3, 7, 7 });
+
+        // Wide-biased carving: full-width top and bottom
+        // slabs plus the left and right remainders.
+        VERIFY_ARE_EQUAL(4u, region.size());
+        auto it = region.begin();
+        VERIFY_ARE_EQUAL(til::rect(0, 0, 10, 3), *it++);
+        VERIFY_ARE_EQUAL(til::rect(0, 3, 3, 7), *it++);
+        VERIFY_ARE_EQUAL(til::rect(7, 3, 10, 7), *it++);
+        VERIFY_ARE_EQUAL(til::rect(0, 7, 10, 10), *it++);
+    }
+
+    TEST_METHOD(SubtractDisjoint)
+    {
+        til::rect_set region{ til::rect{ 0, 0, 10, 10 } };
+        region.subtract(til::rect{ 20, 20, 30, 30 });
+
+        VERIFY_ARE_EQUAL(1u, region.size());
+        VERIFY_ARE_EQUAL(til::rect(0, 0, 10, 10), *region.begin());
+    }
+
+    TEST_METHOD(SubtractEverything)
+    {
+        til::rect_set region{ til::rect{ 2, 2, 8, 8 } };
+        region.subtract(til::rect{ 0, 0, 10, 10 });
+
+        VERIFY_IS_TRUE(region.empty());
+    }
+
+    TEST_METHOD(AddIsNonOverlapping)
+    {
+        til::rect_set region{ til::rect{ 0, 0, 10, 10 } };
+        // Entirely covered already: nothing changes.
+        region.add(til::rect{ 2, 2, 8, 8 });
+        VERIFY_ARE_EQUAL(1u, region.size());
+
+        // Partially covered: only the uncovered half is added
+        // and the result merges back into a single rectangle.
+        region.add(til::rect{ 5, 0, 20, 10 });
+        VERIFY_ARE_EQUAL(1u, region.size());
+        VERIFY_ARE_EQUAL(til::rect(0, 0, 20, 10), *region.begin());
+    }
+
+    TEST_METHOD(CoalescesAfterChurn)
+    {
+        // Punch a hole and fill it back in: the region
+        // should collapse back to the original rectangle.
+        til::rect_set region{ til::rect{ 0, 0, 10, 10 } };
+        region.subtract(til::rect{ 3, 3, 7, 7 });
+        region.add(til::rect{ 3, 3, 7, 7 });
+
+        VERIFY_ARE_EQUAL(1u, region.size());
+        VERIFY_ARE_EQUAL(til::rect(0, 0, 10, 10), *region.begin());
+    }
+
+    TEST_METHOD(RepeatedSubtractStaysNormalized)
+    {
+        // Slice a row band out of every other line. Each remaining band is a
+        // single full-width rectangle, so the region must not fragment beyond
+        // one rectangle per band no matter the order of operations.
+        til::rect_set region{ til::rect{ 0, 0, 100, 20 } };
+        for (til::CoordType y = 1; y < 20; y += 2)
+        {
+            region.subtract(til::rect{ 0, y, 100, y + 1 });
+        }
+
+        VERIFY_ARE_EQUAL(10u, region.size());
+        for (const auto& r : region)
+        {
+            VERIFY_ARE_EQUAL(100, r.width());
+            VERIFY_ARE_EQUAL(1, r.height());
+        }
+    }
+};
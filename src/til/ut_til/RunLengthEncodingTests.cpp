@@ -378,6 +378,97 @@ class RunLengthEncodingTests
         }
     }
 
+    TEST_METHOD(ReplaceSameValue)
+    {
+        // Replacing a range with the value it already carries must be an
+        // identity operation (it takes a no-op fast path internally).
+        rle_vector rle{ rle_encode("1|3 3|2|1 1 1|5 5") };
+
+        rle.replace(1, 3, 3); // exactly one run
+        VERIFY_ARE_EQUAL("1|3 3|2|1 1 1|5 5"sv, rle);
+
+        rle.replace(5, 6, 1); // within a run
+        VERIFY_ARE_EQUAL("1|3 3|2|1 1 1|5 5"sv, rle);
+
+        rle.replace(7, 9, 5); // at the end
+        VERIFY_ARE_EQUAL("1|3 3|2|1 1 1|5 5"sv, rle);
+
+        // A range that only partially matches still has to be replaced.
+        rle.replace(4, 8, 1);
+        VERIFY_ARE_EQUAL("1|3 3|2|1 1 1 1|5"sv, rle);
+    }
+
+    TEST_METHOD(ReplaceBatch)
+    {
+        using change_type = rle_vector::change_type;
+
+        rle_vector rle{ rle_encode("1|3 3|2|1 1 1|5 5") };
+
+        // An empty batch is a no-op.
+        rle.replace(std::span<const change_type>{});
+        VERIFY_ARE_EQUAL("1|3 3|2|1 1 1|5 5"sv, rle);
+
+        // All changes land in a single pass, including ones that split runs,
+        // coalesce with their neighbors, or exceed size() (and get clamped).
+        const std::array changes{
+            change_type{ 0, 2, 3 },
+            change_type{ 4, 6, 2 },
+            change_type{ 8, 100, 1 },
+        };
+        rle.replace(std::span{ changes });
+        VERIFY_ARE_EQUAL("3 3 3|2 2 2|1|5|1"sv, rle);
+        VERIFY_ARE_EQUAL(9u, rle.size());
+
+        // Unsorted or overlapping batches are rejected.
+        const std::array overlapping{
+            change_type{ 0, 3, 7 },
+            change_type{ 2, 5, 8 },
+        };
+        VERIFY_THROWS(rle.replace(std::span{ overlapping }), std::out_of_range);
+    }
+
+    TEST_METHOD(ForEachRun)
+    {
+        rle_vector rle{ rle_encode("1|3 3|2|1 1 1|5 5") };
+
+        rle_container actual;
+        const auto collect = [&](const value_type& value, size_type length) {
+            actual.emplace_back(value, length);
+        };
+
+        // empty ranges
+        rle.for_each_run(2, 2, collect);
+        rle.for_each_run(5, 0, collect);
+        rle.for_each_run(1000, 900, collect);
+        VERIFY_IS_TRUE(actual.empty());
+
+        // full range
+        rle.for_each_run(0, rle.size(), collect);
+        VERIFY_ARE_EQUAL(rle.runs(), actual);
+
+        // within a run -> within a run, with clamped boundary lengths
+        actual.clear();
+        rle.for_each_run(2, 6, collect);
+        const rle_container expected{ { 3, 1 }, { 2, 1 }, { 1, 2 } };
+        VERIFY_ARE_EQUAL(expected, actual);
+    }
+
+    TEST_METHOD(Append)
+    {
+        rle_vector rle;
+
+        rle.append(1, 0); // zero lengths are ignored
+        VERIFY_ARE_EQUAL(""sv, rle);
+
+        rle.append(1, 1);
+        rle.append(3, 2);
+        rle.append(3, 1); // coalesces with the previous run
+        rle.append(5, 2);
+        VERIFY_ARE_EQUAL("1|3 3 3|5 5"sv, rle);
+        VERIFY_ARE_EQUAL(6u, rle.size());
+        VERIFY_ARE_EQUAL(3u, rle.runs().size());
+    }
+
     TEST_METHOD(ReplaceValues)
     {
         struct TestCase
@@ -170,6 +170,13 @@ class SmallVectorTests
         VERIFY_ARE_EQUAL(v0.size(), 10u);
         VERIFY_ARE_EQUAL(v0.back(), 'z');
         VERIFY_IS_LESS_THAN_OR_EQUAL(v0.size(), v0.max_size());
+        v0.resize_for_overwrite(16);
+        VERIFY_ARE_EQUAL(v0.size(), 16u);
+        // The first 10 items survive a growing resize_for_overwrite untouched.
+        VERIFY_ARE_EQUAL(v0[9], 'z');
+        v0.resize_for_overwrite(10);
+        VERIFY_ARE_EQUAL(v0.size(), 10u);
+        VERIFY_ARE_EQUAL(v0.back(), 'z');
 
         container* p_cont = &v0;
         p_cont = p_cont; // to quiet diagnostics
@@ -358,6 +365,36 @@ class SmallVectorTests
         VERIFY_ARE_NOT_EQUAL(v0, v1);
     }
 
+    TEST_METHOD(ResizeAndOverwrite)
+    {
+        til::small_vector<char, 4> v;
+        v.push_back('a');
+        v.push_back('b');
+
+        v.resize_and_overwrite(16, [](char* data, size_t max_size) {
+            VERIFY_ARE_EQUAL(max_size, 16u);
+            // The existing items survive the growth.
+            VERIFY_ARE_EQUAL(data[0], 'a');
+            VERIFY_ARE_EQUAL(data[1], 'b');
+            for (size_t i = 0; i < 8; ++i)
+            {
+                data[i] = static_cast<char>('0' + i);
+            }
+            return 8;
+        });
+        VERIFY_ARE_EQUAL(v.size(), 8u);
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(v.capacity(), 16u);
+        VERIFY_ARE_EQUAL(v.front(), '0');
+        VERIFY_ARE_EQUAL(v.back(), '7');
+
+        // Writing nothing empties the vector without releasing the buffer.
+        v.resize_and_overwrite(4, [](char*, size_t) {
+            return 0;
+        });
+        VERIFY_IS_TRUE(v.empty());
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(v.capacity(), 16u);
+    }
+
     TEST_METHOD(InsertTrivialType)
     {
         til::small_vector<int, 5> actual{ { 0, 1, 2, 4 } };
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "til/ticket_lock.h"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class TicketLockTests
+{
+    BEGIN_TEST_CLASS(TicketLockTests)
+        TEST_CLASS_PROPERTY(L"TestTimeout", L"0:0:10") // 10s timeout
+    END_TEST_CLASS()
+
+    TEST_METHOD(SharedBasic)
+    {
+        til::ticket_lock lock;
+
+        // Consecutive shared acquisitions may be held concurrently.
+        std::shared_lock lock1{ lock };
+        std::shared_lock lock2{ lock };
+        lock1.unlock();
+        lock2.unlock();
+
+        // This is here just to ensure that the prior
+        // .lock_shared() calls properly unlocked the lock.
+        std::unique_lock lock3{ lock };
+    }
+
+    TEST_METHOD(ExclusionUnderContention)
+    {
+        til::ticket_lock lock;
+        auto x = 0;
+        auto y = 0;
+        std::atomic<bool> stop{ false };
+        std::atomic<int> inconsistencies{ 0 };
+
+        std::vector<std::thread> threads;
+        for (auto i = 0; i < 2; ++i)
+        {
+            threads.emplace_back([&]() {
+                for (auto n = 0; n < 50000; ++n)
+                {
+                    std::unique_lock guard{ lock };
+                    ++x;
+                    ++y;
+                }
+            });
+        }
+        for (auto i = 0; i < 2; ++i)
+        {
+            threads.emplace_back([&]() {
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    std::shared_lock guard{ lock };
+                    if (x != y)
+                    {
+                        inconsistencies.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        threads[0].join();
+        threads[1].join();
+        stop.store(true, std::memory_order_relaxed);
+        threads[2].join();
+        threads[3].join();
+
+        VERIFY_ARE_EQUAL(100000, x);
+        VERIFY_ARE_EQUAL(100000, y);
+        VERIFY_ARE_EQUAL(0, inconsistencies.load());
+    }
+
+    TEST_METHOD(WriterDrainsReaders)
+    {
+        til::ticket_lock lock;
+        lock.lock_shared();
+
+        std::atomic<bool> writerDone{ false };
+        std::thread writer([&]() {
+            std::unique_lock guard{ lock };
+            writerDone.store(true);
+        });
+
+        // Give the writer ample time to take its ticket; it must not be
+        // admitted while the shared holder is still active.
+        Sleep(100);
+        VERIFY_IS_FALSE(writerDone.load());
+
+        lock.unlock_shared();
+        writer.join();
+        VERIFY_IS_TRUE(writerDone.load());
+    }
+};
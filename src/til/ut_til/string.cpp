@@ -17,6 +17,11 @@ class StringTests
         const std::wstring_view expected{ L"\u241b[A\u2423\u241b[B\x2421" };
         const auto actual = til::visualize_control_codes(input);
         VERIFY_ARE_EQUAL(expected, actual);
+
+        // Long enough to cover the vectorized main loop and its scalar tail.
+        const std::wstring_view longInput{ L"cmd.exe /c \"echo \u001b[31mred\u001b[m\"\r\n\x7f" };
+        const std::wstring_view longExpected{ L"cmd.exe\u2423/c\u2423\"echo\u2423\u241b[31mred\u241b[m\"\u240d\u240a\u2421" };
+        VERIFY_ARE_EQUAL(longExpected, til::visualize_control_codes(longInput));
     }
 
     TEST_METHOD(starts_with)
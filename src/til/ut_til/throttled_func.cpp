@@ -39,4 +39,71 @@ class ThrottledFuncTests
 
         latch.wait();
     }
+
+    TEST_METHOD(LeadingAndTrailingEdge)
+    {
+        using namespace std::chrono_literals;
+
+        std::atomic<int> count{ 0 };
+        til::latch latch{ 2 };
+
+        til::throttled_func_both<> tf{ 100ms, [&]() {
+                                          count.fetch_add(1, std::memory_order_relaxed);
+                                          latch.count_down();
+                                      } };
+
+        // The first call fires immediately (leading edge), the other two get
+        // coalesced into a single trailing edge invocation.
+        tf();
+        tf();
+        tf();
+
+        latch.wait();
+        VERIFY_ARE_EQUAL(2, count.load(std::memory_order_relaxed));
+
+        const auto stats = tf.stats();
+        VERIFY_ARE_EQUAL(3u, stats.calls);
+        VERIFY_ARE_EQUAL(2u, stats.invocations);
+    }
+
+    TEST_METHOD(Statistics)
+    {
+        using namespace std::chrono_literals;
+
+        til::latch latch{ 1 };
+
+        til::throttled_func_trailing<> tf{ 100ms, [&]() {
+                                              latch.count_down();
+                                          } };
+
+        tf();
+        tf();
+        tf();
+
+        latch.wait();
+
+        const auto stats = tf.stats();
+        VERIFY_ARE_EQUAL(3u, stats.calls);
+        VERIFY_ARE_EQUAL(1u, stats.invocations);
+    }
+
+    TEST_METHOD(AdaptiveDelay)
+    {
+        using namespace std::chrono_literals;
+
+        // The adaptive constructor requires 0 < min_delay <= max_delay.
+        using throttled_func = til::throttled_func_trailing<>;
+        VERIFY_THROWS(throttled_func(0ms, 10ms, [] {}), std::invalid_argument);
+        VERIFY_THROWS(throttled_func(20ms, 10ms, [] {}), std::invalid_argument);
+
+        til::latch latch{ 1 };
+        throttled_func tf{ 1ms, 100ms, [&]() {
+                              latch.count_down();
+                          } };
+
+        tf();
+        latch.wait();
+
+        VERIFY_ARE_EQUAL(1u, tf.stats().invocations);
+    }
 };
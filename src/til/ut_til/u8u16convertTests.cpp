@@ -17,6 +17,7 @@ class Utf8Utf16ConvertTests
     TEST_METHOD(TestU8ToU16Partials);
     TEST_METHOD(TestU16ToU8Partials);
     TEST_METHOD(TestU8ToU16OneByOne);
+    TEST_METHOD(TestU8ToU16AsciiRuns);
 };
 
 void Utf8Utf16ConvertTests::TestU8ToU16()
@@ -191,3 +192,25 @@ void Utf8Utf16ConvertTests::TestU8ToU16OneByOne()
     VERIFY_SUCCEEDED(til::u8u16(u8String1_4, u16Out1, state));
     VERIFY_ARE_EQUAL(u16StringComp1, u16Out1);
 }
+
+void Utf8Utf16ConvertTests::TestU8ToU16AsciiRuns()
+{
+    // Exercise the vectorized ASCII prefix copy: a run longer than one 16-byte
+    // chunk, a non-ASCII code point stopping the scan mid-chunk, more ASCII,
+    // and finally a trailing partial that has to be cached across calls.
+    const std::string u8String1{ "The quick brown fox jumps \xE2\x82\xAC over the lazy dog \xF0\xA4" };
+    const std::string u8String2{ "\xBD\x9C and then some" };
+
+    const std::wstring u16StringComp1{ L"The quick brown fox jumps \x20AC over the lazy dog " };
+    const std::wstring u16StringComp2{ L"\xD853\xDF5C and then some" };
+
+    til::u8state state{};
+
+    std::wstring u16Out1{};
+    VERIFY_SUCCEEDED(til::u8u16(u8String1, u16Out1, state));
+    VERIFY_ARE_EQUAL(u16StringComp1, u16Out1);
+
+    std::wstring u16Out2{};
+    VERIFY_SUCCEEDED(til::u8u16(u8String2, u16Out2, state));
+    VERIFY_ARE_EQUAL(u16StringComp2, u16Out2);
+}
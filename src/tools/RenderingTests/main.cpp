@@ -3,9 +3,14 @@
 #include <Windows.h>
 #include <conio.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <string>
 #include <string_view>
+#include <vector>
 
 // The following list of colors is only used as a debug aid and not part of the final product.
 // They're licensed under:
@@ -120,7 +125,159 @@ static void clear()
     );
 }
 
-int main()
+// --bench: Instead of the interactive test patterns, drive scripted reference
+// scenes through the attached console and record how long each frame's
+// WriteConsoleW takes. The call doesn't return until the host has ingested the
+// text, so the percentiles below are the client-observed per-frame cost of the
+// VT parser, buffer, and renderer wakeup combined. (The host-side breakdown
+// into lock/paint/present stages is available via the renderer's own frame
+// timing instrumentation; this tool can't see across the process boundary.)
+namespace bench
+{
+    struct SceneResult
+    {
+        const wchar_t* name = nullptr;
+        std::vector<LONGLONG> frameUs;
+    };
+
+    static LONGLONG percentile(const std::vector<LONGLONG>& sorted, size_t p)
+    {
+        return sorted[std::min(sorted.size() - 1, (sorted.size() * p) / 100)];
+    }
+
+    // Each scene appends one frame's worth of VT to `frame`. `iteration` varies
+    // the content so that consecutive frames never look identical to the host
+    // and can't be elided as unchanged.
+    static void sceneScroll(std::wstring& frame, const COORD size, const int iteration)
+    {
+        for (SHORT row = 0; row < size.Y; ++row)
+        {
+            frame.append(size.X - 2, static_cast<wchar_t>(L'a' + (row + iteration) % 26));
+            frame.append(L"\r\n");
+        }
+    }
+
+    static void sceneEmojiGrid(std::wstring& frame, const COORD size, const int iteration)
+    {
+        frame.append(L"\x1B[H");
+        for (SHORT row = 0; row < size.Y; ++row)
+        {
+            // Emoji are two columns wide; cycle through a few faces (U+1F600...).
+            for (SHORT col = 0; col < size.X - 2; col += 2)
+            {
+                const auto codepoint = 0x1F600 + (row + col + iteration) % 16;
+                frame.push_back(static_cast<wchar_t>(0xD800 + ((codepoint - 0x10000) >> 10)));
+                frame.push_back(static_cast<wchar_t>(0xDC00 + (codepoint & 0x3FF)));
+            }
+            if (row < size.Y - 1)
+            {
+                frame.append(L"\r\n");
+            }
+        }
+    }
+
+    static void sceneSgrDense(std::wstring& frame, const COORD size, const int iteration)
+    {
+        frame.append(L"\x1B[H");
+        for (SHORT row = 0; row < size.Y; ++row)
+        {
+            for (SHORT col = 0; col < size.X - 4; col += 4)
+            {
+                wchar_t run[16];
+                const auto length = _snwprintf_s(run, _TRUNCATE, L"\x1B[38;5;%dmabcd", (row + col + iteration) % 256);
+                frame.append(run, length);
+            }
+            frame.append(L"\x1B[m");
+            if (row < size.Y - 1)
+            {
+                frame.append(L"\r\n");
+            }
+        }
+    }
+
+    static std::vector<SceneResult> run(const HANDLE outputHandle, const int frames)
+    {
+        CONSOLE_SCREEN_BUFFER_INFO info{};
+        if (!GetConsoleScreenBufferInfo(outputHandle, &info))
+        {
+            return {};
+        }
+
+        const COORD size{
+            static_cast<SHORT>(info.srWindow.Right - info.srWindow.Left + 1),
+            static_cast<SHORT>(info.srWindow.Bottom - info.srWindow.Top + 1),
+        };
+
+        using SceneFn = void (*)(std::wstring&, COORD, int);
+        static constexpr struct
+        {
+            const wchar_t* name;
+            SceneFn fn;
+        } scenes[]{
+            { L"full-screen scroll", &sceneScroll },
+            { L"emoji grid        ", &sceneEmojiGrid },
+            { L"SGR-dense         ", &sceneSgrDense },
+        };
+
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+
+        std::vector<SceneResult> results;
+        std::wstring frame;
+
+        for (const auto& scene : scenes)
+        {
+            auto& result = results.emplace_back();
+            result.name = scene.name;
+            result.frameUs.reserve(frames);
+
+            constexpr int warmup = 8;
+            for (int i = 0; i < frames + warmup; ++i)
+            {
+                frame.clear();
+                scene.fn(frame, size, i);
+
+                LARGE_INTEGER beg, end;
+                QueryPerformanceCounter(&beg);
+                WriteConsoleW(outputHandle, frame.data(), static_cast<DWORD>(frame.size()), nullptr, nullptr);
+                QueryPerformanceCounter(&end);
+
+                if (i >= warmup)
+                {
+                    result.frameUs.push_back(((end.QuadPart - beg.QuadPart) * 1'000'000) / frequency.QuadPart);
+                }
+            }
+
+            std::sort(result.frameUs.begin(), result.frameUs.end());
+            clear();
+        }
+
+        return results;
+    }
+
+    // Called after main has left the alternative screen buffer, so that the
+    // numbers survive on the primary one.
+    static void printSummary(const std::vector<SceneResult>& results, const int frames)
+    {
+        for (const auto& result : results)
+        {
+            printfUTF16(
+                L"%s  p50 %lld.%03lldms, p90 %lld.%03lldms, p99 %lld.%03lldms, max %lld.%03lldms (%d frames)\r\n",
+                result.name,
+                percentile(result.frameUs, 50) / 1000,
+                percentile(result.frameUs, 50) % 1000,
+                percentile(result.frameUs, 90) / 1000,
+                percentile(result.frameUs, 90) % 1000,
+                percentile(result.frameUs, 99) / 1000,
+                percentile(result.frameUs, 99) % 1000,
+                result.frameUs.back() / 1000,
+                result.frameUs.back() % 1000,
+                frames);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
 {
     const auto outputHandle = GetStdHandle(STD_OUTPUT_HANDLE);
     DWORD consoleMode = ENABLE_PROCESSED_OUTPUT | ENABLE_WRAP_AT_EOL_OUTPUT;
@@ -131,6 +288,20 @@ int main()
         SetConsoleMode(outputHandle, consoleMode);
     };
 
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+    {
+        const auto frames = std::max(1, argc > 2 ? atoi(argv[2]) : 100);
+
+        // The scenes run on the alternative screen buffer like the test
+        // patterns do, but the summary goes to the primary one afterwards.
+        printUTF16(L"\x1b[?1049h");
+        const auto results = bench::run(outputHandle, frames);
+        printUTF16(L"\x1b[?1049l");
+
+        bench::printSummary(results, frames);
+        return results.empty() ? 1 : 0;
+    }
+
     printUTF16(
         L"\x1b[?1049h" // enable alternative screen buffer
     );
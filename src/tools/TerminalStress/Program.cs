@@ -1,12 +1,123 @@
 namespace TerminalStress
 {
     using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Runtime.InteropServices;
     using System.Text;
+    using System.Threading;
+    using System.Threading.Tasks;
 
     class Program
     {
+        [DllImport("kernel32.dll", SetLastError = true)]
+        static extern IntPtr GetStdHandle(int nStdHandle);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        static extern bool GetConsoleMode(IntPtr hConsoleHandle, out uint lpMode);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        static extern bool SetConsoleMode(IntPtr hConsoleHandle, uint dwMode);
+
+        const int STD_INPUT_HANDLE = -10;
+        const int STD_OUTPUT_HANDLE = -11;
+        const uint ENABLE_PROCESSED_INPUT = 0x0001;
+        const uint ENABLE_LINE_INPUT = 0x0002;
+        const uint ENABLE_ECHO_INPUT = 0x0004;
+        const uint ENABLE_VIRTUAL_TERMINAL_INPUT = 0x0200;
+        const uint ENABLE_VIRTUAL_TERMINAL_PROCESSING = 0x0004;
+
+        // Measures write-to-response round trips while the console is under
+        // flood. A DSR cursor position request goes out through stdout and its
+        // report comes back on stdin only after the host has ingested
+        // everything written before it, so the sample covers output ingestion,
+        // the input pipe, and everything in between - the path a keypress echo
+        // takes, minus the keyboard. Run several instances in separate panes
+        // for multi-pane numbers.
+        static void LatencyMode(int seconds)
+        {
+            var stdinHandle = GetStdHandle(STD_INPUT_HANDLE);
+            var stdoutHandle = GetStdHandle(STD_OUTPUT_HANDLE);
+
+            GetConsoleMode(stdinHandle, out var inModeOld);
+            GetConsoleMode(stdoutHandle, out var outModeOld);
+            SetConsoleMode(stdinHandle, (inModeOld & ~(ENABLE_PROCESSED_INPUT | ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT)) | ENABLE_VIRTUAL_TERMINAL_INPUT);
+            SetConsoleMode(stdoutHandle, outModeOld | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+
+            var stdout = Console.OpenStandardOutput();
+            var stdin = Console.OpenStandardInput();
+            var request = Encoding.ASCII.GetBytes("\x1b[6n");
+            var samplesUs = new List<long>();
+            var cts = new CancellationTokenSource();
+
+            // Roughly the same chaos the default mode produces, as background load.
+            var flood = Task.Run(() =>
+            {
+                var r = new Random(1);
+                var sb = new StringBuilder();
+                while (!cts.Token.IsCancellationRequested)
+                {
+                    sb.Clear();
+                    for (int i = 0; i < 64; i++)
+                    {
+                        sb.Append("\x1b[").Append(30 + r.Next(8)).Append('m').Append((char)r.Next(0x20, 0x7f));
+                    }
+                    Console.Write(sb.ToString());
+                }
+            });
+
+            var total = Stopwatch.StartNew();
+            var readBuffer = new byte[64];
+            while (total.Elapsed.TotalSeconds < seconds)
+            {
+                var sw = Stopwatch.StartNew();
+                stdout.Write(request, 0, request.Length);
+                stdout.Flush();
+
+                // The report ends in 'R'; anything else on the wire (stray
+                // keypresses) is discarded.
+                bool done = false;
+                while (!done)
+                {
+                    int read = stdin.Read(readBuffer, 0, readBuffer.Length);
+                    if (read <= 0)
+                    {
+                        done = true;
+                    }
+                    for (int i = 0; i < read; i++)
+                    {
+                        if (readBuffer[i] == (byte)'R')
+                        {
+                            done = true;
+                        }
+                    }
+                }
+
+                samplesUs.Add(sw.ElapsedTicks * 1_000_000 / Stopwatch.Frequency);
+                Thread.Sleep(10);
+            }
+
+            cts.Cancel();
+            try { flood.Wait(); } catch { }
+
+            SetConsoleMode(stdinHandle, inModeOld);
+            SetConsoleMode(stdoutHandle, outModeOld);
+            Console.ResetColor();
+            Console.Clear();
+
+            samplesUs.Sort();
+            long P(int p) => samplesUs[Math.Min(samplesUs.Count - 1, samplesUs.Count * p / 100)];
+            Console.WriteLine($"{samplesUs.Count} DSR round trips under flood:");
+            Console.WriteLine($"p50 {P(50) / 1000.0:F3}ms, p90 {P(90) / 1000.0:F3}ms, p99 {P(99) / 1000.0:F3}ms, max {samplesUs[samplesUs.Count - 1] / 1000.0:F3}ms");
+        }
+
         static void Main(string[] args)
         {
+            if (args.Length > 0 && args[0] == "latency")
+            {
+                LatencyMode(args.Length > 1 && int.TryParse(args[1], out var secs) ? secs : 10);
+                return;
+            }
 
             Random r = new Random();
 
@@ -325,6 +325,54 @@ enum class VtMode
     Color
 };
 
+enum class Corpus
+{
+    None,
+    Ascii,
+    Vt,
+    Unicode,
+    Scroll,
+    Attr
+};
+
+static const char* corpus_name(Corpus corpus) noexcept
+{
+    switch (corpus)
+    {
+    case Corpus::Ascii:
+        return "ascii";
+    case Corpus::Vt:
+        return "vt";
+    case Corpus::Unicode:
+        return "unicode";
+    case Corpus::Scroll:
+        return "scroll";
+    case Corpus::Attr:
+        return "attr";
+    default:
+        return "file";
+    }
+}
+
+static void sort_durations(int64_t* values, size_t count) noexcept
+{
+    for (size_t i = 1; i < count; ++i)
+    {
+        const auto v = values[i];
+        auto j = i;
+        for (; j > 0 && values[j - 1] > v; --j)
+        {
+            values[j] = values[j - 1];
+        }
+        values[j] = v;
+    }
+}
+
+static int64_t percentile(const int64_t* sorted, size_t count, size_t p) noexcept
+{
+    return sorted[min(count - 1, (count * p) / 100)];
+}
+
 static HANDLE g_stdout;
 static HANDLE g_stderr;
 static UINT g_console_cp_old;
@@ -408,6 +456,115 @@ static char* allocate(size_t size)
     print_last_error("allocate memory");
 }
 
+static size_t generate_corpus(const Corpus corpus, char* const dst, const size_t size, pcg_engines::oneseq_dxsm_64_32& rng)
+{
+    // Each loop iteration below appends at most this many bytes, so stopping
+    // once we're within the margin keeps us inside the allocation.
+    static constexpr size_t margin = 64;
+    const auto limit = dst + size - margin;
+    auto p = dst;
+    uint32_t column = 0;
+
+    switch (corpus)
+    {
+    case Corpus::Ascii:
+        // Plain words wrapped at 80 columns: the plain-text fast path.
+        while (p < limit)
+        {
+            const auto len = 1 + rng(12);
+            for (uint32_t i = 0; i < len; ++i)
+            {
+                *p++ = static_cast<char>('a' + rng(26));
+            }
+            column += len + 1;
+            if (column >= 80)
+            {
+                p = buffer_append_string(p, "\r\n");
+                column = 0;
+            }
+            else
+            {
+                *p++ = ' ';
+            }
+        }
+        break;
+    case Corpus::Vt:
+        // Cursor addressing with tiny payloads: the VT parser and cursor
+        // movement dominate, not text insertion.
+        while (p < limit)
+        {
+            p = buffer_append_string(p, "\x1b[");
+            p = buffer_append_number(p, static_cast<uint8_t>(1 + rng(24)));
+            *p++ = ';';
+            p = buffer_append_number(p, static_cast<uint8_t>(1 + rng(80)));
+            *p++ = 'H';
+            const auto len = 1 + rng(4);
+            for (uint32_t i = 0; i < len; ++i)
+            {
+                *p++ = static_cast<char>('a' + rng(26));
+            }
+        }
+        break;
+    case Corpus::Unicode:
+    {
+        // A mix of 2-4 byte UTF-8 sequences (Greek, kana, CJK, an emoji) to
+        // keep the UTF-8 decoder and grapheme clustering busy.
+        static constexpr const char* samples[] = { "\xce\xb1", "\xce\xb2", "\xe3\x81\x82", "\xe3\x81\x84", "\xe4\xbd\xa0", "\xe5\xa5\xbd", "\xf0\x9f\x98\x80" };
+        while (p < limit)
+        {
+            p = buffer_append_string(p, samples[rng(static_cast<uint32_t>(ARRAYSIZE(samples)))]);
+            if (++column >= 40)
+            {
+                p = buffer_append_string(p, "\r\n");
+                column = 0;
+            }
+        }
+        break;
+    }
+    case Corpus::Scroll:
+        // Full lines of text: once the viewport fills up, every further line
+        // forces a scroll.
+        while (p < limit)
+        {
+            for (uint32_t i = 0; i < 78; ++i)
+            {
+                *p++ = static_cast<char>('a' + rng(26));
+            }
+            p = buffer_append_string(p, "\r\n");
+        }
+        break;
+    case Corpus::Attr:
+        // A truecolor SGR change every few characters, like printing a file
+        // with per-token syntax highlighting.
+        while (p < limit)
+        {
+            p = buffer_append_string(p, "\x1b[38;2");
+            for (int i = 0; i < 3; i++)
+            {
+                *p++ = ';';
+                p = buffer_append_number(p, static_cast<uint8_t>(rng()));
+            }
+            *p++ = 'm';
+            const auto len = 4 + rng(4);
+            for (uint32_t i = 0; i < len; ++i)
+            {
+                *p++ = static_cast<char>('a' + rng(26));
+            }
+            column += len;
+            if (column >= 80)
+            {
+                p = buffer_append_string(p, "\r\n");
+                column = 0;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    return static_cast<size_t>(p - dst);
+}
+
 static BOOL WINAPI consoleCtrlHandler(DWORD)
 {
     CancelIoEx(g_stdout, nullptr);
@@ -427,8 +584,13 @@ int __stdcall main() noexcept
     uint32_t chunk_size = 128 * 1024;
     uint32_t repeat = 1;
     VtMode vt = VtMode::Off;
+    Corpus corpus = Corpus::None;
+    uint32_t corpus_size = 16 * 1024 * 1024;
     uint64_t seed = 0;
     bool has_seed = false;
+    bool use_write_console = false;
+    bool json_output = false;
+    LONGLONG baseline = 0;
 
     {
         int argc;
@@ -445,6 +607,49 @@ int __stdcall main() noexcept
             {
                 repeat = parse_number_with_suffix(suffix);
             }
+            else if (const auto suffix = split_prefix(argv[i], L"-g"))
+            {
+                if (has_suffix(suffix, L"ascii"))
+                {
+                    corpus = Corpus::Ascii;
+                }
+                else if (has_suffix(suffix, L"vt"))
+                {
+                    corpus = Corpus::Vt;
+                }
+                else if (has_suffix(suffix, L"unicode"))
+                {
+                    corpus = Corpus::Unicode;
+                }
+                else if (has_suffix(suffix, L"scroll"))
+                {
+                    corpus = Corpus::Scroll;
+                }
+                else if (has_suffix(suffix, L"attr"))
+                {
+                    corpus = Corpus::Attr;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            else if (const auto suffix = split_prefix(argv[i], L"-n"))
+            {
+                corpus_size = min<uint32_t>(parse_number_with_suffix(suffix), 1024 * 1024 * 1024);
+            }
+            else if (const auto suffix = split_prefix(argv[i], L"-b"))
+            {
+                baseline = parse_number_with_suffix(suffix);
+            }
+            else if (has_suffix(argv[i], L"-wc"))
+            {
+                use_write_console = true;
+            }
+            else if (has_suffix(argv[i], L"-j"))
+            {
+                json_output = true;
+            }
             else if (const auto suffix = split_prefix(argv[i], L"-v"))
             {
                 vt = VtMode::On;
@@ -461,7 +666,7 @@ int __stdcall main() noexcept
                     break;
                 }
             }
-            else if (has_suffix(argv[i], L"-s"))
+            else if (const auto suffix = split_prefix(argv[i], L"-s"))
             {
                 seed = parse_number_with_suffix(suffix);
                 has_seed = true;
@@ -477,7 +682,7 @@ int __stdcall main() noexcept
         }
     }
 
-    if (!path || !chunk_size || !repeat)
+    if ((!path && corpus == Corpus::None) || !chunk_size || !repeat || !corpus_size)
     {
         eprintf(
             "bc [options] <filename>\r\n"
@@ -487,11 +692,23 @@ int __stdcall main() noexcept
             "  -c{d}{u}  chunk size, defaults to 128Ki\r\n"
             "  -r{d}{u}  repeats, defaults to 1\r\n"
             "  -s{d}     RNG seed\r\n"
+            "  -g{name}  generate a corpus instead of reading a file:\r\n"
+            "            ascii, vt, unicode, scroll, attr\r\n"
+            "  -n{d}{u}  generated corpus size, defaults to 16Mi\r\n"
+            "  -wc       write via WriteConsoleA instead of WriteFile\r\n"
+            "  -j        print the result as JSON\r\n"
+            "  -b{d}{u}  baseline B/s; exit code 2 if throughput drops below\r\n"
             "{d} are base-10 digits\r\n"
             "{u} are suffix units k, Ki, M, Mi, G, Gi\r\n");
     }
 
-    if (!has_seed && vt == VtMode::Color)
+    // The VT-heavy corpora are meaningless with VT processing disabled.
+    if (vt == VtMode::Off && (corpus == Corpus::Vt || corpus == Corpus::Attr))
+    {
+        vt = VtMode::On;
+    }
+
+    if (!has_seed && (vt == VtMode::Color || corpus != Corpus::None))
     {
         const auto cryptbase = LoadLibraryExW(L"cryptbase.dll", nullptr, 0);
         if (!cryptbase)
@@ -511,52 +728,64 @@ int __stdcall main() noexcept
     pcg_engines::oneseq_dxsm_64_32 rng{ seed };
 
     const auto stdout = GetStdHandle(STD_OUTPUT_HANDLE);
-    const auto file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-    if (file == INVALID_HANDLE_VALUE)
-    {
-        print_last_error("open file");
-    }
+
+    acquire_lock_memory_privilege();
 
     size_t file_size = 0;
+    char* file_data = nullptr;
+
+    if (corpus != Corpus::None)
     {
-#ifdef _WIN64
-        LARGE_INTEGER i;
-        if (!GetFileSizeEx(file, &i))
+        file_data = allocate(corpus_size);
+        file_size = generate_corpus(corpus, file_data, corpus_size, rng);
+    }
+    else
+    {
+        const auto file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
         {
             print_last_error("open file");
         }
 
-        file_size = static_cast<size_t>(i.QuadPart);
-
-#else
-        file_size = GetFileSize(file, nullptr);
-        if (file_size == INVALID_FILE_SIZE)
         {
-            print_last_error("open file");
-        }
-#endif
-    }
+#ifdef _WIN64
+            LARGE_INTEGER i;
+            if (!GetFileSizeEx(file, &i))
+            {
+                print_last_error("open file");
+            }
 
-    acquire_lock_memory_privilege();
+            file_size = static_cast<size_t>(i.QuadPart);
 
-    const auto file_data = allocate(file_size);
-    auto stdout_size = file_size;
-    auto stdout_data = file_data;
+#else
+            file_size = GetFileSize(file, nullptr);
+            if (file_size == INVALID_FILE_SIZE)
+            {
+                print_last_error("open file");
+            }
+#endif
+        }
 
-    {
-        auto read_data = file_data;
-        DWORD read = 0;
+        file_data = allocate(file_size);
 
-        for (auto remaining = file_size; remaining > 0; remaining -= read, read_data += read)
         {
-            read = static_cast<DWORD>(min<size_t>(0xffffffff, remaining));
-            if (!ReadFile(file, read_data, read, &read, nullptr))
+            auto read_data = file_data;
+            DWORD read = 0;
+
+            for (auto remaining = file_size; remaining > 0; remaining -= read, read_data += read)
             {
-                print_last_error("read");
+                read = static_cast<DWORD>(min<size_t>(0xffffffff, remaining));
+                if (!ReadFile(file, read_data, read, &read, nullptr))
+                {
+                    print_last_error("read");
+                }
             }
         }
     }
 
+    auto stdout_size = file_size;
+    auto stdout_data = file_data;
+
     switch (vt)
     {
     case VtMode::Italic:
@@ -631,10 +860,13 @@ int __stdcall main() noexcept
         }
     }
 
+    const auto iteration_us = reinterpret_cast<int64_t*>(allocate(repeat * sizeof(int64_t)));
+
     LARGE_INTEGER frequency, beg, end;
     QueryPerformanceFrequency(&frequency);
     QueryPerformanceCounter(&beg);
 
+    auto iteration_beg = beg;
     for (size_t iteration = 0; iteration < repeat; ++iteration)
     {
         auto write_data = stdout_data;
@@ -643,28 +875,71 @@ int __stdcall main() noexcept
         for (auto remaining = stdout_size; remaining != 0; remaining -= written, write_data += written)
         {
             written = static_cast<DWORD>(min<size_t>(remaining, chunk_size));
-            if (!WriteFile(stdout, write_data, written, &written, nullptr))
+            const auto ok = use_write_console ?
+                                WriteConsoleA(stdout, write_data, written, &written, nullptr) :
+                                WriteFile(stdout, write_data, written, &written, nullptr);
+            if (!ok)
             {
                 print_last_error("write");
             }
         }
+
+        LARGE_INTEGER iteration_end;
+        QueryPerformanceCounter(&iteration_end);
+        iteration_us[iteration] = ((iteration_end.QuadPart - iteration_beg.QuadPart) * 1'000'000) / frequency.QuadPart;
+        iteration_beg = iteration_end;
     }
 
-    QueryPerformanceCounter(&end);
+    end = iteration_beg;
 
     const auto elapsed_ticks = end.QuadPart - beg.QuadPart;
     const auto elapsed_us = (elapsed_ticks * 1'000'000) / frequency.QuadPart;
     LONGLONG total_size = static_cast<LONGLONG>(stdout_size) * repeat;
     const auto bytes_per_second = (total_size * frequency.QuadPart) / elapsed_ticks;
 
+    sort_durations(iteration_us, repeat);
+    const auto min_us = iteration_us[0];
+    const auto p50_us = percentile(iteration_us, repeat, 50);
+    const auto p90_us = percentile(iteration_us, repeat, 90);
+    const auto max_us = iteration_us[repeat - 1];
+
+    const UINT exit_code = baseline && bytes_per_second < baseline ? 2 : 0;
+
+    if (json_output)
+    {
+        char json[512];
+        const auto json_length = format(
+            &json[0],
+            sizeof(json),
+            "\r\n{\"corpus\":\"%s\",\"api\":\"%s\",\"bytes\":%lld,\"iterations\":%lu,\"total_us\":%lld,\"bps\":%lld,\"min_us\":%lld,\"p50_us\":%lld,\"p90_us\":%lld,\"max_us\":%lld}\r\n",
+            corpus_name(corpus),
+            use_write_console ? "writeconsole" : "writefile",
+            total_size,
+            static_cast<unsigned long>(repeat),
+            elapsed_us,
+            bytes_per_second,
+            min_us,
+            p50_us,
+            p90_us,
+            max_us);
+
+        if (json_length <= 0)
+        {
+            clean_exit(1);
+        }
+
+        WriteFile(g_stderr, &json[0], static_cast<DWORD>(json_length), nullptr, nullptr);
+        clean_exit(exit_code);
+    }
+
     const auto written = format_size(total_size);
     const auto duration = format_duration(elapsed_us);
     const auto throughput = format_size(bytes_per_second);
 
-    char status[128];
-    const auto status_length = format(
+    char status[256];
+    auto status_length = format(
         &status[0],
-        1024,
+        sizeof(status),
         FORMAT_RESULT_FMT "B, " FORMAT_RESULT_FMT "s, " FORMAT_RESULT_FMT "B/s",
         FORMAT_RESULT_ARGS(written),
         FORMAT_RESULT_ARGS(duration),
@@ -675,11 +950,34 @@ int __stdcall main() noexcept
         clean_exit(1);
     }
 
-    char buffer[256];
+    // The dashed rule above the summary matches the width of the first line.
+    const auto rule_length = status_length;
+
+    if (repeat > 1)
+    {
+        const auto mn = format_duration(min_us);
+        const auto md = format_duration(p50_us);
+        const auto hi = format_duration(p90_us);
+        const auto mx = format_duration(max_us);
+        const auto extra = format(
+            &status[status_length],
+            static_cast<int>(sizeof(status)) - status_length,
+            "\r\nmin " FORMAT_RESULT_FMT "s, p50 " FORMAT_RESULT_FMT "s, p90 " FORMAT_RESULT_FMT "s, max " FORMAT_RESULT_FMT "s",
+            FORMAT_RESULT_ARGS(mn),
+            FORMAT_RESULT_ARGS(md),
+            FORMAT_RESULT_ARGS(hi),
+            FORMAT_RESULT_ARGS(mx));
+        if (extra > 0)
+        {
+            status_length += extra;
+        }
+    }
+
+    char buffer[640];
     char* buffer_end = &buffer[0];
 
     buffer_end = buffer_append_string(buffer_end, "\r\n");
-    for (int i = 0; i < status_length; ++i)
+    for (int i = 0; i < rule_length; ++i)
     {
         *buffer_end++ = '-';
     }
@@ -688,5 +986,5 @@ int __stdcall main() noexcept
     buffer_end = buffer_append_string(buffer_end, "\r\n");
 
     WriteFile(g_stderr, &buffer[0], static_cast<DWORD>(buffer_end - &buffer[0]), nullptr, nullptr);
-    clean_exit(0);
+    clean_exit(exit_code);
 }
@@ -0,0 +1,306 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "LibraryIncludes.h"
+
+#include <windows.h>
+
+#include <til/hash.h>
+#include <til/rle.h>
+#include <til/small_vector.h>
+
+#include "../../buffer/out/textBuffer.hpp"
+#include "../../renderer/inc/DummyRenderer.hpp"
+
+// microbench times the small primitives the terminal's hot paths are built out
+// of - the til containers and the text buffer - in isolation. It complements
+// vtbench (parser throughput) and benchcat (end-to-end throughput); use it to
+// gate changes to the primitives themselves.
+// Usage:
+//   microbench [--json] [filter]
+// Each benchmark is calibrated until a single sample runs for at least ~50ms
+// and the fastest of 5 samples is reported as ns/op, which makes the numbers
+// stable enough to compare across runs. --json switches the report to a
+// machine-readable format for trend tracking. An optional filter argument
+// runs only the benchmarks whose name contains it.
+
+namespace
+{
+    // Writing each benchmark's checksum into a volatile keeps the computations
+    // that produced it alive. (MSVC has no equivalent of Google Benchmark's
+    // DoNotOptimize() inline-asm trick.)
+    volatile uint64_t g_sink = 0;
+
+    struct Benchmark
+    {
+        const wchar_t* name;
+        uint64_t (*fn)(uint64_t iterations);
+    };
+
+    struct Measurement
+    {
+        double nsPerOp = 0;
+        uint64_t iterations = 0;
+    };
+
+    // The glyph cache case: one pointer-sized key per call.
+    uint64_t hashInt(uint64_t iterations)
+    {
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            checksum += til::hash(i);
+        }
+        return checksum;
+    }
+
+    // The string cases: a short run of text and a whole 2048-column row,
+    // which is what the renderer hashes for its row cache.
+    template<size_t Length>
+    uint64_t hashString(uint64_t iterations)
+    {
+        std::wstring str(Length, L'x');
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            // Perturbing the input prevents the (inlined) hash from being
+            // hoisted out of the loop. The same trick recurs below.
+            str[0] = static_cast<wchar_t>(L'a' + (i & 15));
+            checksum += til::hash(str.data(), str.size() * sizeof(wchar_t));
+        }
+        return checksum;
+    }
+
+    // Filling the inline capacity, the intended use of a small_vector.
+    uint64_t smallVectorInline(uint64_t iterations)
+    {
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            til::small_vector<uint32_t, 16> vec;
+            for (uint32_t j = 0; j < 16; ++j)
+            {
+                vec.push_back(j + static_cast<uint32_t>(i));
+            }
+            checksum += vec.back();
+        }
+        return checksum;
+    }
+
+    // Overflowing the inline capacity, which measures the growth path
+    // including its allocations.
+    uint64_t smallVectorSpill(uint64_t iterations)
+    {
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            til::small_vector<uint32_t, 16> vec;
+            for (uint32_t j = 0; j < 256; ++j)
+            {
+                vec.push_back(j + static_cast<uint32_t>(i));
+            }
+            checksum += vec.back();
+        }
+        return checksum;
+    }
+
+    // Splicing a short run into a row's worth of color runs, the way
+    // ROW::ReplaceAttributes does when output is colored word by word.
+    uint64_t rleReplace(uint64_t iterations)
+    {
+        til::small_rle<uint16_t, uint16_t, 3> colors{ 240, 7 };
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            const auto beg = static_cast<uint16_t>(i % 200);
+            colors.replace(beg, beg + 17, static_cast<uint16_t>(i & 0xff));
+            checksum += colors.runs().size();
+        }
+        return checksum;
+    }
+
+    // A render pass worth of dirty tracking: mark a handful of rectangles
+    // in a 120x30 bitmap and walk the coalesced runs.
+    uint64_t bitmapSetRuns(uint64_t iterations)
+    {
+        til::bitmap dirty{ til::size{ 120, 30 } };
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            dirty.reset_all();
+            const auto x = static_cast<til::CoordType>(i % 100);
+            const auto y = static_cast<til::CoordType>(i % 25);
+            dirty.set(til::rect{ x, y, x + 17, y + 3 });
+            dirty.set(til::point{ static_cast<til::CoordType>(i % 120), 29 });
+            checksum += dirty.runs().size();
+        }
+        return checksum;
+    }
+
+    // A full row of ASCII into a scratch row, the innermost
+    // write primitive below all output processing.
+    uint64_t rowReplaceText(uint64_t iterations)
+    {
+        DummyRenderer renderer;
+        TextBuffer buffer{ til::size{ 120, 30 }, TextAttribute{ 0x7 }, 0, false, renderer };
+        auto& row = buffer.GetScratchpadRow();
+        std::wstring text(120, L'x');
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            text[0] = static_cast<wchar_t>(L'a' + (i & 15));
+            RowWriteState state{ .text = text };
+            row.ReplaceText(state);
+            checksum += static_cast<uint64_t>(state.columnEnd);
+        }
+        return checksum;
+    }
+
+    // One full attributed row per iteration through TextBuffer::Write,
+    // which adds attribute runs and dirty tracking on top of ReplaceText.
+    uint64_t textBufferWrite(uint64_t iterations)
+    {
+        DummyRenderer renderer;
+        TextBuffer buffer{ til::size{ 120, 30 }, TextAttribute{ 0x7 }, 0, false, renderer };
+        const TextAttribute attr{ 0x4e };
+        std::wstring text(120, L'x');
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            text[0] = static_cast<wchar_t>(L'a' + (i & 15));
+            RowWriteState state{ .text = text };
+            buffer.Write(static_cast<til::CoordType>(i % 30), attr, state);
+            checksum += static_cast<uint64_t>(state.columnEndDirty);
+        }
+        return checksum;
+    }
+
+    // The newline-at-the-bottom hot path: recycle the topmost row.
+    uint64_t textBufferScroll(uint64_t iterations)
+    {
+        DummyRenderer renderer;
+        TextBuffer buffer{ til::size{ 120, 30 }, TextAttribute{ 0x7 }, 0, false, renderer };
+        std::wstring text(120, L'x');
+        for (til::CoordType row = 0; row < 30; ++row)
+        {
+            RowWriteState state{ .text = text };
+            buffer.Write(row, TextAttribute{ 0x7 }, state);
+        }
+        uint64_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            buffer.IncrementCircularBuffer();
+            checksum += static_cast<uint64_t>(buffer.GetFirstRowIndex());
+        }
+        return checksum;
+    }
+
+    static constexpr Benchmark benchmarks[] = {
+        { L"til.hash.int", hashInt },
+        { L"til.hash.string32", hashString<32> },
+        { L"til.hash.string2048", hashString<2048> },
+        { L"til.small_vector.inline16", smallVectorInline },
+        { L"til.small_vector.spill256", smallVectorSpill },
+        { L"til.rle.replace", rleReplace },
+        { L"til.bitmap.set_runs", bitmapSetRuns },
+        { L"row.replace_text", rowReplaceText },
+        { L"textbuffer.write_row", textBufferWrite },
+        { L"textbuffer.scroll", textBufferScroll },
+    };
+
+    Measurement measure(const Benchmark& bench)
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        const auto qpcToSeconds = 1.0 / static_cast<double>(frequency.QuadPart);
+
+        const auto sample = [&](uint64_t iterations) {
+            LARGE_INTEGER beg, end;
+            QueryPerformanceCounter(&beg);
+            g_sink = g_sink + bench.fn(iterations);
+            QueryPerformanceCounter(&end);
+            return static_cast<double>(end.QuadPart - beg.QuadPart) * qpcToSeconds;
+        };
+
+        // Calibrate until a single sample runs for at least ~50ms, which
+        // drowns out both the timer resolution and the fixture setup.
+        uint64_t iterations = 1;
+        auto elapsed = sample(iterations);
+        while (elapsed < 0.05)
+        {
+            iterations *= 2;
+            elapsed = sample(iterations);
+        }
+
+        // The fastest sample has the least scheduling noise in it.
+        for (int i = 0; i < 4; ++i)
+        {
+            elapsed = std::min(elapsed, sample(iterations));
+        }
+
+        return { elapsed / static_cast<double>(iterations) * 1e9, iterations };
+    }
+}
+
+int __cdecl wmain(int argc, wchar_t* argv[])
+try
+{
+    auto json = false;
+    std::wstring_view filter;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::wstring_view arg{ argv[i] };
+        if (arg == L"--json")
+        {
+            json = true;
+        }
+        else
+        {
+            filter = arg;
+        }
+    }
+
+    if (json)
+    {
+        wprintf(L"{\n  \"benchmarks\": [\n");
+    }
+
+    auto first = true;
+    for (const auto& bench : benchmarks)
+    {
+        if (!filter.empty() && std::wstring_view{ bench.name }.find(filter) == std::wstring_view::npos)
+        {
+            continue;
+        }
+
+        const auto result = measure(bench);
+
+        if (json)
+        {
+            if (!first)
+            {
+                wprintf(L",\n");
+            }
+            wprintf(L"    { \"name\": \"%s\", \"ns_per_op\": %.2f, \"iterations\": %llu }", bench.name, result.nsPerOp, result.iterations);
+        }
+        else
+        {
+            wprintf(L"%-28s %10.2f ns/op  %14.0f op/s\n", bench.name, result.nsPerOp, 1e9 / result.nsPerOp);
+        }
+
+        first = false;
+    }
+
+    if (json)
+    {
+        wprintf(L"\n  ]\n}\n");
+    }
+
+    return 0;
+}
+catch (...)
+{
+    LOG_CAUGHT_EXCEPTION();
+    return 1;
+}
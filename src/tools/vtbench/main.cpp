@@ -0,0 +1,242 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "LibraryIncludes.h"
+
+#include <windows.h>
+
+#include "../../terminal/parser/OutputStateMachineEngine.hpp"
+#include "../../terminal/parser/stateMachine.hpp"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+// vtbench replays synthetic (or recorded) VT streams through StateMachine +
+// OutputStateMachineEngine with a no-op dispatcher. It measures nothing but the
+// parser itself, which makes it suitable for gating parser changes on throughput.
+// Usage:
+//   vtbench [-r<n>] [file...]
+// Without file arguments it runs the 4 built-in corpora (plain text, SGR-dense,
+// cursor-movement-heavy, OSC-heavy). Each file argument is replayed as its own
+// category (read as UTF-8).
+
+namespace
+{
+    // Print/PrintString are the only members a concrete dispatcher must implement.
+    // Everything else inherits the no-op defaults from TermDispatch, so all
+    // dispatched sequences cost exactly one virtual call and nothing more.
+    class NullDispatch final : public TermDispatch
+    {
+    public:
+        void Print(const wchar_t /*wchPrintable*/) override {}
+        void PrintString(const std::wstring_view /*string*/) override {}
+    };
+
+    struct Corpus
+    {
+        std::wstring name;
+        std::wstring text;
+        size_t sequences = 0;
+    };
+
+    // Deterministic and fast. We don't need high quality randomness,
+    // just plausible variation in parameter values and run lengths.
+    uint32_t nextRandom(uint32_t& state) noexcept
+    {
+        state = state * 747796405u + 2891336453u;
+        const auto word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        return (word >> 22u) ^ word;
+    }
+
+    void appendNumber(std::wstring& out, uint32_t value)
+    {
+        wchar_t buffer[10];
+        auto it = std::end(buffer);
+        do
+        {
+            *--it = L'0' + value % 10;
+            value /= 10;
+        } while (value);
+        out.append(it, std::end(buffer));
+    }
+
+    constexpr std::wstring_view words[]{
+        L"lorem", L"ipsum", L"dolor", L"sit", L"amet", L"consectetur",
+        L"adipiscing", L"elit", L"sed", L"do", L"eiusmod", L"tempor"
+    };
+
+    // ~1MiB of plain ASCII lines. This exercises the vectorized
+    // "actionable character" scan and the print batching.
+    Corpus makePlainText()
+    {
+        Corpus corpus{ .name = L"plain text" };
+        uint32_t rng = 0x243f6a88;
+        while (corpus.text.size() < 1024 * 1024)
+        {
+            size_t column = 0;
+            while (column < 80)
+            {
+                const auto& word = words[nextRandom(rng) % std::size(words)];
+                corpus.text.append(word);
+                corpus.text.push_back(L' ');
+                column += word.size() + 1;
+            }
+            corpus.text.append(L"\r\n");
+            corpus.sequences += 2; // CR + LF are dispatched as C0 executes.
+        }
+        return corpus;
+    }
+
+    // Every word gets its own RGB color, the way colorizing tools like
+    // ls or ripgrep emit their output.
+    Corpus makeSgrDense()
+    {
+        Corpus corpus{ .name = L"SGR-dense" };
+        uint32_t rng = 0x85a308d3;
+        while (corpus.text.size() < 1024 * 1024)
+        {
+            corpus.text.append(L"\x1b[38;2");
+            for (int i = 0; i < 3; ++i)
+            {
+                corpus.text.push_back(L';');
+                appendNumber(corpus.text, nextRandom(rng) % 256);
+            }
+            corpus.text.push_back(L'm');
+            corpus.text.append(words[nextRandom(rng) % std::size(words)]);
+            corpus.text.append(L"\x1b[0m ");
+            corpus.sequences += 2;
+        }
+        return corpus;
+    }
+
+    // Full-screen applications like vim or top repaint by
+    // moving the cursor around and clearing line remainders.
+    Corpus makeCursorHeavy()
+    {
+        Corpus corpus{ .name = L"cursor-heavy" };
+        uint32_t rng = 0x13198a2e;
+        while (corpus.text.size() < 1024 * 1024)
+        {
+            corpus.text.append(L"\x1b[");
+            appendNumber(corpus.text, 1 + nextRandom(rng) % 120);
+            corpus.text.push_back(L';');
+            appendNumber(corpus.text, 1 + nextRandom(rng) % 400);
+            corpus.text.push_back(L'H');
+            corpus.text.append(words[nextRandom(rng) % std::size(words)]);
+            corpus.text.append(L"\x1b[K");
+            corpus.sequences += 2;
+        }
+        return corpus;
+    }
+
+    // Window titles and hyperlinks, which stress the OSC string collection path.
+    Corpus makeOscHeavy()
+    {
+        Corpus corpus{ .name = L"OSC-heavy" };
+        uint32_t rng = 0x03707344;
+        while (corpus.text.size() < 1024 * 1024)
+        {
+            corpus.text.append(L"\x1b]0;");
+            for (int i = 0; i < 6; ++i)
+            {
+                corpus.text.append(words[nextRandom(rng) % std::size(words)]);
+                corpus.text.push_back(L' ');
+            }
+            corpus.text.push_back(L'\a');
+            corpus.text.append(L"\x1b]8;;https://example.com/");
+            corpus.text.append(words[nextRandom(rng) % std::size(words)]);
+            corpus.text.append(L"\x1b\\link\x1b]8;;\x1b\\ ");
+            corpus.sequences += 3;
+        }
+        return corpus;
+    }
+
+    Corpus loadFile(const wchar_t* path)
+    {
+        Corpus corpus{ .name = path };
+
+        const wil::unique_hfile file{ CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        LARGE_INTEGER size{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file.get(), &size));
+
+        std::string raw(gsl::narrow<size_t>(size.QuadPart), '\0');
+        DWORD read = 0;
+        THROW_IF_WIN32_BOOL_FALSE(ReadFile(file.get(), raw.data(), gsl::narrow<DWORD>(raw.size()), &read, nullptr));
+        raw.resize(read);
+
+        corpus.text = til::u8u16(raw);
+        return corpus;
+    }
+
+    void runBenchmark(const Corpus& corpus, const uint32_t repeat)
+    {
+        StateMachine machine{ std::make_unique<OutputStateMachineEngine>(std::make_unique<NullDispatch>()) };
+
+        LARGE_INTEGER frequency, beg, end;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&beg);
+
+        for (uint32_t i = 0; i < repeat; ++i)
+        {
+            machine.ProcessString(corpus.text);
+        }
+
+        QueryPerformanceCounter(&end);
+
+        const auto elapsed = static_cast<double>(end.QuadPart - beg.QuadPart) / static_cast<double>(frequency.QuadPart);
+        const auto bytes = static_cast<double>(corpus.text.size()) * sizeof(wchar_t) * repeat;
+        const auto sequences = static_cast<double>(corpus.sequences) * repeat;
+
+        wprintf(L"%-16s %8.1f MB/s", corpus.name.c_str(), bytes / elapsed / 1e6);
+        if (corpus.sequences)
+        {
+            wprintf(L"  %10.0f seq/s", sequences / elapsed);
+        }
+        wprintf(L"\n");
+    }
+}
+
+int __cdecl wmain(int argc, wchar_t* argv[])
+try
+{
+    uint32_t repeat = 64;
+    std::vector<Corpus> corpora;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (argv[i][0] == L'-' && argv[i][1] == L'r')
+        {
+            repeat = std::max(1u, static_cast<uint32_t>(wcstoul(&argv[i][2], nullptr, 10)));
+        }
+        else
+        {
+            corpora.push_back(loadFile(argv[i]));
+        }
+    }
+
+    if (corpora.empty())
+    {
+        corpora.push_back(makePlainText());
+        corpora.push_back(makeSgrDense());
+        corpora.push_back(makeCursorHeavy());
+        corpora.push_back(makeOscHeavy());
+    }
+
+    for (const auto& corpus : corpora)
+    {
+        // A warmup pass takes first-touch page faults and branch
+        // predictor training out of the measurement.
+        StateMachine warmup{ std::make_unique<OutputStateMachineEngine>(std::make_unique<NullDispatch>()) };
+        warmup.ProcessString(corpus.text);
+
+        runBenchmark(corpus, repeat);
+    }
+
+    return 0;
+}
+catch (const wil::ResultException& e)
+{
+    fwprintf(stderr, L"failed with 0x%08x\n", e.GetErrorCode());
+    return 1;
+}
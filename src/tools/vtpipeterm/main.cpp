@@ -58,6 +58,14 @@ void toPrintableBuffer(char c, char* printBuffer, int* printCch);
 std::string csi(string seq);
 void PrintInputToDebug(std::string& rawInput);
 void PrintOutputToDebug(std::string& rawOutput);
+
+// Defined in VtConsole.cpp
+HRESULT CreatePseudoConsoleAndHandles(COORD size,
+                                      _In_ DWORD dwFlags,
+                                      _Out_ HANDLE* phInput,
+                                      _Out_ HANDLE* phOutput,
+                                      _Out_ HPCON* phPC);
+HRESULT AttachPseudoConsole(HPCON hPC, LPPROC_THREAD_ATTRIBUTE_LIST lpAttributeList);
 ////////////////////////////////////////////////////////////////////////////////
 
 void ReadCallback(BYTE* buffer, DWORD dwRead)
@@ -505,6 +513,171 @@ void CreateIOThreads()
     hInputThread;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Bench mode: pump a recorded byte stream through a fresh ConPTY at max rate
+// and measure what comes out the other side. The stream has to originate from
+// a client process attached to the pty - writing it to the pty's input pipe
+// would make it keyboard input - so we respawn ourselves as a --bench-client
+// that plays the file to its stdout while the parent drains and counts the
+// re-rendered VT on the out pipe. That covers the whole double-parse pipeline:
+// client write, host ingestion and parse, buffer write, VT re-render, pipe out.
+// The host-internal stage split isn't observable from out here; the renderer's
+// frame timing instrumentation covers that side.
+
+struct BenchDrainState
+{
+    HANDLE outPipe;
+    LONGLONG bytesOut;
+    LARGE_INTEGER firstRead;
+    LARGE_INTEGER lastRead;
+};
+
+DWORD WINAPI BenchDrainThread(LPVOID lpParameter)
+{
+    BenchDrainState* state = (BenchDrainState*)lpParameter;
+    static BYTE buffer[64 * 1024];
+    DWORD dwRead = 0;
+
+    // The pipe breaks once the pseudoconsole is closed after the client exits.
+    while (ReadFile(state->outPipe, buffer, ARRAYSIZE(buffer), &dwRead, nullptr))
+    {
+        if (state->firstRead.QuadPart == 0)
+        {
+            QueryPerformanceCounter(&state->firstRead);
+        }
+        QueryPerformanceCounter(&state->lastRead);
+        state->bytesOut += dwRead;
+    }
+    return 0;
+}
+
+int RunBenchClient(const wchar_t* path, const int repeat)
+{
+    HANDLE hFile = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return GetLastError();
+    }
+
+    LARGE_INTEGER fileSize = { 0 };
+    GetFileSizeEx(hFile, &fileSize);
+
+    std::vector<char> data((size_t)fileSize.QuadPart);
+    DWORD dwRead = 0;
+    if (!ReadFile(hFile, data.data(), (DWORD)data.size(), &dwRead, nullptr))
+    {
+        return GetLastError();
+    }
+    CloseHandle(hFile);
+
+    // Our stdout is the conpty's client-side console handle; chunked WriteFile
+    // here is exactly how a real client's output enters the host.
+    HANDLE hStdOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    const DWORD chunk = 128 * 1024;
+    for (int i = 0; i < repeat; ++i)
+    {
+        DWORD written = 0;
+        for (DWORD offset = 0; offset < dwRead; offset += written)
+        {
+            const DWORD toWrite = min(chunk, dwRead - offset);
+            if (!WriteFile(hStdOut, data.data() + offset, toWrite, &written, nullptr))
+            {
+                return GetLastError();
+            }
+        }
+    }
+    return 0;
+}
+
+int RunBench(const wchar_t* path, const int repeat)
+{
+    HANDLE hFile = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        printf("Failed to open %ls\n", path);
+        return 1;
+    }
+    LARGE_INTEGER fileSize = { 0 };
+    GetFileSizeEx(hFile, &fileSize);
+    CloseHandle(hFile);
+
+    HANDLE inPipe = INVALID_HANDLE_VALUE;
+    HANDLE outPipe = INVALID_HANDLE_VALUE;
+    HPCON hPC = nullptr;
+    if (FAILED(CreatePseudoConsoleAndHandles({ 120, 30 }, 0, &inPipe, &outPipe, &hPC)))
+    {
+        printf("Failed to create pseudoconsole\n");
+        return 1;
+    }
+
+    // Respawn ourselves as the client attached to the pty.
+    wchar_t exePath[MAX_PATH];
+    GetModuleFileNameW(nullptr, exePath, MAX_PATH);
+    std::wstringstream ss;
+    ss << L"\"" << exePath << L"\" --bench-client \"" << path << L"\" " << repeat;
+    std::wstring cmdline = ss.str();
+
+    STARTUPINFOEX siEx = { 0 };
+    siEx.StartupInfo.cb = sizeof(STARTUPINFOEX);
+    size_t size = 0;
+    InitializeProcThreadAttributeList(nullptr, 1, 0, (PSIZE_T)&size);
+    std::vector<BYTE> attrList(size);
+    siEx.lpAttributeList = reinterpret_cast<PPROC_THREAD_ATTRIBUTE_LIST>(attrList.data());
+    if (!InitializeProcThreadAttributeList(siEx.lpAttributeList, 1, 0, (PSIZE_T)&size) ||
+        FAILED(AttachPseudoConsole(hPC, siEx.lpAttributeList)))
+    {
+        printf("Failed to prepare the client attribute list\n");
+        return 1;
+    }
+
+    BenchDrainState state = { outPipe, 0, { 0 }, { 0 } };
+    HANDLE hDrainThread = CreateThread(nullptr, 0, BenchDrainThread, &state, 0, nullptr);
+
+    LARGE_INTEGER frequency, spawnTime, exitTime;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&spawnTime);
+
+    PROCESS_INFORMATION piClient = { 0 };
+    if (!CreateProcessW(nullptr, &cmdline[0], nullptr, nullptr, true, EXTENDED_STARTUPINFO_PRESENT, nullptr, nullptr, &siEx.StartupInfo, &piClient))
+    {
+        printf("Failed to launch the bench client\n");
+        return 1;
+    }
+    DeleteProcThreadAttributeList(siEx.lpAttributeList);
+
+    WaitForSingleObject(piClient.hProcess, INFINITE);
+    QueryPerformanceCounter(&exitTime);
+
+    // Closing the pseudoconsole flushes the remaining output and breaks the
+    // out pipe, which ends the drain thread.
+    ClosePseudoConsole(hPC);
+    WaitForSingleObject(hDrainThread, 10 * 1000);
+
+    const LONGLONG bytesIn = fileSize.QuadPart * repeat;
+    // The client's last WriteFile completes when the host has ingested it; the
+    // drain stamps cover the re-rendered stream leaving the host.
+    const LONGLONG ingestUs = ((exitTime.QuadPart - spawnTime.QuadPart) * 1'000'000) / frequency.QuadPart;
+    const LONGLONG renderUs = state.lastRead.QuadPart > state.firstRead.QuadPart ?
+                                  ((state.lastRead.QuadPart - state.firstRead.QuadPart) * 1'000'000) / frequency.QuadPart :
+                                  0;
+
+    printf("conpty bench: %lld bytes in (%d x %lld), %lld bytes out (%.2fx amplification)\n",
+           bytesIn,
+           repeat,
+           fileSize.QuadPart,
+           state.bytesOut,
+           bytesIn > 0 ? (double)state.bytesOut / (double)bytesIn : 0.0);
+    printf("  ingest: %lld.%03lld s, %.1f MB/s (client write -> host parse -> buffer)\n",
+           ingestUs / 1'000'000,
+           (ingestUs % 1'000'000) / 1000,
+           ingestUs > 0 ? (double)bytesIn / (double)ingestUs : 0.0);
+    printf("  render: %lld.%03lld s, %.1f MB/s out (VT re-render -> pipe)\n",
+           renderUs / 1'000'000,
+           (renderUs % 1'000'000) / 1000,
+           renderUs > 0 ? (double)state.bytesOut / (double)renderUs : 0.0);
+    return 0;
+}
+
 BOOL WINAPI CtrlHandler(DWORD fdwCtrlType)
 {
     switch (fdwCtrlType)
@@ -538,6 +711,15 @@ int __cdecl wmain(int argc, WCHAR* argv[])
         for (int i = 0; i < argc; ++i)
         {
             std::wstring arg = argv[i];
+            if (arg == std::wstring(L"--bench") && i + 1 < argc)
+            {
+                const int repeat = i + 2 < argc ? _wtoi(argv[i + 2]) : 1;
+                return RunBench(argv[i + 1], repeat > 0 ? repeat : 1);
+            }
+            if (arg == std::wstring(L"--bench-client") && i + 2 < argc)
+            {
+                return RunBenchClient(argv[i + 1], _wtoi(argv[i + 2]));
+            }
             if (arg == std::wstring(L"--headless"))
             {
                 g_headless = true;
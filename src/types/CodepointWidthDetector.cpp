@@ -323,6 +323,77 @@ namespace
         UnicodeRange{ 0xf0000, 0xffffd, 1 },
         UnicodeRange{ 0x100000, 0x10fffd, 1 },
     };
+
+    enum class WidthClass : uint8_t
+    {
+        Narrow = 0,
+        Wide = 1,
+        Ambiguous = 2,
+    };
+
+    // Virtually all text we ever measure lives in the BMP, and a binary search over
+    // ~300 ranges per codepoint adds up during large writes. This condenses the BMP
+    // portion of s_wideAndAmbiguousTable into a two-level direct lookup at compile time:
+    // the high byte of a codepoint selects a block via `index` and the low byte selects
+    // a 2-bit WidthClass within that block. Identical blocks are deduplicated, which
+    // shrinks the whole thing to a few KB (29 distinct blocks at the time of writing).
+    struct BmpWidthTable
+    {
+        std::array<uint8_t, 256> index;
+        std::array<std::array<uint8_t, 64>, 32> blocks;
+        size_t blockCount;
+    };
+
+    constexpr BmpWidthTable buildBmpWidthTable() noexcept
+    {
+        std::array<std::array<uint8_t, 64>, 256> packed{};
+
+        for (const auto& range : s_wideAndAmbiguousTable)
+        {
+            if (range.lowerBound > 0xffff)
+            {
+                break; // the table is sorted and the rest is astral planes
+            }
+
+            const auto cls = range.isAmbiguous ? WidthClass::Ambiguous : WidthClass::Wide;
+            const auto last = std::min<char32_t>(range.upperBound, 0xffff);
+            for (auto cp = range.lowerBound; cp <= last; ++cp)
+            {
+                packed[cp >> 8][(cp & 0xff) >> 2] |= static_cast<uint8_t>(static_cast<uint8_t>(cls) << ((cp & 3) * 2));
+            }
+        }
+
+        BmpWidthTable table{};
+        for (size_t page = 0; page < 256; ++page)
+        {
+            size_t i = 0;
+            while (i < table.blockCount && table.blocks[i] != packed[page])
+            {
+                ++i;
+            }
+            if (i == table.blockCount)
+            {
+                table.blocks[table.blockCount++] = packed[page];
+            }
+            table.index[page] = static_cast<uint8_t>(i);
+        }
+        return table;
+    }
+
+    constexpr auto s_bmpWidthTable = buildBmpWidthTable();
+
+    constexpr WidthClass lookupBmpWidthClass(const char32_t codepoint) noexcept
+    {
+        const auto& block = s_bmpWidthTable.blocks[s_bmpWidthTable.index[codepoint >> 8]];
+        return static_cast<WidthClass>((block[(codepoint & 0xff) >> 2] >> ((codepoint & 3) * 2)) & 3);
+    }
+
+    // Spot checks against the range table above.
+    static_assert(lookupBmpWidthClass(L'a') == WidthClass::Narrow);
+    static_assert(lookupBmpWidthClass(0xa1) == WidthClass::Ambiguous);
+    static_assert(lookupBmpWidthClass(0x1100) == WidthClass::Wide);
+    static_assert(lookupBmpWidthClass(0x4e00) == WidthClass::Wide);
+    static_assert(lookupBmpWidthClass(0xffe8) == WidthClass::Narrow);
 }
 
 // Routine Description:
@@ -377,20 +448,31 @@ bool CodepointWidthDetector::IsWide(const std::wstring_view& glyph) noexcept
 // GetWidth's slow-path for non-ASCII characters. Returns the number of columns the codepoint takes up in the terminal.
 uint8_t CodepointWidthDetector::_lookupGlyphWidth(const char32_t codepoint, const std::wstring_view& glyph) noexcept
 {
-#pragma warning(suppress : 26447) // The function is declared 'noexcept' but calls function 'lower_bound<...>()' which may throw exceptions (f.6).
-    const auto it = std::lower_bound(s_wideAndAmbiguousTable.begin(), s_wideAndAmbiguousTable.end(), codepoint);
-    uint8_t width = 1;
+    auto cls = WidthClass::Narrow;
 
-    if (it != s_wideAndAmbiguousTable.end() && codepoint >= it->lowerBound && codepoint <= it->upperBound)
+    if (codepoint <= 0xffff) [[likely]]
     {
-        width = 2;
-        if (it->isAmbiguous)
+        cls = lookupBmpWidthClass(codepoint);
+    }
+    else
+    {
+#pragma warning(suppress : 26447) // The function is declared 'noexcept' but calls function 'lower_bound<...>()' which may throw exceptions (f.6).
+        const auto it = std::lower_bound(s_wideAndAmbiguousTable.begin(), s_wideAndAmbiguousTable.end(), codepoint);
+        if (it != s_wideAndAmbiguousTable.end() && codepoint >= it->lowerBound && codepoint <= it->upperBound)
         {
-            width = _checkFallbackViaCache(codepoint, glyph);
+            cls = it->isAmbiguous ? WidthClass::Ambiguous : WidthClass::Wide;
         }
     }
 
-    return width;
+    switch (cls)
+    {
+    case WidthClass::Wide:
+        return 2;
+    case WidthClass::Ambiguous:
+        return _checkFallbackViaCache(codepoint, glyph);
+    default:
+        return 1;
+    }
 }
 
 // Call the function specified via SetFallbackMethod() to turn CodepointWidth::Ambiguous into Narrow/Wide.
@@ -25,6 +25,50 @@ bool IsGlyphFullWidth(const wchar_t wch) noexcept
     return wch < 0x80 ? false : IsGlyphFullWidth({ &wch, 1 });
 }
 
+// Function Description:
+// - Returns the length of the leading run of UTF-16 units that are guaranteed to be
+//      narrow (= ASCII). This lets callers that iterate over text classify whole runs
+//      with a vector compare per 16 characters instead of one width lookup per character.
+// Arguments:
+// - text - the text to scan
+// Return Value:
+// - the number of leading characters that are narrow
+size_t MeasureNarrowGlyphRun(const std::wstring_view& text) noexcept
+{
+    const auto data = text.data();
+    const auto len = text.size();
+    size_t off = 0;
+
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#ifdef TIL_SSE_INTRINSICS
+    // Any UTF-16 unit with a bit inside 0xff80 set is outside the ASCII range.
+    const auto mask = _mm_set1_epi16(static_cast<short>(0xff80));
+    const auto zero = _mm_setzero_si128();
+
+    for (; off + 16 <= len; off += 16)
+    {
+        const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + off));
+        const auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + off + 8));
+        const auto nonAscii = _mm_and_si128(_mm_or_si128(lo, hi), mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xffff)
+        {
+            break;
+        }
+    }
+#endif
+
+    // Scalar tail. After a failed vector compare this also finds the exact
+    // position of the first non-ASCII character within that chunk.
+    for (; off < len && data[off] < 0x80; ++off)
+    {
+    }
+#pragma warning(pop)
+
+    return off;
+}
+
 // Function Description:
 // - Sets a function that should be used by the global CodepointWidthDetector
 //      as the fallback mechanism for determining a particular glyph's width,
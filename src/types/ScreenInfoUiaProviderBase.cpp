@@ -365,6 +365,47 @@ IFACEMETHODIMP ScreenInfoUiaProviderBase::get_SupportedTextSelection(_Out_ Suppo
 
 #pragma endregion
 
+// Method Description:
+// - Looks up the text snapshot left behind by a previous extraction of the exact
+//   same range. Returns nullptr on a miss; the pointer stays valid until the next
+//   CacheTextValue call. The console lock must be held.
+const std::wstring* ScreenInfoUiaProviderBase::GetCachedTextValue(const uint64_t mutationId,
+                                                                  const til::point start,
+                                                                  const til::point end,
+                                                                  const bool blockRange,
+                                                                  const til::CoordType maxLength) const noexcept
+{
+    const auto& cache = _textValueCache;
+    if (cache.mutationId == mutationId &&
+        cache.start == start &&
+        cache.end == end &&
+        cache.blockRange == blockRange &&
+        cache.maxLength == maxLength)
+    {
+        return &cache.text;
+    }
+    return nullptr;
+}
+
+// Method Description:
+// - Stores the text extracted for a range so that identical requests can be served
+//   without re-walking the buffer, until the buffer mutates and the stamp expires.
+//   The console lock must be held.
+void ScreenInfoUiaProviderBase::CacheTextValue(const uint64_t mutationId,
+                                               const til::point start,
+                                               const til::point end,
+                                               const bool blockRange,
+                                               const til::CoordType maxLength,
+                                               std::wstring text)
+{
+    _textValueCache.mutationId = mutationId;
+    _textValueCache.start = start;
+    _textValueCache.end = end;
+    _textValueCache.blockRange = blockRange;
+    _textValueCache.maxLength = maxLength;
+    _textValueCache.text = std::move(text);
+}
+
 til::size ScreenInfoUiaProviderBase::_getScreenBufferCoords() const noexcept
 {
     return _getTextBuffer().GetSize().Dimensions();
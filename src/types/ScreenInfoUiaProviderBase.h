@@ -76,6 +76,22 @@ namespace Microsoft::Console::Types
         IFACEMETHODIMP get_DocumentRange(_COM_Outptr_result_maybenull_ ITextRangeProvider** ppRetVal) override;
         IFACEMETHODIMP get_SupportedTextSelection(_Out_ SupportedTextSelection* pRetVal) noexcept override;
 
+        // Generation-stamped snapshot of the most recently extracted range text.
+        // Accessibility clients poll the same ranges repeatedly within a frame, and
+        // every text range created from this provider re-walks the buffer under the
+        // console lock otherwise. Both methods must be called with the console lock held.
+        const std::wstring* GetCachedTextValue(const uint64_t mutationId,
+                                               const til::point start,
+                                               const til::point end,
+                                               const bool blockRange,
+                                               const til::CoordType maxLength) const noexcept;
+        void CacheTextValue(const uint64_t mutationId,
+                            const til::point start,
+                            const til::point end,
+                            const bool blockRange,
+                            const til::CoordType maxLength,
+                            std::wstring text);
+
     protected:
         ScreenInfoUiaProviderBase() = default;
 
@@ -122,6 +138,20 @@ namespace Microsoft::Console::Types
         // mechanism for multi-threaded code.
         std::unordered_map<EVENTID, bool> _signalFiringMapping{};
 
+        // Single-entry snapshot for GetCachedTextValue/CacheTextValue. The text
+        // buffer's mutation id serves as the generation stamp: any write to the
+        // buffer advances it and orphans the snapshot, so a hit can only serve
+        // text that is still current. Guarded by the console lock.
+        struct
+        {
+            uint64_t mutationId = UINT64_MAX;
+            til::point start;
+            til::point end;
+            bool blockRange = false;
+            til::CoordType maxLength = 0;
+            std::wstring text;
+        } _textValueCache;
+
         til::size _getScreenBufferCoords() const noexcept;
         const TextBuffer& _getTextBuffer() const noexcept;
         Viewport _getViewport() const noexcept;
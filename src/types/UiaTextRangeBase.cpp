@@ -946,13 +946,26 @@ try
     });
     RETURN_HR_IF(E_FAIL, !_pData->IsUiaDataInitialized());
 
-    const auto text = _getTextValue(maxLength);
-    Unlock.reset();
+    // Accessibility clients poll aggressively and tend to ask for the same range
+    // over and over between frames. The provider keeps a generation-stamped
+    // snapshot of the last extraction, so a repeated request against an unchanged
+    // buffer is served straight from the snapshot instead of re-walking the rows.
+    const auto mutationId = _pData->GetTextBuffer().GetLastMutationId();
+    const gsl::not_null<ScreenInfoUiaProviderBase*> provider = static_cast<ScreenInfoUiaProviderBase*>(_pProvider);
+
+    auto text = provider->GetCachedTextValue(mutationId, _start, _end, _blockRange, maxLength);
+    if (!text)
+    {
+        provider->CacheTextValue(mutationId, _start, _end, _blockRange, maxLength, _getTextValue(maxLength));
+        text = provider->GetCachedTextValue(mutationId, _start, _end, _blockRange, maxLength);
+    }
 
-    *pRetVal = SysAllocString(text.c_str());
+    // The snapshot pointer is only stable while we hold the lock, so the BSTR
+    // has to be produced before unlocking.
+    *pRetVal = SysAllocString(text->c_str());
     RETURN_HR_IF_NULL(E_OUTOFMEMORY, *pRetVal);
 
-    UiaTracing::TextRange::GetText(*this, maxLength, text);
+    UiaTracing::TextRange::GetText(*this, maxLength, *text);
     return S_OK;
 }
 CATCH_RETURN();
@@ -985,21 +998,60 @@ std::wstring UiaTextRangeBase::_getTextValue(til::CoordType maxLength) const
         auto inclusiveEnd = _end;
         bufferSize.DecrementInBounds(inclusiveEnd, true);
 
-        // reserve size in accordance to extracted text
-        const auto textRects = buffer.GetTextRects(_start, inclusiveEnd, _blockRange, true);
-        const auto bufferData = buffer.GetText(true,
-                                               false,
-                                               textRects);
-        const size_t textDataSize = bufferData.text.size() * bufferSize.Width();
-        textData.reserve(textDataSize);
-        for (const auto& text : bufferData.text)
+        // Extract the text row by row as contiguous char spans straight out of
+        // the row storage, rather than cell by cell through an iterator. For
+        // document-wide ranges (Narrator reading the whole buffer) this is the
+        // difference between a pass over the bytes and a pass over the cells.
+        const auto [higherCoord, lowerCoord] = bufferSize.CompareInBounds(_start, inclusiveEnd) <= 0 ?
+                                                   std::make_pair(_start, inclusiveEnd) :
+                                                   std::make_pair(inclusiveEnd, _start);
+
+        const auto rowCount = gsl::narrow_cast<size_t>(lowerCoord.y - higherCoord.y + 1);
+        const auto rowWidth = gsl::narrow_cast<size_t>(bufferSize.Width());
+        textData.reserve(std::min(maxLengthAsSize, rowCount * (rowWidth + 2))); // + 2 for \r\n
+
+        for (auto y = higherCoord.y; y <= lowerCoord.y; y++)
         {
             if (textData.size() >= maxLengthAsSize)
             {
                 // early exit; we're already at/past max length
                 break;
             }
-            textData += text;
+
+            auto left = bufferSize.Left();
+            auto right = bufferSize.RightInclusive();
+            if (_blockRange || higherCoord.y == lowerCoord.y)
+            {
+                left = std::min(higherCoord.x, lowerCoord.x);
+                right = std::max(higherCoord.x, lowerCoord.x);
+            }
+            else if (y == higherCoord.y)
+            {
+                left = higherCoord.x;
+            }
+            else if (y == lowerCoord.y)
+            {
+                right = lowerCoord.x;
+            }
+
+            const auto& row = buffer.GetRowByOffset(y);
+
+            // A right edge on the leading half of a wide glyph needs to be
+            // extended so the whole glyph makes it into the output. A left
+            // edge on a trailing half needs no such treatment: the char
+            // offsets already resolve it to the start of the glyph's text.
+            if (row.DbcsAttrAt(right) == DbcsAttribute::Leading)
+            {
+                right++;
+            }
+            textData.append(row.GetText(left, right + 1));
+
+            // rows that were wrapped by the client have no line break;
+            // explicit breaks become \r\n, same as the cell-by-cell path did.
+            if (y < lowerCoord.y && !row.WasWrapForced())
+            {
+                textData.append(L"\r\n");
+            }
         }
 
         // only use maxLength to resize down.
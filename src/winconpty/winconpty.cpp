@@ -239,28 +239,120 @@ HRESULT _CreatePseudoConsole(const HANDLE hToken,
     return S_OK;
 }
 
+// How long we let resize requests settle before the next packet may leave for
+// conhost. Live resizes tick at the embedder's frame rate; two frames' worth
+// of settling keeps the stream down to a rate conhost can comfortably reflow
+// at, without the drag preview visibly lagging the host.
+static const DWORD sResizeCoalesceDeadlineMs = 33;
+
+// Function Description:
+// - Returns the relative due time for the resize deadline timer.
+static FILETIME _ResizeDeadlineDueTime()
+{
+    // Negative FILETIME values are relative due times, in 100ns units.
+    const auto relative = -static_cast<LONGLONG>(sResizeCoalesceDeadlineMs) * 10000;
+    FILETIME dueTime;
+    dueTime.dwLowDateTime = static_cast<DWORD>(relative);
+    dueTime.dwHighDateTime = static_cast<DWORD>(relative >> 32);
+    return dueTime;
+}
+
+// Function Description:
+// - Writes a single resize packet to the signal pipe.
+static HRESULT _WriteResizePacket(_In_ const PseudoConsole* const pPty, _In_ const COORD size)
+{
+    unsigned short signalPacket[3];
+    signalPacket[0] = PTY_SIGNAL_RESIZE_WINDOW;
+    signalPacket[1] = size.X;
+    signalPacket[2] = size.Y;
+
+    const auto fSuccess = WriteFile(pPty->hSignal, signalPacket, sizeof(signalPacket), nullptr, nullptr);
+    return fSuccess ? S_OK : HRESULT_FROM_WIN32(GetLastError());
+}
+
+// Function Description:
+// - Threadpool callback for the resize deadline. Forwards the latest coalesced
+//   geometry if any arrived during the deadline, or closes the deadline window
+//   so the next request goes out immediately again.
+static VOID CALLBACK _ResizeDeadlineElapsed(PTP_CALLBACK_INSTANCE /*instance*/, PVOID context, PTP_TIMER timer)
+{
+    const auto pPty = static_cast<PseudoConsole*>(context);
+
+    COORD size{};
+    auto fSend = FALSE;
+
+    AcquireSRWLockExclusive(&pPty->ResizeLock);
+    if (pPty->fResizePending)
+    {
+        size = pPty->pendingResizeSize;
+        pPty->fResizePending = FALSE;
+        // Keep the window open for another deadline, so that a continuous
+        // stream of requests settles into one packet per deadline.
+        const auto dueTime = _ResizeDeadlineDueTime();
+        SetThreadpoolTimer(timer, &dueTime, 0, 0);
+        fSend = TRUE;
+    }
+    else
+    {
+        pPty->fResizeWindowOpen = FALSE;
+    }
+    ReleaseSRWLockExclusive(&pPty->ResizeLock);
+
+    if (fSend)
+    {
+        LOG_IF_FAILED(_WriteResizePacket(pPty, size));
+    }
+}
+
 // Function Description:
-// - Resizes the conpty
+// - Resizes the conpty. The request returns to the caller immediately; while
+//   requests arrive faster than the coalescing deadline, only the most recent
+//   geometry is forwarded to conhost, where every resize packet costs a full
+//   buffer reflow.
 // Arguments:
 // - hSignal: A signal pipe as returned by CreateConPty.
 // - size: The new dimensions of the conpty, in characters.
 // Return Value:
 // - S_OK if the call succeeded, else an appropriate HRESULT for failing to
 //      write the resize message to the pty.
-HRESULT _ResizePseudoConsole(_In_ const PseudoConsole* const pPty, _In_ const COORD size)
+HRESULT _ResizePseudoConsole(_In_ PseudoConsole* const pPty, _In_ const COORD size)
 {
     if (pPty == nullptr || size.X < 0 || size.Y < 0)
     {
         return E_INVALIDARG;
     }
 
-    unsigned short signalPacket[3];
-    signalPacket[0] = PTY_SIGNAL_RESIZE_WINDOW;
-    signalPacket[1] = size.X;
-    signalPacket[2] = size.Y;
+    AcquireSRWLockExclusive(&pPty->ResizeLock);
 
-    const auto fSuccess = WriteFile(pPty->hSignal, signalPacket, sizeof(signalPacket), nullptr, nullptr);
-    return fSuccess ? S_OK : HRESULT_FROM_WIN32(GetLastError());
+    if (pPty->fResizeWindowOpen)
+    {
+        // A packet already left within the last deadline. Just remember the
+        // newest geometry for when the timer fires - replacing an older
+        // pending size is the point, only settled geometry should reach
+        // conhost.
+        pPty->pendingResizeSize = size;
+        pPty->fResizePending = TRUE;
+        ReleaseSRWLockExclusive(&pPty->ResizeLock);
+        return S_OK;
+    }
+
+    // First request in a while: forward it immediately, so one-off resizes
+    // keep their latency, and open the deadline window for followers.
+    if (pPty->hResizeTimer == nullptr)
+    {
+        // If the timer can't be allocated, we simply stay synchronous.
+        pPty->hResizeTimer = CreateThreadpoolTimer(_ResizeDeadlineElapsed, pPty, nullptr);
+    }
+    if (pPty->hResizeTimer != nullptr)
+    {
+        pPty->fResizeWindowOpen = TRUE;
+        const auto dueTime = _ResizeDeadlineDueTime();
+        SetThreadpoolTimer(pPty->hResizeTimer, &dueTime, 0, 0);
+    }
+
+    ReleaseSRWLockExclusive(&pPty->ResizeLock);
+
+    return _WriteResizePacket(pPty, size);
 }
 
 // Function Description:
@@ -358,6 +450,17 @@ void _ClosePseudoConsoleMembers(_In_ PseudoConsole* pPty, _In_ DWORD dwMilliseco
 {
     if (pPty != nullptr)
     {
+        // Retire the resize deadline timer before touching the signal pipe, so
+        // that a late callback can't write to a closed handle. A still-pending
+        // resize needs no flush - we're tearing the conhost down anyway.
+        if (pPty->hResizeTimer != nullptr)
+        {
+            SetThreadpoolTimer(pPty->hResizeTimer, nullptr, 0, 0);
+            WaitForThreadpoolTimerCallbacks(pPty->hResizeTimer, TRUE);
+            CloseThreadpoolTimer(pPty->hResizeTimer);
+            pPty->hResizeTimer = nullptr;
+        }
+
         // See MSFT:19918626
         // First break the signal pipe - this will trigger conhost to tear itself down
         if (_HandleIsValid(pPty->hSignal))
@@ -483,7 +586,7 @@ extern "C" HRESULT WINAPI ConptyCreatePseudoConsoleAsUser(_In_ HANDLE hToken,
 // Resizes the given conpty to the specified size, in characters.
 extern "C" HRESULT WINAPI ConptyResizePseudoConsole(_In_ HPCON hPC, _In_ COORD size)
 {
-    const PseudoConsole* const pPty = (PseudoConsole*)hPC;
+    PseudoConsole* const pPty = (PseudoConsole*)hPC;
     auto hr = pPty == nullptr ? E_INVALIDARG : S_OK;
     if (SUCCEEDED(hr))
     {
@@ -38,6 +38,18 @@ typedef struct _PseudoConsole
     HANDLE hPtyReference;
     // hConPtyProcess is a process handle to the conhost instance that we've spawned for ConPTY.
     HANDLE hConPtyProcess;
+    // The following members implement deadline coalescing of resize requests.
+    // Embedders drive ConptyResizePseudoConsole from live window-resize ticks,
+    // and every packet that reaches conhost costs a full buffer reflow there.
+    // The first request in a while is forwarded immediately; while requests
+    // keep arriving, at most one packet per deadline leaves, carrying the most
+    // recent geometry. All of these are protected by ResizeLock, and all
+    // allocation sites of this struct zero-initialize them.
+    SRWLOCK ResizeLock;
+    PTP_TIMER hResizeTimer;
+    COORD pendingResizeSize;
+    BOOL fResizePending; // a newer size is waiting for the deadline timer
+    BOOL fResizeWindowOpen; // the deadline timer is armed
 } PseudoConsole;
 
 // Signals
@@ -70,7 +82,7 @@ HRESULT _CreatePseudoConsole(const HANDLE hToken,
                              const DWORD dwFlags,
                              _Inout_ PseudoConsole* pPty);
 
-HRESULT _ResizePseudoConsole(_In_ const PseudoConsole* const pPty, _In_ const COORD size);
+HRESULT _ResizePseudoConsole(_In_ PseudoConsole* const pPty, _In_ const COORD size);
 HRESULT _ClearPseudoConsole(_In_ const PseudoConsole* const pPty);
 HRESULT _ShowHidePseudoConsole(_In_ const PseudoConsole* const pPty, const bool show);
 HRESULT _ReparentPseudoConsole(_In_ const PseudoConsole* const pPty, _In_ const HWND newParent);
@@ -0,0 +1,99 @@
+# Copyright (c) Microsoft Corporation.
+# Licensed under the MIT license.
+
+################################
+# This script runs benchcat (src\tools\benchcat, built as bc.exe) across a
+# matrix of synthetic corpora and write APIs and collects the JSON results
+# into a single report. With -Baseline pointing at a previous report, it
+# compares throughput case-by-case and fails if any case regressed by more
+# than -TolerancePercent.
+#
+# Run it from inside the console host you want to measure: conhost, an
+# OpenConsole window, or Windows Terminal (for conpty coverage). The tool
+# writes to whatever console the shell is attached to.
+#
+# Typical use against two builds:
+#   .\tools\Invoke-BenchcatSuite.ps1 -BenchcatPath .\bin\x64\Release\bc.exe -OutputPath before.json
+#   # ...deploy the new build, then in the new console:
+#   .\tools\Invoke-BenchcatSuite.ps1 -BenchcatPath .\bin\x64\Release\bc.exe -OutputPath after.json -Baseline before.json
+
+[CmdletBinding()]
+Param(
+    [Parameter(Mandatory = $true)]
+    [string]$BenchcatPath,
+
+    [string]$OutputPath,
+
+    [string]$Baseline,
+
+    # A case fails if its throughput drops below (baseline * (100 - tolerance) / 100).
+    [int]$TolerancePercent = 10,
+
+    # Iterations per case; percentiles come from per-iteration timings.
+    [int]$Iterations = 10,
+
+    # Size of each generated corpus, passed through to bc -n.
+    [string]$CorpusSize = "16Mi",
+
+    # Fixed RNG seed so both sides of a comparison write identical bytes.
+    [int]$Seed = 1
+)
+
+$Corpora = "ascii", "vt", "unicode", "scroll", "attr"
+$Apis = "writefile", "writeconsole"
+
+If (-Not (Test-Path $BenchcatPath)) {
+    Write-Error "benchcat not found at $BenchcatPath"
+    Exit 1
+}
+
+$Results = @()
+ForEach ($Corpus in $Corpora) {
+    ForEach ($Api in $Apis) {
+        $BcArgs = @("-g$Corpus", "-n$CorpusSize", "-r$Iterations", "-s$Seed", "-j")
+        If ($Api -Eq "writeconsole") {
+            $BcArgs += "-wc"
+        }
+
+        # The summary goes to stderr so that the measured stream stays clean.
+        $Json = (& $BenchcatPath @BcArgs 2>&1 1>$null) -Join "" | ConvertFrom-Json
+        If (-Not $Json) {
+            Write-Error "no result from benchcat for $Corpus/$Api"
+            Exit 1
+        }
+
+        $Results += $Json
+        Write-Verbose ("{0}/{1}: {2:N0} B/s (p50 {3} us, p90 {4} us)" -F $Corpus, $Api, $Json.bps, $Json.p50_us, $Json.p90_us)
+    }
+}
+
+If ($OutputPath) {
+    $Results | ConvertTo-Json | Out-File -Encoding utf8 $OutputPath
+}
+
+If ($Baseline) {
+    $BaselineResults = Get-Content $Baseline | ConvertFrom-Json
+    $Regressions = @()
+
+    ForEach ($Result in $Results) {
+        $Old = $BaselineResults | Where-Object { $_.corpus -Eq $Result.corpus -And $_.api -Eq $Result.api }
+        If (-Not $Old) {
+            Continue
+        }
+
+        $Floor = [long]($Old.bps * (100 - $TolerancePercent) / 100)
+        If ($Result.bps -Lt $Floor) {
+            $Regressions += "{0}/{1}: {2:N0} B/s -> {3:N0} B/s" -F $Result.corpus, $Result.api, $Old.bps, $Result.bps
+        }
+    }
+
+    If ($Regressions.Count -Gt 0) {
+        Write-Host "Throughput regressions beyond ${TolerancePercent}%:"
+        $Regressions | ForEach-Object { Write-Host "  $_" }
+        Exit 1
+    }
+
+    Write-Host "No throughput regressions beyond ${TolerancePercent}%."
+}
+
+Exit 0